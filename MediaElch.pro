@@ -160,19 +160,28 @@ SOURCES += src/main.cpp \
     src/data/tv_show/TvShowEpisode.cpp \
     src/data/TvDbId.cpp \
     src/data/TvMazeId.cpp \
+    src/database/AlbumSnapshot.cpp \
+    src/database/ArtistSnapshot.cpp \
     src/database/Database.cpp \
     src/database/DatabaseId.cpp \
+    src/database/EpisodeSnapshot.cpp \
+    src/database/MovieSnapshot.cpp \
+    src/database/SnapshotStream.cpp \
     src/export/CsvExport.cpp \
+    src/export/ExportManifest.cpp \
     src/export/ExportTemplate.cpp \
     src/export/ExportTemplateLoader.cpp \
     src/export/MediaExport.cpp \
     src/export/SimpleEngine.cpp \
+    src/export/SimpleTemplate.cpp \
     src/export/TableWriter.cpp \
     src/file_search/ConcertFileSearcher.cpp \
+    src/file_search/DirectoryWalker.cpp \
     src/file_search/movie/MovieDirectorySearcher.cpp \
     src/file_search/movie/MovieDirScan.cpp \
     src/file_search/movie/MovieFileSearcher.cpp \
     src/file_search/MovieFilesOrganizer.cpp \
+    src/file_search/music/MusicDiskLoader.cpp \
     src/file_search/MusicFileSearcher.cpp \
     src/file_search/TvShowFileSearcher.cpp \
     src/globals/Globals.cpp \
@@ -184,20 +193,27 @@ SOURCES += src/main.cpp \
     src/globals/VersionInfo.cpp \
     src/import/DownloadFileSearcher.cpp \
     src/import/Extractor.cpp \
+    src/import/FileCopier.cpp \
+    src/import/FileOperationBatch.cpp \
     src/import/FileWorker.cpp \
     src/import/MakeMkvCon.cpp \
-    src/import/MyFile.cpp \
     src/log/Log.cpp \
+    src/log/LogWriter.cpp \
     src/media/AsyncImage.cpp \
+    src/media/DirectoryListing.cpp \
     src/media/FileFilter.cpp \
     src/media/FilenameUtils.cpp \
     src/media/ImageCache.cpp \
     src/media/ImageCapture.cpp \
+    src/media/ImageHeader.cpp \
+    src/media/ImageMetadataCache.cpp \
     src/media/ImageUtils.cpp \
     src/media/MediaInfoFile.cpp \
     src/media/NameFormatter.cpp \
+    src/media/NameMatcher.cpp \
     src/media/Path.cpp \
     src/media/StreamDetails.cpp \
+    src/media/ThumbnailCaptureJob.cpp \
     src/media_center/kodi/AlbumXmlReader.cpp \
     src/media_center/kodi/AlbumXmlWriter.cpp \
     src/media_center/kodi/ArtistXmlReader.cpp \
@@ -206,6 +222,8 @@ SOURCES += src/main.cpp \
     src/media_center/kodi/ConcertXmlWriter.cpp \
     src/media_center/kodi/EpisodeXmlReader.cpp \
     src/media_center/kodi/EpisodeXmlWriter.cpp \
+    src/media_center/kodi/KodiJsonRpcBatch.cpp \
+    src/media_center/kodi/KodiPathIndex.cpp \
     src/media_center/kodi/KodiXmlWriter.cpp \
     src/media_center/kodi/MovieXmlReader.cpp \
     src/media_center/kodi/MovieXmlWriter.cpp \
@@ -214,6 +232,7 @@ SOURCES += src/main.cpp \
     src/media_center/KodiVersion.cpp \
     src/media_center/KodiXml.cpp \
     src/media_center/MediaCenterInterface.cpp \
+    src/media_center/SaveQueue.cpp \
     src/model/ActorModel.cpp \
     src/model/ConcertModel.cpp \
     src/model/ConcertProxyModel.cpp \
@@ -245,6 +264,7 @@ SOURCES += src/main.cpp \
     src/renamer/EpisodeRenamer.cpp \
     src/renamer/MovieRenamer.cpp \
     src/renamer/Renamer.cpp \
+    src/renamer/RenamerTemplate.cpp \
     src/scrapers/concert/ConcertIdentifier.cpp \
     src/scrapers/concert/ConcertScraper.cpp \
     src/scrapers/concert/ConcertSearchJob.cpp \
@@ -295,15 +315,18 @@ SOURCES += src/main.cpp \
     src/scrapers/music/TheAudioDb.cpp \
     src/scrapers/music/TvTunes.cpp \
     src/scrapers/music/UniversalMusicScraper.cpp \
+    src/scrapers/HtmlIndex.cpp \
     src/scrapers/ScraperError.cpp \
     src/scrapers/ScraperInfos.cpp \
     src/scrapers/ScraperInterface.cpp \
     src/scrapers/ScraperResult.cpp \
     src/scrapers/ScraperUtils.cpp \
+    src/scrapers/ScrapePrefetcher.cpp \
     src/scrapers/tmdb/TmdbApi.cpp \
     src/scrapers/trailer/HdTrailers.cpp \
     src/scrapers/trailer/TrailerProvider.cpp \
     src/scrapers/trailer/TrailerResult.cpp \
+    src/scrapers/tv_show/BatchedEpisodeScrapeJob.cpp \
     src/scrapers/tv_show/custom/CustomEpisodeScrapeJob.cpp \
     src/scrapers/tv_show/custom/CustomSeasonScrapeJob.cpp \
     src/scrapers/tv_show/custom/CustomShowScrapeJob.cpp \
@@ -320,6 +343,7 @@ SOURCES += src/main.cpp \
     src/scrapers/tv_show/imdb/ImdbTvShowParser.cpp \
     src/scrapers/tv_show/imdb/ImdbTvShowScrapeJob.cpp \
     src/scrapers/tv_show/imdb/ImdbTvShowSearchJob.cpp \
+    src/scrapers/tv_show/SeasonBatcher.cpp \
     src/scrapers/tv_show/SeasonScrapeJob.cpp \
     src/scrapers/tv_show/ShowIdentifier.cpp \
     src/scrapers/tv_show/ShowMerger.cpp \
@@ -522,19 +546,28 @@ HEADERS  += Version.h \
     src/data/tv_show/TvShowEpisode.h \
     src/data/TvDbId.h \
     src/data/TvMazeId.h \
+    src/database/AlbumSnapshot.h \
+    src/database/ArtistSnapshot.h \
     src/database/Database.h \
     src/database/DatabaseId.h \
+    src/database/EpisodeSnapshot.h \
+    src/database/MovieSnapshot.h \
+    src/database/SnapshotStream.h \
     src/export/CsvExport.h \
+    src/export/ExportManifest.h \
     src/export/ExportTemplate.h \
     src/export/ExportTemplateLoader.h \
     src/export/MediaExport.h \
     src/export/SimpleEngine.h \
+    src/export/SimpleTemplate.h \
     src/export/TableWriter.h \
     src/file_search/ConcertFileSearcher.h \
+    src/file_search/DirectoryWalker.h \
     src/file_search/movie/MovieDirectorySearcher.h \
     src/file_search/movie/MovieDirScan.h \
     src/file_search/movie/MovieFileSearcher.h \
     src/file_search/MovieFilesOrganizer.h \
+    src/file_search/music/MusicDiskLoader.h \
     src/file_search/MusicFileSearcher.h \
     src/file_search/TvShowFileSearcher.h \
     src/globals/Globals.h \
@@ -547,20 +580,28 @@ HEADERS  += Version.h \
     src/globals/VersionInfo.h \
     src/import/DownloadFileSearcher.h \
     src/import/Extractor.h \
+    src/import/FileCopier.h \
+    src/import/FileOperationBatch.h \
     src/import/FileWorker.h \
     src/import/MakeMkvCon.h \
-    src/import/MyFile.h \
     src/log/Log.h \
+    src/log/LogRingBuffer.h \
+    src/log/LogWriter.h \
     src/media/AsyncImage.h \
+    src/media/DirectoryListing.h \
     src/media/FileFilter.h \
     src/media/FilenameUtils.h \
     src/media/ImageCache.h \
     src/media/ImageCapture.h \
+    src/media/ImageHeader.h \
+    src/media/ImageMetadataCache.h \
     src/media/ImageUtils.h \
     src/media/MediaInfoFile.h \
     src/media/NameFormatter.h \
+    src/media/NameMatcher.h \
     src/media/Path.h \
     src/media/StreamDetails.h \
+    src/media/ThumbnailCaptureJob.h \
     src/media_center/kodi/AlbumXmlReader.h \
     src/media_center/kodi/AlbumXmlWriter.h \
     src/media_center/kodi/ArtistXmlReader.h \
@@ -569,6 +610,8 @@ HEADERS  += Version.h \
     src/media_center/kodi/ConcertXmlWriter.h \
     src/media_center/kodi/EpisodeXmlReader.h \
     src/media_center/kodi/EpisodeXmlWriter.h \
+    src/media_center/kodi/KodiJsonRpcBatch.h \
+    src/media_center/kodi/KodiPathIndex.h \
     src/media_center/kodi/KodiXmlWriter.h \
     src/media_center/kodi/MovieXmlReader.h \
     src/media_center/kodi/MovieXmlWriter.h \
@@ -577,6 +620,7 @@ HEADERS  += Version.h \
     src/media_center/KodiVersion.h \
     src/media_center/KodiXml.h \
     src/media_center/MediaCenterInterface.h \
+    src/media_center/SaveQueue.h \
     src/model/ActorModel.h \
     src/model/ConcertModel.h \
     src/model/ConcertProxyModel.h \
@@ -608,6 +652,7 @@ HEADERS  += Version.h \
     src/renamer/EpisodeRenamer.h \
     src/renamer/MovieRenamer.h \
     src/renamer/Renamer.h \
+    src/renamer/RenamerTemplate.h \
     src/scrapers/concert/ConcertIdentifier.h \
     src/scrapers/concert/ConcertScraper.h \
     src/scrapers/concert/ConcertSearchJob.h \
@@ -658,15 +703,18 @@ HEADERS  += Version.h \
     src/scrapers/music/TheAudioDb.h \
     src/scrapers/music/TvTunes.h \
     src/scrapers/music/UniversalMusicScraper.h \
+    src/scrapers/HtmlIndex.h \
     src/scrapers/ScraperError.h \
     src/scrapers/ScraperInfos.h \
     src/scrapers/ScraperInterface.h \
     src/scrapers/ScraperResult.h \
     src/scrapers/ScraperUtils.h \
+    src/scrapers/ScrapePrefetcher.h \
     src/scrapers/tmdb/TmdbApi.h \
     src/scrapers/trailer/HdTrailers.h \
     src/scrapers/trailer/TrailerProvider.h \
     src/scrapers/trailer/TrailerResult.h \
+    src/scrapers/tv_show/BatchedEpisodeScrapeJob.h \
     src/scrapers/tv_show/custom/CustomEpisodeScrapeJob.h \
     src/scrapers/tv_show/custom/CustomSeasonScrapeJob.h \
     src/scrapers/tv_show/custom/CustomShowScrapeJob.h \
@@ -683,6 +731,7 @@ HEADERS  += Version.h \
     src/scrapers/tv_show/imdb/ImdbTvShowParser.h \
     src/scrapers/tv_show/imdb/ImdbTvShowScrapeJob.h \
     src/scrapers/tv_show/imdb/ImdbTvShowSearchJob.h \
+    src/scrapers/tv_show/SeasonBatcher.h \
     src/scrapers/tv_show/SeasonScrapeJob.h \
     src/scrapers/tv_show/ShowIdentifier.h \
     src/scrapers/tv_show/ShowMerger.h \
@@ -1,6 +1,9 @@
 #include "cli/common.h"
 
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QTextStream>
+#include <iostream>
 
 // levels:
 //   0  only errors
@@ -9,6 +12,7 @@
 //   3  also info messages
 //   4  also debug messages
 static int s_verbosityLevel = 0;
+static bool s_jsonOutput = false;
 
 namespace mediaelch {
 namespace cli {
@@ -44,6 +48,49 @@ void setVerbosity(int level)
     }
 }
 
+void setJsonOutput(bool enabled)
+{
+    s_jsonOutput = enabled;
+}
+
+bool isJsonOutput()
+{
+    return s_jsonOutput;
+}
+
+static void printJson(const QJsonObject& obj)
+{
+    // One object per line and flushed, so that other processes can read it while we're running.
+    std::cout << QJsonDocument(obj).toJson(QJsonDocument::Compact).toStdString() << std::endl;
+}
+
+void printProgress(const QString& task, int current, int total)
+{
+    if (!s_jsonOutput) {
+        return;
+    }
+    QJsonObject obj;
+    obj.insert("task", task);
+    obj.insert("type", QStringLiteral("progress"));
+    obj.insert("current", current);
+    obj.insert("total", total);
+    printJson(obj);
+}
+
+void printResult(const QString& task, const QString& message, bool success)
+{
+    if (!s_jsonOutput) {
+        (success ? std::cout : std::cerr) << message.toStdString() << std::endl;
+        return;
+    }
+    QJsonObject obj;
+    obj.insert("task", task);
+    obj.insert("type", QStringLiteral("result"));
+    obj.insert("success", success);
+    obj.insert("message", message);
+    printJson(obj);
+}
+
 static bool shouldPrintMessage(QtMsgType type)
 {
     switch (type) {
@@ -58,13 +105,7 @@ static bool shouldPrintMessage(QtMsgType type)
 
 void messageHandler(QtMsgType type, const QMessageLogContext& context, const QString& msg)
 {
-#ifndef QT_DEBUG
-    // no debug output on the command line
-    if (type == QtInfoMsg || type == QtDebugMsg) {
-        return;
-    }
-#endif
-
+    // Debug and info messages are only printed with --verbose; see shouldPrintMessage().
 #ifdef Q_OS_WIN32
     const QString newLine = "\r\n";
 #else
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <QEventLoop>
 #include <QMessageLogContext>
+#include <QObject>
 #include <QString>
 
 namespace mediaelch {
@@ -21,5 +23,34 @@ MediaType mediaTypeFromString(QString str);
 void setVerbosity(int level);
 void messageHandler(QtMsgType type, const QMessageLogContext& context, const QString& msg);
 
+/// \brief If enabled, progress and results are printed as JSON objects, one per line.
+/// \details Useful for scripts and cron jobs that run MediaElch on a headless server.
+void setJsonOutput(bool enabled);
+bool isJsonOutput();
+
+/// \brief Print the progress of a long running task, e.g. "reload".
+/// \details Only printed if JSON output is enabled; plain output only contains results.
+void printProgress(const QString& task, int current, int total);
+/// \brief Print the result of a task. Uses JSON if enabled.
+void printResult(const QString& task, const QString& message, bool success = true);
+
+/// \brief Call the given function and wait until the sender emits the given signal.
+/// \details Returns immediately if the signal is emitted synchronously by the function.
+template<typename Sender, typename Signal, typename Function>
+void runAndWait(Sender* sender, Signal signal, Function function)
+{
+    QEventLoop loop;
+    bool finished = false;
+    const auto connection = QObject::connect(sender, signal, &loop, [&finished, &loop]() {
+        finished = true;
+        loop.quit();
+    });
+    function();
+    if (!finished) {
+        loop.exec();
+    }
+    QObject::disconnect(connection);
+}
+
 } // namespace cli
 } // namespace mediaelch
@@ -0,0 +1,123 @@
+#include "cli/export.h"
+
+#include "cli/reload.h"
+#include "data/tv_show/TvShow.h"
+#include "export/ExportTemplateLoader.h"
+#include "export/MediaExport.h"
+#include "globals/Manager.h"
+#include "utils/Meta.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <atomic>
+#include <iostream>
+
+namespace mediaelch {
+namespace cli {
+
+namespace {
+
+bool shouldExport(MediaType configured, MediaType type)
+{
+    return configured == MediaType::All || configured == type;
+}
+
+} // namespace
+
+int exportLibrary(QCoreApplication& app, QCommandLineParser& parser)
+{
+    parser.clearPositionalArguments();
+    // re-add this command so that it appears when help is printed
+    parser.addPositionalArgument("export", "Export the media library", "export [export_options]");
+
+    QCommandLineOption templateOption("template", "Identifier of an installed export template", "identifier");
+    QCommandLineOption dirOption("dir", "Export directory. Must exist.", "path");
+    QCommandLineOption typeOption(
+        "type", R"(Media type. Either "all", "movie", "concert" or "tvshow")", "mediatype", "all");
+    QCommandLineOption incrementalOption(
+        "incremental", "Update an existing export in the export directory instead of creating a new one.");
+
+    parser.addOption(templateOption);
+    parser.addOption(dirOption);
+    parser.addOption(typeOption);
+    parser.addOption(incrementalOption);
+    parser.process(app);
+
+    ExportConfig config;
+    config.mediaType = mediaTypeFromString(parser.value(typeOption));
+    config.templateIdentifier = parser.value(templateOption);
+    config.directory = parser.value(dirOption);
+    config.incremental = parser.isSet(incrementalOption);
+
+    if (config.mediaType == MediaType::Unknown || config.mediaType == MediaType::Music) {
+        std::cerr << "Unsupported media type: " << parser.value(typeOption).toStdString() << std::endl;
+        return 1;
+    }
+
+    ExportTemplate* exportTemplate =
+        ExportTemplateLoader::instance()->getTemplateByIdentifier(config.templateIdentifier);
+    if (exportTemplate == nullptr) {
+        std::cerr << "Export template is not installed: " << config.templateIdentifier.toStdString() << std::endl;
+        return 1;
+    }
+
+    QDir dir(config.directory);
+    if (config.directory.isEmpty() || !dir.exists()) {
+        std::cerr << "Export directory does not exist: " << config.directory.toStdString() << std::endl;
+        return 1;
+    }
+
+    // Same directory layout as MediaElch's export dialog.
+    if (!config.incremental) {
+        const QString subDir =
+            QStringLiteral("MediaElch Export %1").arg(QDateTime::currentDateTime().toString("yyyy-MM-dd hh-mm-ss"));
+        if (!dir.mkdir(subDir) || !dir.cd(subDir)) {
+            std::cerr << "Could not create export directory in: " << config.directory.toStdString() << std::endl;
+            return 1;
+        }
+    }
+
+    QVector<ExportTemplate::ExportSection> sections;
+    int itemCount = 0;
+    const auto& templateSections = exportTemplate->exportSections();
+    if (shouldExport(config.mediaType, MediaType::Movie)
+        && templateSections.contains(ExportTemplate::ExportSection::Movies)) {
+        reloadMovies(false);
+        sections << ExportTemplate::ExportSection::Movies;
+        itemCount += qsizetype_to_int(Manager::instance()->movieModel()->movies().size());
+    }
+    if (shouldExport(config.mediaType, MediaType::TvShow)
+        && templateSections.contains(ExportTemplate::ExportSection::TvShows)) {
+        reloadTvShows(false);
+        sections << ExportTemplate::ExportSection::TvShows;
+        for (TvShow* show : Manager::instance()->tvShowModel()->tvShows()) {
+            itemCount += 1 + show->episodeCount();
+        }
+    }
+    if (shouldExport(config.mediaType, MediaType::Concert)
+        && templateSections.contains(ExportTemplate::ExportSection::Concerts)) {
+        reloadConcerts(false);
+        sections << ExportTemplate::ExportSection::Concerts;
+        itemCount += qsizetype_to_int(Manager::instance()->concertModel()->concerts().size());
+    }
+
+    if (sections.isEmpty()) {
+        std::cerr << "The export template does not support the selected media type." << std::endl;
+        return 1;
+    }
+
+    std::atomic_bool canceled{false};
+    int itemsExported = 0;
+    MediaExport exporter(canceled);
+    exporter.setIncremental(config.incremental);
+    QObject::connect(&exporter, &MediaExport::sigItemExported, [&itemsExported, itemCount]() {
+        printProgress("export", ++itemsExported, itemCount);
+    });
+    exporter.doExport(*exportTemplate, dir, sections);
+
+    printResult("export", QStringLiteral("Exported library to %1").arg(dir.absolutePath()));
+    return 0;
+}
+
+} // namespace cli
+} // namespace mediaelch
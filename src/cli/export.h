@@ -0,0 +1,23 @@
+#pragma once
+
+#include "cli/common.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+
+namespace mediaelch {
+namespace cli {
+
+struct ExportConfig
+{
+    MediaType mediaType = MediaType::All;
+    QString templateIdentifier;
+    QString directory;
+    bool incremental = false;
+};
+
+/// Export the library using an installed export template. Same as MediaElch's export dialog.
+int exportLibrary(QCoreApplication& app, QCommandLineParser& parser);
+
+} // namespace cli
+} // namespace mediaelch
@@ -26,7 +26,7 @@ static InfoObjectType infoTypeFromString(QString str)
     return InfoObjectType::Unknown;
 }
 
-int info(QApplication& app, QCommandLineParser& parser)
+int info(QCoreApplication& app, QCommandLineParser& parser)
 {
     parser.clearPositionalArguments();
     // re-add this command so that it appears when help is printed
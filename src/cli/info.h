@@ -2,13 +2,13 @@
 
 #include "cli/common.h"
 
-#include <QApplication>
 #include <QCommandLineParser>
+#include <QCoreApplication>
 
 namespace mediaelch {
 namespace cli {
 
-int info(QApplication& app, QCommandLineParser& parser);
+int info(QCoreApplication& app, QCommandLineParser& parser);
 
 } // namespace cli
 } // namespace mediaelch
@@ -104,9 +104,10 @@ void printArtist(TableWriter& table, Artist& artist)
 
 void listMusic()
 {
-    Manager::instance()->musicFileSearcher()->setMusicDirectories(
-        Settings::instance()->directorySettings().musicDirectories());
-    Manager::instance()->musicFileSearcher()->reload(false);
+    auto* searcher = Manager::instance()->musicFileSearcher();
+    searcher->setMusicDirectories(Settings::instance()->directorySettings().musicDirectories());
+    // Directories with "auto reload" are scanned in the background.
+    runAndWait(searcher, &MusicFileSearcher::musicLoaded, [searcher]() { searcher->reload(false); });
     MusicModel* musicModel = Manager::instance()->musicModel();
 
     TableLayout layout;
@@ -129,9 +130,6 @@ void listTvShows()
 {
     Manager::instance()->tvShowFileSearcher()->setTvShowDirectories(
         Settings::instance()->directorySettings().tvShowDirectories());
-    // The global TvShowFilesWidget instance is set in its constructor...
-    // TODO: Don't implicitly expect that it is instantiated somewhere.
-    TvShowFilesWidget filesWidget;
     Manager::instance()->tvShowFileSearcher()->reload(false);
     TvShowModel* tvShowModel = Manager::instance()->tvShowModel();
 
@@ -182,7 +180,7 @@ void listEntries(ListConfig config)
     std::cout << std::endl;
 }
 
-int list(QApplication& app, QCommandLineParser& parser)
+int list(QCoreApplication& app, QCommandLineParser& parser)
 {
     parser.clearPositionalArguments();
     // re-add this command so that it appears when help is printed
@@ -2,8 +2,8 @@
 
 #include "cli/common.h"
 
-#include <QApplication>
 #include <QCommandLineParser>
+#include <QCoreApplication>
 
 class Album;
 class Artist;
@@ -33,7 +33,7 @@ void listTvShows();
 
 void listEntries(ListConfig config);
 
-int list(QApplication& app, QCommandLineParser& parser);
+int list(QCoreApplication& app, QCommandLineParser& parser);
 
 } // namespace cli
 } // namespace mediaelch
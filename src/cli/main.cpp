@@ -1,15 +1,21 @@
 #include "Version.h"
 #include "cli/common.h"
+#include "cli/export.h"
 #include "cli/info.h"
 #include "cli/list.h"
 #include "cli/reload.h"
 #include "cli/show.h"
+#include "cli/streamdetails.h"
+#include "cli/sync.h"
+#include "globals/Globals.h"
+#include "log/Log.h"
 #include "settings/Settings.h"
 #include "utils/Meta.h"
 
-#include <QApplication>
 #include <QCommandLineOption>
 #include <QCommandLineParser>
+#include <QGuiApplication>
+#include <QThreadPool>
 #include <iostream>
 #include <string>
 
@@ -27,6 +33,8 @@ enum class Command
     Add,
     Show,
     Sync,
+    Export,
+    StreamDetails,
     Settings,
     Info,
     Help,
@@ -50,6 +58,12 @@ static Command commandFromString(const QString& command)
     if ("sync" == command) {
         return Command::Sync;
     }
+    if ("export" == command) {
+        return Command::Export;
+    }
+    if ("streamdetails" == command) {
+        return Command::StreamDetails;
+    }
     if ("info" == command) {
         return Command::Info;
     }
@@ -72,6 +86,13 @@ Options:
                    `mediaelch <command> --help`.
  -v, --version     Print MediaElch's version.
  --verbose=<level> Verbosity level (0: only errors, 4: everything)
+ --jobs=<n>        Number of worker threads, e.g. for loading media files.
+ --json            Print progress and results as JSON objects, one per line.
+ --log-level=<category>=<level>[,...]
+                   Minimum level of log messages of a category, e.g.
+                   `--log-level="*=warning,scraper.tmdb=debug"`. Levels are
+                   debug, info, warning, critical and off. Overrides the levels
+                   of advancedsettings.xml. Use --verbose to print messages.
 
 commands:
    list        List all media entries.
@@ -80,6 +101,9 @@ commands:
    show <id>   Show an entry with the identifier <id>. <id> can be either
                MediaElch's media id, IMDb, TMDB or TVmaze id for TV shows.
    sync        Sync MediaElch with Kodi. Uses parameters set in settings.
+   export      Export the media library using an installed export template.
+   streamdetails
+               Reload stream details from media files and save them.
    settings    Get or set MediaElch's settings.
    info        Get various details about MediaElch.
    help        Same as `--help`.
@@ -103,13 +127,16 @@ static void printUnsupported(QString command)
     std::cout << "Command '" << command.toStdString() << "' not supported, yet." << std::endl;
 }
 
-static int parseArguments(QApplication& app)
+static int parseArguments(QCoreApplication& app)
 {
     QCommandLineParser parser;
     // custom help option that lists all commands
     parser.addOption({{"h", "?", "help"}, "Print help"});
     parser.addOption({"version", "Print version"});
     parser.addOption({"verbose", "Verbosity level (0: only errors, 4: everything)", "level"});
+    parser.addOption({"jobs", "Number of worker threads", "n"});
+    parser.addOption({"json", "Print progress and results as JSON"});
+    parser.addOption({"log-level", "Minimum level of log messages of a category", "category=level"});
     parser.addHelpOption();
     parser.addPositionalArgument("command", "The command to execute.");
 
@@ -121,6 +148,30 @@ static int parseArguments(QApplication& app)
         const int verbosity = QString(parser.value("verbose")).toInt();
         mediaelch::cli::setVerbosity(verbosity);
     }
+    if (parser.isSet("jobs")) {
+        const int jobs = QString(parser.value("jobs")).toInt();
+        if (jobs > 0) {
+            // Used by file searchers, stream detail loading and the export.
+            QThreadPool::globalInstance()->setMaxThreadCount(jobs);
+        }
+    }
+    mediaelch::cli::setJsonOutput(parser.isSet("json"));
+
+    if (parser.isSet("log-level")) {
+        QMap<QString, mediaelch::LogLevel> levels = Settings::instance()->advanced()->logLevels();
+        for (const QString& value : parser.values("log-level")) {
+            for (const QString& categoryLevel : value.split(',', ElchSplitBehavior::SkipEmptyParts)) {
+                const QString category = categoryLevel.section('=', 0, 0).trimmed();
+                mediaelch::LogLevel level = mediaelch::LogLevel::Debug;
+                if (category.isEmpty() || !mediaelch::logLevelFromString(categoryLevel.section('=', 1), level)) {
+                    std::cerr << "Invalid log level: " << categoryLevel.toStdString() << std::endl;
+                    return 1;
+                }
+                levels.insert(category, level);
+            }
+        }
+        mediaelch::setLogLevels(levels);
+    }
 
     const QStringList args = parser.positionalArguments();
     const QString command = args.isEmpty() ? QString() : args.first();
@@ -130,8 +181,10 @@ static int parseArguments(QApplication& app)
     case Command::Version: printVersion(); return 0;
     case Command::List: return mediaelch::cli::list(app, parser);
     case Command::Reload: return mediaelch::cli::reload(app, parser);
+    case Command::Sync: return mediaelch::cli::sync(app, parser);
+    case Command::Export: return mediaelch::cli::exportLibrary(app, parser);
+    case Command::StreamDetails: return mediaelch::cli::streamDetails(app, parser);
     case Command::Settings:
-    case Command::Sync:
     case Command::Add: printUnsupported(command); return 1;
     case Command::Show: return mediaelch::cli::show(app, parser);
     case Command::Info: return mediaelch::cli::info(app, parser);
@@ -163,7 +216,12 @@ static int parseArguments(QApplication& app)
 
 int main(int argc, char** argv)
 {
-    QApplication app(argc, argv);
+    // No widgets are created, but MediaElch's models still need fonts and images.
+    // The offscreen platform lets the CLI run without a display, e.g. as a cron job.
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QGuiApplication app(argc, argv);
     registerAllMetaTypes();
 
     QCoreApplication::setOrganizationName(mediaelch::constants::OrganizationName);
@@ -177,6 +235,7 @@ int main(int argc, char** argv)
     qInstallMessageHandler(mediaelch::cli::messageHandler);
 
     Settings::instance(QCoreApplication::instance())->loadSettings();
+    mediaelch::setLogLevels(Settings::instance()->advanced()->logLevels());
 
     return parseArguments(app);
 }
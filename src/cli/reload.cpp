@@ -1,5 +1,8 @@
 #include "cli/reload.h"
 
+#include "file_search/ConcertFileSearcher.h"
+#include "file_search/MusicFileSearcher.h"
+#include "file_search/TvShowFileSearcher.h"
 #include "file_search/movie/MovieFileSearcher.h"
 #include "globals/Manager.h"
 
@@ -8,59 +11,80 @@
 namespace mediaelch {
 namespace cli {
 
-void reloadMovies()
+void reloadMovies(bool fromDisk)
 {
-    Manager::instance()->movieFileSearcher()->setMovieDirectories(
-        Settings::instance()->directorySettings().movieDirectories());
-    Manager::instance()->movieFileSearcher()->reload(true);
-    std::cout << "Movies reloaded." << std::endl;
+    auto* searcher = Manager::instance()->movieFileSearcher();
+    searcher->setMovieDirectories(Settings::instance()->directorySettings().movieDirectories());
+
+    const auto connection = QObject::connect(searcher, &MovieFileSearcher::percentChanged, [](float percent, int) {
+        printProgress("reload_movies", qRound(percent), 100);
+    });
+    runAndWait(searcher, &MovieFileSearcher::finished, [searcher, fromDisk]() { searcher->reload(fromDisk); });
+    QObject::disconnect(connection);
+
+    printResult("reload_movies", "Movies reloaded.");
 }
 
-void reloadTvShows()
+void reloadTvShows(bool fromDisk)
 {
-    Manager::instance()->tvShowFileSearcher()->setTvShowDirectories(
-        Settings::instance()->directorySettings().tvShowDirectories());
-    // The global TvShowFilesWidget instance is set in its constructor...
-    // TODO: Don't implicitly expect that it is instantiated somewhere.
-    TvShowFilesWidget filesWidget;
-    Manager::instance()->tvShowFileSearcher()->reload(true);
-    std::cout << "Concerts reloaded." << std::endl;
+    auto* searcher = Manager::instance()->tvShowFileSearcher();
+    searcher->setTvShowDirectories(Settings::instance()->directorySettings().tvShowDirectories());
+
+    const auto connection = QObject::connect(searcher, &TvShowFileSearcher::progress, [](int current, int max, int) {
+        printProgress("reload_tvshows", current, max);
+    });
+    runAndWait(searcher, &TvShowFileSearcher::tvShowsLoaded, [searcher, fromDisk]() { searcher->reload(fromDisk); });
+    QObject::disconnect(connection);
+
+    printResult("reload_tvshows", "TV shows reloaded.");
 }
 
-void reloadConcerts()
+void reloadConcerts(bool fromDisk)
 {
-    Manager::instance()->concertFileSearcher()->setConcertDirectories(
-        Settings::instance()->directorySettings().concertDirectories());
-    Manager::instance()->concertFileSearcher()->reload(true);
-    std::cout << "Concerts reloaded." << std::endl;
+    auto* searcher = Manager::instance()->concertFileSearcher();
+    searcher->setConcertDirectories(Settings::instance()->directorySettings().concertDirectories());
+
+    const auto connection = QObject::connect(searcher, &ConcertFileSearcher::progress, [](int current, int max, int) {
+        printProgress("reload_concerts", current, max);
+    });
+    runAndWait(searcher, &ConcertFileSearcher::concertsLoaded, [searcher, fromDisk]() { searcher->reload(fromDisk); });
+    QObject::disconnect(connection);
+
+    printResult("reload_concerts", "Concerts reloaded.");
 }
 
-void reloadMusic()
+void reloadMusic(bool fromDisk)
 {
-    Manager::instance()->musicFileSearcher()->setMusicDirectories(
-        Settings::instance()->directorySettings().musicDirectories());
-    Manager::instance()->musicFileSearcher()->reload(true);
-    std::cout << "Music reloaded." << std::endl;
+    auto* searcher = Manager::instance()->musicFileSearcher();
+    searcher->setMusicDirectories(Settings::instance()->directorySettings().musicDirectories());
+
+    const auto connection = QObject::connect(searcher, &MusicFileSearcher::progress, [](int current, int max, int) {
+        printProgress("reload_music", current, max);
+    });
+    runAndWait(searcher, &MusicFileSearcher::musicLoaded, [searcher, fromDisk]() { searcher->reload(fromDisk); });
+    QObject::disconnect(connection);
+
+    printResult("reload_music", "Music reloaded.");
 }
 
 void reloadEntries(ReloadConfig config)
 {
     switch (config.mediaType) {
-    case MediaType::Movie: reloadMovies(); break;
-    case MediaType::TvShow: reloadTvShows(); break;
-    case MediaType::Concert: reloadConcerts(); break;
-    case MediaType::Music: reloadMusic(); break;
+    case MediaType::Movie: reloadMovies(config.fromDisk); break;
+    case MediaType::TvShow: reloadTvShows(config.fromDisk); break;
+    case MediaType::Concert: reloadConcerts(config.fromDisk); break;
+    case MediaType::Music: reloadMusic(config.fromDisk); break;
     case MediaType::All:
-        reloadMovies();
-        reloadTvShows();
-        reloadConcerts();
-        reloadMusic();
+        reloadMovies(config.fromDisk);
+        reloadTvShows(config.fromDisk);
+        reloadConcerts(config.fromDisk);
+        reloadMusic(config.fromDisk);
         break;
     case MediaType::Unknown: break;
     }
 }
 
-int reload(QApplication& app, QCommandLineParser& parser)
+int reload(QCoreApplication& app, QCommandLineParser& parser)
 {
     parser.clearPositionalArguments();
     // re-add this command so that it appears when help is printed
@@ -82,10 +106,8 @@ int reload(QApplication& app, QCommandLineParser& parser)
 
     reloadEntries(config);
 
-    return 1;
+    return 0;
 }
 
-
 } // namespace cli
-
 } // namespace mediaelch
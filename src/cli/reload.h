@@ -2,8 +2,8 @@
 
 #include "cli/common.h"
 
-#include <QApplication>
 #include <QCommandLineParser>
+#include <QCoreApplication>
 
 namespace mediaelch {
 namespace cli {
@@ -11,16 +11,19 @@ namespace cli {
 struct ReloadConfig
 {
     MediaType mediaType = MediaType::All;
+    /// If false, entries are loaded from MediaElch's cache if possible.
+    bool fromDisk = true;
 };
 
-void reloadMovies();
-void reloadTvShows();
-void reloadConcerts();
-void reloadMusic();
+// All functions block until the entries are loaded.
+void reloadMovies(bool fromDisk = true);
+void reloadTvShows(bool fromDisk = true);
+void reloadConcerts(bool fromDisk = true);
+void reloadMusic(bool fromDisk = true);
 
 void reloadEntries(ReloadConfig config);
 
-int reload(QApplication& app, QCommandLineParser& parser);
+int reload(QCoreApplication& app, QCommandLineParser& parser);
 
 } // namespace cli
 } // namespace mediaelch
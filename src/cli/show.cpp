@@ -10,7 +10,7 @@
 namespace mediaelch {
 namespace cli {
 
-int show(QApplication& app, QCommandLineParser& parser)
+int show(QCoreApplication& app, QCommandLineParser& parser)
 {
     parser.clearPositionalArguments();
     // re-add this command so that it appears when help is printed
@@ -2,8 +2,8 @@
 
 #include "cli/common.h"
 
-#include <QApplication>
 #include <QCommandLineParser>
+#include <QCoreApplication>
 
 namespace mediaelch {
 namespace cli {
@@ -13,7 +13,7 @@ struct ShowConfig
     QString id;
 };
 
-int show(QApplication& app, QCommandLineParser& parser);
+int show(QCoreApplication& app, QCommandLineParser& parser);
 
 } // namespace cli
 } // namespace mediaelch
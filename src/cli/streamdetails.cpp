@@ -0,0 +1,153 @@
+#include "cli/streamdetails.h"
+
+#include "cli/reload.h"
+#include "data/concert/Concert.h"
+#include "data/movie/Movie.h"
+#include "data/tv_show/TvShow.h"
+#include "data/tv_show/TvShowEpisode.h"
+#include "globals/Manager.h"
+#include "utils/Meta.h"
+
+#include <QEventLoop>
+#include <QFutureWatcher>
+#include <QtConcurrent>
+#include <iostream>
+
+namespace mediaelch {
+namespace cli {
+
+namespace {
+
+/// Refresh the stream details of the given items.
+///  1. Load all details from the NFO files (main thread); otherwise, saving would lose them.
+///  2. Load the stream details from the media files (worker threads, see "--jobs").
+///  3. Save all items whose stream details could be loaded (main thread).
+/// \returns Number of updated items.
+template<typename T, typename LoadFunction, typename StreamDetailsFunction, typename SaveFunction>
+int refreshStreamDetails(const QString& task,
+    const QVector<T*>& items,
+    LoadFunction load,
+    StreamDetailsFunction loadStreamDetails,
+    SaveFunction save)
+{
+    struct Item
+    {
+        T* item = nullptr;
+        bool success = false;
+    };
+
+    QVector<Item> jobs;
+    jobs.reserve(items.size());
+    for (T* item : items) {
+        load(item);
+        jobs.append({item, false});
+    }
+
+    const int total = qsizetype_to_int(jobs.size());
+    QFutureWatcher<void> watcher;
+    QEventLoop loop;
+    QObject::connect(&watcher, &QFutureWatcher<void>::progressValueChanged, &loop, [&task, total](int progress) {
+        printProgress(task, progress, total);
+    });
+    QObject::connect(&watcher, &QFutureWatcher<void>::finished, &loop, &QEventLoop::quit);
+    watcher.setFuture(QtConcurrent::map(jobs, [&loadStreamDetails](Item& job) { //
+        job.success = loadStreamDetails(job.item);
+    }));
+    loop.exec();
+
+    int updated = 0;
+    for (const Item& job : asConst(jobs)) {
+        if (job.success && save(job.item)) {
+            ++updated;
+        }
+    }
+    return updated;
+}
+
+void refreshMovies()
+{
+    reloadMovies(false);
+    const int updated = refreshStreamDetails(
+        "streamdetails_movies",
+        Manager::instance()->movieModel()->movies(),
+        [](Movie* movie) { movie->controller()->loadData(Manager::instance()->mediaCenterInterface()); },
+        [](Movie* movie) { return movie->controller()->loadStreamDetailsFromFile(); },
+        [](Movie* movie) { return movie->controller()->saveData(Manager::instance()->mediaCenterInterface()); });
+    printResult("streamdetails_movies", QStringLiteral("Updated stream details of %1 movies.").arg(updated));
+}
+
+void refreshConcerts()
+{
+    reloadConcerts(false);
+    const int updated = refreshStreamDetails(
+        "streamdetails_concerts",
+        Manager::instance()->concertModel()->concerts(),
+        [](Concert* concert) {
+            concert->controller()->loadData(Manager::instance()->mediaCenterInterfaceConcert());
+        },
+        [](Concert* concert) { return concert->controller()->loadStreamDetailsFromFile(); },
+        [](Concert* concert) {
+            return concert->controller()->saveData(Manager::instance()->mediaCenterInterfaceConcert());
+        });
+    printResult("streamdetails_concerts", QStringLiteral("Updated stream details of %1 concerts.").arg(updated));
+}
+
+void refreshEpisodes()
+{
+    reloadTvShows(false);
+    QVector<TvShowEpisode*> episodes;
+    for (TvShow* show : Manager::instance()->tvShowModel()->tvShows()) {
+        for (TvShowEpisode* episode : show->episodes()) {
+            if (!episode->isDummy()) {
+                episodes << episode;
+            }
+        }
+    }
+    const int updated = refreshStreamDetails(
+        "streamdetails_episodes",
+        episodes,
+        [](TvShowEpisode* episode) {
+            episode->loadData(Manager::instance()->mediaCenterInterfaceTvShow(), true, false);
+        },
+        [](TvShowEpisode* episode) { return episode->loadStreamDetailsFromFile(); },
+        [](TvShowEpisode* episode) { return episode->saveData(Manager::instance()->mediaCenterInterfaceTvShow()); });
+    printResult("streamdetails_episodes", QStringLiteral("Updated stream details of %1 episodes.").arg(updated));
+}
+
+} // namespace
+
+int streamDetails(QCoreApplication& app, QCommandLineParser& parser)
+{
+    parser.clearPositionalArguments();
+    // re-add this command so that it appears when help is printed
+    parser.addPositionalArgument(
+        "streamdetails", "Reload stream details from media files", "streamdetails [streamdetails_options]");
+
+    QCommandLineOption typeOption(
+        "type", R"(Media type. Either "all", "movie", "concert" or "tvshow")", "mediatype", "all");
+
+    parser.addOption(typeOption);
+    parser.process(app);
+
+    StreamDetailsConfig config;
+    config.mediaType = mediaTypeFromString(parser.value(typeOption));
+
+    switch (config.mediaType) {
+    case MediaType::Movie: refreshMovies(); return 0;
+    case MediaType::TvShow: refreshEpisodes(); return 0;
+    case MediaType::Concert: refreshConcerts(); return 0;
+    case MediaType::All:
+        refreshMovies();
+        refreshEpisodes();
+        refreshConcerts();
+        return 0;
+    case MediaType::Music:
+    case MediaType::Unknown: break;
+    }
+
+    std::cerr << "Unsupported media type: " << parser.value(typeOption).toStdString() << std::endl;
+    return 1;
+}
+
+} // namespace cli
+} // namespace mediaelch
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "cli/common.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+
+namespace mediaelch {
+namespace cli {
+
+struct StreamDetailsConfig
+{
+    MediaType mediaType = MediaType::All;
+};
+
+/// Reload the stream details of all items from their files and save them.
+int streamDetails(QCoreApplication& app, QCommandLineParser& parser);
+
+} // namespace cli
+} // namespace mediaelch
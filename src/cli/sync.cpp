@@ -0,0 +1,337 @@
+#include "cli/sync.h"
+
+#include "cli/reload.h"
+#include "data/concert/Concert.h"
+#include "data/movie/Movie.h"
+#include "data/tv_show/TvShow.h"
+#include "data/tv_show/TvShowEpisode.h"
+#include "globals/Manager.h"
+#include "media_center/kodi/KodiPathIndex.h"
+#include "network/NetworkManager.h"
+#include "settings/Settings.h"
+#include "utils/Meta.h"
+
+#include <QAuthenticator>
+#include <QEventLoop>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QUrl>
+#include <iostream>
+
+// Uses the Kodi JSON-RPC API, same as KodiSync in MediaElch's GUI.
+// See: https://kodi.wiki/view/JSON-RPC_API
+
+namespace mediaelch {
+namespace cli {
+
+namespace {
+
+SyncType syncTypeFromString(const QString& str)
+{
+    if ("scan" == str) {
+        return SyncType::Scan;
+    }
+    if ("clean" == str) {
+        return SyncType::Clean;
+    }
+    if ("watched" == str) {
+        return SyncType::Watched;
+    }
+    return SyncType::Unknown;
+}
+
+/// Blocking JSON-RPC client for Kodi.
+class KodiClient
+{
+public:
+    explicit KodiClient(const KodiSettings& settings) : m_settings{settings}
+    {
+        if (Settings::instance()->networkSettings().useProxyForKodi()) {
+            m_network.enableDefaultProxy();
+        } else {
+            m_network.disableProxy();
+        }
+        QObject::connect(&m_network,
+            &network::NetworkManager::authenticationRequired,
+            &m_network,
+            [this](QNetworkReply*, QAuthenticator* authenticator) {
+                authenticator->setUser(m_settings.xbmcUser());
+                authenticator->setPassword(m_settings.xbmcPassword());
+            });
+    }
+
+    bool isConfigured() const { return !m_settings.xbmcHost().isEmpty() && m_settings.xbmcPort() != 0; }
+
+    /// \brief Call the given method and wait for Kodi's response.
+    /// \returns false on network and JSON-RPC errors. Errors are printed.
+    bool call(const QString& method, const QJsonObject& params, QJsonObject& result)
+    {
+        QJsonObject o;
+        o.insert("jsonrpc", QString("2.0"));
+        o.insert("method", method);
+        o.insert("id", ++m_requestId);
+        if (!params.isEmpty()) {
+            o.insert("params", params);
+        }
+
+        const QUrl url(QStringLiteral("http://%1:%2/jsonrpc").arg(m_settings.xbmcHost()).arg(m_settings.xbmcPort()));
+        QNetworkRequest request(url);
+        request.setRawHeader("Content-Type", "application/json");
+        request.setRawHeader("Accept", "application/json");
+
+        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
+        QEventLoop loop;
+        QObject::connect(reply, &QNetworkReply::finished, &loop, &QEventLoop::quit);
+        if (!reply->isFinished()) {
+            loop.exec();
+        }
+        reply->deleteLater();
+
+        if (reply->error() != QNetworkReply::NoError) {
+            printResult("sync", QStringLiteral("Network error: %1").arg(reply->errorString()), false);
+            return false;
+        }
+        const QJsonObject response = QJsonDocument::fromJson(reply->readAll()).object();
+        if (response.contains("error")) {
+            printResult("sync",
+                QStringLiteral("Kodi error for %1: %2")
+                    .arg(method, response.value("error").toObject().value("message").toString()),
+                false);
+            return false;
+        }
+        result = response.value("result").toObject();
+        return true;
+    }
+
+private:
+    const KodiSettings& m_settings;
+    network::NetworkManager m_network;
+    int m_requestId = 0;
+};
+
+struct KodiWatchedData
+{
+    int playCount = 0;
+    QDateTime lastPlayed;
+};
+
+/// Kodi's items of one type, indexed by their file paths.
+struct KodiItems
+{
+    KodiPathIndex index;
+    QHash<int, KodiWatchedData> data;
+};
+
+bool loadKodiItems(KodiClient& kodi,
+    const QString& method,
+    const QString& listKey,
+    const QString& idKey,
+    KodiItems& items)
+{
+    QJsonObject params;
+    params.insert("limits", QJsonObject{{"end", 100000}});
+    params.insert("properties", QJsonArray{"file", "playcount", "lastplayed"});
+
+    QJsonObject result;
+    if (!kodi.call(method, params, result)) {
+        return false;
+    }
+
+    const QJsonArray list = result.value(listKey).toArray();
+    for (const QJsonValue& value : list) {
+        const QJsonObject obj = value.toObject();
+        const int id = obj.value(idKey).toInt();
+        if (id == 0) {
+            continue;
+        }
+        KodiWatchedData data;
+        data.playCount = obj.value("playcount").toInt();
+        data.lastPlayed = QDateTime::fromString(obj.value("lastplayed").toString(), "yyyy-MM-dd HH:mm:ss");
+        items.data.insert(id, data);
+        items.index.insert(id, obj.value("file").toString().normalized(QString::NormalizationForm_C));
+    }
+    return true;
+}
+
+// Episodes use a different name for the play count getter.
+int playCountOf(const Movie* movie)
+{
+    return movie->playcount();
+}
+
+int playCountOf(const Concert* concert)
+{
+    return concert->playcount();
+}
+
+int playCountOf(const TvShowEpisode* episode)
+{
+    return episode->playCount();
+}
+
+/// Update the play count and last played date of all items that changed in Kodi and save them.
+/// \returns Number of updated items.
+template<typename T, typename LoadFunction, typename SaveFunction>
+int updateWatched(const QString& task,
+    const QVector<T*>& localItems,
+    const KodiItems& kodiItems,
+    LoadFunction load,
+    SaveFunction save)
+{
+    int updated = 0;
+    int current = 0;
+    for (T* item : localItems) {
+        printProgress(task, ++current, qsizetype_to_int(localItems.size()));
+        const int id = kodiItems.index.findId(item->files().toStringList());
+        if (id <= 0) {
+            continue;
+        }
+        const KodiWatchedData data = kodiItems.data.value(id);
+        if (playCountOf(item) == data.playCount && item->lastPlayed() == data.lastPlayed) {
+            continue;
+        }
+        // Load all details from the NFO file first. Otherwise, saving would lose them.
+        load(item);
+        item->setPlayCount(data.playCount);
+        item->setLastPlayed(data.lastPlayed);
+        if (save(item)) {
+            ++updated;
+        }
+    }
+    return updated;
+}
+
+int syncWatched(KodiClient& kodi, MediaType mediaType)
+{
+    bool success = true;
+    if (mediaType == MediaType::All || mediaType == MediaType::Movie) {
+        KodiItems items;
+        if (loadKodiItems(kodi, "VideoLibrary.GetMovies", "movies", "movieid", items)) {
+            reloadMovies(false);
+            const int updated = updateWatched(
+                "sync_movies",
+                Manager::instance()->movieModel()->movies(),
+                items,
+                [](Movie* movie) { movie->controller()->loadData(Manager::instance()->mediaCenterInterface()); },
+                [](Movie* movie) {
+                    return movie->controller()->saveData(Manager::instance()->mediaCenterInterface());
+                });
+            printResult("sync_movies", QStringLiteral("Updated %1 movies.").arg(updated));
+        } else {
+            success = false;
+        }
+    }
+
+    if (mediaType == MediaType::All || mediaType == MediaType::Concert) {
+        KodiItems items;
+        if (loadKodiItems(kodi, "VideoLibrary.GetMusicVideos", "musicvideos", "musicvideoid", items)) {
+            reloadConcerts(false);
+            const int updated = updateWatched(
+                "sync_concerts",
+                Manager::instance()->concertModel()->concerts(),
+                items,
+                [](Concert* concert) {
+                    concert->controller()->loadData(Manager::instance()->mediaCenterInterfaceConcert());
+                },
+                [](Concert* concert) {
+                    return concert->controller()->saveData(Manager::instance()->mediaCenterInterfaceConcert());
+                });
+            printResult("sync_concerts", QStringLiteral("Updated %1 concerts.").arg(updated));
+        } else {
+            success = false;
+        }
+    }
+
+    if (mediaType == MediaType::All || mediaType == MediaType::TvShow) {
+        KodiItems items;
+        if (loadKodiItems(kodi, "VideoLibrary.GetEpisodes", "episodes", "episodeid", items)) {
+            reloadTvShows(false);
+            QVector<TvShowEpisode*> episodes;
+            for (TvShow* show : Manager::instance()->tvShowModel()->tvShows()) {
+                for (TvShowEpisode* episode : show->episodes()) {
+                    if (!episode->isDummy()) {
+                        episodes << episode;
+                    }
+                }
+            }
+            const int updated = updateWatched(
+                "sync_episodes",
+                episodes,
+                items,
+                [](TvShowEpisode* episode) {
+                    episode->loadData(Manager::instance()->mediaCenterInterfaceTvShow(), true, false);
+                },
+                [](TvShowEpisode* episode) {
+                    return episode->saveData(Manager::instance()->mediaCenterInterfaceTvShow());
+                });
+            printResult("sync_episodes", QStringLiteral("Updated %1 episodes.").arg(updated));
+        } else {
+            success = false;
+        }
+    }
+
+    return success ? 0 : 1;
+}
+
+} // namespace
+
+int sync(QCoreApplication& app, QCommandLineParser& parser)
+{
+    parser.clearPositionalArguments();
+    // re-add this command so that it appears when help is printed
+    parser.addPositionalArgument("sync", "Sync MediaElch with Kodi", "sync [sync_options]");
+
+    QCommandLineOption syncTypeOption("sync-type",
+        "What to sync. Either \"scan\" (Kodi scans for new items), \"clean\" (Kodi removes deleted items)"
+        " or \"watched\" (store Kodi's play counts in NFO files)",
+        "synctype",
+        "scan");
+    QCommandLineOption typeOption(
+        "type", R"(Media type for "watched". Either "all", "movie", "concert" or "tvshow")", "mediatype", "all");
+
+    parser.addOption(syncTypeOption);
+    parser.addOption(typeOption);
+    parser.process(app);
+
+    SyncConfig config;
+    config.syncType = syncTypeFromString(parser.value(syncTypeOption));
+    config.mediaType = mediaTypeFromString(parser.value(typeOption));
+
+    if (config.syncType == SyncType::Unknown) {
+        std::cerr << "Unknown sync type: " << parser.value(syncTypeOption).toStdString() << std::endl;
+        return 1;
+    }
+    if (config.mediaType == MediaType::Unknown || config.mediaType == MediaType::Music) {
+        std::cerr << "Unsupported media type: " << parser.value(typeOption).toStdString() << std::endl;
+        return 1;
+    }
+
+    KodiClient kodi(Settings::instance()->kodiSettings());
+    if (!kodi.isConfigured()) {
+        std::cerr << "Kodi's host and port are not set in MediaElch's settings." << std::endl;
+        return 1;
+    }
+
+    QJsonObject result;
+    switch (config.syncType) {
+    case SyncType::Scan:
+        if (!kodi.call("VideoLibrary.Scan", {}, result)) {
+            return 1;
+        }
+        printResult("sync", "Kodi is now scanning for new items.");
+        return 0;
+    case SyncType::Clean:
+        if (!kodi.call("VideoLibrary.Clean", {}, result)) {
+            return 1;
+        }
+        printResult("sync", "Kodi is now cleaning its database.");
+        return 0;
+    case SyncType::Watched: return syncWatched(kodi, config.mediaType);
+    case SyncType::Unknown: break;
+    }
+    return 1;
+}
+
+} // namespace cli
+} // namespace mediaelch
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "cli/common.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+
+namespace mediaelch {
+namespace cli {
+
+enum class SyncType
+{
+    Unknown,
+    /// Let Kodi scan its sources for new and changed items.
+    Scan,
+    /// Let Kodi remove items whose files no longer exist.
+    Clean,
+    /// Store Kodi's play counts and last played dates in MediaElch's NFO files.
+    Watched
+};
+
+struct SyncConfig
+{
+    SyncType syncType = SyncType::Unknown;
+    MediaType mediaType = MediaType::All;
+};
+
+int sync(QCoreApplication& app, QCommandLineParser& parser);
+
+} // namespace cli
+} // namespace mediaelch
@@ -495,6 +495,11 @@ bool MovieController::infoLoaded() const
     return m_infoLoaded;
 }
 
+void MovieController::setInfoLoaded(bool infoLoaded)
+{
+    m_infoLoaded = infoLoaded;
+}
+
 bool MovieController::downloadsInProgress() const
 {
     return m_downloadManager->isDownloading();
@@ -54,6 +54,9 @@ public:
     /// \brief Holds whether movie infos were loaded from a MediaCenterInterface or ScraperInterface
     /// \return Infos were loaded
     bool infoLoaded() const;
+    /// \brief Mark the movie's details as loaded without going through loadData(),
+    ///        e.g. if they were restored from a database snapshot.
+    void setInfoLoaded(bool infoLoaded);
 
     /// \brief Returns true if a download is in progress
     /// \return Download is in progress
@@ -1496,7 +1496,7 @@ void TvShow::fillMissingEpisodes()
     }
 
     Manager::instance()->tvShowModel()->updateShow(this);
-    TvShowFilesWidget::instance().renewModel(true);
+    renewFilesWidgetModel();
 }
 
 void TvShow::clearMissingEpisodes()
@@ -1505,7 +1505,16 @@ void TvShow::clearMissingEpisodes()
     m_episodes.erase(std::remove_if(m_episodes.begin(), m_episodes.end(), isDummyEpisode), m_episodes.end());
 
     Manager::instance()->tvShowModel()->updateShow(this);
-    TvShowFilesWidget::instance().renewModel(true);
+    renewFilesWidgetModel();
+}
+
+void TvShow::renewFilesWidgetModel()
+{
+    // There is no files widget in MediaElch's command line interface.
+    TvShowFilesWidget* filesWidget = Manager::instance()->tvShowFilesWidget();
+    if (filesWidget != nullptr) {
+        filesWidget->renewModel(true);
+    }
 }
 
 QDebug operator<<(QDebug dbg, const TvShow& show)
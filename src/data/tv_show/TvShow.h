@@ -338,6 +338,7 @@ private:
     QMap<SeasonNumber, QMap<ImageType, bool>> m_hasSeasonImageChanged;
 
     void clearSeasonImageType(ImageType imageType);
+    void renewFilesWidgetModel();
 };
 
 QDebug operator<<(QDebug dbg, const TvShow& show);
@@ -0,0 +1,76 @@
+#include "database/AlbumSnapshot.h"
+
+#include "data/music/Album.h"
+#include "database/SnapshotStream.h"
+
+namespace mediaelch {
+
+QByteArray AlbumSnapshot::write(const Album& album)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    snapshot::writeHeader(out, formatVersion);
+
+    out << album.title() << album.artist();
+    out << album.mbReleaseGroupId().toString() << album.mbAlbumId().toString() << album.allMusicId().toString();
+    out << album.genres() << album.styles() << album.moods();
+    out << album.review() << album.label() << album.releaseDate();
+    out << static_cast<qint32>(album.year()) << static_cast<double>(album.rating());
+
+    snapshot::writePosters(out, album.images(ImageType::AlbumThumb));
+
+    return data;
+}
+
+bool AlbumSnapshot::read(const QByteArray& data, Album& album)
+{
+    if (data.isEmpty()) {
+        return false;
+    }
+
+    QDataStream in(data);
+    if (!snapshot::readHeader(in, formatVersion)) {
+        return false;
+    }
+
+    QString title;
+    QString artist;
+    QString mbReleaseGroupId;
+    QString mbAlbumId;
+    QString allMusicId;
+    in >> title >> artist >> mbReleaseGroupId >> mbAlbumId >> allMusicId;
+    album.setTitle(title);
+    album.setArtist(artist);
+    album.setMbReleaseGroupId(MusicBrainzId(mbReleaseGroupId));
+    album.setMbAlbumId(MusicBrainzId(mbAlbumId));
+    album.setAllMusicId(AllMusicId(allMusicId));
+
+    QStringList genres;
+    QStringList styles;
+    QStringList moods;
+    in >> genres >> styles >> moods;
+    album.setGenres(genres);
+    album.setStyles(styles);
+    album.setMoods(moods);
+
+    QString review;
+    QString label;
+    QString releaseDate;
+    qint32 year = 0;
+    double rating = 0.0;
+    in >> review >> label >> releaseDate >> year >> rating;
+    album.setReview(review);
+    album.setLabel(label);
+    album.setReleaseDate(releaseDate);
+    album.setYear(year);
+    album.setRating(rating);
+
+    const QVector<Poster> thumbs = snapshot::readPosters(in);
+    for (const Poster& thumb : thumbs) {
+        album.addImage(ImageType::AlbumThumb, thumb);
+    }
+
+    return snapshot::isComplete(in);
+}
+
+} // namespace mediaelch
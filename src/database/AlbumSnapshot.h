@@ -0,0 +1,27 @@
+#pragma once
+
+#include <QByteArray>
+
+class Album;
+
+namespace mediaelch {
+
+/// \brief Binary snapshot of all details that are read from an album's NFO file.
+/// \see MovieSnapshot
+class AlbumSnapshot
+{
+public:
+    /// \brief Version of the binary layout.
+    /// \details Must be increased whenever fields are added, removed or reordered.
+    static constexpr quint16 formatVersion = 1;
+
+    /// \brief Serialize all NFO details of the given album.
+    static QByteArray write(const Album& album);
+
+    /// \brief Restore NFO details from the given snapshot into the album.
+    /// \return False if the snapshot is empty, corrupt or has another version.
+    ///         The album must then be loaded from its NFO content instead.
+    static bool read(const QByteArray& data, Album& album);
+};
+
+} // namespace mediaelch
@@ -0,0 +1,92 @@
+#include "database/ArtistSnapshot.h"
+
+#include "data/music/Artist.h"
+#include "database/SnapshotStream.h"
+
+namespace mediaelch {
+
+QByteArray ArtistSnapshot::write(const Artist& artist)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    snapshot::writeHeader(out, formatVersion);
+
+    out << artist.name() << artist.mbId().toString() << artist.allMusicId().toString();
+    out << artist.genres() << artist.styles() << artist.moods();
+    out << artist.yearsActive() << artist.formed() << artist.born() << artist.died() << artist.disbanded();
+    out << artist.biography();
+
+    snapshot::writePosters(out, artist.images(ImageType::ArtistThumb));
+    snapshot::writePosters(out, artist.images(ImageType::ArtistFanart));
+
+    const QVector<DiscographyAlbum> discography = artist.discographyAlbums();
+    out << static_cast<qint32>(discography.size());
+    for (const DiscographyAlbum& album : discography) {
+        out << album.title << album.year;
+    }
+
+    return data;
+}
+
+bool ArtistSnapshot::read(const QByteArray& data, Artist& artist)
+{
+    if (data.isEmpty()) {
+        return false;
+    }
+
+    QDataStream in(data);
+    if (!snapshot::readHeader(in, formatVersion)) {
+        return false;
+    }
+
+    QString name;
+    QString mbId;
+    QString allMusicId;
+    in >> name >> mbId >> allMusicId;
+    artist.setName(name);
+    artist.setMbId(MusicBrainzId(mbId));
+    artist.setAllMusicId(AllMusicId(allMusicId));
+
+    QStringList genres;
+    QStringList styles;
+    QStringList moods;
+    in >> genres >> styles >> moods;
+    artist.setGenres(genres);
+    artist.setStyles(styles);
+    artist.setMoods(moods);
+
+    QString yearsActive;
+    QString formed;
+    QString born;
+    QString died;
+    QString disbanded;
+    QString biography;
+    in >> yearsActive >> formed >> born >> died >> disbanded >> biography;
+    artist.setYearsActive(yearsActive);
+    artist.setFormed(formed);
+    artist.setBorn(born);
+    artist.setDied(died);
+    artist.setDisbanded(disbanded);
+    artist.setBiography(biography);
+
+    const QVector<Poster> thumbs = snapshot::readPosters(in);
+    for (const Poster& thumb : thumbs) {
+        artist.addImage(ImageType::ArtistThumb, thumb);
+    }
+    const QVector<Poster> fanarts = snapshot::readPosters(in);
+    for (const Poster& fanart : fanarts) {
+        artist.addImage(ImageType::ArtistFanart, fanart);
+    }
+
+    qint32 albumCount = 0;
+    in >> albumCount;
+    for (qint32 i = 0; i < albumCount && in.status() == QDataStream::Ok; ++i) {
+        DiscographyAlbum album;
+        in >> album.title >> album.year;
+        artist.addDiscographyAlbum(album);
+    }
+
+    return snapshot::isComplete(in);
+}
+
+} // namespace mediaelch
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <QByteArray>
+
+class Artist;
+
+namespace mediaelch {
+
+/// \brief Binary snapshot of all details that are read from an artist's NFO file.
+/// \see MovieSnapshot
+class ArtistSnapshot
+{
+public:
+    /// \brief Version of the binary layout.
+    /// \details Must be increased whenever fields are added, removed or reordered.
+    static constexpr quint16 formatVersion = 1;
+
+    /// \brief Serialize all NFO details of the given artist.
+    static QByteArray write(const Artist& artist);
+
+    /// \brief Restore NFO details from the given snapshot into the artist.
+    /// \return False if the snapshot is empty, corrupt or has another version.
+    ///         The artist must then be loaded from its NFO content instead.
+    static bool read(const QByteArray& data, Artist& artist);
+};
+
+} // namespace mediaelch
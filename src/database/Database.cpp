@@ -44,7 +44,7 @@ Database::Database(QObject* parent) : QObject(parent)
     m_db = std::make_unique<QSqlDatabase>(QSqlDatabase::addDatabase("QSQLITE", connectionName));
     m_db->setDatabaseName(m_dataLocation.filePath("MediaElch.sqlite"));
     if (!m_db->open()) {
-        qCCritical(generic) << "Could not open cache database";
+        qCCritical(c_database) << "Could not open cache database";
     } else {
         setupDatabase();
     }
@@ -187,7 +187,8 @@ void Database::addMovie(Movie* movie, DirectoryPath path)
 void Database::update(Movie* movie)
 {
     QSqlQuery query(db());
-    query.prepare("UPDATE movies SET content=:content WHERE idMovie=:idMovie");
+    // The snapshot was created from the old content and is rebuilt on the next load.
+    query.prepare("UPDATE movies SET content=:content, snapshot=NULL WHERE idMovie=:idMovie");
     query.bindValue(":content", movie->nfoContent().isEmpty() ? "" : movie->nfoContent());
     query.bindValue(":idMovie", movie->databaseId().toInt());
     query.exec();
@@ -238,7 +239,7 @@ QVector<Movie*> Database::moviesInDirectory(DirectoryPath path, QObject* moviePa
             movie = movies.value(query.value(query.record().indexOf("idMovie")).toInt());
             if (movie == nullptr) {
                 // This *must* not happen because we just inserted it.
-                qCCritical(generic) << "[Database] Movie is undefined but should exist!";
+                qCCritical(c_database) << "[Database] Movie is undefined but should exist!";
                 continue;
             }
 
@@ -298,6 +299,29 @@ QVector<Movie*> Database::moviesInDirectory(DirectoryPath path, QObject* moviePa
     return movies.values().toVector();
 }
 
+QHash<int, QByteArray> Database::movieSnapshotsInDirectory(DirectoryPath path)
+{
+    QSqlQuery query(db());
+    query.prepare("SELECT idMovie, snapshot FROM movies WHERE path=:path AND snapshot IS NOT NULL");
+    query.bindValue(":path", path.toString().toUtf8());
+    query.exec();
+
+    QHash<int, QByteArray> snapshots;
+    while (query.next()) {
+        snapshots.insert(query.value(0).toInt(), query.value(1).toByteArray());
+    }
+    return snapshots;
+}
+
+void Database::setMovieSnapshot(mediaelch::DatabaseId id, const QByteArray& snapshot)
+{
+    QSqlQuery query(db());
+    query.prepare("UPDATE movies SET snapshot=:snapshot WHERE idMovie=:idMovie");
+    query.bindValue(":snapshot", snapshot);
+    query.bindValue(":idMovie", id.toInt());
+    query.exec();
+}
+
 void Database::clearAllConcerts()
 {
     QSqlQuery query(db());
@@ -512,7 +536,8 @@ void Database::update(TvShow* show)
 void Database::update(TvShowEpisode* episode)
 {
     QSqlQuery query(db());
-    query.prepare("UPDATE episodes SET content=:content WHERE idEpisode=:id");
+    // The snapshot was created from the old content and is rebuilt on the next load.
+    query.prepare("UPDATE episodes SET content=:content, snapshot=NULL WHERE idEpisode=:id");
     query.bindValue(":content", episode->nfoContent().isEmpty() ? "" : episode->nfoContent());
     query.bindValue(":id", episode->databaseId().toInt());
     query.exec();
@@ -573,33 +598,96 @@ QVector<TvShow*> Database::showsInDirectory(DirectoryPath path)
     return shows;
 }
 
-QVector<TvShowEpisode*> Database::episodes(mediaelch::DatabaseId idShow)
+QHash<int, QVector<TvShowEpisode*>> Database::episodesInDirectory(DirectoryPath path)
 {
-    QVector<TvShowEpisode*> episodes;
+    // One query for all episodes and their files instead of one query per show and episode.
+    // Rows are ordered by episode, so that each episode can be created as soon as all of
+    // its files have been read.
     QSqlQuery query(db());
-    QSqlQuery queryFiles(db());
-    query.prepare("SELECT idEpisode, content, seasonNumber, episodeNumber FROM episodes WHERE idShow=:idShow");
-    query.bindValue(":idShow", idShow.toInt());
+    query.setForwardOnly(true);
+    query.prepare("SELECT E.idEpisode, E.idShow, E.content, E.seasonNumber, E.episodeNumber, EF.file "
+                  "FROM episodes E "
+                  "INNER JOIN shows S ON S.idShow=E.idShow "
+                  "LEFT JOIN episodeFiles EF ON EF.idEpisode=E.idEpisode "
+                  "WHERE S.path=:path "
+                  "ORDER BY E.idEpisode, EF.idFile");
+    query.bindValue(":path", path.toString().toUtf8());
     query.exec();
-    while (query.next()) {
-        QStringList files;
-        queryFiles.prepare("SELECT file FROM episodeFiles WHERE idEpisode=:idEpisode");
-        queryFiles.bindValue(":idEpisode", query.value(query.record().indexOf("idEpisode")).toInt());
-        queryFiles.exec();
-        while (queryFiles.next()) {
-            files << QString::fromUtf8(queryFiles.value(queryFiles.record().indexOf("file")).toByteArray());
+
+    const int idEpisodeIndex = query.record().indexOf("idEpisode");
+    const int idShowIndex = query.record().indexOf("idShow");
+    const int contentIndex = query.record().indexOf("content");
+    const int seasonIndex = query.record().indexOf("seasonNumber");
+    const int episodeIndex = query.record().indexOf("episodeNumber");
+    const int fileIndex = query.record().indexOf("file");
+
+    QHash<int, QVector<TvShowEpisode*>> episodes;
+
+    int currentId = -1;
+    int currentShowId = -1;
+    QStringList currentFiles;
+    QString currentContent;
+    int currentSeason = 0;
+    int currentEpisode = 0;
+
+    const auto createCurrentEpisode = [&]() {
+        if (currentId == -1) {
+            return;
         }
+        auto* episode = new TvShowEpisode(currentFiles);
+        episode->setSeason(SeasonNumber(currentSeason));
+        episode->setEpisode(EpisodeNumber(currentEpisode));
+        episode->setDatabaseId(currentId);
+        episode->setNfoContent(currentContent);
+        episodes[currentShowId].append(episode);
+    };
 
-        auto* episode = new TvShowEpisode(files);
-        episode->setSeason(SeasonNumber(query.value(query.record().indexOf("seasonNumber")).toInt()));
-        episode->setEpisode(EpisodeNumber(query.value(query.record().indexOf("episodeNumber")).toInt()));
-        episode->setDatabaseId(query.value(query.record().indexOf("idEpisode")).toInt());
-        episode->setNfoContent(QString::fromUtf8(query.value(query.record().indexOf("content")).toByteArray()));
-        episodes.append(episode);
+    while (query.next()) {
+        const int idEpisode = query.value(idEpisodeIndex).toInt();
+        if (idEpisode != currentId) {
+            createCurrentEpisode();
+            currentId = idEpisode;
+            currentShowId = query.value(idShowIndex).toInt();
+            currentFiles.clear();
+            currentContent = QString::fromUtf8(query.value(contentIndex).toByteArray());
+            currentSeason = query.value(seasonIndex).toInt();
+            currentEpisode = query.value(episodeIndex).toInt();
+        }
+        if (!query.value(fileIndex).isNull()) {
+            currentFiles << QString::fromUtf8(query.value(fileIndex).toByteArray());
+        }
     }
+    createCurrentEpisode();
+
     return episodes;
 }
 
+QHash<int, QByteArray> Database::episodeSnapshotsInDirectory(DirectoryPath path)
+{
+    QSqlQuery query(db());
+    query.setForwardOnly(true);
+    query.prepare("SELECT E.idEpisode, E.snapshot FROM episodes E "
+                  "INNER JOIN shows S ON S.idShow=E.idShow "
+                  "WHERE S.path=:path AND E.snapshot IS NOT NULL");
+    query.bindValue(":path", path.toString().toUtf8());
+    query.exec();
+
+    QHash<int, QByteArray> snapshots;
+    while (query.next()) {
+        snapshots.insert(query.value(0).toInt(), query.value(1).toByteArray());
+    }
+    return snapshots;
+}
+
+void Database::setEpisodeSnapshot(mediaelch::DatabaseId id, const QByteArray& snapshot)
+{
+    QSqlQuery query(db());
+    query.prepare("UPDATE episodes SET snapshot=:snapshot WHERE idEpisode=:idEpisode");
+    query.bindValue(":snapshot", snapshot);
+    query.bindValue(":idEpisode", id.toInt());
+    query.exec();
+}
+
 void Database::clearAllTvShows()
 {
     QSqlQuery query(db());
@@ -663,7 +751,7 @@ int Database::episodeCount()
     if (query.next()) {
         return query.value(0).toInt();
     } else {
-        qCWarning(generic) << "[Database] Query was not successful: Can't retrieve number of episodes";
+        qCWarning(c_database) << "[Database] Query was not successful: Can't retrieve number of episodes";
         return 0;
     }
 }
@@ -1056,10 +1144,32 @@ void Database::setupDatabase()
         query.exec();
 
         myDbVersion = 17;
-        Q_UNUSED(myDbVersion);
         updateDbVersion(17);
     }
 
+    if (myDbVersion < 18) {
+        // Binary snapshot of the parsed NFO content, see mediaelch::MovieSnapshot
+        query.prepare("ALTER TABLE movies ADD COLUMN snapshot blob;");
+        query.exec();
+
+        myDbVersion = 18;
+        updateDbVersion(18);
+    }
+
+    if (myDbVersion < 19) {
+        // Binary snapshots of episodes, artists and albums, see e.g. mediaelch::EpisodeSnapshot
+        query.prepare("ALTER TABLE episodes ADD COLUMN snapshot blob;");
+        query.exec();
+        query.prepare("ALTER TABLE artists ADD COLUMN snapshot blob;");
+        query.exec();
+        query.prepare("ALTER TABLE albums ADD COLUMN snapshot blob;");
+        query.exec();
+
+        myDbVersion = 19;
+        Q_UNUSED(myDbVersion);
+        updateDbVersion(19);
+    }
+
     query.prepare("PRAGMA synchronous=0;");
     query.exec();
 
@@ -1101,7 +1211,7 @@ void Database::add(Artist* artist, DirectoryPath path)
 void Database::update(Artist* artist)
 {
     QSqlQuery query(db());
-    query.prepare("UPDATE artists SET content=:content WHERE idArtist=:id");
+    query.prepare("UPDATE artists SET content=:content, snapshot=NULL WHERE idArtist=:id");
     query.bindValue(":content", artist->nfoContent().isEmpty() ? "" : artist->nfoContent());
     query.bindValue(":id", artist->databaseId().toInt());
     query.exec();
@@ -1124,6 +1234,95 @@ QVector<Artist*> Database::artistsInDirectory(DirectoryPath path)
     return artists;
 }
 
+QHash<int, QByteArray> Database::artistSnapshotsInDirectory(DirectoryPath path)
+{
+    QSqlQuery query(db());
+    query.prepare("SELECT idArtist, snapshot FROM artists WHERE path=:path AND snapshot IS NOT NULL");
+    query.bindValue(":path", path.toString().toUtf8());
+    query.exec();
+
+    QHash<int, QByteArray> snapshots;
+    while (query.next()) {
+        snapshots.insert(query.value(0).toInt(), query.value(1).toByteArray());
+    }
+    return snapshots;
+}
+
+void Database::setArtistSnapshot(mediaelch::DatabaseId id, const QByteArray& snapshot)
+{
+    QSqlQuery query(db());
+    query.prepare("UPDATE artists SET snapshot=:snapshot WHERE idArtist=:idArtist");
+    query.bindValue(":snapshot", snapshot);
+    query.bindValue(":idArtist", id.toInt());
+    query.exec();
+}
+
+QVector<Album*> Database::albumsInDirectory(DirectoryPath path, const QVector<Artist*>& artists)
+{
+    QHash<int, Artist*> artistsById;
+    for (Artist* artist : artists) {
+        artistsById.insert(artist->databaseId().toInt(), artist);
+    }
+
+    // One query for the albums of all artists instead of one query per artist.
+    QVector<Album*> albums;
+    QSqlQuery query(db());
+    query.setForwardOnly(true);
+    query.prepare("SELECT AL.idAlbum, AL.idArtist, AL.content, AL.dir "
+                  "FROM albums AL "
+                  "INNER JOIN artists AR ON AR.idArtist=AL.idArtist "
+                  "WHERE AR.path=:path "
+                  "ORDER BY AL.idAlbum");
+    query.bindValue(":path", path.toString().toUtf8());
+    query.exec();
+
+    const int idAlbumIndex = query.record().indexOf("idAlbum");
+    const int idArtistIndex = query.record().indexOf("idArtist");
+    const int contentIndex = query.record().indexOf("content");
+    const int dirIndex = query.record().indexOf("dir");
+
+    while (query.next()) {
+        Artist* artist = artistsById.value(query.value(idArtistIndex).toInt(), nullptr);
+        if (artist == nullptr) {
+            continue;
+        }
+        mediaelch::DirectoryPath dir(QString::fromUtf8(query.value(dirIndex).toByteArray()));
+        auto* album = new Album(dir, Manager::instance()->musicFileSearcher());
+        album->setDatabaseId(query.value(idAlbumIndex).toInt());
+        album->setNfoContent(QString::fromUtf8(query.value(contentIndex).toByteArray()));
+        album->setArtistObj(artist);
+        artist->addAlbum(album);
+        albums.append(album);
+    }
+    return albums;
+}
+
+QHash<int, QByteArray> Database::albumSnapshotsInDirectory(DirectoryPath path)
+{
+    QSqlQuery query(db());
+    query.setForwardOnly(true);
+    query.prepare("SELECT AL.idAlbum, AL.snapshot FROM albums AL "
+                  "INNER JOIN artists AR ON AR.idArtist=AL.idArtist "
+                  "WHERE AR.path=:path AND AL.snapshot IS NOT NULL");
+    query.bindValue(":path", path.toString().toUtf8());
+    query.exec();
+
+    QHash<int, QByteArray> snapshots;
+    while (query.next()) {
+        snapshots.insert(query.value(0).toInt(), query.value(1).toByteArray());
+    }
+    return snapshots;
+}
+
+void Database::setAlbumSnapshot(mediaelch::DatabaseId id, const QByteArray& snapshot)
+{
+    QSqlQuery query(db());
+    query.prepare("UPDATE albums SET snapshot=:snapshot WHERE idAlbum=:idAlbum");
+    query.bindValue(":snapshot", snapshot);
+    query.bindValue(":idAlbum", id.toInt());
+    query.exec();
+}
+
 void Database::clearAllAlbums()
 {
     QSqlQuery query(db());
@@ -1157,27 +1356,8 @@ void Database::add(Album* album, DirectoryPath path)
 void Database::update(Album* album)
 {
     QSqlQuery query(db());
-    query.prepare("UPDATE albums SET content=:content WHERE idAlbum=:id");
+    query.prepare("UPDATE albums SET content=:content, snapshot=NULL WHERE idAlbum=:id");
     query.bindValue(":content", album->nfoContent().isEmpty() ? "" : album->nfoContent());
     query.bindValue(":id", album->databaseId().toInt());
     query.exec();
 }
-
-QVector<Album*> Database::albums(Artist* artist)
-{
-    QVector<Album*> albums;
-    QSqlQuery query(db());
-    query.prepare("SELECT idAlbum, content, dir FROM albums WHERE idArtist=:idArtist");
-    query.bindValue(":idArtist", artist->databaseId().toInt());
-    query.exec();
-    while (query.next()) {
-        mediaelch::DirectoryPath dir(QString::fromUtf8(query.value(query.record().indexOf("dir")).toByteArray()));
-        auto* album = new Album(dir, Manager::instance()->musicFileSearcher());
-        album->setDatabaseId(query.value(query.record().indexOf("idAlbum")).toInt());
-        album->setNfoContent(QString::fromUtf8(query.value(query.record().indexOf("content")).toByteArray()));
-        album->setArtistObj(artist);
-        artist->addAlbum(album);
-        albums.append(album);
-    }
-    return albums;
-}
@@ -5,7 +5,9 @@
 #include "globals/Globals.h"
 #include "media/Path.h"
 
+#include <QByteArray>
 #include <QDateTime>
+#include <QHash>
 #include <QSqlDatabase>
 #include <QString>
 #include <QStringList>
@@ -37,6 +39,10 @@ public:
     void addMovie(Movie* movie, mediaelch::DirectoryPath path);
     void update(Movie* movie);
     QVector<Movie*> moviesInDirectory(mediaelch::DirectoryPath path, QObject* movieParent);
+    /// \brief Binary snapshots of all movies in the given directory, indexed by their database id.
+    /// \see mediaelch::MovieSnapshot
+    QHash<int, QByteArray> movieSnapshotsInDirectory(mediaelch::DirectoryPath path);
+    void setMovieSnapshot(mediaelch::DatabaseId id, const QByteArray& snapshot);
 
     void clearAllConcerts();
     void clearConcertsInDirectory(mediaelch::DirectoryPath path);
@@ -53,7 +59,12 @@ public:
     void clearTvShowInDirectory(mediaelch::DirectoryPath path);
     int showCount(mediaelch::DirectoryPath path);
     QVector<TvShow*> showsInDirectory(mediaelch::DirectoryPath path);
-    QVector<TvShowEpisode*> episodes(mediaelch::DatabaseId idShow);
+    /// \brief Episodes of all shows in the given directory, indexed by the show's database id.
+    QHash<int, QVector<TvShowEpisode*>> episodesInDirectory(mediaelch::DirectoryPath path);
+    /// \brief Binary snapshots of all episodes of shows in the given directory, indexed by their database id.
+    /// \see mediaelch::EpisodeSnapshot
+    QHash<int, QByteArray> episodeSnapshotsInDirectory(mediaelch::DirectoryPath path);
+    void setEpisodeSnapshot(mediaelch::DatabaseId id, const QByteArray& snapshot);
     int episodeCount();
 
     void setShowMissingEpisodes(TvShow* show, bool showMissing);
@@ -69,12 +80,19 @@ public:
     void add(Artist* artist, mediaelch::DirectoryPath path);
     void update(Artist* artist);
     QVector<Artist*> artistsInDirectory(mediaelch::DirectoryPath path);
+    /// \see mediaelch::ArtistSnapshot
+    QHash<int, QByteArray> artistSnapshotsInDirectory(mediaelch::DirectoryPath path);
+    void setArtistSnapshot(mediaelch::DatabaseId id, const QByteArray& snapshot);
 
     void clearAllAlbums();
     void clearAlbumsInDirectory(mediaelch::DirectoryPath path);
     void add(Album* album, mediaelch::DirectoryPath path);
     void update(Album* album);
-    QVector<Album*> albums(Artist* artist);
+    /// \brief Albums of all given artists in the given directory. Albums are added to their artist.
+    QVector<Album*> albumsInDirectory(mediaelch::DirectoryPath path, const QVector<Artist*>& artists);
+    /// \see mediaelch::AlbumSnapshot
+    QHash<int, QByteArray> albumSnapshotsInDirectory(mediaelch::DirectoryPath path);
+    void setAlbumSnapshot(mediaelch::DatabaseId id, const QByteArray& snapshot);
 
     void addImport(QString fileName, QString type, mediaelch::DirectoryPath path);
     bool guessImport(QString fileName, QString& type, QString& path);
@@ -0,0 +1,126 @@
+#include "database/EpisodeSnapshot.h"
+
+#include "data/tv_show/TvShowEpisode.h"
+#include "database/SnapshotStream.h"
+#include "utils/Meta.h"
+
+namespace mediaelch {
+
+QByteArray EpisodeSnapshot::write(TvShowEpisode& episode)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    snapshot::writeHeader(out, formatVersion);
+
+    out << episode.title() << episode.showTitle() << episode.overview() << episode.network();
+    out << static_cast<qint32>(episode.seasonNumber().toInt()) << static_cast<qint32>(episode.episodeNumber().toInt());
+    out << static_cast<qint32>(episode.displaySeason().toInt())
+        << static_cast<qint32>(episode.displayEpisode().toInt());
+    out << episode.writers() << episode.directors() << episode.tags();
+
+    out << episode.imdbId().toString() << episode.tmdbId().toString() << episode.tvdbId().toString()
+        << episode.tvmazeId().toString();
+    out << episode.certification().toString();
+    out << episode.thumbnail();
+    out << episode.firstAired() << episode.lastPlayed() << episode.epBookmark();
+    out << static_cast<qint32>(episode.playCount()) << static_cast<qint32>(episode.top250());
+
+    snapshot::writeRatings(out, episode.ratings());
+
+    const Actors& actors = episode.actors();
+    out << static_cast<qint32>(actors.size());
+    for (const Actor* actor : actors) {
+        out << actor->name << actor->role << actor->thumb << static_cast<qint32>(actor->order);
+    }
+
+    snapshot::writeStreamDetails(out, *episode.streamDetails());
+
+    return data;
+}
+
+bool EpisodeSnapshot::read(const QByteArray& data, TvShowEpisode& episode)
+{
+    if (data.isEmpty()) {
+        return false;
+    }
+
+    QDataStream in(data);
+    if (!snapshot::readHeader(in, formatVersion)) {
+        return false;
+    }
+
+    QString title;
+    QString showTitle;
+    QString overview;
+    QString network;
+    in >> title >> showTitle >> overview >> network;
+    episode.setTitle(title);
+    episode.setShowTitle(showTitle);
+    episode.setOverview(overview);
+    episode.setNetwork(network);
+
+    qint32 season = 0;
+    qint32 episodeNumber = 0;
+    qint32 displaySeason = 0;
+    qint32 displayEpisode = 0;
+    in >> season >> episodeNumber >> displaySeason >> displayEpisode;
+    episode.setSeason(SeasonNumber(season));
+    episode.setEpisode(EpisodeNumber(episodeNumber));
+    episode.setDisplaySeason(SeasonNumber(displaySeason));
+    episode.setDisplayEpisode(EpisodeNumber(displayEpisode));
+
+    QStringList writers;
+    QStringList directors;
+    QStringList tags;
+    in >> writers >> directors >> tags;
+    episode.setWriters(writers);
+    episode.setDirectors(directors);
+    for (const QString& tag : asConst(tags)) {
+        episode.addTag(tag);
+    }
+
+    QString imdbId;
+    QString tmdbId;
+    QString tvdbId;
+    QString tvmazeId;
+    QString certification;
+    QUrl thumbnail;
+    in >> imdbId >> tmdbId >> tvdbId >> tvmazeId >> certification >> thumbnail;
+    episode.setImdbId(ImdbId(imdbId));
+    episode.setTmdbId(TmdbId(tmdbId));
+    episode.setTvdbId(TvDbId(tvdbId));
+    episode.setTvMazeId(TvMazeId(tvmazeId));
+    episode.setCertification(Certification(certification));
+    episode.setThumbnail(thumbnail);
+
+    QDate firstAired;
+    QDateTime lastPlayed;
+    QTime epBookmark;
+    qint32 playCount = 0;
+    qint32 top250 = 0;
+    in >> firstAired >> lastPlayed >> epBookmark >> playCount >> top250;
+    episode.setFirstAired(firstAired);
+    episode.setLastPlayed(lastPlayed);
+    episode.setEpBookmark(epBookmark);
+    episode.setPlayCount(playCount);
+    episode.setTop250(top250);
+
+    snapshot::readRatings(in, episode.ratings());
+
+    qint32 actorCount = 0;
+    in >> actorCount;
+    for (qint32 i = 0; i < actorCount && in.status() == QDataStream::Ok; ++i) {
+        Actor actor;
+        actor.imageHasChanged = false;
+        qint32 order = 0;
+        in >> actor.name >> actor.role >> actor.thumb >> order;
+        actor.order = order;
+        episode.addActor(actor);
+    }
+
+    snapshot::readStreamDetails(in, *episode.streamDetails());
+
+    return snapshot::isComplete(in);
+}
+
+} // namespace mediaelch
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <QByteArray>
+
+class TvShowEpisode;
+
+namespace mediaelch {
+
+/// \brief Binary snapshot of all details that are read from an episode's NFO file.
+///
+/// Same as MovieSnapshot, but for TV show episodes, which are usually by far the
+/// largest part of a library.  Season and episode number are part of the snapshot,
+/// because the NFO file may differ from the numbers detected from the file name.
+class EpisodeSnapshot
+{
+public:
+    /// \brief Version of the binary layout.
+    /// \details Must be increased whenever fields are added, removed or reordered.
+    static constexpr quint16 formatVersion = 1;
+
+    /// \brief Serialize all NFO details of the given episode.
+    static QByteArray write(TvShowEpisode& episode);
+
+    /// \brief Restore NFO details from the given snapshot into the episode.
+    /// \return False if the snapshot is empty, corrupt or has another version.
+    ///         The episode must then be loaded from its NFO content instead.
+    static bool read(const QByteArray& data, TvShowEpisode& episode);
+};
+
+} // namespace mediaelch
@@ -0,0 +1,155 @@
+#include "database/MovieSnapshot.h"
+
+#include "data/movie/Movie.h"
+#include "database/SnapshotStream.h"
+#include "utils/Meta.h"
+
+namespace mediaelch {
+
+QByteArray MovieSnapshot::write(Movie& movie)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    snapshot::writeHeader(out, formatVersion);
+
+    out << movie.name() << movie.originalName() << movie.sortTitle();
+    out << movie.overview() << movie.outline() << movie.tagline();
+    out << movie.set().name << movie.set().overview;
+    out << movie.writer() << movie.director();
+    out << movie.tags() << movie.studios() << movie.genres() << movie.countries();
+
+    out << movie.imdbId().toString() << movie.tmdbId().toString() << movie.wikidataId().toString();
+    out << movie.certification().toString();
+    out << movie.trailer();
+    out << movie.released() << movie.dateAdded() << movie.lastPlayed();
+    out << static_cast<qint64>(movie.runtime().count());
+    out << static_cast<qint32>(movie.playcount()) << static_cast<qint32>(movie.top250());
+    out << movie.userRating();
+    out << movie.resumeTime().position << movie.resumeTime().total;
+
+    snapshot::writeRatings(out, movie.ratings());
+
+    const Actors& actors = movie.actors();
+    out << static_cast<qint32>(actors.size());
+    for (const Actor* actor : actors) {
+        out << actor->name << actor->role << actor->thumb;
+    }
+
+    snapshot::writePosters(out, movie.images().posters());
+    snapshot::writePosters(out, movie.images().backdrops());
+    snapshot::writeStreamDetails(out, *movie.streamDetails());
+
+    return data;
+}
+
+bool MovieSnapshot::read(const QByteArray& data, Movie& movie)
+{
+    if (data.isEmpty()) {
+        return false;
+    }
+
+    QDataStream in(data);
+    if (!snapshot::readHeader(in, formatVersion)) {
+        return false;
+    }
+
+    QString name;
+    QString originalName;
+    QString sortTitle;
+    in >> name >> originalName >> sortTitle;
+    movie.setName(name);
+    movie.setOriginalName(originalName);
+    movie.setSortTitle(sortTitle);
+
+    QString overview;
+    QString outline;
+    QString tagline;
+    in >> overview >> outline >> tagline;
+    movie.setOverview(overview);
+    movie.setOutline(outline);
+    movie.setTagline(tagline);
+
+    MovieSet set;
+    in >> set.name >> set.overview;
+    movie.setSet(set);
+
+    QString writer;
+    QString director;
+    in >> writer >> director;
+    movie.setWriter(writer);
+    movie.setDirector(director);
+
+    QStringList tags;
+    QStringList studios;
+    QStringList genres;
+    QStringList countries;
+    in >> tags >> studios >> genres >> countries;
+    for (const QString& tag : asConst(tags)) {
+        movie.addTag(tag);
+    }
+    for (const QString& studio : asConst(studios)) {
+        movie.addStudio(studio);
+    }
+    for (const QString& genre : asConst(genres)) {
+        movie.addGenre(genre);
+    }
+    for (const QString& country : asConst(countries)) {
+        movie.addCountry(country);
+    }
+
+    QString imdbId;
+    QString tmdbId;
+    QString wikidataId;
+    QString certification;
+    QUrl trailer;
+    in >> imdbId >> tmdbId >> wikidataId >> certification >> trailer;
+    movie.setImdbId(ImdbId(imdbId));
+    movie.setTmdbId(TmdbId(tmdbId));
+    movie.setWikidataId(WikidataId(wikidataId));
+    movie.setCertification(Certification(certification));
+    movie.setTrailer(trailer);
+
+    QDate released;
+    QDateTime dateAdded;
+    QDateTime lastPlayed;
+    qint64 runtime = 0;
+    qint32 playcount = 0;
+    qint32 top250 = 0;
+    double userRating = 0.0;
+    ResumeTime resumeTime;
+    in >> released >> dateAdded >> lastPlayed >> runtime >> playcount >> top250 >> userRating;
+    in >> resumeTime.position >> resumeTime.total;
+    movie.setReleased(released);
+    movie.setDateAdded(dateAdded);
+    movie.setLastPlayed(lastPlayed);
+    movie.setRuntime(std::chrono::minutes(runtime));
+    movie.setPlayCount(playcount);
+    movie.setTop250(top250);
+    movie.setUserRating(userRating);
+    movie.setResumeTime(resumeTime);
+
+    snapshot::readRatings(in, movie.ratings());
+
+    qint32 actorCount = 0;
+    in >> actorCount;
+    for (qint32 i = 0; i < actorCount && in.status() == QDataStream::Ok; ++i) {
+        Actor actor;
+        actor.imageHasChanged = false;
+        in >> actor.name >> actor.role >> actor.thumb;
+        movie.addActor(actor);
+    }
+
+    const QVector<Poster> posters = snapshot::readPosters(in);
+    for (const Poster& poster : posters) {
+        movie.images().addPoster(poster);
+    }
+    const QVector<Poster> backdrops = snapshot::readPosters(in);
+    for (const Poster& backdrop : backdrops) {
+        movie.images().addBackdrop(backdrop);
+    }
+    snapshot::readStreamDetails(in, *movie.streamDetails());
+
+    return snapshot::isComplete(in);
+}
+
+} // namespace mediaelch
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <QByteArray>
+
+class Movie;
+
+namespace mediaelch {
+
+/// \brief Binary snapshot of all details that are read from a movie's NFO file.
+///
+/// Loading movies from the cache database used to parse each movie's NFO content
+/// again, which dominates startup time for large libraries. A snapshot stores the
+/// parsed result in a compact, versioned QDataStream format so that it can be
+/// restored without any XML parsing.
+///
+/// A snapshot is only valid for the NFO content that it was created from.
+/// The database drops it as soon as the content is updated.
+///
+/// \code{cpp}
+///   QByteArray snapshot = MovieSnapshot::write(movie);
+///   Movie copy;
+///   bool ok = MovieSnapshot::read(snapshot, copy);
+/// \endcode
+class MovieSnapshot
+{
+public:
+    /// \brief Version of the binary layout.
+    /// \details Must be increased whenever fields are added, removed or reordered.
+    ///          Snapshots of other versions are treated as stale and rebuilt.
+    static constexpr quint16 formatVersion = 1;
+
+    /// \brief Serialize all NFO details of the given movie.
+    static QByteArray write(Movie& movie);
+
+    /// \brief Restore NFO details from the given snapshot into the movie.
+    /// \return False if the snapshot is empty, corrupt or has another version.
+    ///         In that case the movie may be partially modified and must be
+    ///         loaded from its NFO content instead.
+    static bool read(const QByteArray& snapshot, Movie& movie);
+};
+
+} // namespace mediaelch
@@ -0,0 +1,162 @@
+#include "database/SnapshotStream.h"
+
+#include "data/Rating.h"
+#include "media/StreamDetails.h"
+
+#include <QMap>
+#include <array>
+
+namespace {
+
+// Magic number in front of each snapshot to detect foreign blobs.
+constexpr quint32 SNAPSHOT_MAGIC = 0x4d45534e; // "MESN"
+
+template<class Key>
+void writeDetails(QDataStream& out, const QMap<Key, QString>& details)
+{
+    out << static_cast<qint32>(details.size());
+    for (auto i = details.constBegin(); i != details.constEnd(); ++i) {
+        out << static_cast<qint32>(i.key()) << i.value();
+    }
+}
+
+template<class Key>
+QMap<Key, QString> readDetails(QDataStream& in)
+{
+    qint32 count = 0;
+    in >> count;
+    QMap<Key, QString> details;
+    for (qint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        qint32 key = 0;
+        QString value;
+        in >> key >> value;
+        details.insert(static_cast<Key>(key), value);
+    }
+    return details;
+}
+
+} // namespace
+
+namespace mediaelch {
+namespace snapshot {
+
+void writeHeader(QDataStream& out, quint16 formatVersion)
+{
+    out.setVersion(QDataStream::Qt_5_6);
+    out << SNAPSHOT_MAGIC << formatVersion;
+}
+
+bool readHeader(QDataStream& in, quint16 formatVersion)
+{
+    in.setVersion(QDataStream::Qt_5_6);
+    quint32 magic = 0;
+    quint16 version = 0;
+    in >> magic >> version;
+    return in.status() == QDataStream::Ok && magic == SNAPSHOT_MAGIC && version == formatVersion;
+}
+
+bool isComplete(const QDataStream& in)
+{
+    return in.status() == QDataStream::Ok && in.atEnd();
+}
+
+void writePosters(QDataStream& out, const QVector<Poster>& posters)
+{
+    out << static_cast<qint32>(posters.size());
+    for (const Poster& poster : posters) {
+        out << poster.originalUrl << poster.thumbUrl << poster.aspect;
+    }
+}
+
+QVector<Poster> readPosters(QDataStream& in)
+{
+    qint32 count = 0;
+    in >> count;
+    QVector<Poster> posters;
+    for (qint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        Poster poster;
+        in >> poster.originalUrl >> poster.thumbUrl >> poster.aspect;
+        posters << poster;
+    }
+    return posters;
+}
+
+void writeRatings(QDataStream& out, const Ratings& ratings)
+{
+    out << static_cast<qint32>(ratings.size());
+    for (const Rating& rating : ratings) {
+        out << rating.source << rating.rating << static_cast<qint32>(rating.voteCount) << rating.minRating
+            << rating.maxRating;
+    }
+}
+
+void readRatings(QDataStream& in, Ratings& ratings)
+{
+    qint32 count = 0;
+    in >> count;
+    ratings.clear();
+    for (qint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        Rating rating;
+        qint32 voteCount = 0;
+        in >> rating.source >> rating.rating >> voteCount >> rating.minRating >> rating.maxRating;
+        rating.voteCount = voteCount;
+        ratings.addRating(rating);
+    }
+}
+
+void writeStreamDetails(QDataStream& out, const StreamDetails& streamDetails)
+{
+    out << streamDetails.hasLoaded();
+    writeDetails(out, streamDetails.videoDetails());
+    const auto audioDetails = streamDetails.audioDetails();
+    out << static_cast<qint32>(audioDetails.size());
+    for (const auto& details : audioDetails) {
+        writeDetails(out, details);
+    }
+    const auto subtitleDetails = streamDetails.subtitleDetails();
+    out << static_cast<qint32>(subtitleDetails.size());
+    for (const auto& details : subtitleDetails) {
+        writeDetails(out, details);
+    }
+}
+
+void readStreamDetails(QDataStream& in, StreamDetails& streamDetails)
+{
+    streamDetails.clear();
+    bool loaded = false;
+    in >> loaded;
+
+    const auto videoDetails = readDetails<StreamDetails::VideoDetails>(in);
+    for (auto i = videoDetails.constBegin(); i != videoDetails.constEnd(); ++i) {
+        streamDetails.setVideoDetail(i.key(), i.value());
+    }
+
+    // Same order as in KodiXml::loadStreamDetails() so that derived values
+    // such as the available audio channels are identical to a NFO load.
+    const std::array<StreamDetails::AudioDetails, 3> audioOrder{StreamDetails::AudioDetails::Codec,
+        StreamDetails::AudioDetails::Language,
+        StreamDetails::AudioDetails::Channels};
+    qint32 audioCount = 0;
+    in >> audioCount;
+    for (qint32 stream = 0; stream < audioCount && in.status() == QDataStream::Ok; ++stream) {
+        const auto details = readDetails<StreamDetails::AudioDetails>(in);
+        for (const auto key : audioOrder) {
+            if (details.contains(key)) {
+                streamDetails.setAudioDetail(stream, key, details.value(key));
+            }
+        }
+    }
+
+    qint32 subtitleCount = 0;
+    in >> subtitleCount;
+    for (qint32 stream = 0; stream < subtitleCount && in.status() == QDataStream::Ok; ++stream) {
+        const auto details = readDetails<StreamDetails::SubtitleDetails>(in);
+        for (auto i = details.constBegin(); i != details.constEnd(); ++i) {
+            streamDetails.setSubtitleDetail(stream, i.key(), i.value());
+        }
+    }
+    streamDetails.setLoaded(loaded);
+}
+
+} // namespace snapshot
+} // namespace mediaelch
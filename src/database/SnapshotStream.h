@@ -0,0 +1,41 @@
+#pragma once
+
+#include "data/Poster.h"
+
+#include <QDataStream>
+#include <QVector>
+
+class Ratings;
+class StreamDetails;
+
+namespace mediaelch {
+namespace snapshot {
+
+/// \brief Helpers for binary snapshots of parsed NFO content.
+///
+/// Shared by MovieSnapshot, EpisodeSnapshot, ArtistSnapshot and AlbumSnapshot.
+/// Every snapshot starts with a magic number and the snapshot's format version.
+/// Reading functions stop early if the stream is corrupt; callers have to check
+/// QDataStream::status() at the end.
+
+void writeHeader(QDataStream& out, quint16 formatVersion);
+/// \brief Read the header.  Returns false if the magic number or version do not match.
+bool readHeader(QDataStream& in, quint16 formatVersion);
+
+/// \brief True if the whole snapshot was read without errors.
+bool isComplete(const QDataStream& in);
+
+/// \note Only the URLs and the aspect are stored.
+void writePosters(QDataStream& out, const QVector<Poster>& posters);
+QVector<Poster> readPosters(QDataStream& in);
+
+void writeRatings(QDataStream& out, const Ratings& ratings);
+/// \brief Read ratings and add them to the given ones, which are cleared first.
+void readRatings(QDataStream& in, Ratings& ratings);
+
+void writeStreamDetails(QDataStream& out, const StreamDetails& streamDetails);
+/// \brief Restore stream details the same way KodiXml::loadStreamDetails() sets them.
+void readStreamDetails(QDataStream& in, StreamDetails& streamDetails);
+
+} // namespace snapshot
+} // namespace mediaelch
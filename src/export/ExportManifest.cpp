@@ -0,0 +1,169 @@
+#include "export/ExportManifest.h"
+
+#include "log/Log.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <algorithm>
+
+namespace {
+
+constexpr int MANIFEST_VERSION = 1;
+
+}
+
+namespace mediaelch {
+
+ExportManifest::ExportManifest(QDir directory) : m_dir{std::move(directory)}
+{
+}
+
+QString ExportManifest::fileName()
+{
+    return QStringLiteral(".mediaelch_export.json");
+}
+
+bool ExportManifest::load()
+{
+    QFile file(m_dir.filePath(fileName()));
+    if (!file.open(QFile::ReadOnly)) {
+        return false;
+    }
+
+    QJsonParseError parseError{};
+    const QJsonDocument json = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError) {
+        qCWarning(c_export) << "[ExportManifest] Invalid manifest; exporting everything:" << parseError.errorString();
+        return false;
+    }
+
+    const QJsonObject root = json.object();
+    if (root.value("version").toInt() != MANIFEST_VERSION) {
+        qCInfo(c_export) << "[ExportManifest] Manifest version differs; exporting everything";
+        return false;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    m_previous.clear();
+    const QJsonObject files = root.value("files").toObject();
+    for (auto it = files.constBegin(); it != files.constEnd(); ++it) {
+        const QJsonObject obj = it.value().toObject();
+        Entry entry;
+        entry.hash = obj.value("sha1").toString();
+        entry.sourceFile = obj.value("source").toString();
+        entry.sourceModified = static_cast<qint64>(obj.value("sourceModified").toDouble());
+        entry.sourceSize = static_cast<qint64>(obj.value("sourceSize").toDouble());
+        m_previous.insert(it.key(), entry);
+    }
+    qCDebug(c_export) << "[ExportManifest] Loaded manifest with" << m_previous.size() << "files";
+    return true;
+}
+
+bool ExportManifest::save() const
+{
+    QJsonObject files;
+    {
+        QMutexLocker locker(&m_mutex);
+        // Files of sections that were not exported this time are kept.
+        QHash<QString, Entry> all = m_previous;
+        for (auto it = m_current.constBegin(); it != m_current.constEnd(); ++it) {
+            all.insert(it.key(), it.value());
+        }
+        for (auto it = all.constBegin(); it != all.constEnd(); ++it) {
+            QJsonObject obj;
+            if (!it.value().hash.isEmpty()) {
+                obj.insert("sha1", it.value().hash);
+            }
+            if (!it.value().sourceFile.isEmpty()) {
+                obj.insert("source", it.value().sourceFile);
+                obj.insert("sourceModified", static_cast<double>(it.value().sourceModified));
+                obj.insert("sourceSize", static_cast<double>(it.value().sourceSize));
+            }
+            files.insert(it.key(), obj);
+        }
+    }
+
+    QJsonObject root;
+    root.insert("version", MANIFEST_VERSION);
+    root.insert("files", files);
+
+    QSaveFile file(m_dir.filePath(fileName()));
+    if (!file.open(QFile::WriteOnly)) {
+        qCWarning(c_export) << "[ExportManifest] Could not write manifest:" << file.fileName();
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+    return file.commit();
+}
+
+bool ExportManifest::updateFile(const QString& relativePath, const QByteArray& content)
+{
+    Entry entry;
+    entry.hash = QString::fromLatin1(QCryptographicHash::hash(content, QCryptographicHash::Sha1).toHex());
+    const bool unchanged = isUnchanged(relativePath, entry);
+
+    QMutexLocker locker(&m_mutex);
+    m_current.insert(relativePath, entry);
+    return !unchanged;
+}
+
+bool ExportManifest::updateImage(const QString& relativePath, const QString& sourceFile)
+{
+    const QFileInfo sourceInfo(sourceFile);
+    Entry entry;
+    entry.sourceFile = sourceFile;
+    entry.sourceModified = sourceInfo.lastModified().toMSecsSinceEpoch();
+    entry.sourceSize = sourceInfo.size();
+    const bool unchanged = isUnchanged(relativePath, entry);
+
+    QMutexLocker locker(&m_mutex);
+    m_current.insert(relativePath, entry);
+    return !unchanged;
+}
+
+int ExportManifest::removeStaleFiles(const QStringList& pathPrefixes)
+{
+    QMutexLocker locker(&m_mutex);
+    int removed = 0;
+    for (auto it = m_previous.begin(); it != m_previous.end();) {
+        const QString& path = it.key();
+        const bool isInSection = std::any_of(pathPrefixes.cbegin(), pathPrefixes.cend(), //
+            [&path](const QString& prefix) { return path.startsWith(prefix); });
+        if (!isInSection || m_current.contains(path)) {
+            ++it;
+            continue;
+        }
+        if (QFile::remove(m_dir.filePath(path))) {
+            ++removed;
+        }
+        it = m_previous.erase(it);
+    }
+    qCDebug(c_export) << "[ExportManifest] Removed" << removed << "stale files";
+    return removed;
+}
+
+bool ExportManifest::isUnchanged(const QString& relativePath, const Entry& entry) const
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        auto it = m_previous.constFind(relativePath);
+        if (it == m_previous.constEnd()) {
+            return false;
+        }
+        const Entry& previous = it.value();
+        if (previous.hash != entry.hash || previous.sourceFile != entry.sourceFile
+            || previous.sourceModified != entry.sourceModified || previous.sourceSize != entry.sourceSize) {
+            return false;
+        }
+    }
+    // The user may have deleted the file in the meantime.
+    return QFileInfo::exists(m_dir.filePath(relativePath));
+}
+
+} // namespace mediaelch
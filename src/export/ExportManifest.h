@@ -0,0 +1,63 @@
+#pragma once
+
+#include <QByteArray>
+#include <QDir>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QStringList>
+
+namespace mediaelch {
+
+/// \brief Manifest of previously exported files, stored in the export directory.
+/// \details
+///   Used for incremental exports: Files whose content did not change since the last
+///   export are not written again, images whose source file did not change are not
+///   scaled again, and files of items that no longer exist are removed.
+///   All member functions are thread-safe.
+class ExportManifest
+{
+public:
+    explicit ExportManifest(QDir directory);
+
+    /// File name of the manifest inside the export directory.
+    static QString fileName();
+
+    /// \brief Load the manifest of a previous export from the export directory.
+    /// \returns false if there is no (valid) manifest. In that case all files are exported.
+    bool load();
+    bool save() const;
+
+    /// \brief Register the given file as exported.
+    /// \returns true if the file has to be written, i.e. its content changed.
+    bool updateFile(const QString& relativePath, const QByteArray& content);
+    /// \brief Register the given image as exported.
+    /// \returns true if the image has to be created, i.e. its source file changed.
+    bool updateImage(const QString& relativePath, const QString& sourceFile);
+
+    /// \brief Remove files of the previous export that were not registered in this one.
+    /// \details Only files that are inside one of the given directories or that match
+    ///          one of the given file names are removed. That way, sections that were not
+    ///          exported this time, are kept.
+    /// \returns Number of removed files
+    int removeStaleFiles(const QStringList& pathPrefixes);
+
+private:
+    struct Entry
+    {
+        QString hash;
+        QString sourceFile;
+        qint64 sourceModified = 0;
+        qint64 sourceSize = 0;
+    };
+
+    bool isUnchanged(const QString& relativePath, const Entry& entry) const;
+
+private:
+    QDir m_dir;
+    mutable QMutex m_mutex;
+    QHash<QString, Entry> m_previous;
+    QHash<QString, Entry> m_current;
+};
+
+} // namespace mediaelch
@@ -321,7 +321,7 @@ bool ExportTemplate::copyDir(const QString& srcPath, const QString& dstPath)
                 return false;
             }
         } else {
-            qCDebug(generic) << "Unhandled item" << info.filePath() << "in cpDir";
+            qCDebug(c_export) << "Unhandled item" << info.filePath() << "in cpDir";
         }
     }
     return true;
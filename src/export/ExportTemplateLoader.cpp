@@ -30,7 +30,7 @@ ExportTemplateLoader* ExportTemplateLoader::instance(QObject* parent)
 
 void ExportTemplateLoader::getRemoteTemplates()
 {
-    qCInfo(generic) << "[ExportTemplateLoader] Loading themes list from" << s_themeListUrl;
+    qCInfo(c_export) << "[ExportTemplateLoader] Loading themes list from" << s_themeListUrl;
     QNetworkReply* reply = m_network.get(mediaelch::network::requestWithDefaults(QUrl(s_themeListUrl)));
     connect(reply, &QNetworkReply::finished, this, &ExportTemplateLoader::onLoadRemoteTemplatesFinished);
 }
@@ -44,7 +44,7 @@ void ExportTemplateLoader::onLoadRemoteTemplatesFinished()
     reply->deleteLater();
 
     if (reply->error() != QNetworkReply::NoError) {
-        qCWarning(generic) << "[ExportTemplateLoader] Network Error" << reply->errorString();
+        qCWarning(c_export) << "[ExportTemplateLoader] Network Error" << reply->errorString();
         emit sigTemplatesLoaded(mergeTemplates(m_localTemplates, m_remoteTemplates));
         return;
     }
@@ -53,7 +53,7 @@ void ExportTemplateLoader::onLoadRemoteTemplatesFinished()
     QXmlStreamReader xml(msg);
 
     if (!xml.readNextStartElement() || xml.name() != QLatin1String("themes")) {
-        qCWarning(generic) << "[ExportTemplateLoader] export_themes.xml does not have a root <themes> element";
+        qCWarning(c_export) << "[ExportTemplateLoader] export_themes.xml does not have a root <themes> element";
         emit sigTemplatesLoaded(mergeTemplates(m_localTemplates, m_remoteTemplates));
         return;
     }
@@ -63,7 +63,7 @@ void ExportTemplateLoader::onLoadRemoteTemplatesFinished()
         if (xml.name() == QLatin1String("theme")) {
             templates << parseTemplate(xml);
         } else {
-            qCWarning(generic) << "[ExportTemplateLoader] Found unknown XML tag in theme list:" << xml.name();
+            qCWarning(c_export) << "[ExportTemplateLoader] Found unknown XML tag in theme list:" << xml.name();
             xml.skipCurrentElement();
         }
     }
@@ -78,7 +78,7 @@ void ExportTemplateLoader::loadLocalTemplates()
     mediaelch::DirectoryPath location = Settings::instance()->exportTemplatesDir();
     QDir storageDir(location.dir());
     if (!storageDir.exists() && !storageDir.mkpath(location.toString())) {
-        qCCritical(generic) << "[ExportTemplateLoader] Could not create storage location";
+        qCCritical(c_export) << "[ExportTemplateLoader] Could not create storage location";
         return;
     }
 
@@ -91,8 +91,8 @@ void ExportTemplateLoader::loadLocalTemplates()
 
         QFile file(infos.first().absoluteFilePath());
         if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            qCWarning(generic) << "[ExportTemplateLoader] File" << infos.first().absoluteFilePath()
-                               << "could not be opened for reading";
+            qCWarning(c_export) << "[ExportTemplateLoader] File" << infos.first().absoluteFilePath()
+                                << "could not be opened for reading";
             continue;
         }
 
@@ -102,7 +102,7 @@ void ExportTemplateLoader::loadLocalTemplates()
         QXmlStreamReader xml(content);
 
         if (!xml.readNextStartElement()) {
-            qCWarning(generic) << "[ExportTemplateLoader] Couldn't read XML root element of local template";
+            qCWarning(c_export) << "[ExportTemplateLoader] Couldn't read XML root element of local template";
             continue;
         }
 
@@ -121,7 +121,7 @@ ExportTemplate* ExportTemplateLoader::parseTemplate(QXmlStreamReader& xml)
 bool ExportTemplateLoader::validateChecksum(const QByteArray& data, const ExportTemplate& exportTemplate)
 {
     if (exportTemplate.remoteFileChecksum().isEmpty()) {
-        qCWarning(generic) << "[ExportTemplateLoader] No checksum found for template" << exportTemplate.name();
+        qCWarning(c_export) << "[ExportTemplateLoader] No checksum found for template" << exportTemplate.name();
         return true; // TODO: Expect there to be a checksum
     }
 
@@ -129,21 +129,21 @@ bool ExportTemplateLoader::validateChecksum(const QByteArray& data, const Export
     QString epected = exportTemplate.remoteFileChecksum().toLower();
     QByteArray actual = QCryptographicHash::hash(data, QCryptographicHash::Algorithm::Sha256).toHex();
     if (epected != actual) {
-        qCWarning(generic) << "[ExportTemplateLoader] SHA256 check fail for template" << exportTemplate.name()
-                           << " | Expected:" << epected << "but found:" << actual;
+        qCWarning(c_export) << "[ExportTemplateLoader] SHA256 check fail for template" << exportTemplate.name()
+                            << " | Expected:" << epected << "but found:" << actual;
         return false;
     }
 
-    qCInfo(generic) << "[ExportTemplateLoader] SHA256 check was successful for template:" << exportTemplate.name()
-                    << "with checksum:" << actual;
+    qCInfo(c_export) << "[ExportTemplateLoader] SHA256 check was successful for template:" << exportTemplate.name()
+                     << "with checksum:" << actual;
 
     return true;
 }
 
 void ExportTemplateLoader::installTemplate(ExportTemplate* exportTemplate)
 {
-    qCInfo(generic) << "[ExportTemplateLoader] Downloading theme" << exportTemplate->name() << "from"
-                    << exportTemplate->remoteFile();
+    qCInfo(c_export) << "[ExportTemplateLoader] Downloading theme" << exportTemplate->name() << "from"
+                     << exportTemplate->remoteFile();
     QNetworkReply* reply = m_network.get(mediaelch::network::requestWithDefaults(QUrl(exportTemplate->remoteFile())));
     reply->setProperty("storage", QVariant::fromValue(exportTemplate));
     connect(reply, &QNetworkReply::finished, this, &ExportTemplateLoader::onDownloadTemplateFinished);
@@ -158,7 +158,7 @@ void ExportTemplateLoader::onDownloadTemplateFinished()
     ExportTemplate* exportTemplate = reply->property("storage").value<ExportTemplate*>();
     reply->deleteLater();
     if (reply->error() != QNetworkReply::NoError) {
-        qCWarning(generic) << "[ExportTemplateLoader] Network Error" << reply->errorString();
+        qCWarning(c_export) << "[ExportTemplateLoader] Network Error" << reply->errorString();
         emit sigTemplateInstalled(exportTemplate, false);
         return;
     }
@@ -171,7 +171,7 @@ void ExportTemplateLoader::onDownloadTemplateFinished()
 
     QBuffer buffer(&ba);
     if (!unpackTemplate(buffer, exportTemplate)) {
-        qCDebug(generic) << "[ExportTemplateLoader] Could not unpack template";
+        qCDebug(c_export) << "[ExportTemplateLoader] Could not unpack template";
         emit sigTemplateInstalled(exportTemplate, false);
         return;
     }
@@ -203,29 +203,29 @@ bool ExportTemplateLoader::unpackTemplate(QBuffer& buffer, ExportTemplate* expor
     mediaelch::DirectoryPath location = Settings::instance()->exportTemplatesDir();
     QDir storageDir(location.dir());
     if (!storageDir.exists() && !storageDir.mkpath(location.toString())) {
-        qCWarning(generic) << "[ExportTemplateLoader] Could not create storage location";
+        qCWarning(c_export) << "[ExportTemplateLoader] Could not create storage location";
         return false;
     }
 
     storageDir.setPath(location.subDir(exportTemplate->identifier()).toString());
     if ((exportTemplate->isInstalled() || storageDir.exists()) && !uninstallTemplate(exportTemplate)) {
-        qCWarning(generic) << "[ExportTemplateLoader] Could not uninstall template";
+        qCWarning(c_export) << "[ExportTemplateLoader] Could not uninstall template";
         return false;
     }
 
     if (!storageDir.mkpath(storageDir.absolutePath())) {
-        qCWarning(generic) << "[ExportTemplateLoader] Could not create storage path";
+        qCWarning(c_export) << "[ExportTemplateLoader] Could not create storage path";
         return false;
     }
 
     QuaZip zip(&buffer);
     if (!zip.open(QuaZip::mdUnzip)) {
-        qCWarning(generic) << "[ExportTemplateLoader] Zip file could not be opened";
+        qCWarning(c_export) << "[ExportTemplateLoader] Zip file could not be opened";
         return false;
     }
 
     if (zip.getEntriesCount() == 0) {
-        qCWarning(generic) << "[ExportTemplateLoader] Zip file does not contain any entries!";
+        qCWarning(c_export) << "[ExportTemplateLoader] Zip file does not contain any entries!";
         zip.close();
         return false;
     }
@@ -242,8 +242,8 @@ bool ExportTemplateLoader::unpackTemplate(QBuffer& buffer, ExportTemplate* expor
         entries.cbegin(), entries.cend(), [&baseDir](const QString& entry) { return entry.startsWith(baseDir); });
 
     if (isGitHubReleaseFormat) {
-        qCInfo(generic)
-            << "[ExportTemplateLoader] One directory inside ZIP. Assuming GitHub Release format. Skip first "
+        qCInfo(c_export)
+             << "[ExportTemplateLoader] One directory inside ZIP. Assuming GitHub Release format. Skip first "
                "directory level.";
     }
 
@@ -265,7 +265,7 @@ bool ExportTemplateLoader::unpackTemplate(QBuffer& buffer, ExportTemplate* expor
         }
         if (filename.endsWith("/")) {
             if (!storageDir.mkdir(filename)) {
-                qCWarning(generic) << "[ExportTemplateLoader] Could not create subdirectory";
+                qCWarning(c_export) << "[ExportTemplateLoader] Could not create subdirectory";
                 return false;
             }
             continue;
@@ -281,7 +281,7 @@ bool ExportTemplateLoader::unpackTemplate(QBuffer& buffer, ExportTemplate* expor
         }
     }
     if (zip.getZipError() != UNZ_OK) {
-        qCWarning(generic) << "There was an error while uncompressing the file";
+        qCWarning(c_export) << "There was an error while uncompressing the file";
         return false;
     }
 
@@ -402,8 +402,8 @@ ExportTemplate* parseTemplate(QXmlStreamReader& xml, QObject* parent)
         } else if (xml.name() == QLatin1String("checksum")) {
             if (xml.attributes().value("format") != QLatin1String("sha256")) {
                 // Assume name is set first. If not, its just an empty string.
-                qCWarning(generic) << "[ExportTemplateLoader] Unsupported checksum type; default to sha256 for"
-                                   << exportTemplate->name();
+                qCWarning(c_export) << "[ExportTemplateLoader] Unsupported checksum type; default to sha256 for"
+                                    << exportTemplate->name();
             }
             exportTemplate->setRemoteFileChecksum(xml.readElementText().trimmed());
         } else if (xml.name() == QLatin1String("version")) {
@@ -27,6 +27,7 @@ void MediaExport::doExport(ExportTemplate& exportTemplate,
     switch (exportTemplate.templateEngine()) {
     case ExportEngine::Simple:
         SimpleEngine engine(exportTemplate, directory, m_canceled);
+        engine.setIncremental(m_incremental);
         connect(&engine, &SimpleEngine::sigItemExported, this, [&]() { emit sigItemExported(); });
 
         if (!m_canceled && sections.contains(ExportTemplate::ExportSection::Movies)) {
@@ -42,7 +43,7 @@ void MediaExport::doExport(ExportTemplate& exportTemplate,
         }
         return;
     }
-    qCCritical(generic) << "[MediaExport] Unknown template engine!";
+    qCCritical(c_export) << "[MediaExport] Unknown template engine!";
 }
 
 } // namespace mediaelch
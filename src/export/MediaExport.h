@@ -18,6 +18,10 @@ public:
     /// No cleanup is performed.
     explicit MediaExport(std::atomic_bool& cancelFlag, QObject* parent = nullptr);
 
+    /// If true, an existing export in the target directory is updated: Only changed
+    /// items are written and items that no longer exist are removed.
+    void setIncremental(bool incremental) { m_incremental = incremental; }
+
 signals:
     /// Signal is emitted each time an item is exported (e.g. image, generated HTML, etc.)
     /// Useful for progress bars.
@@ -30,6 +34,7 @@ public:
 
 private:
     std::atomic_bool& m_canceled;
+    bool m_incremental = false;
 };
 
 } // namespace mediaelch
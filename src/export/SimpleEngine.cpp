@@ -6,12 +6,24 @@
 #include "data/tv_show/TvShowEpisode.h"
 #include "globals/Manager.h"
 #include "log/Log.h"
+#include "media/ImageCache.h"
+#include "media/ImageUtils.h"
+#include "media/Path.h"
 #include "media/StreamDetails.h"
 
 #include <QApplication>
+#include <QCryptographicHash>
 #include <QEventLoop>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QMutexLocker>
+#include <QThread>
+#include <QtConcurrent>
+#include <algorithm>
 
-static QString colorLabelToString(ColorLabel label)
+namespace {
+
+QString colorLabelToString(ColorLabel label)
 {
     switch (label) {
     case ColorLabel::NoLabel: return "white";
@@ -26,460 +38,540 @@ static QString colorLabelToString(ColorLabel label)
     return "white";
 }
 
+/// Image placeholder type, e.g. "poster" in "{{ IMAGE.poster[200, 300] }}" and its exported format.
+struct ExportImageType
+{
+    const char* name;
+    ImageType imageType;
+    const char* suffix;
+};
+
+const QVector<ExportImageType>& movieImageTypes()
+{
+    static const QVector<ExportImageType> types{{"poster", ImageType::MoviePoster, "jpg"},
+        {"fanart", ImageType::MovieBackdrop, "jpg"},
+        {"logo", ImageType::MovieLogo, "png"},
+        {"clearart", ImageType::MovieClearArt, "png"},
+        {"disc", ImageType::MovieCdArt, "png"}};
+    return types;
+}
+
+const QVector<ExportImageType>& concertImageTypes()
+{
+    static const QVector<ExportImageType> types{{"poster", ImageType::ConcertPoster, "jpg"},
+        {"fanart", ImageType::ConcertBackdrop, "jpg"},
+        {"logo", ImageType::ConcertLogo, "png"},
+        {"clearart", ImageType::ConcertClearArt, "png"},
+        {"disc", ImageType::ConcertCdArt, "png"}};
+    return types;
+}
+
+const QVector<ExportImageType>& tvShowImageTypes()
+{
+    static const QVector<ExportImageType> types{{"poster", ImageType::TvShowPoster, "jpg"},
+        {"fanart", ImageType::TvShowBackdrop, "jpg"},
+        {"banner", ImageType::TvShowBanner, "jpg"},
+        {"logo", ImageType::TvShowLogos, "png"},
+        {"clearart", ImageType::TvShowClearArt, "png"},
+        {"characterart", ImageType::TvShowCharacterArt, "png"}};
+    return types;
+}
+
+const QVector<ExportImageType>& episodeImageTypes()
+{
+    static const QVector<ExportImageType> types{{"thumbnail", ImageType::TvShowEpisodeThumb, "jpg"}};
+    return types;
+}
+
+/// Add all images of the given item to the context that are used by the current templates.
+/// Images are looked up on the calling thread as the media center interface is not thread-safe.
+template<class T>
+void addImages(mediaelch::SimpleTemplateContext& context,
+    const T* item,
+    const QVector<ExportImageType>& types,
+    const QSet<QString>& usedTypes,
+    const QString& destinationBase,
+    const QString& typeName)
+{
+    for (const ExportImageType& type : types) {
+        const QString name = QString::fromLatin1(type.name);
+        if (!usedTypes.contains(name)) {
+            continue;
+        }
+        mediaelch::SimpleTemplateImage image;
+        image.sourceFile = Manager::instance()->mediaCenterInterface()->imageFileName(item, type.imageType);
+        image.destinationBase = QStringLiteral("%1-%2").arg(destinationBase, name);
+        image.suffix = QString::fromLatin1(type.suffix);
+        image.typeName = typeName;
+        context.setImage(name, image);
+    }
+}
+
+QString dateTimeString(const QDateTime& dateTime)
+{
+    return dateTime.isValid() ? dateTime.toString("yyyy-MM-dd hh:mm") : "";
+}
+
+QString plotString(const QString& plot)
+{
+    return plot.toHtmlEscaped().replace("\n", "<br />");
+}
+
+QString fileDir(const mediaelch::FileList& files)
+{
+    return files.isEmpty() ? "" : QFileInfo(files.first().toString()).absolutePath();
+}
+
+QString firstFile(const mediaelch::FileList& files)
+{
+    return files.isEmpty() ? "" : files.first().toString();
+}
+
+/// \brief Hash of the given key, e.g. an item's path.  The fallback is used for items without files.
+QString stableId(const QString& key, int fallbackId)
+{
+    return key.isEmpty() ? QString::number(fallbackId)
+                         : QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Md5).toHex();
+}
+
+bool isFormatOfSuffix(mediaelch::ImageHeader::Format format, const QString& fileName)
+{
+    const QString suffix = QFileInfo(fileName).suffix().toLower();
+    switch (format) {
+    case mediaelch::ImageHeader::Format::Jpeg: return suffix == "jpg" || suffix == "jpeg";
+    case mediaelch::ImageHeader::Format::Png: return suffix == "png";
+    case mediaelch::ImageHeader::Format::WebP: return suffix == "webp";
+    case mediaelch::ImageHeader::Format::Unknown: return false;
+    }
+    return false;
+}
+
+} // namespace
+
 namespace mediaelch {
 
 SimpleEngine::SimpleEngine(ExportTemplate& exportTemplate,
     QDir directory,
     std::atomic_bool& cancelFlag,
     QObject* parent) :
-    QObject(parent), m_cancelFlag{cancelFlag}, m_template{&exportTemplate}, m_dir{directory}
+    QObject(parent),
+    m_cancelFlag{cancelFlag},
+    m_template{&exportTemplate},
+    m_dir{directory},
+    m_exportPath{directory.path()},
+    m_imageCache{ImageCache::instance()}
 {
+    // Scaling images is CPU bound and each job holds a full-size image in memory.
+    m_imagePool.setMaxThreadCount(std::max(1, QThread::idealThreadCount()));
+
     // Create the base structure
     m_template->copyTo(mediaelch::DirectoryPath(m_dir));
 }
 
+SimpleEngine::~SimpleEngine()
+{
+    m_imagePool.waitForDone();
+}
+
+QString SimpleEngine::exportId(const Movie* movie)
+{
+    return stableId(firstFile(movie->files()), movie->movieId());
+}
+
+QString SimpleEngine::exportId(const TvShow* show)
+{
+    return stableId(show->dir().toString(), show->showId());
+}
+
+QString SimpleEngine::exportId(const TvShowEpisode* episode)
+{
+    // Multi-episode files contain several episodes, which all need their own page.
+    const QString file = firstFile(episode->files());
+    const QString key = file.isEmpty() ? QString()
+                                       : QStringLiteral("%1#S%2E%3")
+                                             .arg(file)
+                                             .arg(episode->seasonNumber().toInt())
+                                             .arg(episode->episodeNumber().toInt());
+    return stableId(key, episode->episodeId());
+}
+
+void SimpleEngine::setIncremental(bool incremental)
+{
+    if (!incremental) {
+        m_manifest.reset();
+        return;
+    }
+    m_manifest = std::make_unique<ExportManifest>(m_dir);
+    if (!m_manifest->load()) {
+        qCInfo(c_export) << "[Export][SimpleEngine] No previous export found; exporting all items";
+    }
+}
+
 void SimpleEngine::exportMovies(QVector<Movie*> movies)
 {
     std::sort(movies.begin(), movies.end(), Movie::lessThan);
-    QString listContent = m_template->getTemplate(ExportTemplate::ExportSection::Movies);
-    QString itemContent = m_template->getTemplate(ExportTemplate::ExportSection::Movie);
-
-    QString listMovieItem;
-    QString listMovieBlock;
-    QStringList movieList;
-    QRegularExpression rx(R"(\{\{ BEGIN_BLOCK_MOVIE \}\}(.*)\{\{ END_BLOCK_MOVIE \}\})", //
-        QRegularExpression::InvertedGreedinessOption | QRegularExpression::DotMatchesEverythingOption);
-
-    QRegularExpressionMatchIterator matches = rx.globalMatch(listContent);
-    while (matches.hasNext()) {
-        QRegularExpressionMatch match = matches.next();
-        listMovieBlock = match.captured(0);
-        listMovieItem = match.captured(1).trimmed();
-    }
+    const SimpleTemplate listTemplate =
+        SimpleTemplate::parse(m_template->getTemplate(ExportTemplate::ExportSection::Movies));
+    const SimpleTemplate itemTemplate =
+        SimpleTemplate::parse(m_template->getTemplate(ExportTemplate::ExportSection::Movie));
+    m_imageTypes = listTemplate.imageTypes() + itemTemplate.imageTypes();
 
     m_dir.mkdir("movies");
     m_dir.mkdir("movie_images");
 
+    QVector<Page> pages;
+    std::vector<SimpleTemplateContext> listItems;
+    pages.reserve(movies.size());
+    listItems.reserve(static_cast<std::size_t>(movies.size()));
+
     for (Movie* movie : movies) {
         if (m_cancelFlag.load()) {
             return;
         }
-
-        // We can't replace an empty block...
-        if (!listMovieItem.isEmpty()) {
-            QString m = listMovieItem;
-            replaceVars(m, movie);
-            movieList << m;
-        }
-
-        if (!itemContent.isEmpty()) {
-            QString movieTemplate = itemContent;
-            replaceVars(movieTemplate, movie, true);
-            QFile file(m_dir.path() + QStringLiteral("/movies/%1.html").arg(movie->movieId()));
-            if (file.open(QFile::WriteOnly | QFile::Text)) {
-                file.write(movieTemplate.toUtf8());
-                file.close();
-            }
-        }
-
-        emit sigItemExported();
-        QApplication::processEvents();
-    }
-
-    // If the movie block is empty, replacing it would result in add a line break after each character
-    if (!listMovieBlock.isEmpty()) {
-        listContent.replace(listMovieBlock, movieList.join("\n"));
+        Page page;
+        page.pageTemplate = &itemTemplate;
+        page.context = movieContext(movie);
+        page.fileName = QStringLiteral("movies/%1.html").arg(exportId(movie));
+        listItems.push_back(page.context);
+        pages.push_back(std::move(page));
     }
 
-    QFile file(m_dir.path() + "/movies.html");
-    if (file.open(QFile::WriteOnly | QFile::Text)) {
-        file.write(listContent.toUtf8());
-        file.close();
+    renderPages(pages);
+    if (!m_cancelFlag.load()) {
+        renderListPage(listTemplate, "MOVIE", std::move(listItems), "movies.html");
     }
+    waitForImages();
+    finishSection({"movies/", "movie_images/", "movies.html"});
 }
 
-void SimpleEngine::replaceVars(QString& m, Movie* movie, bool subDir)
-{
-    m.replace("{{ MOVIE.ID }}", QString::number(movie->movieId(), 'f', 0));
-    m.replace("{{ MOVIE.LINK }}", QString("movies/%1.html").arg(movie->movieId()));
-    m.replace("{{ MOVIE.IMDB_ID }}", movie->imdbId().toString());
-    m.replace("{{ MOVIE.TMDB_ID }}", movie->tmdbId().toString());
-    m.replace("{{ MOVIE.TITLE }}", movie->name().toHtmlEscaped());
-    m.replace("{{ MOVIE.YEAR }}", movie->released().isValid() ? movie->released().toString("yyyy") : "");
-    m.replace("{{ MOVIE.ORIGINAL_TITLE }}", movie->originalName().toHtmlEscaped());
-    m.replace("{{ MOVIE.PLOT }}", movie->overview().toHtmlEscaped().replace("\n", "<br />"));
-    m.replace("{{ MOVIE.PLOT_SIMPLE }}", movie->outline().toHtmlEscaped().replace("\n", "<br />"));
-    m.replace("{{ MOVIE.SET }}", movie->set().name.toHtmlEscaped());
-    m.replace("{{ MOVIE.TAGLINE }}", movie->tagline().toHtmlEscaped());
-    m.replace("{{ MOVIE.GENRES }}", movie->genres().join(", ").toHtmlEscaped());
-    m.replace("{{ MOVIE.COUNTRIES }}", movie->countries().join(", ").toHtmlEscaped());
-    m.replace("{{ MOVIE.STUDIOS }}", movie->studios().join(", ").toHtmlEscaped());
-    m.replace("{{ MOVIE.TAGS }}", movie->tags().join(", ").toHtmlEscaped());
-    m.replace("{{ MOVIE.WRITER }}", movie->writer().toHtmlEscaped());
-    m.replace("{{ MOVIE.DIRECTOR }}", movie->director().toHtmlEscaped());
-    m.replace("{{ MOVIE.CERTIFICATION }}", movie->certification().toString().toHtmlEscaped());
-    m.replace("{{ MOVIE.TRAILER }}", movie->trailer().toString());
-    m.replace("{{ MOVIE.LABEL }}", colorLabelToString(movie->label()));
+SimpleTemplateContext SimpleEngine::movieContext(Movie* movie)
+{
+    SimpleTemplateContext c;
+    const QString id = exportId(movie);
+    c.setVariable("MOVIE.ID", id);
+    c.setVariable("MOVIE.LINK", QString("movies/%1.html").arg(id));
+    c.setVariable("MOVIE.IMDB_ID", movie->imdbId().toString());
+    c.setVariable("MOVIE.TMDB_ID", movie->tmdbId().toString());
+    c.setVariable("MOVIE.TITLE", movie->name().toHtmlEscaped());
+    c.setVariable("MOVIE.YEAR", movie->released().isValid() ? movie->released().toString("yyyy") : "");
+    c.setVariable("MOVIE.ORIGINAL_TITLE", movie->originalName().toHtmlEscaped());
+    c.setVariable("MOVIE.PLOT", plotString(movie->overview()));
+    c.setVariable("MOVIE.PLOT_SIMPLE", plotString(movie->outline()));
+    c.setVariable("MOVIE.SET", movie->set().name.toHtmlEscaped());
+    c.setVariable("MOVIE.TAGLINE", movie->tagline().toHtmlEscaped());
+    c.setVariable("MOVIE.GENRES", movie->genres().join(", ").toHtmlEscaped());
+    c.setVariable("MOVIE.COUNTRIES", movie->countries().join(", ").toHtmlEscaped());
+    c.setVariable("MOVIE.STUDIOS", movie->studios().join(", ").toHtmlEscaped());
+    c.setVariable("MOVIE.TAGS", movie->tags().join(", ").toHtmlEscaped());
+    c.setVariable("MOVIE.WRITER", movie->writer().toHtmlEscaped());
+    c.setVariable("MOVIE.DIRECTOR", movie->director().toHtmlEscaped());
+    c.setVariable("MOVIE.CERTIFICATION", movie->certification().toString().toHtmlEscaped());
+    c.setVariable("MOVIE.TRAILER", movie->trailer().toString());
+    c.setVariable("MOVIE.LABEL", colorLabelToString(movie->label()));
 
     // \todo multiple ratings
     if (!movie->ratings().isEmpty()) {
         double rating = movie->ratings().first().rating;
         int voteCount = movie->ratings().first().voteCount;
-        m.replace("{{ MOVIE.RATING }}", QString::number(rating, 'f', 1));
-        m.replace("{{ MOVIE.VOTES }}", QString::number(voteCount, 'f', 0));
+        c.setVariable("MOVIE.RATING", QString::number(rating, 'f', 1));
+        c.setVariable("MOVIE.VOTES", QString::number(voteCount, 'f', 0));
     } else {
-        m.replace("{{ MOVIE.RATING }}", "n/a");
-        m.replace("{{ MOVIE.VOTES }}", "n/a");
+        c.setVariable("MOVIE.RATING", "n/a");
+        c.setVariable("MOVIE.VOTES", "n/a");
     }
 
-    m.replace("{{ MOVIE.RUNTIME }}", QString::number(static_cast<double>(movie->runtime().count()), 'f', 0));
-    m.replace("{{ MOVIE.PLAY_COUNT }}", QString::number(movie->playcount(), 'f', 0));
-    m.replace("{{ MOVIE.LAST_PLAYED }}",
-        movie->lastPlayed().isValid() ? movie->lastPlayed().toString("yyyy-MM-dd hh:mm") : "");
-    m.replace(
-        "{{ MOVIE.DATE_ADDED }}", movie->dateAdded().isValid() ? movie->dateAdded().toString("yyyy-MM-dd hh:mm") : "");
-    m.replace("{{ MOVIE.FILE_LAST_MODIFIED }}",
-        movie->fileLastModified().isValid() ? movie->fileLastModified().toString("yyyy-MM-dd hh:mm") : "");
-    m.replace("{{ MOVIE.FILENAME }}", (!movie->files().isEmpty()) ? movie->files().first().toString() : "");
-    if (!movie->files().isEmpty()) {
-        QFileInfo fi(movie->files().first().toString());
-        m.replace("{{ MOVIE.DIR }}", fi.absolutePath());
-    } else {
-        m.replace("{{ MOVIE.DIR }}", "");
-    }
+    c.setVariable("MOVIE.RUNTIME", QString::number(static_cast<double>(movie->runtime().count()), 'f', 0));
+    c.setVariable("MOVIE.PLAY_COUNT", QString::number(movie->playcount(), 'f', 0));
+    c.setVariable("MOVIE.LAST_PLAYED", dateTimeString(movie->lastPlayed()));
+    c.setVariable("MOVIE.DATE_ADDED", dateTimeString(movie->dateAdded()));
+    c.setVariable("MOVIE.FILE_LAST_MODIFIED", dateTimeString(movie->fileLastModified()));
+    c.setVariable("MOVIE.FILENAME", firstFile(movie->files()));
+    c.setVariable("MOVIE.DIR", fileDir(movie->files()));
 
-    replaceSingleBlock(m, "TAGS", "TAG.NAME", movie->tags());
-    replaceSingleBlock(m, "GENRES", "GENRE.NAME", movie->genres());
-    replaceSingleBlock(m, "COUNTRIES", "COUNTRY.NAME", movie->countries());
-    replaceSingleBlock(m, "STUDIOS", "STUDIO.NAME", movie->studios());
+    c.setListBlock("TAGS", "TAG.NAME", movie->tags());
+    c.setListBlock("GENRES", "GENRE.NAME", movie->genres());
+    c.setListBlock("COUNTRIES", "COUNTRY.NAME", movie->countries());
+    c.setListBlock("STUDIOS", "STUDIO.NAME", movie->studios());
 
-    QStringList actorNames;
-    QStringList actorRoles;
+    std::vector<SimpleTemplateContext> actors;
     for (const Actor* actor : movie->actors()) {
-        actorNames << actor->name;
-        actorRoles << actor->role;
-    }
-    replaceMultiBlock(m, "ACTORS", {"ACTOR.NAME", "ACTOR.ROLE"}, QVector<QStringList>() << actorNames << actorRoles);
-
-    replaceStreamDetailsVars(m, movie->streamDetails());
-    replaceImages(m, subDir, movie);
+        SimpleTemplateContext a;
+        a.setVariable("ACTOR.NAME", actor->name.toHtmlEscaped());
+        a.setVariable("ACTOR.ROLE", actor->role.toHtmlEscaped());
+        actors.push_back(std::move(a));
+    }
+    c.setBlock("ACTORS", std::move(actors));
+
+    addStreamDetails(c, movie->streamDetails());
+    addImages(c,
+        movie,
+        movieImageTypes(),
+        m_imageTypes,
+        QStringLiteral("movie_images/%1").arg(id),
+        QStringLiteral("movie"));
+    return c;
 }
 
 void SimpleEngine::exportConcerts(QVector<Concert*> concerts)
 {
     std::sort(concerts.begin(), concerts.end(), Concert::lessThan);
-    QString listContent = m_template->getTemplate(ExportTemplate::ExportSection::Concerts);
-    QString itemContent = m_template->getTemplate(ExportTemplate::ExportSection::Concert);
-
-    QString listConcertItem;
-    QString listConcertBlock;
-    QStringList concertList;
-    QRegularExpression rx(R"(\{\{ BEGIN_BLOCK_CONCERT \}\}(.*)\{\{ END_BLOCK_CONCERT \}\})", //
-        QRegularExpression::InvertedGreedinessOption | QRegularExpression::DotMatchesEverythingOption);
-
-    QRegularExpressionMatchIterator matches = rx.globalMatch(listContent);
-    while (matches.hasNext()) {
-        QRegularExpressionMatch match = matches.next();
-        listConcertBlock = match.captured(0);
-        listConcertItem = match.captured(1).trimmed();
-    }
+    const SimpleTemplate listTemplate =
+        SimpleTemplate::parse(m_template->getTemplate(ExportTemplate::ExportSection::Concerts));
+    const SimpleTemplate itemTemplate =
+        SimpleTemplate::parse(m_template->getTemplate(ExportTemplate::ExportSection::Concert));
+    m_imageTypes = listTemplate.imageTypes() + itemTemplate.imageTypes();
 
     m_dir.mkdir("concerts");
     m_dir.mkdir("concert_images");
 
-    int counter = 0;
+    QVector<Page> pages;
+    std::vector<SimpleTemplateContext> listItems;
+    pages.reserve(concerts.size());
+    listItems.reserve(static_cast<std::size_t>(concerts.size()));
 
+    int counter = 0;
     for (const Concert* concert : concerts) {
         if (m_cancelFlag.load()) {
             return;
         }
-
-        QString concertTemplate = itemContent;
-        replaceVars(concertTemplate, concert, QString::number(counter), true);
-        QFile file(m_dir.path() + QString("/concerts/%1.html").arg(counter));
-        if (file.open(QFile::WriteOnly | QFile::Text)) {
-            file.write(concertTemplate.toUtf8());
-            file.close();
-        }
-
-        QString c = listConcertItem;
-        replaceVars(c, concert, QString::number(counter));
-        concertList << c;
-        emit sigItemExported();
-        QApplication::processEvents();
+        const QString id = stableId(firstFile(concert->files()), counter++);
+        Page page;
+        page.pageTemplate = &itemTemplate;
+        page.context = concertContext(concert, id);
+        page.fileName = QStringLiteral("concerts/%1.html").arg(id);
+        listItems.push_back(page.context);
+        pages.push_back(std::move(page));
     }
 
-    listContent.replace(listConcertBlock, concertList.join("\n"));
-
-    QFile file(m_dir.path() + "/concerts.html");
-    if (file.open(QFile::WriteOnly | QFile::Text)) {
-        file.write(listContent.toUtf8());
-        file.close();
+    renderPages(pages);
+    if (!m_cancelFlag.load()) {
+        renderListPage(listTemplate, "CONCERT", std::move(listItems), "concerts.html");
     }
+    waitForImages();
+    finishSection({"concerts/", "concert_images/", "concerts.html"});
 }
 
-void SimpleEngine::replaceVars(QString& m, const Concert* concert, const QString& id, bool subDir)
+SimpleTemplateContext SimpleEngine::concertContext(const Concert* concert, const QString& id)
 {
-    m.replace("{{ CONCERT.ID }}", id);
-    m.replace("{{ CONCERT.LINK }}", QString("concerts/%1.html").arg(id));
-    m.replace("{{ CONCERT.TITLE }}", concert->title().toHtmlEscaped());
-    m.replace("{{ CONCERT.ARTIST }}", concert->artist().toHtmlEscaped());
-    m.replace("{{ CONCERT.ALBUM }}", concert->album().toHtmlEscaped());
-    m.replace("{{ CONCERT.TAGLINE }}", concert->tagline().toHtmlEscaped());
+    SimpleTemplateContext c;
+    c.setVariable("CONCERT.ID", id);
+    c.setVariable("CONCERT.LINK", QString("concerts/%1.html").arg(id));
+    c.setVariable("CONCERT.TITLE", concert->title().toHtmlEscaped());
+    c.setVariable("CONCERT.ARTIST", concert->artist().toHtmlEscaped());
+    c.setVariable("CONCERT.ALBUM", concert->album().toHtmlEscaped());
+    c.setVariable("CONCERT.TAGLINE", concert->tagline().toHtmlEscaped());
 
     if (concert->ratings().isEmpty()) {
-        m.replace("{{ CONCERT.RATING }}", "n/a");
-    } else {
-        m.replace("{{ CONCERT.RATING }}", QString::number(concert->ratings().first().rating, 'f', 1));
-    }
-
-    m.replace("{{ CONCERT.YEAR }}", concert->released().isValid() ? concert->released().toString("yyyy") : "");
-    m.replace("{{ CONCERT.RUNTIME }}", QString::number(static_cast<double>(concert->runtime().count()), 'f', 0));
-    m.replace("{{ CONCERT.CERTIFICATION }}", concert->certification().toString().toHtmlEscaped());
-    m.replace("{{ CONCERT.TRAILER }}", concert->trailer().toString());
-    m.replace("{{ CONCERT.PLAY_COUNT }}", QString::number(concert->playcount(), 'f', 0));
-    m.replace("{{ CONCERT.LAST_PLAYED }}",
-        concert->lastPlayed().isValid() ? concert->lastPlayed().toString("yyyy-MM-dd hh:mm") : "");
-    m.replace("{{ CONCERT.FILE_LAST_MODIFIED }}",
-        concert->lastModified().isValid() ? concert->lastModified().toString("yyyy-MM-dd hh:mm") : "");
-
-    m.replace("{{ CONCERT.FILENAME }}", (!concert->files().isEmpty()) ? concert->files().first().toString() : "");
-    if (!concert->files().isEmpty()) {
-        QFileInfo fi(concert->files().first().toString());
-        m.replace("{{ CONCERT.DIR }}", fi.absolutePath());
+        c.setVariable("CONCERT.RATING", "n/a");
     } else {
-        m.replace("{{ CONCERT.DIR }}", "");
-    }
-
-    m.replace("{{ CONCERT.PLOT }}", concert->overview().toHtmlEscaped().replace("\n", "<br />"));
-    m.replace("{{ CONCERT.TAGS }}", concert->tags().join(", ").toHtmlEscaped());
-    m.replace("{{ CONCERT.GENRES }}", concert->genres().join(", ").toHtmlEscaped());
-
-    replaceStreamDetailsVars(m, concert->streamDetails());
-    replaceSingleBlock(m, "TAGS", "TAG.NAME", concert->tags());
-    replaceSingleBlock(m, "GENRES", "GENRE.NAME", concert->genres());
-    replaceImages(m, subDir, concert, id);
+        c.setVariable("CONCERT.RATING", QString::number(concert->ratings().first().rating, 'f', 1));
+    }
+
+    c.setVariable("CONCERT.YEAR", concert->released().isValid() ? concert->released().toString("yyyy") : "");
+    c.setVariable("CONCERT.RUNTIME", QString::number(static_cast<double>(concert->runtime().count()), 'f', 0));
+    c.setVariable("CONCERT.CERTIFICATION", concert->certification().toString().toHtmlEscaped());
+    c.setVariable("CONCERT.TRAILER", concert->trailer().toString());
+    c.setVariable("CONCERT.PLAY_COUNT", QString::number(concert->playcount(), 'f', 0));
+    c.setVariable("CONCERT.LAST_PLAYED", dateTimeString(concert->lastPlayed()));
+    c.setVariable("CONCERT.FILE_LAST_MODIFIED", dateTimeString(concert->lastModified()));
+    c.setVariable("CONCERT.FILENAME", firstFile(concert->files()));
+    c.setVariable("CONCERT.DIR", fileDir(concert->files()));
+    c.setVariable("CONCERT.PLOT", plotString(concert->overview()));
+    c.setVariable("CONCERT.TAGS", concert->tags().join(", ").toHtmlEscaped());
+    c.setVariable("CONCERT.GENRES", concert->genres().join(", ").toHtmlEscaped());
+
+    addStreamDetails(c, concert->streamDetails());
+    c.setListBlock("TAGS", "TAG.NAME", concert->tags());
+    c.setListBlock("GENRES", "GENRE.NAME", concert->genres());
+    addImages(c,
+        concert,
+        concertImageTypes(),
+        m_imageTypes,
+        QStringLiteral("concert_images/%1").arg(id),
+        QStringLiteral("concert"));
+    return c;
 }
 
 void SimpleEngine::exportTvShows(QVector<TvShow*> shows)
 {
     std::sort(shows.begin(), shows.end(), TvShow::lessThan);
-    QString listContent = m_template->getTemplate(ExportTemplate::ExportSection::TvShows);
-    QString itemContent = m_template->getTemplate(ExportTemplate::ExportSection::TvShow);
-    QString episodeContent = m_template->getTemplate(ExportTemplate::ExportSection::Episode);
-
-    QString listTvShowItem;
-    QString listTvShowBlock;
-    QStringList tvShowList;
-    QRegularExpression rx(R"(\{\{ BEGIN_BLOCK_TVSHOW \}\}(.*)\{\{ END_BLOCK_TVSHOW \}\})", //
-        QRegularExpression::InvertedGreedinessOption | QRegularExpression::DotMatchesEverythingOption);
-
-    QRegularExpressionMatchIterator matches = rx.globalMatch(listContent);
-    while (matches.hasNext()) {
-        QRegularExpressionMatch match = matches.next();
-        listTvShowBlock = match.captured(0);
-        listTvShowItem = match.captured(1).trimmed();
-    }
+    const SimpleTemplate listTemplate =
+        SimpleTemplate::parse(m_template->getTemplate(ExportTemplate::ExportSection::TvShows));
+    const SimpleTemplate itemTemplate =
+        SimpleTemplate::parse(m_template->getTemplate(ExportTemplate::ExportSection::TvShow));
+    const SimpleTemplate episodeTemplate =
+        SimpleTemplate::parse(m_template->getTemplate(ExportTemplate::ExportSection::Episode));
+    m_imageTypes = listTemplate.imageTypes() + itemTemplate.imageTypes() + episodeTemplate.imageTypes();
+
+    // Seasons are only needed if any template lists them.
+    const bool withSeasons = listTemplate.hasBlock("SEASON") || itemTemplate.hasBlock("SEASON");
 
     m_dir.mkdir("tvshows");
     m_dir.mkdir("tvshow_images");
     m_dir.mkdir("episodes");
     m_dir.mkdir("episode_images");
 
-    for (TvShow* show : shows) {
+    QVector<Page> pages;
+    std::vector<SimpleTemplateContext> listItems;
+    listItems.reserve(static_cast<std::size_t>(shows.size()));
+
+    for (const TvShow* show : shows) {
         if (m_cancelFlag.load()) {
             return;
         }
 
         // tvshow.html - Single TV show
-        {
-            QString showTemplate = itemContent;
-            replaceVars(showTemplate, show, true);
-            QFile file(m_dir.path() + QString("/tvshows/%1.html").arg(show->showId()));
-            if (file.open(QFile::WriteOnly | QFile::Text)) {
-                file.write(showTemplate.toUtf8());
-                file.close();
-            }
-            QApplication::processEvents();
-        }
+        Page page;
+        page.pageTemplate = &itemTemplate;
+        page.context = tvShowContext(show, withSeasons);
+        page.fileName = QStringLiteral("tvshows/%1.html").arg(exportId(show));
 
         // tvshows.html - All TV shows listed
-        {
-            QString showBlock = listTvShowItem;
-            replaceVars(showBlock, show, false);
-            tvShowList << showBlock;
-            emit sigItemExported();
-            QApplication::processEvents();
-        }
+        listItems.push_back(page.context);
+        pages.push_back(std::move(page));
 
         // episode.html - Single episode
-        for (TvShowEpisode* episode : show->episodes()) {
+        for (const TvShowEpisode* episode : show->episodes()) {
             if (episode->isDummy()) {
                 continue;
             }
-            QString episodeTemplate = episodeContent;
-            replaceVars(episodeTemplate, episode, true);
-            QFile file(m_dir.path() + QString("/episodes/%1.html").arg(episode->episodeId()));
-            if (file.open(QFile::WriteOnly | QFile::Text)) {
-                file.write(episodeTemplate.toUtf8());
-                file.close();
-            }
-            emit sigItemExported();
-            QApplication::processEvents();
+            Page episodePage;
+            episodePage.pageTemplate = &episodeTemplate;
+            episodePage.context = episodeContext(episode);
+            episodePage.fileName = QStringLiteral("episodes/%1.html").arg(exportId(episode));
+            pages.push_back(std::move(episodePage));
         }
     }
 
-    listContent.replace(listTvShowBlock, tvShowList.join("\n"));
-
-    QFile file(m_dir.path() + "/tvshows.html");
-    if (file.open(QFile::WriteOnly | QFile::Text)) {
-        file.write(listContent.toUtf8());
-        file.close();
+    renderPages(pages);
+    if (!m_cancelFlag.load()) {
+        renderListPage(listTemplate, "TVSHOW", std::move(listItems), "tvshows.html");
     }
+    waitForImages();
+    finishSection({"tvshows/", "tvshow_images/", "episodes/", "episode_images/", "tvshows.html"});
 }
 
-void SimpleEngine::replaceVars(QString& m, const TvShow* show, bool subDir)
+SimpleTemplateContext SimpleEngine::tvShowContext(const TvShow* show, bool withSeasons)
 {
-    m.replace("{{ TVSHOW.ID }}", QString::number(show->showId(), 'f', 0));
-    m.replace("{{ TVSHOW.LINK }}", QString("tvshows/%1.html").arg(show->showId()));
-    m.replace("{{ TVSHOW.IMDB_ID }}", show->imdbId().toString());
-    m.replace("{{ TVSHOW.TITLE }}", show->title().toHtmlEscaped());
-    m.replace("{{ TVSHOW.SORTTITLE }}", show->sortTitle().toHtmlEscaped());
-    m.replace("{{ TVSHOW.ORIGINALTITLE }}", show->originalTitle().toHtmlEscaped());
+    SimpleTemplateContext c;
+    const QString id = exportId(show);
+    c.setVariable("TVSHOW.ID", id);
+    c.setVariable("TVSHOW.LINK", QString("tvshows/%1.html").arg(id));
+    c.setVariable("TVSHOW.IMDB_ID", show->imdbId().toString());
+    c.setVariable("TVSHOW.TITLE", show->title().toHtmlEscaped());
+    c.setVariable("TVSHOW.SORTTITLE", show->sortTitle().toHtmlEscaped());
+    c.setVariable("TVSHOW.ORIGINALTITLE", show->originalTitle().toHtmlEscaped());
 
     // \todo multiple ratings
     if (!show->ratings().isEmpty()) {
         double rating = show->ratings().first().rating;
         int voteCount = show->ratings().first().voteCount;
-        m.replace("{{ TVSHOW.RATING }}", QString::number(rating, 'f', 1));
-        m.replace("{{ TVSHOW.VOTES }}", QString::number(voteCount, 'f', 0));
+        c.setVariable("TVSHOW.RATING", QString::number(rating, 'f', 1));
+        c.setVariable("TVSHOW.VOTES", QString::number(voteCount, 'f', 0));
     } else {
-        m.replace("{{ TVSHOW.RATING }}", "n/a");
-        m.replace("{{ TVSHOW.VOTES }}", "n/a");
-    }
-
-    m.replace("{{ TVSHOW.CERTIFICATION }}", show->certification().toString().toHtmlEscaped());
-    m.replace(
-        "{{ TVSHOW.FIRST_AIRED }}", show->firstAired().isValid() ? show->firstAired().toString("yyyy-MM-dd") : "");
-    m.replace("{{ TVSHOW.STUDIO }}", show->network().toHtmlEscaped());
-    m.replace("{{ TVSHOW.PLOT }}", show->overview().toHtmlEscaped().replace("\n", "<br />"));
-    m.replace("{{ TVSHOW.TAGS }}", show->tags().join(", ").toHtmlEscaped());
-    m.replace("{{ TVSHOW.GENRES }}", show->genres().join(", ").toHtmlEscaped());
-    m.replace("{{ TVSHOW.SEASONS_AMOUNT }}", QString::number(show->seasons(false).size()));
-
-    QStringList actorNames;
-    QStringList actorRoles;
-    for (const Actor* actor : show->actors()) {
-        actorNames << actor->name;
-        actorRoles << actor->role;
+        c.setVariable("TVSHOW.RATING", "n/a");
+        c.setVariable("TVSHOW.VOTES", "n/a");
     }
-    replaceMultiBlock(m, "ACTORS", {"ACTOR.NAME", "ACTOR.ROLE"}, {actorNames, actorRoles});
-    replaceSingleBlock(m, "TAGS", "TAG.NAME", show->tags());
-    replaceSingleBlock(m, "GENRES", "GENRE.NAME", show->genres());
 
-    QString listSeasonItem;
-    QString listSeasonBlock;
-    QStringList seasonList;
-
-    QRegularExpression rx(R"(\{\{ BEGIN_BLOCK_SEASON \}\}(.*)\{\{ END_BLOCK_SEASON \}\})", //
-        QRegularExpression::InvertedGreedinessOption | QRegularExpression::DotMatchesEverythingOption);
-
-    {
-        QRegularExpressionMatchIterator matches = rx.globalMatch(m);
-        while (matches.hasNext()) {
-            QRegularExpressionMatch match = matches.next();
-            listSeasonBlock = match.captured(0);
-            listSeasonItem = match.captured(1).trimmed();
-        }
-    }
-
-    if (listSeasonBlock.isEmpty() || listSeasonItem.isEmpty()) {
-        replaceImages(m, subDir, show);
-        return;
-    }
+    c.setVariable("TVSHOW.CERTIFICATION", show->certification().toString().toHtmlEscaped());
+    c.setVariable(
+        "TVSHOW.FIRST_AIRED", show->firstAired().isValid() ? show->firstAired().toString("yyyy-MM-dd") : "");
+    c.setVariable("TVSHOW.STUDIO", show->network().toHtmlEscaped());
+    c.setVariable("TVSHOW.PLOT", plotString(show->overview()));
+    c.setVariable("TVSHOW.TAGS", show->tags().join(", ").toHtmlEscaped());
+    c.setVariable("TVSHOW.GENRES", show->genres().join(", ").toHtmlEscaped());
 
     QVector<SeasonNumber> seasons = show->seasons(false);
-    std::sort(seasons.begin(), seasons.end());
-    for (const SeasonNumber& season : asConst(seasons)) {
-        QVector<TvShowEpisode*> episodes = show->episodes(season);
-        std::sort(episodes.begin(), episodes.end(), TvShowEpisode::lessThan);
-        QString s = listSeasonItem;
-        s.replace("{{ SEASON }}", season.toString());
-
-        QString listEpisodeItem;
-        QString listEpisodeBlock;
-        QStringList episodeList;
-
-        rx.setPattern(R"(\{\{ BEGIN_BLOCK_EPISODE \}\}(.*)\{\{ END_BLOCK_EPISODE \}\})");
-        QRegularExpressionMatchIterator matches = rx.globalMatch(s);
-        while (matches.hasNext()) {
-            QRegularExpressionMatch match = matches.next();
-            listEpisodeBlock = match.captured(0);
-            listEpisodeItem = match.captured(1).trimmed();
-        }
+    c.setVariable("TVSHOW.SEASONS_AMOUNT", QString::number(seasons.size()));
 
-        if (!listEpisodeItem.isEmpty()) {
-            for (TvShowEpisode* episode : asConst(episodes)) {
-                QString e = listEpisodeItem;
-                replaceVars(e, episode, subDir);
-                episodeList << e;
+    std::vector<SimpleTemplateContext> actors;
+    for (const Actor* actor : show->actors()) {
+        SimpleTemplateContext a;
+        a.setVariable("ACTOR.NAME", actor->name.toHtmlEscaped());
+        a.setVariable("ACTOR.ROLE", actor->role.toHtmlEscaped());
+        actors.push_back(std::move(a));
+    }
+    c.setBlock("ACTORS", std::move(actors));
+    c.setListBlock("TAGS", "TAG.NAME", show->tags());
+    c.setListBlock("GENRES", "GENRE.NAME", show->genres());
+
+    if (withSeasons) {
+        std::sort(seasons.begin(), seasons.end());
+        std::vector<SimpleTemplateContext> seasonItems;
+        for (const SeasonNumber& season : asConst(seasons)) {
+            QVector<TvShowEpisode*> episodes = show->episodes(season);
+            std::sort(episodes.begin(), episodes.end(), TvShowEpisode::lessThan);
+
+            std::vector<SimpleTemplateContext> episodeItems;
+            for (const TvShowEpisode* episode : asConst(episodes)) {
+                episodeItems.push_back(episodeContext(episode));
             }
+
+            SimpleTemplateContext s;
+            s.setVariable("SEASON", season.toString());
+            s.setBlock("EPISODE", std::move(episodeItems), "\n");
+            seasonItems.push_back(std::move(s));
         }
-        s.replace(listEpisodeBlock, episodeList.join("\n"));
-        seasonList << s;
+        c.setBlock("SEASON", std::move(seasonItems), "\n");
     }
 
-    m.replace(listSeasonBlock, seasonList.join("\n"));
-    replaceImages(m, subDir, show);
+    addImages(c,
+        show,
+        tvShowImageTypes(),
+        m_imageTypes,
+        QStringLiteral("tvshow_images/%1").arg(id),
+        QStringLiteral("tvshow"));
+    return c;
 }
 
-void SimpleEngine::replaceVars(QString& m, const TvShowEpisode* episode, bool subDir)
+SimpleTemplateContext SimpleEngine::episodeContext(const TvShowEpisode* episode)
 {
-    m.replace("{{ SHOW.TITLE }}", episode->tvShow()->title().toHtmlEscaped());
-    m.replace("{{ SHOW.LINK }}", QString("../tvshows/%1.html").arg(episode->tvShow()->showId()));
-    m.replace("{{ EPISODE.LINK }}", QString("../episodes/%1.html").arg(episode->episodeId()));
-    m.replace("{{ EPISODE.TITLE }}", episode->title().toHtmlEscaped());
-    m.replace("{{ EPISODE.SEASON }}", episode->seasonString().toHtmlEscaped());
-    m.replace("{{ EPISODE.EPISODE }}", episode->episodeString().toHtmlEscaped());
+    SimpleTemplateContext c;
+    const QString id = exportId(episode);
+    c.setVariable("SHOW.TITLE", episode->tvShow()->title().toHtmlEscaped());
+    c.setVariable("SHOW.LINK", QString("../tvshows/%1.html").arg(exportId(episode->tvShow())));
+    c.setVariable("EPISODE.LINK", QString("../episodes/%1.html").arg(id));
+    c.setVariable("EPISODE.TITLE", episode->title().toHtmlEscaped());
+    c.setVariable("EPISODE.SEASON", episode->seasonString().toHtmlEscaped());
+    c.setVariable("EPISODE.EPISODE", episode->episodeString().toHtmlEscaped());
     if (episode->ratings().isEmpty()) {
-        m.replace("{{ EPISODE.RATING }}", "n/a");
+        c.setVariable("EPISODE.RATING", "n/a");
     } else {
-        m.replace("{{ EPISODE.RATING }}", QString::number(episode->ratings().first().rating, 'f', 1));
+        c.setVariable("EPISODE.RATING", QString::number(episode->ratings().first().rating, 'f', 1));
     }
-    m.replace("{{ EPISODE.CERTIFICATION }}", episode->certification().toString().toHtmlEscaped());
-    m.replace("{{ EPISODE.FIRST_AIRED }}",
+    c.setVariable("EPISODE.CERTIFICATION", episode->certification().toString().toHtmlEscaped());
+    c.setVariable("EPISODE.FIRST_AIRED",
         episode->firstAired().isValid() ? episode->firstAired().toString("yyyy-MM-dd") : "");
-    m.replace("{{ EPISODE.LAST_PLAYED }}",
-        episode->lastPlayed().isValid() ? episode->lastPlayed().toString("yyyy-MM-dd hh:mm") : "");
-    m.replace("{{ EPISODE.STUDIO }}", episode->network().toHtmlEscaped());
-    m.replace("{{ EPISODE.PLOT }}", episode->overview().toHtmlEscaped().replace("\n", "<br />"));
-    m.replace("{{ EPISODE.WRITERS }}", episode->writers().join(", ").toHtmlEscaped());
-    m.replace("{{ EPISODE.DIRECTORS }}", episode->directors().join(", ").toHtmlEscaped());
-
-    if (!episode->files().isEmpty()) {
-        QFileInfo fi(episode->files().first().toString());
-        m.replace("{{ EPISODE.DIR }}", fi.absolutePath());
-    } else {
-        m.replace("{{ EPISODE.DIR }}", "");
-    }
-    m.replace("{{ EPISODE.FILENAME }}", (!episode->files().isEmpty()) ? episode->files().first().toString() : "");
-
-    replaceStreamDetailsVars(m, episode->streamDetails());
-    replaceSingleBlock(m, "WRITERS", "WRITER.NAME", episode->writers());
-    replaceSingleBlock(m, "DIRECTORS", "DIRECTOR.NAME", episode->directors());
-    replaceImages(m, subDir, episode);
+    c.setVariable("EPISODE.LAST_PLAYED", dateTimeString(episode->lastPlayed()));
+    c.setVariable("EPISODE.STUDIO", episode->network().toHtmlEscaped());
+    c.setVariable("EPISODE.PLOT", plotString(episode->overview()));
+    c.setVariable("EPISODE.WRITERS", episode->writers().join(", ").toHtmlEscaped());
+    c.setVariable("EPISODE.DIRECTORS", episode->directors().join(", ").toHtmlEscaped());
+    c.setVariable("EPISODE.DIR", fileDir(episode->files()));
+    c.setVariable("EPISODE.FILENAME", firstFile(episode->files()));
+
+    addStreamDetails(c, episode->streamDetails());
+    c.setListBlock("WRITERS", "WRITER.NAME", episode->writers());
+    c.setListBlock("DIRECTORS", "DIRECTOR.NAME", episode->directors());
+    addImages(c,
+        episode,
+        episodeImageTypes(),
+        m_imageTypes,
+        QStringLiteral("episode_images/%1").arg(id),
+        QStringLiteral("episode"));
+    return c;
 }
 
-void SimpleEngine::replaceStreamDetailsVars(QString& m, const StreamDetails* details)
+void SimpleEngine::addStreamDetails(SimpleTemplateContext& c, const StreamDetails* details)
 {
     const auto videoDetails = (details != nullptr) ? details->videoDetails() : decltype(details->videoDetails()){};
     const auto audioDetails = (details != nullptr) ? details->audioDetails() : decltype(details->audioDetails()){};
 
-    m.replace("{{ FILEINFO.WIDTH }}", videoDetails.value(StreamDetails::VideoDetails::Width, "0"));
-    m.replace("{{ FILEINFO.HEIGHT }}", videoDetails.value(StreamDetails::VideoDetails::Height, "0"));
-    m.replace("{{ FILEINFO.ASPECT }}", videoDetails.value(StreamDetails::VideoDetails::Aspect, "0"));
-    m.replace("{{ FILEINFO.CODEC }}", videoDetails.value(StreamDetails::VideoDetails::Codec, ""));
-    m.replace("{{ FILEINFO.DURATION }}", videoDetails.value(StreamDetails::VideoDetails::DurationInSeconds, "0"));
+    c.setVariable("FILEINFO.WIDTH", videoDetails.value(StreamDetails::VideoDetails::Width, "0"));
+    c.setVariable("FILEINFO.HEIGHT", videoDetails.value(StreamDetails::VideoDetails::Height, "0"));
+    c.setVariable("FILEINFO.ASPECT", videoDetails.value(StreamDetails::VideoDetails::Aspect, "0"));
+    c.setVariable("FILEINFO.CODEC", videoDetails.value(StreamDetails::VideoDetails::Codec, ""));
+    c.setVariable("FILEINFO.DURATION", videoDetails.value(StreamDetails::VideoDetails::DurationInSeconds, "0"));
 
     QStringList audioCodecs;
     QStringList audioChannels;
@@ -489,9 +581,9 @@ void SimpleEngine::replaceStreamDetailsVars(QString& m, const StreamDetails* det
         audioChannels << audioDetails.at(i).value(StreamDetails::AudioDetails::Channels);
         audioLanguages << audioDetails.at(i).value(StreamDetails::AudioDetails::Language);
     }
-    m.replace("{{ FILEINFO.AUDIO.CODEC }}", audioCodecs.join("|"));
-    m.replace("{{ FILEINFO.AUDIO.CHANNELS }}", audioChannels.join("|"));
-    m.replace("{{ FILEINFO.AUDIO.LANGUAGE }}", audioLanguages.join("|"));
+    c.setVariable("FILEINFO.AUDIO.CODEC", audioCodecs.join("|"));
+    c.setVariable("FILEINFO.AUDIO.CHANNELS", audioChannels.join("|"));
+    c.setVariable("FILEINFO.AUDIO.LANGUAGE", audioLanguages.join("|"));
 
     QStringList subtitleLanguages;
     if (details != nullptr) {
@@ -499,306 +591,133 @@ void SimpleEngine::replaceStreamDetailsVars(QString& m, const StreamDetails* det
             subtitleLanguages << subtitle.value(StreamDetails::SubtitleDetails::Language);
         }
     }
-    m.replace("{{ FILEINFO.SUBTITLES.LANGUAGE }}", subtitleLanguages.join("|"));
-}
-
-void SimpleEngine::replaceSingleBlock(QString& m, QString blockName, QString itemName, QStringList replaces)
-{
-    replaceMultiBlock(m, blockName, QStringList() << itemName, QVector<QStringList>() << replaces);
-}
-
-void SimpleEngine::replaceMultiBlock(QString& m,
-    QString blockName,
-    QStringList itemNames,
-    QVector<QStringList> replaces)
-{
-    QRegularExpression rx("\\{\\{ BEGIN_BLOCK_" + blockName + R"( \}\}(.*)\{\{ END_BLOCK_)" + blockName + " \\}\\}", //
-        QRegularExpression::InvertedGreedinessOption | QRegularExpression::DotMatchesEverythingOption);
-    QRegularExpressionMatch match = rx.match(m);
-    if (match.hasMatch()) {
-        QString block = match.captured(0);
-        QString item = match.captured(1).trimmed();
-        QStringList list;
-        for (elch_ssize_t i = 0, n = replaces.at(0).count(); i < n; ++i) {
-            QString subItem = item;
-            for (elch_ssize_t x = 0, y = itemNames.count(); x < y; ++x) {
-                subItem.replace("{{ " + itemNames.at(x) + " }}", replaces.at(x).at(i).toHtmlEscaped());
-            }
-            list << subItem;
-        }
-        m.replace(block, list.join(" "));
-    }
+    c.setVariable("FILEINFO.SUBTITLES.LANGUAGE", subtitleLanguages.join("|"));
 }
 
-void SimpleEngine::saveImage(QSize size, QString imageFile, QString destinationFile, const char* format, int quality)
+void SimpleEngine::renderPages(QVector<Page>& pages)
 {
-    Q_UNUSED(format)
-    Q_UNUSED(quality)
-
-    QImage img(imageFile);
-    if (img.isNull()) {
-        qCWarning(generic) << "[Export][SimpleEngine] Cannot load image:" << imageFile;
+    if (pages.isEmpty()) {
         return;
     }
 
-    img = img.scaled(size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
-
-    if (!img.isNull()) {
-        img.save(destinationFile);
-    } else {
-        qCWarning(generic) << "[Export][SimpleEngine] Could not scale (result was empty):" << imageFile;
-    }
-}
-
-void SimpleEngine::replaceImages(QString& m,
-    const bool& subDir,
-    const Movie* movie,
-    const Concert* concert,
-    const QString& concertId,
-    const TvShow* tvShow,
-    const TvShowEpisode* episode)
-{
-    QString item;
-    QSize size;
-    QRegularExpression rx(R"(\{\{ IMAGE.(.*)\[(\d*), ?(\d*)\] \}\})", //
-        QRegularExpression::InvertedGreedinessOption | QRegularExpression::DotMatchesEverythingOption);
-    QRegularExpressionMatchIterator matches = rx.globalMatch(m);
-    while (matches.hasNext()) {
-        QRegularExpressionMatch match = matches.next();
-        item = match.captured(0);
-        QString type = match.captured(1).toLower();
-        size.setWidth(match.captured(2).toInt());
-        size.setHeight(match.captured(3).toInt());
-
-        if (item.isEmpty() || size.isEmpty()) {
-            continue;
-        }
-
-        QString destFile;
-        bool imageSaved = false;
-        bool isPlaceholderUsed = true;
-        QString typeName;
-        if (movie != nullptr) {
-            imageSaved = saveImageForType(type, size, destFile, movie, &isPlaceholderUsed);
-            typeName = "movie";
-
-        } else if (concert != nullptr) {
-            imageSaved = saveImageForType(type, size, destFile, concert, concertId, &isPlaceholderUsed);
-            typeName = "concert";
-
-        } else if (tvShow != nullptr) {
-            imageSaved = saveImageForType(type, size, destFile, tvShow, &isPlaceholderUsed);
-            typeName = "tvshow";
-
-        } else if (episode != nullptr) {
-            imageSaved = saveImageForType(type, size, destFile, episode, &isPlaceholderUsed);
-            typeName = "episode";
+    const SimpleTemplate::ImageCallback onImage = [this](const QString& sourceFile,
+                                                      const QString& destination,
+                                                      QSize size) { scheduleImage(sourceFile, destination, size); };
+    const auto renderPage = [this, &onImage](const Page& page) {
+        if (m_cancelFlag.load() || page.pageTemplate->isEmpty()) {
+            return;
         }
-
-        if (!isPlaceholderUsed) {
-            continue;
+        writeFile(page.fileName, page.pageTemplate->render(page.context, true, onImage));
+    };
+
+    int exportedPages = 0;
+    QFutureWatcher<void> watcher;
+    QEventLoop loop;
+    connect(&watcher, &QFutureWatcher<void>::progressValueChanged, this, [this, &exportedPages](int progress) {
+        for (; exportedPages < progress; ++exportedPages) {
+            emit sigItemExported();
         }
+    });
+    connect(&watcher, &QFutureWatcher<void>::finished, &loop, &QEventLoop::quit);
+    watcher.setFuture(QtConcurrent::map(pages, renderPage));
+    loop.exec();
 
-        if (imageSaved) {
-            m.replace(item, (subDir ? "../" : "") + destFile);
-        } else {
-            m.replace(item,
-                (subDir ? "../" : "")
-                    + QString("defaults/%1_%2_%3x%4.png").arg(typeName).arg(type).arg(size.width()).arg(size.height()));
+    if (!m_cancelFlag.load()) {
+        for (; exportedPages < pages.size(); ++exportedPages) {
+            emit sigItemExported();
         }
     }
 }
 
-void SimpleEngine::replaceImages(QString& m, const bool& subDir, const Movie* movie)
+void SimpleEngine::renderListPage(const SimpleTemplate& listTemplate,
+    const QString& blockName,
+    std::vector<SimpleTemplateContext> items,
+    const QString& fileName)
 {
-    replaceImages(m, subDir, movie, nullptr, {}, nullptr, nullptr);
+    SimpleTemplateContext context;
+    context.setBlock(blockName, std::move(items), "\n");
+    const QString content = listTemplate.render(
+        context, false, [this](const QString& sourceFile, const QString& destination, QSize size) {
+            scheduleImage(sourceFile, destination, size);
+        });
+    writeFile(fileName, content);
 }
 
-void SimpleEngine::replaceImages(QString& m, const bool& subDir, const Concert* concert, const QString& concertId)
+void SimpleEngine::scheduleImage(const QString& sourceFile, const QString& destination, QSize size)
 {
-    replaceImages(m, subDir, nullptr, concert, concertId, nullptr, nullptr);
-}
+    {
+        QMutexLocker locker(&m_imageMutex);
+        if (m_scheduledImages.contains(destination)) {
+            return;
+        }
+        m_scheduledImages.insert(destination);
+    }
+    if (m_manifest != nullptr && !m_manifest->updateImage(destination, sourceFile)) {
+        return;
+    }
 
-void SimpleEngine::replaceImages(QString& m, const bool& subDir, const TvShow* tvShow)
-{
-    replaceImages(m, subDir, nullptr, nullptr, {}, tvShow, nullptr);
+    const ImageCache* cache = m_imageCache;
+    std::atomic_bool& cancelFlag = m_cancelFlag;
+    const QString destinationFile = m_exportPath + "/" + destination;
+    QtConcurrent::run(&m_imagePool, [cache, &cancelFlag, size, sourceFile, destinationFile]() {
+        if (!cancelFlag.load()) {
+            saveImage(cache, size, sourceFile, destinationFile);
+        }
+    });
 }
 
-void SimpleEngine::replaceImages(QString& m, const bool& subDir, const TvShowEpisode* episode)
+void SimpleEngine::waitForImages()
 {
-    replaceImages(m, subDir, nullptr, nullptr, {}, nullptr, episode);
+    while (!m_imagePool.waitForDone(50)) {
+        QApplication::processEvents();
+    }
 }
 
-bool SimpleEngine::saveImageForType(const QString& type,
-    const QSize& size,
-    QString& destFile,
-    const Movie* movie,
-    bool* isPlaceHolderUsed)
+void SimpleEngine::finishSection(const QStringList& pathPrefixes)
 {
-    std::string imageFormat = "png";
-    ImageType imageType = ImageType::None;
-
-    if (type == "poster") {
-        imageType = ImageType::MoviePoster;
-        imageFormat = "jpg";
-    } else if (type == "fanart") {
-        imageType = ImageType::MovieBackdrop;
-        imageFormat = "jpg";
-    } else if (type == "logo") {
-        imageType = ImageType::MovieLogo;
-    } else if (type == "clearart") {
-        imageType = ImageType::MovieClearArt;
-    } else if (type == "disc") {
-        imageType = ImageType::MovieCdArt;
-    } else {
-        *isPlaceHolderUsed = false;
-        return false;
-    }
-
-    *isPlaceHolderUsed = true;
-
-    QString file_ending = QString::fromStdString(imageFormat);
-    destFile = "movie_images/"
-               + QString("%1-%2_%3x%4.%5")
-                     .arg(movie->movieId())
-                     .arg(type)
-                     .arg(size.width())
-                     .arg(size.height())
-                     .arg(file_ending);
-
-    QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(movie, imageType);
-    if (filename.isEmpty()) {
-        return false;
+    if (m_manifest == nullptr || m_cancelFlag.load()) {
+        return;
     }
-
-    int imageQuality = (imageFormat == "jpg") ? 90 : -1;
-    saveImage(size, filename, m_dir.path() + "/" + destFile, imageFormat.c_str(), imageQuality);
-
-    return true;
+    m_manifest->removeStaleFiles(pathPrefixes);
+    m_manifest->save();
 }
 
-bool SimpleEngine::saveImageForType(const QString& type,
-    const QSize& size,
-    QString& destFile,
-    const Concert* concert,
-    const QString& concertId,
-    bool* isPlaceHolderUsed)
+void SimpleEngine::saveImage(const ImageCache* cache, QSize size, QString imageFile, QString destinationFile)
 {
-    std::string imageFormat = "png";
-    ImageType imageType;
-
-    if (type == "poster") {
-        imageType = ImageType::ConcertPoster;
-        imageFormat = "jpg";
-    } else if (type == "fanart") {
-        imageType = ImageType::ConcertBackdrop;
-        imageFormat = "jpg";
-    } else if (type == "logo") {
-        imageType = ImageType::ConcertLogo;
-    } else if (type == "clearart") {
-        imageType = ImageType::ConcertClearArt;
-    } else if (type == "disc") {
-        imageType = ImageType::ConcertCdArt;
-    } else {
-        *isPlaceHolderUsed = false;
-        return false;
+    // Artwork that already has the requested size and format is copied as it is.
+    // Only its header is read; decoding and encoding it again would just lose quality.
+    const ImageHeader header = cache->imageHeader(mediaelch::FilePath(imageFile));
+    if (header.isValid() && scaledSize(header.size, size) == header.size
+        && isFormatOfSuffix(header.format, destinationFile)) {
+        QFile::remove(destinationFile);
+        if (QFile::copy(imageFile, destinationFile)) {
+            return;
+        }
     }
 
-    *isPlaceHolderUsed = true;
-
-    QString file_ending = QString::fromStdString(imageFormat);
-    destFile = "movie_images/"
-               + QString("%1-%2_%3x%4.%5") //
-                     .arg(concertId)
-                     .arg(type)
-                     .arg(size.width())
-                     .arg(size.height())
-                     .arg(file_ending);
-
-    QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(concert, imageType);
-    if (filename.isEmpty()) {
-        return false;
+    // The image cache keeps the scaled image, so that subsequent exports do not have to
+    // decode and scale the full-size artwork again.
+    QImage img = cache->loadImageSync(mediaelch::FilePath(imageFile), size);
+    if (img.isNull()) {
+        qCWarning(c_export) << "[Export][SimpleEngine] Cannot load or scale image:" << imageFile;
+        return;
     }
-
-    int imageQuality = (imageFormat == "jpg") ? 90 : -1;
-    saveImage(size, filename, m_dir.path() + "/" + destFile, imageFormat.c_str(), imageQuality);
-
-    return true;
+    img.save(destinationFile);
 }
 
-bool SimpleEngine::saveImageForType(const QString& type,
-    const QSize& size,
-    QString& destFile,
-    const TvShow* tvShow,
-    bool* isPlaceHolderUsed)
+void SimpleEngine::writeFile(const QString& relativePath, const QString& content)
 {
-    std::string imageFormat = "png";
-    ImageType imageType;
-
-    if (type == "poster") {
-        imageType = ImageType::TvShowPoster;
-        imageFormat = "jpg";
-    } else if (type == "fanart") {
-        imageType = ImageType::TvShowBackdrop;
-        imageFormat = "jpg";
-    } else if (type == "banner") {
-        imageType = ImageType::TvShowBanner;
-        imageFormat = "jpg";
-    } else if (type == "logo") {
-        imageType = ImageType::TvShowLogos;
-    } else if (type == "clearart") {
-        imageType = ImageType::TvShowClearArt;
-    } else if (type == "characterart") {
-        imageType = ImageType::TvShowCharacterArt;
-    } else {
-        *isPlaceHolderUsed = false;
-        return false;
-    }
-    *isPlaceHolderUsed = true;
-
-    QString file_ending = QString::fromStdString(imageFormat);
-    destFile = "tvshow_images/"
-               + QString("%1-%2_%3x%4.%5")
-                     .arg(tvShow->showId())
-                     .arg(type)
-                     .arg(size.width())
-                     .arg(size.height())
-                     .arg(file_ending);
-
-    QString filename = Manager::instance()->mediaCenterInterface()->imageFileName(tvShow, imageType);
-    if (filename.isEmpty()) {
-        return false;
+    const QByteArray data = content.toUtf8();
+    if (m_manifest != nullptr && !m_manifest->updateFile(relativePath, data)) {
+        return;
     }
-
-    int imageQuality = (imageFormat == "jpg") ? 90 : -1;
-    saveImage(size, filename, m_dir.path() + "/" + destFile, imageFormat.c_str(), imageQuality);
-
-    return true;
-}
-
-bool SimpleEngine::saveImageForType(const QString& type,
-    const QSize& size,
-    QString& destFile,
-    const TvShowEpisode* episode,
-    bool* isPlaceHolderUsed)
-{
-    destFile = "episode_images/"
-               + QString("%1-%2_%3x%4.jpg").arg(episode->episodeId()).arg(type).arg(size.width()).arg(size.height());
-
-    if (type == "thumbnail") {
-        *isPlaceHolderUsed = true;
-        QString filename =
-            Manager::instance()->mediaCenterInterface()->imageFileName(episode, ImageType::TvShowEpisodeThumb);
-        if (filename.isEmpty()) {
-            return false;
-        }
-        saveImage(size, filename, m_dir.path() + "/" + destFile, "jpg", 90);
+    QFile file(m_exportPath + "/" + relativePath);
+    if (file.open(QFile::WriteOnly | QFile::Text)) {
+        file.write(data);
+        file.close();
     } else {
-        *isPlaceHolderUsed = false;
-        return false;
+        qCWarning(c_export) << "[Export][SimpleEngine] Cannot write file:" << file.fileName();
     }
-
-    return true;
 }
 
 } // namespace mediaelch
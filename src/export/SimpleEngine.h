@@ -1,12 +1,20 @@
 #pragma once
 
+#include "export/ExportManifest.h"
 #include "export/ExportTemplate.h"
+#include "export/SimpleTemplate.h"
 
 #include <QDir>
+#include <QMutex>
 #include <QObject>
+#include <QSet>
+#include <QThreadPool>
+#include <QVector>
 #include <atomic>
+#include <memory>
 
 class Concert;
+class ImageCache;
 class Movie;
 class TvShow;
 class TvShowEpisode;
@@ -16,6 +24,13 @@ namespace mediaelch {
 
 /// Default export engine for MediaElch. Simple find&replace semantics,
 /// only basic functionality (e.g. condintional block)
+///
+/// Templates are tokenized once per export. Item pages are rendered by worker threads
+/// and images are scaled on a bounded thread pool. Already scaled images are reused from
+/// the ImageCache. All export functions block until the section is exported but keep
+/// the event loop running.
+///
+/// If the export is incremental, only changed pages and images are written. See ExportManifest.
 class SimpleEngine : public QObject
 {
     Q_OBJECT
@@ -24,6 +39,20 @@ public:
         QDir directory,
         std::atomic_bool& cancelFlag,
         QObject* parent = nullptr);
+    ~SimpleEngine() override;
+
+    /// \brief Id of an exported item that is the same in every export.
+    /// \details Ids like Movie::movieId() are only valid while MediaElch runs.  Pages, images and
+    ///          the export manifest are keyed by this id, so that unchanged items are not written
+    ///          again by the next export.  It is available in templates, e.g. as MOVIE.ID.
+    static QString exportId(const Movie* movie);
+    static QString exportId(const TvShow* show);
+    /// \brief Includes season and episode number, because episodes may share a file.
+    static QString exportId(const TvShowEpisode* episode);
+
+    /// \brief Only write pages and images that changed since the last export into
+    ///        the same directory and remove files of items that no longer exist.
+    void setIncremental(bool incremental);
 
 signals:
     /// Signal is emitted each time an item is exported (e.g. image, generated HTML, etc.)
@@ -36,54 +65,51 @@ public:
     void exportTvShows(QVector<TvShow*> shows);
 
 private:
-    void saveImage(QSize size, QString imageFile, QString destinationFile, const char* format, int quality);
-    // TODO: Cleanup
-    void replaceImages(QString& m,
-        const bool& subDir,
-        const Movie* movie,
-        const Concert* concert,
-        const QString& concertId,
-        const TvShow* tvShow,
-        const TvShowEpisode* episode);
-
-    void replaceImages(QString& m, const bool& subDir, const Movie* movie);
-    void replaceImages(QString& m, const bool& subDir, const Concert* concert, const QString& concertId);
-    void replaceImages(QString& m, const bool& subDir, const TvShow* tvShow);
-    void replaceImages(QString& m, const bool& subDir, const TvShowEpisode* episode);
-
-    bool saveImageForType(const QString& type,
-        const QSize& size,
-        QString& destFile,
-        const Movie* movie,
-        bool* isPlaceHolderUsed);
-    bool saveImageForType(const QString& type,
-        const QSize& size,
-        QString& destFile,
-        const Concert* concert,
-        const QString& concertId,
-        bool* isPlaceHolderUsed);
-    bool saveImageForType(const QString& type,
-        const QSize& size,
-        QString& destFile,
-        const TvShow* tvShow,
-        bool* isPlaceHolderUsed);
-    bool saveImageForType(const QString& type,
-        const QSize& size,
-        QString& destFile,
-        const TvShowEpisode* episode,
-        bool* isPlaceHolderUsed);
-    void replaceVars(QString& m, Movie* movie, bool subDir = false);
-    void replaceVars(QString& m, const Concert* concert, const QString& id, bool subDir = false);
-    void replaceVars(QString& m, const TvShow* show, bool subDir = false);
-    void replaceVars(QString& m, const TvShowEpisode* episode, bool subDir = false);
-    void replaceSingleBlock(QString& m, QString blockName, QString itemName, QStringList replaces);
-    void replaceMultiBlock(QString& m, QString blockName, QStringList itemNames, QVector<QStringList> replaces);
-    void replaceStreamDetailsVars(QString& m, const StreamDetails* details);
+    /// A single HTML page, e.g. "movies/42.html". Rendered by a worker thread.
+    struct Page
+    {
+        const SimpleTemplate* pageTemplate = nullptr;
+        SimpleTemplateContext context;
+        QString fileName;
+    };
+
+    SimpleTemplateContext movieContext(Movie* movie);
+    SimpleTemplateContext concertContext(const Concert* concert, const QString& id);
+    SimpleTemplateContext tvShowContext(const TvShow* show, bool withSeasons);
+    SimpleTemplateContext episodeContext(const TvShowEpisode* episode);
+    void addStreamDetails(SimpleTemplateContext& context, const StreamDetails* details);
+
+    /// Render all pages in parallel and write them to the export directory.
+    /// Emits sigItemExported() for each page.
+    void renderPages(QVector<Page>& pages);
+    /// Render a list page such as "movies.html" in which blockName is repeated for all items.
+    void renderListPage(const SimpleTemplate& listTemplate,
+        const QString& blockName,
+        std::vector<SimpleTemplateContext> items,
+        const QString& fileName);
+
+    /// Scale the given image in the background. Thread-safe; each destination is only written once.
+    void scheduleImage(const QString& sourceFile, const QString& destination, QSize size);
+    void waitForImages();
+    /// Remove files of deleted items and store the manifest (incremental exports only).
+    void finishSection(const QStringList& pathPrefixes);
+    static void saveImage(const ImageCache* cache, QSize size, QString imageFile, QString destinationFile);
+    void writeFile(const QString& relativePath, const QString& content);
 
 private:
     std::atomic_bool& m_cancelFlag;
     ExportTemplate* m_template = nullptr;
     QDir m_dir;
+    QString m_exportPath;
+    /// Lower-case image types used by the templates of the current section.
+    QSet<QString> m_imageTypes;
+    /// Only set for incremental exports.
+    std::unique_ptr<ExportManifest> m_manifest;
+
+    const ImageCache* m_imageCache = nullptr;
+    QThreadPool m_imagePool;
+    QMutex m_imageMutex;
+    QSet<QString> m_scheduledImages;
 };
 
 } // namespace mediaelch
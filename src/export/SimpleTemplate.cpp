@@ -0,0 +1,273 @@
+#include "export/SimpleTemplate.h"
+
+#include "utils/Meta.h"
+
+#include <QRegularExpression>
+
+namespace mediaelch {
+
+void SimpleTemplateContext::setBlock(const QString& name, std::vector<SimpleTemplateContext> items, QString separator)
+{
+    m_blocks.insert(name, std::move(items));
+    m_blockSeparators.insert(name, std::move(separator));
+}
+
+void SimpleTemplateContext::setListBlock(const QString& name, const QString& itemName, const QStringList& values)
+{
+    std::vector<SimpleTemplateContext> items;
+    items.reserve(static_cast<std::size_t>(values.size()));
+    for (const QString& value : values) {
+        SimpleTemplateContext item;
+        item.setVariable(itemName, value.toHtmlEscaped());
+        items.push_back(std::move(item));
+    }
+    setBlock(name, std::move(items));
+}
+
+const QString* SimpleTemplateContext::variable(const QString& name) const
+{
+    auto it = m_variables.constFind(name);
+    return it != m_variables.constEnd() ? &it.value() : nullptr;
+}
+
+const SimpleTemplateImage* SimpleTemplateContext::image(const QString& type) const
+{
+    auto it = m_images.constFind(type);
+    return it != m_images.constEnd() ? &it.value() : nullptr;
+}
+
+const std::vector<SimpleTemplateContext>* SimpleTemplateContext::blockItems(const QString& name) const
+{
+    auto it = m_blocks.constFind(name);
+    return it != m_blocks.constEnd() ? &it.value() : nullptr;
+}
+
+/// Chain of contexts: Items of a block can access their parents' values.
+struct SimpleTemplate::Scope
+{
+    const SimpleTemplateContext& context;
+    const Scope* parent;
+};
+
+SimpleTemplate SimpleTemplate::parse(const QString& content)
+{
+    SimpleTemplate tmpl;
+    tmpl.m_nodes = parseNodes(content);
+    return tmpl;
+}
+
+std::vector<SimpleTemplate::Node> SimpleTemplate::parseNodes(const QString& content)
+{
+    static const QString open = QStringLiteral("{{ ");
+    static const QString close = QStringLiteral(" }}");
+    static const QString beginBlock = QStringLiteral("BEGIN_BLOCK_");
+    static const QString endBlock = QStringLiteral("END_BLOCK_");
+    static const QRegularExpression imageRx(QStringLiteral(R"(^IMAGE\.(.+?)\[(\d*), ?(\d*)\]$)"),
+        QRegularExpression::DotMatchesEverythingOption);
+
+    std::vector<Node> nodes;
+    QString text;
+
+    const auto flushText = [&nodes, &text]() {
+        if (!text.isEmpty()) {
+            Node node;
+            node.type = Node::Type::Text;
+            node.value = text;
+            nodes.push_back(std::move(node));
+            text.clear();
+        }
+    };
+
+    elch_ssize_t pos = 0;
+    while (pos < content.length()) {
+        const elch_ssize_t firstOpen = content.indexOf(open, pos);
+        const elch_ssize_t closePos = (firstOpen < 0) ? -1 : content.indexOf(close, firstOpen + open.length());
+        if (closePos < 0) {
+            text.append(content.mid(pos));
+            break;
+        }
+        // Use the innermost "{{ ", e.g. for "{{ {{ MOVIE.TITLE }}"
+        const elch_ssize_t openPos = content.lastIndexOf(open, closePos);
+        const elch_ssize_t tokenEnd = closePos + close.length();
+        const QString name = content.mid(openPos + open.length(), closePos - openPos - open.length());
+        const QString raw = content.mid(openPos, tokenEnd - openPos);
+
+        text.append(content.mid(pos, openPos - pos));
+        pos = tokenEnd;
+
+        if (name.startsWith(beginBlock)) {
+            const QString blockName = name.mid(beginBlock.length());
+            const QString endTag = open + endBlock + blockName + close;
+            const elch_ssize_t endPos = content.indexOf(endTag, pos);
+            if (endPos < 0) {
+                text.append(raw);
+                continue;
+            }
+            flushText();
+            Node node;
+            node.type = Node::Type::Block;
+            node.value = blockName;
+            node.raw = content.mid(openPos, endPos + endTag.length() - openPos);
+            node.children = parseNodes(content.mid(pos, endPos - pos).trimmed());
+            nodes.push_back(std::move(node));
+            pos = endPos + endTag.length();
+            continue;
+        }
+
+        if (name.startsWith(endBlock)) {
+            // Stray end of a block; kept as-is.
+            text.append(raw);
+            continue;
+        }
+
+        if (name.startsWith(QStringLiteral("IMAGE."))) {
+            QRegularExpressionMatch match = imageRx.match(name);
+            const QSize size =
+                match.hasMatch() ? QSize(match.captured(2).toInt(), match.captured(3).toInt()) : QSize();
+            if (size.isEmpty()) {
+                text.append(raw);
+                continue;
+            }
+            flushText();
+            Node node;
+            node.type = Node::Type::Image;
+            node.value = match.captured(1).toLower();
+            node.raw = raw;
+            node.size = size;
+            nodes.push_back(std::move(node));
+            continue;
+        }
+
+        flushText();
+        Node node;
+        node.type = Node::Type::Variable;
+        node.value = name;
+        node.raw = raw;
+        nodes.push_back(std::move(node));
+    }
+
+    flushText();
+    return nodes;
+}
+
+QString SimpleTemplate::render(const SimpleTemplateContext& context, bool isSubDir, const ImageCallback& onImage) const
+{
+    QString out;
+    Scope scope{context, nullptr};
+    renderNodes(out, m_nodes, scope, isSubDir, onImage);
+    return out;
+}
+
+bool SimpleTemplate::hasBlock(const QString& name) const
+{
+    return hasBlock(m_nodes, name);
+}
+
+bool SimpleTemplate::hasBlock(const std::vector<Node>& nodes, const QString& name)
+{
+    for (const Node& node : nodes) {
+        if (node.type == Node::Type::Block && (node.value == name || hasBlock(node.children, name))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+QSet<QString> SimpleTemplate::imageTypes() const
+{
+    QSet<QString> types;
+    collectImageTypes(m_nodes, types);
+    return types;
+}
+
+void SimpleTemplate::collectImageTypes(const std::vector<Node>& nodes, QSet<QString>& types)
+{
+    for (const Node& node : nodes) {
+        if (node.type == Node::Type::Image) {
+            types.insert(node.value);
+        } else if (node.type == Node::Type::Block) {
+            collectImageTypes(node.children, types);
+        }
+    }
+}
+
+void SimpleTemplate::renderNodes(QString& out,
+    const std::vector<Node>& nodes,
+    const Scope& scope,
+    bool isSubDir,
+    const ImageCallback& onImage)
+{
+    for (const Node& node : nodes) {
+        switch (node.type) {
+        case Node::Type::Text: {
+            out.append(node.value);
+            break;
+        }
+        case Node::Type::Variable: {
+            const QString* value = nullptr;
+            for (const Scope* s = &scope; s != nullptr && value == nullptr; s = s->parent) {
+                value = s->context.variable(node.value);
+            }
+            out.append(value != nullptr ? *value : node.raw);
+            break;
+        }
+        case Node::Type::Block: {
+            const std::vector<SimpleTemplateContext>* items = nullptr;
+            const Scope* owner = &scope;
+            for (; owner != nullptr; owner = owner->parent) {
+                items = owner->context.blockItems(node.value);
+                if (items != nullptr) {
+                    break;
+                }
+            }
+            if (items == nullptr) {
+                out.append(node.raw);
+                break;
+            }
+            const QString separator = owner->context.blockSeparator(node.value);
+            bool isFirst = true;
+            for (const SimpleTemplateContext& item : *items) {
+                if (!isFirst) {
+                    out.append(separator);
+                }
+                isFirst = false;
+                Scope itemScope{item, &scope};
+                renderNodes(out, node.children, itemScope, isSubDir, onImage);
+            }
+            break;
+        }
+        case Node::Type::Image: {
+            const SimpleTemplateImage* image = nullptr;
+            for (const Scope* s = &scope; s != nullptr && image == nullptr; s = s->parent) {
+                image = s->context.image(node.value);
+            }
+            if (image == nullptr) {
+                out.append(node.raw);
+                break;
+            }
+            if (isSubDir) {
+                out.append(QStringLiteral("../"));
+            }
+            if (image->sourceFile.isEmpty()) {
+                out.append(QStringLiteral("defaults/%1_%2_%3x%4.png")
+                               .arg(image->typeName, node.value)
+                               .arg(node.size.width())
+                               .arg(node.size.height()));
+                break;
+            }
+            const QString destination = QStringLiteral("%1_%2x%3.%4")
+                                            .arg(image->destinationBase)
+                                            .arg(node.size.width())
+                                            .arg(node.size.height())
+                                            .arg(image->suffix);
+            if (onImage) {
+                onImage(image->sourceFile, destination, node.size);
+            }
+            out.append(destination);
+            break;
+        }
+        }
+    }
+}
+
+} // namespace mediaelch
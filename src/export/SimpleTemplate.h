@@ -0,0 +1,114 @@
+#pragma once
+
+#include <QHash>
+#include <QSet>
+#include <QSize>
+#include <QString>
+#include <QStringList>
+#include <functional>
+#include <vector>
+
+namespace mediaelch {
+
+/// Artwork that an "{{ IMAGE.type[w, h] }}" placeholder refers to.
+struct SimpleTemplateImage
+{
+    /// Absolute path to the original artwork. If empty, the theme's default image is used.
+    QString sourceFile;
+    /// Destination path relative to the export directory without size and file extension,
+    /// e.g. "movie_images/42-poster".
+    QString destinationBase;
+    /// File extension of the exported image, e.g. "jpg".
+    QString suffix;
+    /// Name of the item type used for default images, e.g. "movie" for "defaults/movie_poster_200x300.png".
+    QString typeName;
+};
+
+/// Values that are available while rendering a SimpleTemplate.
+/// Contexts are nested: Items of a block can access the variables and images of
+/// their parent context, e.g. "{{ MOVIE.TITLE }}" inside "{{ BEGIN_BLOCK_ACTORS }}".
+class SimpleTemplateContext
+{
+public:
+    void setVariable(const QString& name, QString value) { m_variables.insert(name, std::move(value)); }
+    void setImage(const QString& type, SimpleTemplateImage image) { m_images.insert(type, std::move(image)); }
+    /// Set the items of the block "{{ BEGIN_BLOCK_<name> }}". Rendered items are joined by separator.
+    void setBlock(const QString& name, std::vector<SimpleTemplateContext> items, QString separator = " ");
+    /// Convenience function for blocks with only one variable per item, e.g. TAGS with "TAG.NAME".
+    /// Values are HTML escaped.
+    void setListBlock(const QString& name, const QString& itemName, const QStringList& values);
+
+    const QString* variable(const QString& name) const;
+    const SimpleTemplateImage* image(const QString& type) const;
+    const std::vector<SimpleTemplateContext>* blockItems(const QString& name) const;
+    QString blockSeparator(const QString& name) const { return m_blockSeparators.value(name); }
+
+private:
+    QHash<QString, QString> m_variables;
+    QHash<QString, SimpleTemplateImage> m_images;
+    QHash<QString, std::vector<SimpleTemplateContext>> m_blocks;
+    QHash<QString, QString> m_blockSeparators;
+};
+
+/// \brief A template of the simple export engine, tokenized into a tree of placeholders.
+/// \details
+///   Parsing is done once per template file. Rendering is a single pass over the node
+///   tree and does not modify the template, so the same instance can be rendered from
+///   multiple threads at once.
+///
+///   Supported syntax:
+///    - "{{ NAME }}": Variable. Unknown variables are kept as-is.
+///    - "{{ BEGIN_BLOCK_NAME }}...{{ END_BLOCK_NAME }}": Repeated once per block item.
+///      Blocks that are not set in the context are kept as-is.
+///    - "{{ IMAGE.type[width, height] }}": Path to a resized image.
+class SimpleTemplate
+{
+public:
+    /// Called for each image that is referenced by the rendered output. The destination
+    /// is relative to the export directory. May be called from multiple threads.
+    using ImageCallback = std::function<void(const QString& sourceFile, const QString& destination, QSize size)>;
+
+    static SimpleTemplate parse(const QString& content);
+
+    /// Render the template. If isSubDir is true, image paths are prefixed with "../".
+    QString render(const SimpleTemplateContext& context, bool isSubDir, const ImageCallback& onImage) const;
+
+    /// Returns true if the template contains the given block at any level.
+    bool hasBlock(const QString& name) const;
+    /// Lower-case types of all images used by this template, e.g. "poster" for "{{ IMAGE.POSTER[200, 300] }}".
+    QSet<QString> imageTypes() const;
+    bool isEmpty() const { return m_nodes.empty(); }
+
+private:
+    struct Node
+    {
+        enum class Type
+        {
+            Text,
+            Variable,
+            Block,
+            Image
+        };
+        Type type = Type::Text;
+        /// Text: literal text; Variable: variable name; Block: block name; Image: image type
+        QString value;
+        /// Original template text of this node; used for unknown placeholders.
+        QString raw;
+        QSize size;
+        std::vector<Node> children;
+    };
+    struct Scope;
+
+    static std::vector<Node> parseNodes(const QString& content);
+    static bool hasBlock(const std::vector<Node>& nodes, const QString& name);
+    static void collectImageTypes(const std::vector<Node>& nodes, QSet<QString>& types);
+    static void renderNodes(QString& out,
+        const std::vector<Node>& nodes,
+        const Scope& scope,
+        bool isSubDir,
+        const ImageCallback& onImage);
+
+    std::vector<Node> m_nodes;
+};
+
+} // namespace mediaelch
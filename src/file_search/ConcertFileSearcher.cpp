@@ -1,5 +1,6 @@
 #include "ConcertFileSearcher.h"
 
+#include "file_search/DirectoryWalker.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
 #include "globals/MessageIds.h"
@@ -7,9 +8,12 @@
 #include "media/FileFilter.h"
 
 #include <QApplication>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QRegularExpression>
 #include <QSqlQuery>
 #include <QSqlRecord>
+#include <algorithm>
 
 ConcertFileSearcher::ConcertFileSearcher(QObject* parent) :
     QObject(parent), m_progressMessageId{Constants::ConcertFileSearcherProgressMessageId}
@@ -23,15 +27,16 @@ void ConcertFileSearcher::setConcertDirectories(QVector<mediaelch::MediaDirector
 
     for (const auto& dir : directories) {
         if (filter.isFolderExcluded(dir.path.dirName())) {
-            qCWarning(generic) << "[ConcertFileSearcher] Concert directory is excluded by advanced settings! "
+            qCWarning(c_scanner) << "[ConcertFileSearcher] Concert directory is excluded by advanced settings! "
                                   "Is this intended? Directory:"
-                               << dir.path.path();
+                                 << dir.path.path();
 
         } else if (!dir.path.isReadable()) {
-            qCDebug(generic) << "[ConcertFileSearcher] Concert directory is not readable, skipping:" << dir.path.path();
+            qCDebug(c_scanner) << "[ConcertFileSearcher] Concert directory is not readable, skipping:"
+                               << dir.path.path();
 
         } else {
-            qCDebug(generic) << "[ConcertFileSearcher] Adding concert directory" << dir.path.path();
+            qCDebug(c_scanner) << "[ConcertFileSearcher] Adding concert directory" << dir.path.path();
             m_directories.append(dir);
         }
     }
@@ -58,7 +63,7 @@ void ConcertFileSearcher::reload(bool force)
 
     addConcertsToGui(loadConcertsFromDatabase());
 
-    qCDebug(generic) << "Searching for concerts done";
+    qCDebug(c_scanner) << "Searching for concerts done";
     if (!m_aborted) {
         emit concertsLoaded();
     }
@@ -79,64 +84,91 @@ void ConcertFileSearcher::scanDir(QString startPath,
     bool separateFolders,
     bool firstScan)
 {
-    const auto& filter = Settings::instance()->advanced()->concertFilters();
-    emit currentDir(path.mid(startPath.length()));
+    using mediaelch::DirectoryWalker;
+    mediaelch::FileFilter filter = Settings::instance()->advanced()->concertFilters();
+    // Skip trailers and sample files
+    filter.excludeFileNamesContaining({"-trailer", "-sample"});
 
-    QDir dir(path);
-    const auto dirEntries = dir.entryList(QDir::Dirs | QDir::NoDotAndDotDot);
-    for (const QString& cDir : dirEntries) {
-        if (m_aborted) {
-            return;
-        }
+    DirectoryWalker::Options options;
+    options.fileGlob = filter.fileGlob;
+    options.parallelism = Settings::instance()->advanced()->directoryScanThreads();
+    options.isAborted = [this]() { return m_aborted; };
 
-        if (filter.isFolderExcluded(cDir)) {
-            continue;
-        }
+    QMutex mutex;
+    QVector<QStringList> foundContents;
 
-        // Skip "Extras" folder
-        if (QString::compare(cDir, "Extras", Qt::CaseInsensitive) == 0
-            || QString::compare(cDir, ".actors", Qt::CaseInsensitive) == 0
-            || QString::compare(cDir, "extrafanarts", Qt::CaseInsensitive) == 0) {
-            continue;
-        }
+    const auto visitor = [&](const QString& dirPath, const QVector<DirectoryWalker::Entry>& entries) {
+        emit currentDir(dirPath.mid(startPath.length()));
 
-        // Handle DVD
-        if (helper::isDvd(path + QDir::separator() + cDir)) {
-            contents.append({QDir(path + "/" + cDir + "/VIDEO_TS/VIDEO_TS.IFO").path()});
-            continue;
-        }
+        QStringList subDirs;
+        QStringList files;
+        QVector<QStringList> dirContents;
 
-        // Handle BluRay
-        if (helper::isBluRay(path + QDir::separator() + cDir)) {
-            contents.append({QDir(path + "/" + cDir + "/BDMV/index.bdmv").path()});
-            continue;
-        }
+        for (const DirectoryWalker::Entry& entry : entries) {
+            if (m_aborted) {
+                return QStringList();
+            }
+            const QString& name = entry.name;
 
-        // Don't scan subfolders when separate folders is checked
-        if (!separateFolders || firstScan) {
-            scanDir(startPath, path + "/" + cDir, contents, separateFolders);
-        }
-    }
+            if (entry.isFile()) {
+                if (!filter.isFileExcluded(name)) {
+                    files.append(name);
+                }
+                continue;
+            }
 
-    QStringList files;
-    const QStringList entries = getFiles(mediaelch::DirectoryPath(path));
-    for (const QString& file : entries) {
-        if (m_aborted) {
-            return;
-        }
+            if (filter.isFolderExcluded(name)) {
+                continue;
+            }
 
-        if (filter.isFileExcluded(file)) {
-            continue;
-        }
+            // Skip "Extras" folder
+            if (QString::compare(name, "Extras", Qt::CaseInsensitive) == 0
+                || QString::compare(name, ".actors", Qt::CaseInsensitive) == 0
+                || QString::compare(name, "extrafanarts", Qt::CaseInsensitive) == 0) {
+                continue;
+            }
 
-        // Skip Trailers and Sample files
-        if (file.contains("-trailer", Qt::CaseInsensitive) || file.contains("-sample", Qt::CaseInsensitive)) {
-            continue;
+            // Handle DVD
+            if (helper::isDvd(dirPath + QDir::separator() + name)) {
+                dirContents.append({QDir(dirPath + "/" + name + "/VIDEO_TS/VIDEO_TS.IFO").path()});
+                continue;
+            }
+
+            // Handle BluRay
+            if (helper::isBluRay(dirPath + QDir::separator() + name)) {
+                dirContents.append({QDir(dirPath + "/" + name + "/BDMV/index.bdmv").path()});
+                continue;
+            }
+
+            // Don't scan subfolders when separate folders is checked
+            if (!separateFolders || (firstScan && dirPath == path)) {
+                subDirs.append(dirPath + "/" + name);
+            }
         }
-        files.append(file);
-    }
-    files.sort();
 
+        files.sort();
+        addConcertFiles(dirPath, files, separateFolders, dirContents);
+
+        QMutexLocker locker(&mutex);
+        foundContents.append(dirContents);
+        return subDirs;
+    };
+
+    DirectoryWalker walker(options);
+    walker.walk(path, visitor);
+
+    // Directories are scanned in parallel. Sort the result so that it does not depend on timing.
+    std::sort(foundContents.begin(), foundContents.end(), [](const QStringList& a, const QStringList& b) {
+        return a.first() < b.first();
+    });
+    contents.append(foundContents);
+}
+
+void ConcertFileSearcher::addConcertFiles(const QString& path,
+    QStringList files,
+    bool separateFolders,
+    QVector<QStringList>& contents)
+{
     if (separateFolders) {
         QStringList concertFiles;
         for (const QString& file : files) {
@@ -293,13 +325,6 @@ void ConcertFileSearcher::addConcertsToGui(const QVector<Concert*>& concerts)
 }
 
 /// Get a list of files in a directory
-QStringList ConcertFileSearcher::getFiles(mediaelch::DirectoryPath path)
-{
-    const auto& fileFilter = Settings::instance()->advanced()->concertFilters();
-    QDir dir(path.dir());
-    return dir.entryList(fileFilter.fileGlob, QDir::Files | QDir::System);
-}
-
 void ConcertFileSearcher::abort()
 {
     m_aborted = true;
@@ -47,6 +47,6 @@ private:
         QVector<QStringList>& contents,
         bool separateFolders = false,
         bool firstScan = false);
-
-    QStringList getFiles(mediaelch::DirectoryPath path);
+    /// \brief Group the given files of a directory into concerts and add them to contents.
+    void addConcertFiles(const QString& path, QStringList files, bool separateFolders, QVector<QStringList>& contents);
 };
@@ -0,0 +1,188 @@
+#include "file_search/DirectoryWalker.h"
+
+#include "utils/Meta.h"
+
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#if defined(Q_OS_LINUX) || defined(Q_OS_MACOS) || defined(Q_OS_FREEBSD)
+#    define MEDIAELCH_RAW_READDIR
+#    include <dirent.h>
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#ifdef MEDIAELCH_RAW_READDIR
+namespace {
+
+QDateTime modificationTime(const struct stat& info)
+{
+#    ifdef Q_OS_MACOS
+    const struct timespec& time = info.st_mtimespec;
+#    else
+    const struct timespec& time = info.st_mtim;
+#    endif
+    return QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(time.tv_sec) * 1000 + time.tv_nsec / 1000000);
+}
+
+bool isDotOrDotDot(const char* name)
+{
+    return name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+}
+
+} // namespace
+#endif
+
+namespace mediaelch {
+
+DirectoryWalker::DirectoryWalker(Options options) : m_options{std::move(options)}
+{
+    for (const QString& pattern : asConst(m_options.fileGlob)) {
+        if (pattern == QLatin1String("*")) {
+            // Matches everything, no need to check other patterns.
+            m_globs.clear();
+            break;
+        }
+        m_globs.append(QRegularExpression(
+            QRegularExpression::wildcardToRegularExpression(pattern), QRegularExpression::CaseInsensitiveOption));
+    }
+}
+
+void DirectoryWalker::walk(const QString& rootPath, const Visitor& visitor) const
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(qMax(1, m_options.parallelism));
+
+    // Each task reads one directory and starts tasks for its subdirectories.
+    std::function<void(const QString&)> visitDirectory;
+    visitDirectory = [this, &pool, &visitor, &visitDirectory](const QString& dirPath) {
+        if (isAborted()) {
+            return;
+        }
+        const QStringList subDirs = visitor(dirPath, readDirectory(dirPath));
+        for (const QString& subDir : subDirs) {
+            QtConcurrent::run(&pool, [&visitDirectory, subDir]() { visitDirectory(subDir); });
+        }
+    };
+
+    visitDirectory(rootPath);
+    pool.waitForDone();
+}
+
+QVector<DirectoryWalker::Entry> DirectoryWalker::readDirectory(const QString& path) const
+{
+    QVector<Entry> entries;
+
+#ifdef MEDIAELCH_RAW_READDIR
+    const int dirFd = ::open(QFile::encodeName(path).constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd < 0) {
+        return entries;
+    }
+    DIR* dir = ::fdopendir(dirFd);
+    if (dir == nullptr) {
+        ::close(dirFd);
+        return entries;
+    }
+
+    while (const struct dirent* dirEntry = ::readdir(dir)) {
+        const char* rawName = dirEntry->d_name;
+        if (isDotOrDotDot(rawName) || (!m_options.includeHidden && rawName[0] == '.')) {
+            continue;
+        }
+
+        struct stat info = {};
+        bool hasInfo = false;
+        bool isDir = false;
+        bool isFile = false;
+
+        switch (dirEntry->d_type) {
+        case DT_DIR: isDir = true; break;
+        case DT_REG: isFile = true; break;
+        case DT_LNK:
+        case DT_UNKNOWN:
+            // Some filesystems don't report the type.  Symbolic links are followed, same as QFileInfo does.
+            hasInfo = ::fstatat(dirFd, rawName, &info, 0) == 0;
+            isDir = hasInfo && S_ISDIR(info.st_mode);
+            isFile = hasInfo && S_ISREG(info.st_mode);
+            break;
+        default:
+            // Sockets, devices, etc.
+            break;
+        }
+
+        if (!isDir && !isFile) {
+            continue;
+        }
+
+        Entry entry;
+        entry.name = QFile::decodeName(rawName);
+        if (isDir) {
+            entry.type = EntryType::Directory;
+            entries.append(entry);
+            continue;
+        }
+
+        if (!matchesGlob(entry.name)) {
+            continue;
+        }
+        if (m_options.withLastModified) {
+            if (!hasInfo) {
+                hasInfo = ::fstatat(dirFd, rawName, &info, 0) == 0;
+            }
+            if (hasInfo) {
+                entry.lastModified = modificationTime(info);
+            }
+        }
+        entries.append(entry);
+    }
+
+    ::closedir(dir); // also closes dirFd
+
+#else
+    QDir::Filters filters = QDir::Files | QDir::AllDirs | QDir::NoDotAndDotDot;
+    if (m_options.includeHidden) {
+        filters |= QDir::Hidden;
+    }
+    QDirIterator it(path, filters);
+    while (it.hasNext()) {
+        it.next();
+        const QFileInfo& info = it.fileInfo();
+        Entry entry;
+        entry.name = info.fileName();
+        if (info.isDir()) {
+            entry.type = EntryType::Directory;
+        } else if (!matchesGlob(entry.name)) {
+            continue;
+        } else if (m_options.withLastModified) {
+            entry.lastModified = info.lastModified();
+        }
+        entries.append(entry);
+    }
+#endif
+
+    return entries;
+}
+
+bool DirectoryWalker::isAborted() const
+{
+    return m_options.isAborted && m_options.isAborted();
+}
+
+bool DirectoryWalker::matchesGlob(const QString& fileName) const
+{
+    if (m_globs.isEmpty()) {
+        return true;
+    }
+    for (const QRegularExpression& glob : m_globs) {
+        if (glob.match(fileName).hasMatch()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace mediaelch
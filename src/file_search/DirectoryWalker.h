@@ -0,0 +1,103 @@
+#pragma once
+
+#include <QDateTime>
+#include <QRegularExpression>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <functional>
+
+namespace mediaelch {
+
+/// \brief Walks a directory tree and reads subdirectories in parallel.
+///
+/// QDirIterator and QDir::entryList() are convenient but create a QFileInfo
+/// for each entry and scanners then stat() each entry to find out whether
+/// it is a file or directory.  On network shares, this is the dominant cost
+/// of a scan.
+///
+/// On Linux, macOS and FreeBSD, directories are read using readdir() on an
+/// open directory handle and the entry type reported by the filesystem is
+/// used.  Only symbolic links, entries of unknown type and, if requested,
+/// files matching the file glob are stat()'ed, relative to the directory
+/// handle.  Other systems use QDirIterator.
+///
+/// The visitor is called once per directory and decides which subdirectories
+/// are walked.  Subdirectories are read concurrently, so the visitor must be
+/// thread-safe.  A walk usually covers a single media directory, i.e. a single
+/// mount, so Options::parallelism is the number of concurrent requests to that
+/// mount.
+///
+/// \code{cpp}
+///   DirectoryWalker::Options options;
+///   options.fileGlob = {"*.mkv"};
+///   DirectoryWalker walker(options);
+///   walker.walk("/media/movies", [](const QString& dirPath, const QVector<DirectoryWalker::Entry>& entries) {
+///       QStringList subDirs;
+///       // ...
+///       return subDirs;
+///   });
+/// \endcode
+class DirectoryWalker
+{
+public:
+    enum class EntryType : int8_t
+    {
+        File,
+        Directory
+    };
+
+    struct Entry
+    {
+        QString name;
+        EntryType type = EntryType::File;
+        /// Only set for files and only if Options::withLastModified is set.
+        QDateTime lastModified;
+
+        bool isFile() const { return type == EntryType::File; }
+        bool isDir() const { return type == EntryType::Directory; }
+    };
+
+    /// \brief Called for each directory with its entries, possibly from multiple threads at once.
+    /// \return Absolute paths of the subdirectories that shall be walked.
+    using Visitor = std::function<QStringList(const QString& dirPath, const QVector<Entry>& entries)>;
+
+    static constexpr int defaultParallelism = 4;
+
+    struct Options
+    {
+        /// Wildcard patterns such as "*.mkv", compared case-insensitively.
+        /// Only files that match one of them are returned.  Directories are always returned.
+        /// If empty, all files are returned.
+        QStringList fileGlob;
+        /// Whether Entry::lastModified is set for files. Requires a stat() for each returned file.
+        bool withLastModified = false;
+        bool includeHidden = false;
+        /// Number of directories that are read at the same time.
+        int parallelism = defaultParallelism;
+        /// Checked before each directory is read.  Aborts the walk if it returns true.
+        std::function<bool()> isAborted;
+    };
+
+public:
+    explicit DirectoryWalker(Options options);
+
+    /// \brief Walk the directory tree starting at rootPath.
+    /// \details Blocks until all directories are walked or the walk was aborted.
+    ///          Entries are not sorted.
+    void walk(const QString& rootPath, const Visitor& visitor) const;
+
+    /// \brief Read the entries of a single directory, filtered according to the options.
+    /// \details Returns an empty list if the directory can't be read.
+    QVector<Entry> readDirectory(const QString& path) const;
+
+private:
+    bool isAborted() const;
+    bool matchesGlob(const QString& fileName) const;
+
+private:
+    Options m_options;
+    QVector<QRegularExpression> m_globs;
+};
+
+} // namespace mediaelch
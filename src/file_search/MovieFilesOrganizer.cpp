@@ -1,6 +1,7 @@
 #include "src/file_search/MovieFilesOrganizer.h"
 
 #include "file_search/movie/MovieDirScan.h"
+#include "globals/Manager.h"
 #include "log/Log.h"
 #include "media/NameFormatter.h"
 #include "settings/Settings.h"
@@ -26,6 +27,9 @@ void MovieFilesOrganizer::moveToDirs(mediaelch::DirectoryPath dir)
         return;
     }
 
+    // Queued NFO files and images would otherwise be written to the old directory.
+    Manager::instance()->saveQueue()->waitForDone();
+
     QVector<QStringList> contents;
     auto* fileSearcher = new mediaelch::MovieDirScan(this);
     fileSearcher->scanDir(path, path, contents, false, true);
@@ -40,7 +44,7 @@ void MovieFilesOrganizer::moveToDirs(mediaelch::DirectoryPath dir)
     for (const QStringList& movie : asConst(contents)) {
         const auto movieIndex = movie.at(0).lastIndexOf(QDir::separator());
         if (!(movie.at(0).left(movieIndex).endsWith(dirName))) {
-            qCDebug(generic) << "[MovieFilesOrganizer] skipping " << movie.at(0);
+            qCDebug(c_scanner) << "[MovieFilesOrganizer] skipping " << movie.at(0);
             continue;
         }
 
@@ -65,7 +69,7 @@ void MovieFilesOrganizer::moveToDirs(mediaelch::DirectoryPath dir)
             if (!dir2.rename(file,
                     newFolder + QDir::separator()
                         + file.right(file.length() - file.lastIndexOf(QDir::separator()) - 1))) {
-                qCWarning(generic) << "Moving " << file << "to " << newFolder << " failed.";
+                qCWarning(c_scanner) << "Moving " << file << "to " << newFolder << " failed.";
             }
         }
     }
@@ -2,14 +2,46 @@
 
 #include "data/music/Album.h"
 #include "data/music/Artist.h"
+#include "database/AlbumSnapshot.h"
+#include "database/ArtistSnapshot.h"
+#include "database/Database.h"
+#include "file_search/music/MusicDiskLoader.h"
 #include "globals/Manager.h"
 #include "globals/MessageIds.h"
 #include "log/Log.h"
 
-#include <QDirIterator>
-#include <QFileInfo>
+#include <QThread>
 #include <QtConcurrent>
 
+namespace {
+
+/// \brief Restore the given artists or albums from their binary snapshots.
+/// \returns Items without a valid snapshot.  Their NFO content needs to be parsed.
+template<class Snapshot, class T>
+QVector<T*> restoreFromSnapshots(const QVector<T*>& items, const QHash<int, QByteArray>& snapshots)
+{
+    QVector<T*> itemsToParse;
+    for (T* item : items) {
+        const QSignalBlocker blocker(item);
+        if (Snapshot::read(snapshots.value(item->databaseId().toInt()), *item)) {
+            item->controller()->setInfoLoaded(true);
+            item->setHasChanged(false);
+        } else {
+            itemsToParse << item;
+        }
+    }
+    return itemsToParse;
+}
+
+void insertSnapshots(QHash<int, QByteArray>& snapshots, const QHash<int, QByteArray>& snapshotsToAdd)
+{
+    for (auto it = snapshotsToAdd.constBegin(); it != snapshotsToAdd.constEnd(); ++it) {
+        snapshots.insert(it.key(), it.value());
+    }
+}
+
+} // namespace
+
 MusicFileSearcher::MusicFileSearcher(QObject* parent) :
     QObject(parent), m_progressMessageId{Constants::MusicFileSearcherProgressMessageId}, m_aborted{false}
 {
@@ -21,15 +53,15 @@ void MusicFileSearcher::setMusicDirectories(QVector<mediaelch::MediaDirectory> d
     m_directories.clear();
     for (const mediaelch::MediaDirectory& dir : directories) {
         if (filter.isFolderExcluded(dir.path.dirName())) {
-            qCWarning(generic) << "[MusicFileSearcher] Music directory is excluded by advanced settings! "
+            qCWarning(c_scanner) << "[MusicFileSearcher] Music directory is excluded by advanced settings! "
                                   "Is this intended? Directory:"
-                               << dir.path.path();
+                                 << dir.path.path();
 
         } else if (!dir.path.isReadable()) {
-            qCDebug(generic) << "[MusicFileSearcher] Music directory is not readable, skipping:" << dir.path.path();
+            qCDebug(c_scanner) << "[MusicFileSearcher] Music directory is not readable, skipping:" << dir.path.path();
 
         } else {
-            qCDebug(generic) << "[MusicFileSearcher] Adding music directory" << dir.path.path();
+            qCDebug(c_scanner) << "[MusicFileSearcher] Adding music directory" << dir.path.path();
             m_directories.append(dir);
         }
     }
@@ -37,24 +69,27 @@ void MusicFileSearcher::setMusicDirectories(QVector<mediaelch::MediaDirectory> d
 
 void MusicFileSearcher::reload(bool force)
 {
+    if (m_currentJob != nullptr) {
+        qCWarning(c_scanner) << "[MusicFileSearcher] Search already in progress";
+        return;
+    }
+
     m_aborted = false;
+    m_directoryQueue.clear();
 
     emit searchStarted(tr("Searching for Music..."));
     Manager::instance()->musicModel()->clear();
 
-    const auto& filter = Settings::instance()->advanced()->musicFilters();
+    Database* db = Manager::instance()->database();
+    if (force) {
+        db->clearAllArtists();
+    }
 
-    QVector<Artist*> artists;
     QVector<Artist*> artistsFromDb;
-    QVector<Album*> albums;
     QVector<Album*> albumsFromDb;
+    QHash<int, QByteArray> artistSnapshots;
+    QHash<int, QByteArray> albumSnapshots;
 
-    if (force) {
-        Manager::instance()->database()->clearAllArtists();
-    }
-
-    QMap<Artist*, mediaelch::DirectoryPath> artistPaths;
-    QMap<Album*, mediaelch::DirectoryPath> albumPaths;
     for (const mediaelch::MediaDirectory& dir : asConst(m_directories)) {
         if (m_aborted) {
             break;
@@ -64,126 +99,156 @@ void MusicFileSearcher::reload(bool force)
         }
 
         if (dir.autoReload) {
-            Manager::instance()->database()->clearArtistsInDirectory(mediaelch::DirectoryPath(dir.path));
+            db->clearArtistsInDirectory(mediaelch::DirectoryPath(dir.path));
         }
 
         if (dir.autoReload || force) {
-            QDirIterator it(dir.path.path(), QDir::NoDotAndDotDot | QDir::Dirs, QDirIterator::FollowSymlinks);
-            while (it.hasNext()) {
-                if (m_aborted) {
-                    break;
-                }
-
-                it.next();
-
-                if (filter.isFolderExcluded(it.fileInfo().dir().dirName())) {
-                    continue;
-                }
-
-                emit currentDir(it.fileInfo().baseName());
-                auto* artist = new Artist(mediaelch::DirectoryPath(it.filePath()), this);
-                artist->setName(it.fileInfo().baseName());
-                artists.append(artist);
-                artistPaths.insert(artist, mediaelch::DirectoryPath(dir.path));
-
-                QDirIterator itAlbums(it.filePath(), QDir::NoDotAndDotDot | QDir::Dirs, QDirIterator::FollowSymlinks);
-                while (itAlbums.hasNext()) {
-                    itAlbums.next();
-
-                    if (filter.isFolderExcluded(itAlbums.fileInfo().dir().dirName())) {
-                        continue;
-                    }
-
-                    if (itAlbums.fileInfo().baseName() == "extrafanart") {
-                        continue;
-                    }
-                    if (itAlbums.fileInfo().baseName() == "extrathumbs") {
-                        continue;
-                    }
-
-                    auto* album = new Album(mediaelch::DirectoryPath(itAlbums.filePath()), this);
-                    album->setTitle(itAlbums.fileInfo().baseName());
-                    album->setArtistObj(artist);
-                    artist->addAlbum(album);
-                    albums.append(album);
-                    albumPaths.insert(album, mediaelch::DirectoryPath(dir.path));
-                }
-            }
+            // Scanned in a background thread, see loadNext()
+            m_directoryQueue.enqueue(dir);
+
         } else {
-            QVector<Artist*> artistsInPath =
-                Manager::instance()->database()->artistsInDirectory(mediaelch::DirectoryPath(dir.path));
-            for (Artist* artist : artistsInPath) {
-                if (artistsFromDb.count() % 20 == 0) {
-                    emit currentDir(artist->path().toString().mid(dir.path.path().length()));
-                }
-                QVector<Album*> albumsOfArtist = Manager::instance()->database()->albums(artist);
-                artistsFromDb.append(artist);
-                albumsFromDb.append(albumsOfArtist);
-            }
+            const mediaelch::DirectoryPath path(dir.path);
+            QVector<Artist*> artistsInPath = db->artistsInDirectory(path);
+            albumsFromDb.append(db->albumsInDirectory(path, artistsInPath));
+            artistsFromDb.append(artistsInPath);
+            insertSnapshots(artistSnapshots, db->artistSnapshotsInDirectory(path));
+            insertSnapshots(albumSnapshots, db->albumSnapshotsInDirectory(path));
         }
     }
 
     emit currentDir("");
     emit searchStarted(tr("Loading Music..."));
 
-    int current = 0;
-    int max = qsizetype_to_int(artists.length() + albums.length() + artistsFromDb.length() + albumsFromDb.length());
+    // Only artists and albums without a valid snapshot need to have their NFO content parsed.
+    const QVector<Artist*> artistsToParse =
+        restoreFromSnapshots<mediaelch::ArtistSnapshot>(artistsFromDb, artistSnapshots);
+    const QVector<Album*> albumsToParse = restoreFromSnapshots<mediaelch::AlbumSnapshot>(albumsFromDb, albumSnapshots);
 
-    Manager::instance()->database()->transaction();
-    for (Artist* artist : artists) {
-        if (m_aborted) {
-            Manager::instance()->database()->commit();
-            return;
-        }
-        artist->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
-        if (current % 20 == 0) {
-            emit currentDir(artist->name());
+    QtConcurrent::blockingMapped(artistsToParse, MusicFileSearcher::loadArtistData);
+    QtConcurrent::blockingMapped(albumsToParse, MusicFileSearcher::loadAlbumData);
+
+    // Store snapshots so that the next start does not have to parse them again.
+    db->transaction();
+    for (Artist* artist : artistsToParse) {
+        if (artist->controller()->infoLoaded()) {
+            db->setArtistSnapshot(artist->databaseId(), mediaelch::ArtistSnapshot::write(*artist));
         }
-        emit progress(++current, max, m_progressMessageId);
-        Manager::instance()->database()->add(artist, artistPaths.value(artist));
     }
-    for (Album* album : albums) {
-        if (m_aborted) {
-            Manager::instance()->database()->commit();
-            return;
-        }
-        album->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
-        if (current % 20 == 0) {
-            emit currentDir(album->artist() + "/" + album->title());
+    for (Album* album : albumsToParse) {
+        if (album->controller()->infoLoaded()) {
+            db->setAlbumSnapshot(album->databaseId(), mediaelch::AlbumSnapshot::write(*album));
         }
-        emit progress(++current, max, m_progressMessageId);
-        Manager::instance()->database()->add(album, albumPaths.value(album));
     }
-    Manager::instance()->database()->commit();
+    db->commit();
 
-    QtConcurrent::blockingMapped(artistsFromDb, MusicFileSearcher::loadArtistData);
-    QtConcurrent::blockingMapped(albumsFromDb, MusicFileSearcher::loadAlbumData);
+    m_artists = artistsFromDb;
 
-    artists.append(artistsFromDb);
-    albums.append(albumsFromDb);
+    loadNext();
+}
 
-    QMap<Artist*, MusicModelItem*> artistModelItems;
-    for (Artist* artist : artists) {
-        MusicModelItem* artistItem = Manager::instance()->musicModel()->appendChild(artist);
-        artistModelItems.insert(artist, artistItem);
+void MusicFileSearcher::loadNext()
+{
+    if (m_aborted) {
+        return;
     }
-    for (Album* album : albums) {
-        MusicModelItem* artistItem = artistModelItems.value(album->artistObj(), nullptr);
-        if (artistItem == nullptr) {
-            qCWarning(generic) << "Artist item was not found for album" << album->path();
-            continue;
+
+    if (m_directoryQueue.isEmpty()) {
+        addArtistsToModel();
+        emit musicLoaded();
+        return;
+    }
+
+    const mediaelch::MediaDirectory dir = m_directoryQueue.dequeue();
+    auto* loader = new mediaelch::MusicDiskLoader(dir, Settings::instance()->advanced()->musicFilters(), nullptr);
+
+    QThread* thread = mediaelch::worker::createAutoDeleteThreadWithJob(loader, this, "musicloaderthread");
+    connect(loader,
+        &mediaelch::MusicDiskLoader::loaderFinished,
+        this,
+        &MusicFileSearcher::onDirectoryLoaded,
+        Qt::QueuedConnection);
+    connect(loader,
+        &mediaelch::MusicDiskLoader::percentChanged,
+        this,
+        &MusicFileSearcher::onPercentChange,
+        Qt::QueuedConnection);
+    connect(loader,
+        &mediaelch::MusicDiskLoader::progressText,
+        this,
+        &MusicFileSearcher::onProgressText,
+        Qt::QueuedConnection);
+
+    m_currentJob = loader;
+    thread->start();
+}
+
+void MusicFileSearcher::onDirectoryLoaded(mediaelch::MusicDiskLoader* job)
+{
+    // The job lives in another thread, so it must not be deleted directly.
+    auto dls = makeDeleteLaterScope(job);
+    // Due to queued connections, this slot may be called for a job that was aborted already.
+    if (job != m_currentJob) {
+        return;
+    }
+    m_currentJob = nullptr;
+
+    if (m_aborted || job->isAborted()) {
+        return;
+    }
+
+    // The job moved all items into our thread; take ownership.
+    const QVector<Artist*> artists = job->takeArtists();
+    for (Artist* artist : artists) {
+        artist->setParent(this);
+        for (Album* album : artist->albums()) {
+            album->setParent(this);
         }
-        artistItem->appendChild(album);
     }
+    m_artists.append(artists);
 
-    if (!m_aborted) {
-        emit musicLoaded();
+    loadNext();
+}
+
+void MusicFileSearcher::onPercentChange(mediaelch::worker::Job* job, float percent)
+{
+    Q_UNUSED(job)
+    // Use two decimal places for smoother transitions, e.g. 1234 for 12.34%.
+    emit progress(static_cast<int>(percent * 100.f), 10000, m_progressMessageId);
+}
+
+void MusicFileSearcher::onProgressText(mediaelch::MusicDiskLoader* job, QString text)
+{
+    Q_UNUSED(job)
+    emit currentDir(text);
+}
+
+void MusicFileSearcher::addArtistsToModel()
+{
+    const QVector<Artist*> artists = std::move(m_artists);
+    m_artists = {};
+
+    const QVector<MusicModelItem*> artistItems = Manager::instance()->musicModel()->appendChildren(artists);
+    for (elch_ssize_t i = 0; i < artists.size(); ++i) {
+        for (Album* album : artists[i]->albums()) {
+            artistItems[i]->appendChild(album);
+        }
     }
 }
 
 void MusicFileSearcher::abort()
 {
     m_aborted = true;
+    m_directoryQueue.clear();
+
+    if (m_currentJob != nullptr) {
+        m_currentJob->kill();
+        m_currentJob = nullptr;
+    }
+    for (Artist* artist : asConst(m_artists)) {
+        qDeleteAll(artist->albums());
+    }
+    qDeleteAll(m_artists);
+    m_artists.clear();
 }
 
 Artist* MusicFileSearcher::loadArtistData(Artist* artist)
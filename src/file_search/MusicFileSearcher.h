@@ -3,12 +3,20 @@
 #include "globals/MediaDirectory.h"
 
 #include <QObject>
+#include <QQueue>
 #include <QString>
 #include <QVector>
 
 class Album;
 class Artist;
 
+namespace mediaelch {
+class MusicDiskLoader;
+namespace worker {
+class Job;
+}
+} // namespace mediaelch
+
 class MusicFileSearcher : public QObject
 {
     Q_OBJECT
@@ -30,8 +38,23 @@ signals:
     void musicLoaded();
     void currentDir(QString);
 
+private slots:
+    void onDirectoryLoaded(mediaelch::MusicDiskLoader* job);
+    void onPercentChange(mediaelch::worker::Job* job, float percent);
+    void onProgressText(mediaelch::MusicDiskLoader* job, QString text);
+
+private:
+    /// \brief Scan the next queued directory in a background thread or finish the reload.
+    void loadNext();
+    void addArtistsToModel();
+
 private:
     QVector<mediaelch::MediaDirectory> m_directories;
+    /// \brief Directories that need to be scanned from disk.
+    QQueue<mediaelch::MediaDirectory> m_directoryQueue;
+    /// \brief Loaded artists that are added to the model once all directories are loaded.
+    QVector<Artist*> m_artists;
+    mediaelch::MusicDiskLoader* m_currentJob = nullptr;
     int m_progressMessageId;
     bool m_aborted;
 };
@@ -2,6 +2,7 @@
 
 #include "data/tv_show/TvShow.h"
 #include "data/tv_show/TvShowEpisode.h"
+#include "database/EpisodeSnapshot.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
 #include "globals/MessageIds.h"
@@ -9,10 +10,13 @@
 
 #include <QApplication>
 #include <QFileInfo>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QSqlError>
 #include <QSqlQuery>
 #include <QSqlRecord>
 #include <QtConcurrent/QtConcurrentMap>
+#include <algorithm>
 
 TvShowFileSearcher::TvShowFileSearcher(QObject* parent) :
     QObject(parent), m_progressMessageId{Constants::TvShowSearcherProgressMessageId}, m_aborted{false}
@@ -25,15 +29,16 @@ void TvShowFileSearcher::setTvShowDirectories(QVector<mediaelch::MediaDirectory>
     m_directories.clear();
     for (auto& dir : directories) {
         if (filter.isFolderExcluded(dir.path.dirName())) {
-            qCWarning(generic) << "[TvShowFileSearcher] TV show directory is excluded by advanced settings! "
+            qCWarning(c_scanner) << "[TvShowFileSearcher] TV show directory is excluded by advanced settings! "
                                   "Is this intended? Directory:"
-                               << dir.path.path();
+                                 << dir.path.path();
 
         } else if (!dir.path.isReadable()) {
-            qCDebug(generic) << "[TvShowFileSearcher] TV show directory is not readable, skipping:" << dir.path.path();
+            qCDebug(c_scanner) << "[TvShowFileSearcher] TV show directory is not readable, skipping:"
+                               << dir.path.path();
 
         } else {
-            qCDebug(generic) << "[TvShowFileSearcher] Adding TV show directory" << dir.path.path();
+            qCDebug(c_scanner) << "[TvShowFileSearcher] Adding TV show directory" << dir.path.path();
             m_directories.append(dir);
         }
     }
@@ -42,7 +47,7 @@ void TvShowFileSearcher::setTvShowDirectories(QVector<mediaelch::MediaDirectory>
 /// \brief Starts the scan process
 void TvShowFileSearcher::reload(bool force)
 {
-    qCInfo(generic) << "[TvShowFileSearcher] Reload TV shows, clear database:" << force;
+    qCInfo(c_scanner) << "[TvShowFileSearcher] Reload TV shows, clear database:" << force;
     m_aborted = false;
 
     clearOldTvShows(force);
@@ -57,9 +62,11 @@ void TvShowFileSearcher::reload(bool force)
     int episodeCounter = 0;
     const int episodeSum = database().episodeCount();
 
-    QVector<TvShow*> dbShows = getShowsFromDatabase(force);
+    QHash<int, QVector<TvShowEpisode*>> dbEpisodes;
+    QHash<int, QByteArray> episodeSnapshots;
+    QVector<TvShow*> dbShows = getShowsFromDatabase(force, dbEpisodes, episodeSnapshots);
     setupShows(files, episodeCounter, episodeSum);
-    setupShowsFromDatabase(dbShows, episodeCounter, episodeSum);
+    setupShowsFromDatabase(dbShows, dbEpisodes, episodeSnapshots, episodeCounter, episodeSum);
 
     for (TvShow* show : Manager::instance()->tvShowModel()->tvShows()) {
         if (show->showMissingEpisodes()) {
@@ -67,7 +74,7 @@ void TvShowFileSearcher::reload(bool force)
         }
     }
 
-    qCDebug(generic) << "[TvShowFileSearcher] Searching for TV shows done";
+    qCDebug(c_scanner) << "[TvShowFileSearcher] Searching for TV shows done";
     if (!m_aborted) {
         emit tvShowsLoaded();
     }
@@ -168,21 +175,43 @@ TvShowEpisode* TvShowFileSearcher::reloadEpisodeData(TvShowEpisode* episode)
  */
 void TvShowFileSearcher::getTvShows(const mediaelch::DirectoryPath& path, QMap<QString, QVector<QStringList>>& contents)
 {
-    const auto& filter = Settings::instance()->advanced()->tvShowFilters();
-    QDir dir(path.toString());
-    QStringList tvShows = dir.entryList(QDir::Dirs | QDir::NoDotAndDotDot);
-    for (const QString& cDir : tvShows) {
-        if (m_aborted) {
-            return;
+    using mediaelch::DirectoryWalker;
+    const mediaelch::FileFilter filter = episodeFilter();
+    const QString rootPath = path.toString();
+
+    // All shows are walked at once, so that small shows don't wait for large ones.
+    QMutex mutex;
+    const auto visitor = [&](const QString& dirPath, const QVector<DirectoryWalker::Entry>& entries) {
+        QStringList subDirs;
+        if (dirPath == rootPath) {
+            // Each directory is a TV show. Files next to them are ignored.
+            for (const DirectoryWalker::Entry& entry : entries) {
+                if (entry.isDir() && !filter.isFolderExcluded(entry.name)) {
+                    subDirs.append(rootPath + '/' + entry.name);
+                }
+            }
+            QMutexLocker locker(&mutex);
+            for (const QString& showDir : asConst(subDirs)) {
+                contents.insert(showDir, {});
+            }
+            return subDirs;
         }
 
-        if (filter.isFolderExcluded(cDir)) {
-            continue;
-        }
+        emit currentDir(dirPath.mid(rootPath.length()));
+        QVector<QStringList> dirContents;
+        subDirs = addEpisodeFiles(filter, dirPath, entries, dirContents);
+
+        const QString showDir = rootPath + '/' + dirPath.mid(rootPath.length() + 1).section('/', 0, 0);
+        QMutexLocker locker(&mutex);
+        contents[showDir].append(dirContents);
+        return subDirs;
+    };
 
-        QVector<QStringList> tvShowContents;
-        scanTvShowDir(path, path.subDir(cDir), tvShowContents);
-        contents.insert((dir.path() + '/' + cDir), tvShowContents);
+    DirectoryWalker walker(walkerOptions());
+    walker.walk(rootPath, visitor);
+
+    for (auto it = contents.begin(); it != contents.end(); ++it) {
+        sortContents(it.value());
     }
 }
 
@@ -197,62 +226,85 @@ void TvShowFileSearcher::scanTvShowDir(const mediaelch::DirectoryPath& startPath
     const mediaelch::DirectoryPath& path,
     QVector<QStringList>& contents)
 {
-    emit currentDir(path.toString().mid(startPath.toString().length()));
-    const auto& filter = Settings::instance()->advanced()->tvShowFilters();
+    using mediaelch::DirectoryWalker;
+    const mediaelch::FileFilter filter = episodeFilter();
+    const QString startPathStr = startPath.toString();
+
+    QMutex mutex;
+    QVector<QStringList> foundContents;
+    const auto visitor = [&](const QString& dirPath, const QVector<DirectoryWalker::Entry>& entries) {
+        emit currentDir(dirPath.mid(startPathStr.length()));
+        QVector<QStringList> dirContents;
+        const QStringList subDirs = addEpisodeFiles(filter, dirPath, entries, dirContents);
+        QMutexLocker locker(&mutex);
+        foundContents.append(dirContents);
+        return subDirs;
+    };
 
-    QDir dir(path.toString());
-    for (const QString& cDir : dir.entryList(QDir::Dirs | QDir::NoDotAndDotDot)) {
+    DirectoryWalker walker(walkerOptions());
+    walker.walk(path.toString(), visitor);
+
+    sortContents(foundContents);
+    contents.append(foundContents);
+}
+
+QStringList TvShowFileSearcher::addEpisodeFiles(const mediaelch::FileFilter& filter,
+    const QString& path,
+    const QVector<mediaelch::DirectoryWalker::Entry>& entries,
+    QVector<QStringList>& contents)
+{
+    const mediaelch::DirectoryPath dirPath(path);
+
+    QStringList subDirs;
+    QStringList files;
+    for (const mediaelch::DirectoryWalker::Entry& entry : entries) {
         if (m_aborted) {
-            return;
+            return {};
         }
+        const QString& name = entry.name;
 
-        if (filter.isFolderExcluded(cDir)) {
+        if (entry.isFile()) {
+            // Also skips trailers and sample files, see episodeFilter().
+            if (!filter.isFileExcluded(name)) {
+                files.append(name);
+            }
+            continue;
+        }
+
+        if (filter.isFolderExcluded(name)) {
             continue;
         }
 
         // Skip "Extras" folder
-        if (QString::compare(cDir, "Extras", Qt::CaseInsensitive) == 0
-            || QString::compare(cDir, ".actors", Qt::CaseInsensitive) == 0
-            || QString::compare(cDir, "extrafanarts", Qt::CaseInsensitive) == 0) {
+        if (QString::compare(name, "Extras", Qt::CaseInsensitive) == 0
+            || QString::compare(name, ".actors", Qt::CaseInsensitive) == 0
+            || QString::compare(name, "extrafanarts", Qt::CaseInsensitive) == 0) {
             continue;
         }
 
         // Handle DVD
-        if (helper::isDvd(path.subDir(cDir))) {
-            contents.append(QStringList() << (path.toString() + "/" + cDir + "/VIDEO_TS/VIDEO_TS.IFO"));
+        if (helper::isDvd(dirPath.subDir(name))) {
+            contents.append(QStringList() << (path + "/" + name + "/VIDEO_TS/VIDEO_TS.IFO"));
             continue;
         }
-        if (helper::isDvd(path.subDir(cDir), true)) {
-            contents.append(QStringList() << (path.toString() + "/" + cDir + "/VIDEO_TS.IFO"));
+        if (helper::isDvd(dirPath.subDir(name), true)) {
+            contents.append(QStringList() << (path + "/" + name + "/VIDEO_TS.IFO"));
             continue;
         }
 
         // Handle BluRay
-        if (helper::isBluRay(path.subDir(cDir))) {
-            contents.append(QStringList() << (path.toString() + "/" + cDir + "/BDMV/index.bdmv"));
+        if (helper::isBluRay(dirPath.subDir(name))) {
+            contents.append(QStringList() << (path + "/" + name + "/BDMV/index.bdmv"));
             continue;
         }
-        scanTvShowDir(startPath, path.subDir(cDir), contents);
-    }
-
-    QStringList files;
-    QStringList entries = getFiles(path);
-    for (const QString& file : entries) {
-        if (filter.isFileExcluded(file)) {
-            continue;
-        }
-        // Skip Trailers and Sample files
-        if (file.contains("-trailer", Qt::CaseInsensitive) || file.contains("-sample", Qt::CaseInsensitive)) {
-            continue;
-        }
-        files.append(file);
+        subDirs.append(path + "/" + name);
     }
     files.sort();
 
     QRegularExpression rx("((?:part|cd)[\\s_]*)(\\d+)", QRegularExpression::CaseInsensitiveOption);
     for (elch_ssize_t i = 0, n = files.size(); i < n; i++) {
         if (m_aborted) {
-            return;
+            return {};
         }
 
         QStringList tvShowFiles;
@@ -261,7 +313,7 @@ void TvShowFileSearcher::scanTvShowDir(const mediaelch::DirectoryPath& startPath
             continue;
         }
 
-        tvShowFiles << (path.toString() + '/' + file);
+        tvShowFiles << (path + '/' + file);
 
         QRegularExpressionMatch match = rx.match(file);
         elch_ssize_t pos = match.capturedStart(0);
@@ -272,7 +324,7 @@ void TvShowFileSearcher::scanTvShowDir(const mediaelch::DirectoryPath& startPath
                 QString subFile = files.at(x);
                 if (subFile != file) {
                     if (subFile.startsWith(left) && subFile.endsWith(right)) {
-                        tvShowFiles << (path.toString() + '/' + subFile);
+                        tvShowFiles << (path + '/' + subFile);
                         files[x] = ""; // set an empty file name, this way we can skip this file in the main loop
                     }
                 }
@@ -282,14 +334,31 @@ void TvShowFileSearcher::scanTvShowDir(const mediaelch::DirectoryPath& startPath
             contents.append(tvShowFiles);
         }
     }
+    return subDirs;
+}
+
+mediaelch::FileFilter TvShowFileSearcher::episodeFilter()
+{
+    mediaelch::FileFilter filter = Settings::instance()->advanced()->tvShowFilters();
+    filter.excludeFileNamesContaining({"-trailer", "-sample"});
+    return filter;
 }
 
-/// Get a list of files in a directory
-QStringList TvShowFileSearcher::getFiles(const mediaelch::DirectoryPath& path)
+mediaelch::DirectoryWalker::Options TvShowFileSearcher::walkerOptions()
 {
-    const auto& fileFilter = Settings::instance()->advanced()->tvShowFilters();
-    QDir dir(path.dir());
-    return dir.entryList(fileFilter.fileGlob, QDir::Files | QDir::System);
+    mediaelch::DirectoryWalker::Options options;
+    options.fileGlob = Settings::instance()->advanced()->tvShowFilters().fileGlob;
+    options.parallelism = Settings::instance()->advanced()->directoryScanThreads();
+    options.isAborted = [this]() { return m_aborted; };
+    return options;
+}
+
+void TvShowFileSearcher::sortContents(QVector<QStringList>& contents)
+{
+    // Directories are scanned in parallel. Sort the result so that it does not depend on timing.
+    std::sort(contents.begin(), contents.end(), [](const QStringList& a, const QStringList& b) {
+        return a.first() < b.first();
+    });
 }
 
 void TvShowFileSearcher::abort()
@@ -466,30 +535,74 @@ void TvShowFileSearcher::clearOldTvShows(bool forceClear)
     }
 }
 
-void TvShowFileSearcher::setupShowsFromDatabase(QVector<TvShow*>& dbShows, int episodeCounter, int episodeSum)
+void TvShowFileSearcher::setupShowsFromDatabase(const QVector<TvShow*>& dbShows,
+    QHash<int, QVector<TvShowEpisode*>>& dbEpisodes,
+    QHash<int, QByteArray>& episodeSnapshots,
+    int episodeCounter,
+    int episodeSum)
 {
-    for (TvShow* show : dbShows) {
+    // Shows are set up and handed to the model in batches. All episodes of a batch are
+    // parsed at once, which parallelizes a lot better than the few episodes of a single show.
+    const int minEpisodesPerBatch = 500;
+
+    elch_ssize_t next = 0;
+    while (next < dbShows.size()) {
         if (m_aborted) {
+            for (const auto& episodes : asConst(dbEpisodes)) {
+                qDeleteAll(episodes);
+            }
+            dbEpisodes.clear();
             return;
         }
 
-        show->loadData(Manager::instance()->mediaCenterInterfaceTvShow(), false);
+        QVector<TvShow*> batch;
+        QVector<TvShowEpisode*> batchEpisodes;
+        while (next < dbShows.size() && batchEpisodes.size() < minEpisodesPerBatch) {
+            TvShow* show = dbShows[next++];
+            batch.append(show);
+            batchEpisodes.append(dbEpisodes.value(show->databaseId().toInt()));
+        }
 
-        QVector<TvShowEpisode*> episodes = database().episodes(show->databaseId());
-        QtConcurrent::blockingMapped(episodes, TvShowFileSearcher::loadEpisodeData);
-        for (TvShowEpisode* episode : episodes) {
-            if (episode == nullptr) {
-                continue;
+        for (TvShow* show : asConst(batch)) {
+            show->loadData(Manager::instance()->mediaCenterInterfaceTvShow(), false);
+        }
+
+        // Restore episodes from their binary snapshots. Only episodes without a valid
+        // snapshot need to have their NFO content parsed.
+        QVector<TvShowEpisode*> episodesToParse;
+        for (TvShowEpisode* episode : asConst(batchEpisodes)) {
+            const QSignalBlocker blocker(episode);
+            if (mediaelch::EpisodeSnapshot::read(episodeSnapshots.take(episode->databaseId().toInt()), *episode)) {
+                episode->setInfosLoaded(true);
+                episode->setChanged(false);
+            } else {
+                episodesToParse << episode;
             }
-            episode->setShow(show);
-            show->addEpisode(episode);
-            emit progress(++episodeCounter, episodeSum, m_progressMessageId);
-            if (episodeCounter % 1000 == 0) {
-                emit currentDir("");
+        }
+        QtConcurrent::blockingMap(episodesToParse, [](TvShowEpisode* episode) { loadEpisodeData(episode); });
+
+        // Store snapshots so that the next start does not have to parse these episodes again.
+        database().transaction();
+        for (TvShowEpisode* episode : asConst(episodesToParse)) {
+            if (episode->infoLoaded()) {
+                database().setEpisodeSnapshot(episode->databaseId(), mediaelch::EpisodeSnapshot::write(*episode));
+            }
+        }
+        database().commit();
+
+        for (TvShow* show : asConst(batch)) {
+            const QVector<TvShowEpisode*> episodes = dbEpisodes.take(show->databaseId().toInt());
+            for (TvShowEpisode* episode : episodes) {
+                episode->setShow(show);
+                show->addEpisode(episode);
+                emit progress(++episodeCounter, episodeSum, m_progressMessageId);
+                if (episodeCounter % 1000 == 0) {
+                    emit currentDir("");
+                }
             }
         }
 
-        Manager::instance()->tvShowModel()->appendShow(show);
+        Manager::instance()->tvShowModel()->appendShows(batch);
     }
 }
 
@@ -591,7 +704,9 @@ QMap<QString, QVector<QStringList>> TvShowFileSearcher::readTvShowContent(bool f
 }
 
 
-QVector<TvShow*> TvShowFileSearcher::getShowsFromDatabase(bool forceReload)
+QVector<TvShow*> TvShowFileSearcher::getShowsFromDatabase(bool forceReload,
+    QHash<int, QVector<TvShowEpisode*>>& dbEpisodes,
+    QHash<int, QByteArray>& episodeSnapshots)
 {
     if (forceReload) {
         return {};
@@ -608,6 +723,14 @@ QVector<TvShow*> TvShowFileSearcher::getShowsFromDatabase(bool forceReload)
         QVector<TvShow*> showsFromDatabase = database().showsInDirectory(mediaelch::DirectoryPath(dir.path));
         if (!showsFromDatabase.isEmpty()) {
             dbShows.append(showsFromDatabase);
+            const auto episodesFromDatabase = database().episodesInDirectory(mediaelch::DirectoryPath(dir.path));
+            for (auto it = episodesFromDatabase.constBegin(); it != episodesFromDatabase.constEnd(); ++it) {
+                dbEpisodes.insert(it.key(), it.value());
+            }
+            const auto snapshots = database().episodeSnapshotsInDirectory(mediaelch::DirectoryPath(dir.path));
+            for (auto it = snapshots.constBegin(); it != snapshots.constEnd(); ++it) {
+                episodeSnapshots.insert(it.key(), it.value());
+            }
         }
     }
     return dbShows;
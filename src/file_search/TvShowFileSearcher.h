@@ -1,10 +1,13 @@
 #pragma once
 
 #include "data/tv_show/TvShowEpisode.h"
+#include "file_search/DirectoryWalker.h"
 #include "globals/MediaDirectory.h"
+#include "media/FileFilter.h"
 #include "media/Path.h"
 
 #include <QDir>
+#include <QHash>
 #include <QObject>
 
 class Database;
@@ -38,7 +41,16 @@ private:
     void scanTvShowDir(const mediaelch::DirectoryPath& startPath,
         const mediaelch::DirectoryPath& path,
         QVector<QStringList>& contents);
-    QStringList getFiles(const mediaelch::DirectoryPath& path);
+    /// \brief Group the episode files of a directory and add them to contents.
+    /// \return Subdirectories that shall be scanned.
+    QStringList addEpisodeFiles(const mediaelch::FileFilter& filter,
+        const QString& path,
+        const QVector<mediaelch::DirectoryWalker::Entry>& entries,
+        QVector<QStringList>& contents);
+    /// \brief TV show filter of the advanced settings that additionally skips trailers and samples.
+    static mediaelch::FileFilter episodeFilter();
+    mediaelch::DirectoryWalker::Options walkerOptions();
+    static void sortContents(QVector<QStringList>& contents);
     bool m_aborted;
 
 private:
@@ -47,7 +59,15 @@ private:
     void clearOldTvShows(bool forceClear);
     /// \brief Get a map of TV show paths and their respective files in the show folder.
     QMap<QString, QVector<QStringList>> readTvShowContent(bool forceReload);
-    QVector<TvShow*> getShowsFromDatabase(bool forceReload);
+    /// \brief Get all shows from the database and their episodes, indexed by the show's database id.
+    /// \param episodeSnapshots Binary snapshots of the episodes, indexed by the episode's database id.
+    QVector<TvShow*> getShowsFromDatabase(bool forceReload,
+        QHash<int, QVector<TvShowEpisode*>>& dbEpisodes,
+        QHash<int, QByteArray>& episodeSnapshots);
     void setupShows(QMap<QString, QVector<QStringList>>& contents, int& episodeCounter, int episodeSum);
-    void setupShowsFromDatabase(QVector<TvShow*>& dbShows, int episodeCounter, int episodeSum);
+    void setupShowsFromDatabase(const QVector<TvShow*>& dbShows,
+        QHash<int, QVector<TvShowEpisode*>>& dbEpisodes,
+        QHash<int, QByteArray>& episodeSnapshots,
+        int episodeCounter,
+        int episodeSum);
 };
@@ -1,11 +1,14 @@
 #include "MovieDirectorySearcher.h"
 
 #include "database/Database.h"
+#include "database/MovieSnapshot.h"
+#include "file_search/DirectoryWalker.h"
 #include "globals/Manager.h"
 #include "globals/MediaDirectory.h"
 #include "log/Log.h"
 #include "media/FilenameUtils.h"
-
+#include "media_center/MediaCenterInterface.h"
+#include "settings/Settings.h"
 
 #include <QMutexLocker>
 #include <QtConcurrent>
@@ -72,6 +75,15 @@ MovieDiskLoader::MovieDiskLoader(mediaelch::MediaDirectory dir,
     QObject* parent) :
     MovieLoader(&store, parent), m_dir{std::move(dir)}, m_filter{std::move(filter)}, m_db{Database::newConnection(this)}
 {
+    // Skip extras files.  Checked together with the user's exclude patterns.
+    m_filter.excludeFileNamesContaining({"-trailer",
+        "-sample",
+        "-behindthescenes",
+        "-deleted",
+        "-featurette",
+        "-interview",
+        "-scene",
+        "-short"});
 }
 
 MovieDiskLoader::~MovieDiskLoader()
@@ -116,6 +128,10 @@ void MovieDiskLoader::doStart()
     // emitting signals is thread safe.
     QtConcurrent::blockingMap(m_contents, [this](const QStringList& files) { createMovie(files); });
 
+    // Listings are outdated as soon as files are written.
+    Manager::instance()->mediaCenterInterface()->directoryListings().remove(m_listedDirectories);
+    m_listedDirectories.clear();
+
     storeAndAddToDatabase();
 
     if (!isAborted()) {
@@ -131,103 +147,111 @@ bool MovieDiskLoader::doKill()
 
 void MovieDiskLoader::loadMovieContents()
 {
-    QQueue<QString> dirs;
-    dirs.enqueue(m_dir.path.path());
+    DirectoryWalker::Options options;
+    options.fileGlob = m_filter.fileGlob;
+    options.withLastModified = true;
+    options.parallelism = Settings::instance()->advanced()->directoryScanThreads();
+    options.isAborted = [this]() { return isAborted(); };
+
+    DirectoryWalker walker(options);
+    walker.walk(m_dir.path.path(), [this](const QString& dirPath, const QVector<DirectoryWalker::Entry>& entries) {
+        return addDirectoryContents(dirPath, entries);
+    });
+}
 
-    QString lastDir;
+QStringList MovieDiskLoader::addDirectoryContents(const QString& dirPath,
+    const QVector<DirectoryWalker::Entry>& entries)
+{
+    // Note: This method is called in parallel!
 
-    while (!dirs.isEmpty()) {
-        QString dir(dirs.dequeue());
+    QStringList subDirs;
+    const QString dirName = QDir(dirPath).dirName();
+    if (m_filter.isFolderExcluded(dirName)) {
+        return subDirs;
+    }
 
-        QDirIterator it(dir, m_filter.fileGlob, QDir::NoDotAndDotDot | QDir::AllDirs | QDir::Files);
+    QStringList files;
+    QHash<QString, QDateTime> lastModifications;
+    QStringList bluRayDirectories;
+    QStringList dvdDirectories;
 
-        while (it.hasNext()) {
-            if (isAborted()) {
-                return;
-            }
-            it.next();
-
-            QString dirName = it.fileInfo().dir().dirName();
-            QString fileName = it.fileName(); // may actually be a directory name
+    for (const DirectoryWalker::Entry& entry : entries) {
+        if (isAborted()) {
+            return {};
+        }
 
-            const bool isFile = it.fileInfo().isFile();
-            const bool isDir = it.fileInfo().isDir();
-            bool isSpecialDir = false; // set to true for DVD or BluRay Structure
+        const QString& fileName = entry.name; // may actually be a directory name
+        const bool isFile = entry.isFile();
+        const bool isDir = entry.isDir();
+        bool isSpecialDir = false; // set to true for DVD or BluRay Structure
 
-            if (isFile && m_filter.isFileExcluded(fileName)) {
-                continue;
-            }
+        // Also skips extras files, see constructor.
+        if (isFile && m_filter.isFileExcluded(fileName)) {
+            continue;
+        }
 
-            if ((isDir && m_filter.isFolderExcluded(fileName)) || m_filter.isFolderExcluded(dirName)) {
-                continue;
-            }
+        if (isDir && m_filter.isFolderExcluded(fileName)) {
+            continue;
+        }
 
-            // Skips Extras files
-            if (isFile
-                && (fileName.contains("-trailer", Qt::CaseInsensitive)
-                    || fileName.contains("-sample", Qt::CaseInsensitive)
-                    || fileName.contains("-behindthescenes", Qt::CaseInsensitive)
-                    || fileName.contains("-deleted", Qt::CaseInsensitive)
-                    || fileName.contains("-featurette", Qt::CaseInsensitive)
-                    || fileName.contains("-interview", Qt::CaseInsensitive)
-                    || fileName.contains("-scene", Qt::CaseInsensitive)
-                    || fileName.contains("-short", Qt::CaseInsensitive))) {
-                continue;
-            }
+        // Skip folders and all files inside them
+        if (isDir
+            && (QString::compare(".actors", fileName, Qt::CaseInsensitive) == 0
+                || QString::compare("extras", fileName, Qt::CaseInsensitive) == 0
+                || QString::compare("featurettes", fileName, Qt::CaseInsensitive) == 0
+                || QString::compare("extrafanart", fileName, Qt::CaseInsensitive) == 0
+                || QString::compare("extrathumbs", fileName, Qt::CaseInsensitive) == 0)) {
+            continue;
+        }
 
-            // Skip folders and all files inside them
-            if (isDir
-                && (QString::compare(".actors", fileName, Qt::CaseInsensitive) == 0
-                    || QString::compare("extras", fileName, Qt::CaseInsensitive) == 0
-                    || QString::compare("featurettes", fileName, Qt::CaseInsensitive) == 0
-                    || QString::compare("extrafanart", fileName, Qt::CaseInsensitive) == 0
-                    || QString::compare("extrathumbs", fileName, Qt::CaseInsensitive) == 0)) {
-                continue;
-            }
+        // Skip BluRay backup folder
+        if (QString::compare("backup", dirName, Qt::CaseInsensitive) == 0
+            && QString::compare("index.bdmv", fileName, Qt::CaseInsensitive) == 0) {
+            continue;
+        }
 
-            // Skip BluRay backup folder
-            if (QString::compare("backup", dirName, Qt::CaseInsensitive) == 0
-                && QString::compare("index.bdmv", fileName, Qt::CaseInsensitive) == 0) {
-                continue;
-            }
+        if (isFile && QString::compare("index.bdmv", fileName, Qt::CaseInsensitive) == 0) {
+            const bool isBdmvDir = QString::compare(dirName, "BDMV", Qt::CaseInsensitive) == 0;
+            bluRayDirectories << (isBdmvDir ? QFileInfo(dirPath).path() : dirPath);
+            isSpecialDir = true;
+        }
+        if (QString::compare("VIDEO_TS.IFO", fileName, Qt::CaseInsensitive) == 0) {
+            const bool isVideoTsDir = QString::compare(dirName, "VIDEO_TS", Qt::CaseInsensitive) == 0;
+            dvdDirectories << (isVideoTsDir ? QFileInfo(dirPath).path() : dirPath);
+            isSpecialDir = true;
+        }
 
-            if (isFile && QString::compare("index.bdmv", fileName, Qt::CaseInsensitive) == 0) {
-                QDir bluRayDir(it.fileInfo().dir());
-                if (QString::compare(bluRayDir.dirName(), "BDMV", Qt::CaseInsensitive) == 0) {
-                    bluRayDir.cdUp();
-                }
-                m_bluRayDirectories << bluRayDir.path();
-                isSpecialDir = true;
-            }
-            if (QString::compare("VIDEO_TS.IFO", fileName, Qt::CaseInsensitive) == 0) {
-                QDir videoDir(it.fileInfo().dir());
-                if (QString::compare(videoDir.dirName(), "VIDEO_TS", Qt::CaseInsensitive) == 0) {
-                    videoDir.cdUp();
-                }
-                m_dvdDirectories << videoDir.path();
-                isSpecialDir = true;
-            }
+        const QString filePath = dirPath + "/" + fileName;
+        if (isFile || isSpecialDir) {
+            files.append(filePath);
+            lastModifications.insert(filePath, entry.lastModified);
+        } else {
+            subDirs.append(filePath);
+        }
+    }
 
-            const QString dirPath = it.fileInfo().path();
-            if (isFile || isSpecialDir) {
-                if (!m_contents.contains(dirPath)) {
-                    m_contents.insert(dirPath, {});
-                }
-                m_contents[dirPath].append(it.filePath());
-                m_lastModifications.insert(it.filePath(), it.fileInfo().lastModified());
-            } else {
-                dirs.enqueue(it.filePath());
-            }
+    if (files.isEmpty() && bluRayDirectories.isEmpty() && dvdDirectories.isEmpty()) {
+        return subDirs;
+    }
 
-            if (dirName != lastDir) {
-                lastDir = dirName;
-                // TODO: Use SignalThrottler
-                if (m_contents.count() % 40 == 0) {
-                    emit progressText(this, dirName);
-                }
-            }
+    QMutexLocker locker(&m_mutex);
+    if (!files.isEmpty()) {
+        m_contents[dirPath].append(files);
+        for (auto it = lastModifications.cbegin(); it != lastModifications.cend(); ++it) {
+            m_lastModifications.insert(it.key(), it.value());
         }
     }
+    m_bluRayDirectories.append(bluRayDirectories);
+    m_dvdDirectories.append(dvdDirectories);
+    const bool reportProgress = !files.isEmpty() && m_contents.count() % 40 == 0;
+    locker.unlock();
+
+    if (reportProgress) {
+        // TODO: Use SignalThrottler
+        emit progressText(this, dirName);
+    }
+
+    return subDirs;
 }
 
 void MovieDiskLoader::createMovie(QStringList files)
@@ -268,6 +292,26 @@ void MovieDiskLoader::createMovie(QStringList files)
         return;
     }
 
+    // Read the movie's directory only once. Looking up NFO, artwork and subtitle
+    // files uses this listing instead of checking each possible file name.
+    DirectoryListingCache& listings = Manager::instance()->mediaCenterInterface()->directoryListings();
+    const QFileInfo firstFile(files.first());
+    QStringList listedDirs{firstFile.absolutePath()};
+    const DirectoryListing listing = listings.add(firstFile.absolutePath());
+    if (discType != DiscType::Single) {
+        // Artwork of discs is stored next to the BDMV or VIDEO_TS folder, see KodiXml::getPath().
+        const QString discDirName = firstFile.dir().dirName();
+        if (QString::compare(discDirName, "BDMV", Qt::CaseInsensitive) == 0
+            || QString::compare(discDirName, "VIDEO_TS", Qt::CaseInsensitive) == 0) {
+            listedDirs << QFileInfo(firstFile.absolutePath()).absolutePath();
+            listings.add(listedDirs.last());
+        }
+    }
+    {
+        QMutexLocker lock(&m_mutex);
+        m_listedDirectories << listedDirs;
+    }
+
     if (files.count() == 1 || m_dir.separateFolders) {
         // single file or in separate folder
         mediaelch::file::sortFilenameList(files);
@@ -282,9 +326,10 @@ void MovieDiskLoader::createMovie(QStringList files)
         movie->controller()->loadData(Manager::instance()->mediaCenterInterface());
         if (discType == DiscType::Single) {
             QFileInfo mFi(files.first());
-            const QList<QFileInfo> subFiles = mFi.dir().entryInfoList(
-                QStringList{"*.sub", "*.srt", "*.smi", "*.ssa"}, QDir::Files | QDir::NoDotAndDotDot);
-            for (const QFileInfo& subFi : subFiles) {
+            const QStringList subFiles = listing.filesWithSuffix({"sub", "srt", "smi", "ssa"});
+            for (const QString& subFile : subFiles) {
+                // Only string operations, QFileInfo does not access the filesystem here.
+                const QFileInfo subFi(mFi.absolutePath() + "/" + subFile);
                 QString subFileName = subFi.fileName().mid(mFi.completeBaseName().length() + 1);
                 QStringList parts = subFileName.split(QRegularExpression(R"(\s+|\-+|\.+)"));
                 if (parts.isEmpty()) {
@@ -294,9 +339,9 @@ void MovieDiskLoader::createMovie(QStringList files)
 
                 QStringList subSubFiles = QStringList() << subFi.fileName();
                 if (QString::compare(subFi.suffix(), "sub", Qt::CaseInsensitive) == 0) {
-                    QFileInfo subIdxFi(subFi.absolutePath() + "/" + subFi.completeBaseName() + ".idx");
-                    if (subIdxFi.exists()) {
-                        subSubFiles << subIdxFi.fileName();
+                    const QString idxFile = subFi.completeBaseName() + ".idx";
+                    if (listings.isFile(subFi.absolutePath(), idxFile)) {
+                        subSubFiles << idxFile;
                     }
                 }
                 auto* subtitle = new Subtitle(movie);
@@ -391,6 +436,9 @@ void MovieDiskLoader::storeAndAddToDatabase()
         // We do this in just one thread.
         movie->setLabel(m_db->getLabel(movie->files()));
         m_db->addMovie(movie, m_dir.path);
+        if (movie->controller()->infoLoaded()) {
+            m_db->setMovieSnapshot(movie->databaseId(), MovieSnapshot::write(*movie));
+        }
         m_store->addMovie(movie);
     }
     m_db->commit();
@@ -405,11 +453,8 @@ void MovieDatabaseLoader::doStart()
     emitPercent(0, 0);
     emit progressText(this, "");
 
-    QVector<Movie*> movies;
-    {
-        std::unique_ptr<Database> db(Database::newConnection(this));
-        movies = db->moviesInDirectory(m_dir.path, this);
-    }
+    std::unique_ptr<Database> db(Database::newConnection(this));
+    QVector<Movie*> movies = db->moviesInDirectory(m_dir.path, this);
     if (isAborted()) {
         return;
     }
@@ -418,8 +463,24 @@ void MovieDatabaseLoader::doStart()
         return;
     }
 
+    // Restore movies from their binary snapshots. Only movies without a valid
+    // snapshot need to have their NFO content parsed.
+    const QHash<int, QByteArray> snapshots = db->movieSnapshotsInDirectory(m_dir.path);
+    QVector<Movie*> moviesToParse;
+    for (Movie* movie : asConst(movies)) {
+        const QSignalBlocker blocker(movie);
+        if (MovieSnapshot::read(snapshots.value(movie->databaseId().toInt()), *movie)) {
+            movie->controller()->setInfoLoaded(true);
+            movie->setChanged(false);
+        } else {
+            moviesToParse << movie;
+        }
+    }
+    qCDebug(c_movie) << "[Movie] Restored" << (movies.count() - moviesToParse.count())
+                     << "movies from snapshots, parsing" << moviesToParse.count() << "NFO files";
+
     // Note, this takes less than a few seconds. No need to check whether we're aborted or not.
-    QtConcurrent::blockingMap(movies,
+    QtConcurrent::blockingMap(moviesToParse,
         [](Movie* movie) { //
             movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), false, false);
         });
@@ -428,6 +489,15 @@ void MovieDatabaseLoader::doStart()
         return;
     }
 
+    // Store snapshots so that the next start does not have to parse these movies again.
+    db->transaction();
+    for (Movie* movie : asConst(moviesToParse)) {
+        if (movie->controller()->infoLoaded()) {
+            db->setMovieSnapshot(movie->databaseId(), MovieSnapshot::write(*movie));
+        }
+    }
+    db->commit();
+
     emitPercent(1, 1);
     emit progressText(this, "");
 
@@ -444,18 +514,9 @@ bool MovieDatabaseLoader::doKill()
     return true;
 }
 
-QThread* createAutoDeleteThreadWithMovieLoader(MovieLoader* worker, QObject* threadParent)
+QThread* createAutoDeleteThreadWithMovieLoader(MovieLoader* loader, QObject* threadParent)
 {
-    QThread* thread = new QThread(threadParent);
-    MediaElch_Assert(thread != nullptr);
-    thread->setObjectName("movieloaderthread");
-    worker->moveToThread(thread);
-
-    // Startup & delete setup
-    QObject::connect(thread, &QThread::started, worker, &MovieLoader::start);
-    QObject::connect(worker, &MovieLoader::destroyed, thread, &QThread::quit);
-    QObject::connect(thread, &QThread::finished, thread, &QThread::deleteLater);
-    return thread;
+    return worker::createAutoDeleteThreadWithJob(loader, threadParent, "movieloaderthread");
 }
 
 } // namespace mediaelch
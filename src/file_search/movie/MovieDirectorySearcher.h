@@ -1,5 +1,6 @@
 #pragma once
 
+#include "file_search/DirectoryWalker.h"
 #include "globals/MediaDirectory.h"
 #include "media/FileFilter.h"
 #include "workers/Job.h"
@@ -86,6 +87,8 @@ protected:
 
 private:
     void loadMovieContents();
+    /// \brief Add the movie files of the given directory. Returns subdirectories that shall be scanned.
+    QStringList addDirectoryContents(const QString& dirPath, const QVector<DirectoryWalker::Entry>& entries);
     void createMovie(QStringList files);
     /// \brief Store all loaded movies into the MovieLoaderStore and database.
     void storeAndAddToDatabase();
@@ -105,6 +108,8 @@ private:
     QStringList m_bluRayDirectories;
     QStringList m_dvdDirectories;
     QMap<QString, QStringList> m_contents;
+    /// Directories whose listings were added to the MediaCenterInterface.
+    QStringList m_listedDirectories;
 };
 
 /// \brief Load movies from database
@@ -188,7 +188,7 @@ void MovieFileSearcher::loadNext()
 void MovieFileSearcher::abort(bool quiet)
 {
     if (!quiet) {
-        qCDebug(generic) << "[Movie] Aborted movie file searcher!";
+        qCDebug(c_scanner) << "[Movie] Aborted movie file searcher!";
     }
     m_aborted = true;
     m_running = false;
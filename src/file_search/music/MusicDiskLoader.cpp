@@ -0,0 +1,225 @@
+#include "file_search/music/MusicDiskLoader.h"
+
+#include "data/music/Album.h"
+#include "data/music/Artist.h"
+#include "database/Database.h"
+#include "globals/Manager.h"
+#include "log/Log.h"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QThread>
+#include <QtConcurrent>
+#include <algorithm>
+#include <memory>
+
+namespace {
+
+// Number of artists (including their albums) that are stored in one database transaction.
+constexpr int DATABASE_BATCH_SIZE = 250;
+
+struct ArtistAlbumDirs
+{
+    Artist* artist = nullptr;
+    QStringList albumDirs;
+};
+
+} // namespace
+
+namespace mediaelch {
+
+MusicDiskLoader::MusicDiskLoader(mediaelch::MediaDirectory dir, FileFilter filter, QObject* parent) :
+    worker::Job(parent), m_dir{std::move(dir)}, m_filter{std::move(filter)}, m_resultThread{QThread::currentThread()}
+{
+    // Instances are run in another thread with its own event loop. Auto-delete would
+    // delete the job before the (queued) slots that take its results are invoked.
+    setAutoDelete(false);
+    connect(this, &worker::Job::finished, this, [this](worker::Job* /*unused*/) { emit loaderFinished(this); });
+}
+
+MusicDiskLoader::~MusicDiskLoader()
+{
+    // Albums are not children of their artists.
+    qDeleteAll(m_albums);
+    qDeleteAll(m_artists);
+}
+
+QVector<Artist*> MusicDiskLoader::takeArtists()
+{
+    QVector<Artist*> artists = std::move(m_artists);
+    m_artists = {};
+    m_albums.clear();
+    return artists;
+}
+
+void MusicDiskLoader::doStart()
+{
+    qCInfo(c_scanner) << "[Music] Scanning directory:" << QDir::toNativeSeparators(m_dir.path.path());
+
+    emitPercent(0, 0);
+    emit progressText(this, "");
+
+    const QStringList artistDirs = subDirectories(m_dir.path.path(), false);
+    for (const QString& artistDir : artistDirs) {
+        auto* artist = new Artist(mediaelch::DirectoryPath(artistDir), nullptr);
+        artist->setName(QFileInfo(artistDir).baseName());
+        m_artists.append(artist);
+    }
+
+    if (isAborted()) {
+        return;
+    }
+
+    // Phase 1: Scan album directories in parallel.  Only their paths are collected, because
+    // QObjects belong to the thread that creates them: all artists and albums must be created
+    // in this thread, so that they can be moved to the result thread below.
+    // Can be blocking as this job must NOT be run in the GUI thread.
+    QVector<ArtistAlbumDirs> artistAlbumDirs;
+    artistAlbumDirs.reserve(m_artists.size());
+    for (Artist* artist : asConst(m_artists)) {
+        artistAlbumDirs.append({artist, {}});
+    }
+    QtConcurrent::blockingMap(artistAlbumDirs, [this](ArtistAlbumDirs& entry) {
+        entry.albumDirs = subDirectories(entry.artist->path().toString(), true);
+    });
+
+    if (isAborted()) {
+        return;
+    }
+
+    for (const ArtistAlbumDirs& entry : asConst(artistAlbumDirs)) {
+        for (const QString& albumDir : entry.albumDirs) {
+            auto* album = new Album(mediaelch::DirectoryPath(albumDir), nullptr);
+            album->setTitle(QFileInfo(albumDir).baseName());
+            album->setArtistObj(entry.artist);
+            entry.artist->addAlbum(album);
+            m_albums.append(album);
+        }
+    }
+
+    // Phase 2: Load artist NFO files in parallel.
+    m_processed = 0;
+    QtConcurrent::blockingMap(m_artists, [this](Artist* artist) { loadArtist(artist); });
+
+    if (isAborted()) {
+        return;
+    }
+
+    // Phase 3: Load album NFO files in parallel.
+    QtConcurrent::blockingMap(m_albums, [this](Album* album) { loadAlbum(album); });
+
+    if (isAborted()) {
+        return;
+    }
+
+    storeInDatabase();
+
+    if (isAborted()) {
+        return;
+    }
+
+    // Items are handed over to the thread that created this job.
+    // moveToThread() must be called from the thread the objects live in.
+    for (Artist* artist : asConst(m_artists)) {
+        artist->moveToThread(m_resultThread);
+    }
+    for (Album* album : asConst(m_albums)) {
+        album->moveToThread(m_resultThread);
+    }
+
+    emitFinished();
+}
+
+bool MusicDiskLoader::doKill()
+{
+    m_aborted.store(true);
+    return true;
+}
+
+QStringList MusicDiskLoader::subDirectories(const QString& path, bool skipExtraArtwork) const
+{
+    QStringList directories;
+    QDirIterator it(path, QDir::NoDotAndDotDot | QDir::Dirs, QDirIterator::FollowSymlinks);
+    while (it.hasNext()) {
+        if (isAborted()) {
+            return {};
+        }
+        it.next();
+        const QString name = it.fileName();
+        if (m_filter.isFolderExcluded(name)) {
+            continue;
+        }
+        if (skipExtraArtwork && (name == "extrafanart" || name == "extrathumbs")) {
+            continue;
+        }
+        directories << it.filePath();
+    }
+    return directories;
+}
+
+void MusicDiskLoader::loadArtist(Artist* artist)
+{
+    if (isAborted()) {
+        return;
+    }
+
+    artist->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
+
+    const int processed = ++m_processed;
+    if (processed % 20 == 0) {
+        emit progressText(this, artist->name());
+    }
+    if (processed % 10 == 0) {
+        // Artists make up the first half of the progress.
+        emitPercent(processed, m_artists.size() * 2);
+    }
+}
+
+void MusicDiskLoader::loadAlbum(Album* album)
+{
+    if (isAborted()) {
+        return;
+    }
+
+    album->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
+
+    // m_processed still contains all artists from the first phase.
+    const int processed = ++m_processed - qsizetype_to_int(m_artists.size());
+    if (processed % 20 == 0) {
+        emit progressText(this, album->artist() + "/" + album->title());
+    }
+    if (processed % 10 == 0) {
+        // Albums make up the second half of the progress.
+        emitPercent(m_albums.size() + processed, m_albums.size() * 2);
+    }
+}
+
+void MusicDiskLoader::storeInDatabase()
+{
+    emitPercent(0, 0);
+    emit progressText(this, tr("Storing music in database..."));
+
+    std::unique_ptr<Database> db(Database::newConnection(nullptr));
+
+    const int artistCount = qsizetype_to_int(m_artists.size());
+    for (int start = 0; start < artistCount; start += DATABASE_BATCH_SIZE) {
+        if (isAborted()) {
+            return;
+        }
+        const int end = std::min(start + DATABASE_BATCH_SIZE, artistCount);
+        db->transaction();
+        for (int i = start; i < end; ++i) {
+            Artist* artist = m_artists[i];
+            // Albums reference the artist's database id, so the artist must be added first.
+            db->add(artist, m_dir.path);
+            const QVector<Album*> albums = artist->albums();
+            for (Album* album : albums) {
+                db->add(album, m_dir.path);
+            }
+        }
+        db->commit();
+        emitPercent(end, artistCount);
+    }
+}
+
+} // namespace mediaelch
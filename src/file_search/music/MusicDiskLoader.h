@@ -0,0 +1,72 @@
+#pragma once
+
+#include "globals/MediaDirectory.h"
+#include "media/FileFilter.h"
+#include "workers/Job.h"
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <atomic>
+
+class Album;
+class Artist;
+class Database;
+class QThread;
+
+namespace mediaelch {
+
+/// \brief Load all artists and albums of a music directory from disk.
+///
+/// Artist directories are scanned and their NFO files are parsed on the global
+/// thread pool.  Artists and albums themselves are created in the job's thread.
+/// New artists and albums are stored in the database in batches.
+/// The job must be run in its own thread, see createAutoDeleteThreadWithJob().
+///
+/// Once finished, all artists (and their albums) are moved to the thread that
+/// created the job and can be taken using takeArtists().
+class MusicDiskLoader final : public worker::Job
+{
+    Q_OBJECT
+public:
+    MusicDiskLoader(mediaelch::MediaDirectory dir, FileFilter filter, QObject* parent = nullptr);
+    ~MusicDiskLoader() override;
+
+    /// \brief Thread-safe way to check whether the loader was aborted.
+    bool isAborted() const { return m_aborted.load(); }
+
+    /// \brief Take ownership of all loaded artists. Albums are attached to their artist.
+    /// \details Must only be called after the job has finished.
+    QVector<Artist*> takeArtists();
+
+signals:
+    /// \brief Convenience signal for finished() but with a MusicDiskLoader* parameter.
+    void loaderFinished(mediaelch::MusicDiskLoader* job);
+    /// \brief A translated string representing the current loading state.
+    void progressText(mediaelch::MusicDiskLoader* job, QString text);
+
+protected:
+    void doStart() override;
+    bool doKill() override;
+
+private:
+    QStringList subDirectories(const QString& path, bool skipExtraArtwork) const;
+    /// \brief Load the artist's details.  Its albums must have been created already.
+    void loadArtist(Artist* artist);
+    void loadAlbum(Album* album);
+    void storeInDatabase();
+
+private:
+    mediaelch::MediaDirectory m_dir;
+    FileFilter m_filter;
+    /// Thread in which the job was created. Loaded items are moved to it.
+    QThread* m_resultThread = nullptr;
+
+    QVector<Artist*> m_artists;
+    QVector<Album*> m_albums;
+
+    std::atomic_bool m_aborted{false};
+    std::atomic_int m_processed{0};
+};
+
+} // namespace mediaelch
@@ -34,6 +34,7 @@ Manager::Manager(QObject* parent) : QObject(parent)
     m_mediaCenters.append(new KodiXml(this));
     m_mediaCentersTvShow.append(new KodiXml(this));
     m_mediaCentersConcert.append(new KodiXml(this));
+    m_saveQueue = new mediaelch::SaveQueue(this);
 
     m_imageProviders.append(new FanartTv(this));
     m_imageProviders.append(new FanartTvMusic(this));
@@ -219,3 +220,17 @@ MyIconFont* Manager::iconFont()
 {
     return m_iconFont;
 }
+
+mediaelch::SaveQueue* Manager::saveQueue()
+{
+    return m_saveQueue;
+}
+
+void Manager::setSaveInBackground(bool inBackground)
+{
+    for (const auto& mediaCenters : {m_mediaCenters, m_mediaCentersTvShow, m_mediaCentersConcert}) {
+        for (MediaCenterInterface* mediaCenter : mediaCenters) {
+            mediaCenter->setSaveQueue(inBackground ? m_saveQueue : nullptr);
+        }
+    }
+}
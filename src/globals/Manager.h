@@ -7,6 +7,7 @@
 #include "file_search/movie/MovieFileSearcher.h"
 #include "globals/ScraperManager.h"
 #include "media_center/MediaCenterInterface.h"
+#include "media_center/SaveQueue.h"
 #include "model/ConcertModel.h"
 #include "model/MovieModel.h"
 #include "model/TvShowModel.h"
@@ -58,6 +59,9 @@ public:
     ELCH_NODISCARD TvShowFilesWidget* tvShowFilesWidget();
     ELCH_NODISCARD MusicFilesWidget* musicFilesWidget();
     ELCH_NODISCARD MyIconFont* iconFont();
+    ELCH_NODISCARD mediaelch::SaveQueue* saveQueue();
+    /// \brief Write NFO and artwork files of all media centers in the background using saveQueue().
+    void setSaveInBackground(bool inBackground);
     void setTvShowFilesWidget(TvShowFilesWidget* widget);
     void setMusicFilesWidget(MusicFilesWidget* widget);
     void setFileScannerDialog(FileScannerDialog* dialog);
@@ -83,4 +87,5 @@ private:
     FileScannerDialog* m_fileScannerDialog = nullptr;
     MusicFileSearcher* m_musicFileSearcher = nullptr;
     MyIconFont* m_iconFont = nullptr;
+    mediaelch::SaveQueue* m_saveQueue = nullptr;
 };
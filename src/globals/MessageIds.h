@@ -11,6 +11,8 @@ namespace Constants {
     const int ConcertFileSearcherProgressMessageId = 10005;
     const int TvShowUpdaterProgressMessageId       = 10006;
     const int MusicFileSearcherProgressMessageId   = 10007;
+    const int SaveQueueProgressMessageId           = 10008;
+    const int EpisodeThumbnailsProgressMessageId   = 10009;
     const int MovieProgressMessageId               = 20000;
     const int TvShowProgressMessageId              = 40000;
     const int EpisodeProgressMessageId             = 60000;
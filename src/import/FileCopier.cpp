@@ -0,0 +1,180 @@
+#include "import/FileCopier.h"
+
+#include "log/Log.h"
+
+#include <QByteArray>
+#include <QFile>
+#include <QFileInfo>
+#include <algorithm>
+
+#ifdef Q_OS_LINUX
+#    include <cerrno>
+#    include <linux/fs.h>
+#    include <sys/ioctl.h>
+#    include <sys/sendfile.h>
+#    include <unistd.h>
+#endif
+
+namespace {
+
+#ifdef Q_OS_LINUX
+
+// Maximum number of bytes copied per system call. Smaller chunks result in more frequent
+// progress updates, larger ones in fewer context switches.
+constexpr qint64 KERNEL_CHUNK_SIZE = 64 * 1024 * 1024;
+
+enum class KernelCopyResult
+{
+    Done,
+    Unsupported,
+    Failed
+};
+
+bool isUnsupportedError(int error)
+{
+    return error == ENOSYS || error == EXDEV || error == EINVAL || error == EOPNOTSUPP;
+}
+
+bool tryClone(int inFd, int outFd)
+{
+#    ifdef FICLONE
+    // Shares the file's extents on copy-on-write filesystems such as Btrfs or XFS.
+    return ::ioctl(outFd, FICLONE, inFd) == 0;
+#    else
+    Q_UNUSED(inFd)
+    Q_UNUSED(outFd)
+    return false;
+#    endif
+}
+
+/// \brief Copy the file in chunks using the given system call.
+/// \details If the very first call fails because the method is not supported, nothing
+///          has been written and another method can be tried.
+template<class CopyChunk>
+KernelCopyResult kernelCopy(qint64 size, const mediaelch::FileCopier::ProgressCallback& progress, CopyChunk copyChunk)
+{
+    qint64 copied = 0;
+    while (copied < size) {
+        const auto chunk = static_cast<size_t>(std::min(size - copied, KERNEL_CHUNK_SIZE));
+        const ssize_t written = copyChunk(chunk);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return (copied == 0 && isUnsupportedError(errno)) ? KernelCopyResult::Unsupported
+                                                               : KernelCopyResult::Failed;
+        }
+        if (written == 0) {
+            // Some filesystems report zero bytes instead of an error if they don't support copying.
+            return copied == 0 ? KernelCopyResult::Unsupported : KernelCopyResult::Failed;
+        }
+        copied += written;
+        if (progress) {
+            progress(written);
+        }
+    }
+    return KernelCopyResult::Done;
+}
+
+#endif
+
+bool bufferedCopy(QFile& in, QFile& out, qint64 size, const mediaelch::FileCopier::ProgressCallback& progress)
+{
+    QByteArray buffer(static_cast<int>(mediaelch::FileCopier::bufferSize), Qt::Uninitialized);
+    qint64 copied = 0;
+    while (true) {
+        const qint64 read = in.read(buffer.data(), buffer.size());
+        if (read < 0) {
+            return false;
+        }
+        if (read == 0) {
+            break;
+        }
+        if (out.write(buffer.constData(), read) != read) {
+            return false;
+        }
+        copied += read;
+        if (progress) {
+            progress(read);
+        }
+    }
+    return copied == size;
+}
+
+bool copyContent(QFile& in, QFile& out, const mediaelch::FileCopier::ProgressCallback& progress)
+{
+    const qint64 size = in.size();
+
+#ifdef Q_OS_LINUX
+    const int inFd = in.handle();
+    const int outFd = out.handle();
+
+    if (tryClone(inFd, outFd)) {
+        if (progress) {
+            progress(size);
+        }
+        return true;
+    }
+
+    KernelCopyResult result = KernelCopyResult::Unsupported;
+#    if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+    result = kernelCopy(size, progress, [inFd, outFd](size_t chunk) { //
+        return ::copy_file_range(inFd, nullptr, outFd, nullptr, chunk, 0);
+    });
+    if (result != KernelCopyResult::Unsupported) {
+        return result == KernelCopyResult::Done;
+    }
+#    endif
+    result = kernelCopy(size, progress, [inFd, outFd](size_t chunk) { //
+        return ::sendfile(outFd, inFd, nullptr, chunk);
+    });
+    if (result != KernelCopyResult::Unsupported) {
+        return result == KernelCopyResult::Done;
+    }
+#endif
+
+    return bufferedCopy(in, out, size, progress);
+}
+
+} // namespace
+
+namespace mediaelch {
+
+bool FileCopier::copy(const QString& source, const QString& destination, const ProgressCallback& progress)
+{
+    if (source.isEmpty() || destination.isEmpty()) {
+        qCWarning(generic) << "[FileCopier] Empty or null file name";
+        return false;
+    }
+    if (QFileInfo::exists(destination)) {
+        qCWarning(generic) << "[FileCopier] Destination already exists:" << destination;
+        return false;
+    }
+
+    // Unbuffered: Content is either copied by the kernel or through our own, large buffer.
+    QFile in(source);
+    if (!in.open(QIODevice::ReadOnly | QIODevice::Unbuffered)) {
+        qCWarning(generic) << "[FileCopier] Can't open source file:" << source << in.errorString();
+        return false;
+    }
+    QFile out(destination);
+    if (!out.open(QIODevice::WriteOnly | QIODevice::Unbuffered)) {
+        qCWarning(generic) << "[FileCopier] Can't open destination file:" << destination << out.errorString();
+        return false;
+    }
+
+    const bool success = copyContent(in, out, progress);
+    out.close();
+    in.close();
+
+    if (!success) {
+        qCWarning(generic) << "[FileCopier] Copying failed:" << source << "to" << destination;
+        out.remove();
+        return false;
+    }
+
+    QFile::setPermissions(destination, QFile::permissions(source));
+    return true;
+}
+
+} // namespace mediaelch
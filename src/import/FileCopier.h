@@ -0,0 +1,37 @@
+#pragma once
+
+#include <QString>
+#include <functional>
+
+namespace mediaelch {
+
+/// \brief Copies a single file as fast as the platform allows.
+///
+/// On Linux, the file is cloned (reflink) if the filesystem supports it.
+/// Otherwise the content is copied inside the kernel using copy_file_range()
+/// or sendfile(). If none of these are available, for example on other
+/// platforms or across some filesystems, a buffered copy with a large buffer
+/// is used.
+///
+/// \code{cpp}
+///   qint64 copied = 0;
+///   bool ok = FileCopier::copy(source, destination, [&copied](qint64 bytes) { copied += bytes; });
+/// \endcode
+class FileCopier
+{
+public:
+    /// \brief Called with the number of bytes that were copied since the last call.
+    /// \details May be called from whichever thread copy() is run in.
+    using ProgressCallback = std::function<void(qint64 bytes)>;
+
+    /// \brief Size of the buffer used if the file can't be copied by the kernel.
+    static constexpr qint64 bufferSize = 4 * 1024 * 1024;
+
+    /// \brief Copy the source file to the destination and keep its permissions.
+    /// \details The destination must not exist. If the copy fails, a partially
+    ///          written destination file is removed.
+    /// \return True if the whole file was copied.
+    static bool copy(const QString& source, const QString& destination, const ProgressCallback& progress = {});
+};
+
+} // namespace mediaelch
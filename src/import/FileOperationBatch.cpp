@@ -0,0 +1,242 @@
+#include "import/FileOperationBatch.h"
+
+#include "log/Log.h"
+#include "utils/Meta.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QStorageInfo>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#ifdef Q_OS_WIN
+#    include <io.h>
+#    include <windows.h>
+#else
+#    include <unistd.h>
+#endif
+
+namespace {
+
+// Number of cross-device moves that are run at the same time.
+constexpr int MAX_PARALLEL_MOVES = 4;
+
+/// \brief Root path of the mounted filesystem that the given path is (or will be) on.
+QString mountPoint(const QString& path)
+{
+    // The destination may not exist, yet. Use the first existing parent directory.
+    QFileInfo info(path);
+    while (!info.exists() && !info.isRoot() && info.absoluteFilePath() != info.absolutePath()) {
+        info.setFile(info.absolutePath());
+    }
+    return QStorageInfo(info.absoluteFilePath()).rootPath();
+}
+
+bool syncToDisk(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadWrite)) {
+        return false;
+    }
+#ifdef Q_OS_WIN
+    return FlushFileBuffers(reinterpret_cast<HANDLE>(_get_osfhandle(file.handle()))) != 0;
+#else
+    return ::fsync(file.handle()) == 0;
+#endif
+}
+
+QByteArray checksum(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    if (!hash.addData(&file)) {
+        return {};
+    }
+    return hash.result();
+}
+
+/// \brief Copy the file to the other filesystem, sync and verify it and remove the source.
+/// \details The copy is written to a temporary file first, so that the destination
+///          only exists if it is complete.
+bool moveAcrossDevices(const QString& source,
+    const QString& destination,
+    const mediaelch::FileCopier::ProgressCallback& progress)
+{
+    if (QFileInfo::exists(destination)) {
+        qCWarning(generic) << "[FileOperationBatch] Destination already exists:" << destination;
+        return false;
+    }
+
+    const QString partFile = destination + ".part";
+    if (QFileInfo::exists(partFile)) {
+        // Leftover of an earlier, aborted move.
+        QFile::remove(partFile);
+    }
+
+    if (!mediaelch::FileCopier::copy(source, partFile, progress)) {
+        return false;
+    }
+
+    if (!syncToDisk(partFile)) {
+        qCWarning(generic) << "[FileOperationBatch] Could not sync file to disk:" << partFile;
+        QFile::remove(partFile);
+        return false;
+    }
+
+    const QByteArray sourceChecksum = checksum(source);
+    if (sourceChecksum.isEmpty() || sourceChecksum != checksum(partFile)) {
+        qCWarning(generic) << "[FileOperationBatch] Checksum mismatch after copying:" << source;
+        QFile::remove(partFile);
+        return false;
+    }
+
+    if (!QDir().rename(partFile, destination)) {
+        qCWarning(generic) << "[FileOperationBatch] Could not rename copied file:" << partFile;
+        QFile::remove(partFile);
+        return false;
+    }
+
+    if (!QFile::remove(source)) {
+        // Don't leave two copies behind: The operation as a whole failed.
+        qCWarning(generic) << "[FileOperationBatch] Could not remove source file:" << source;
+        QFile::remove(destination);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+namespace mediaelch {
+
+void FileOperationBatch::addMove(const QString& source, const QString& destination)
+{
+    Operation operation;
+    operation.source = source;
+    operation.destination = destination;
+    m_operations.append(operation);
+    m_planned = false;
+}
+
+const QVector<FileOperationBatch::Operation>& FileOperationBatch::plan()
+{
+    // Mount points are looked up once per directory as batches usually contain
+    // many files of only a few directories.
+    QHash<QString, QString> mountPoints;
+    const auto cachedMountPoint = [&mountPoints](const QString& path) {
+        const QString dir = QFileInfo(path).absolutePath();
+        auto it = mountPoints.find(dir);
+        if (it == mountPoints.end()) {
+            it = mountPoints.insert(dir, mountPoint(dir));
+        }
+        return it.value();
+    };
+
+    for (Operation& operation : m_operations) {
+        operation.status = OperationStatus::Planned;
+        operation.size = QFileInfo(operation.source).size();
+        // rename() fails across mount points, even if they belong to the same device.
+        operation.type = cachedMountPoint(operation.source) == cachedMountPoint(operation.destination)
+                             ? OperationType::Rename
+                             : OperationType::CrossDeviceMove;
+    }
+    m_planned = true;
+    return m_operations;
+}
+
+bool FileOperationBatch::execute(const FileCopier::ProgressCallback& progress)
+{
+    if (!m_planned) {
+        plan();
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    // Renames are instant and done first. If a rename fails even though both paths
+    // seem to be on the same filesystem, it is retried as a cross-device move.
+    for (Operation& operation : m_operations) {
+        if (operation.type != OperationType::Rename || operation.status != OperationStatus::Planned) {
+            continue;
+        }
+        if (QFileInfo::exists(operation.destination)) {
+            qCWarning(generic) << "[FileOperationBatch] Destination already exists:" << operation.destination;
+            operation.status = OperationStatus::Failed;
+        } else if (QDir().rename(operation.source, operation.destination)) {
+            operation.status = OperationStatus::Done;
+            if (progress) {
+                progress(operation.size);
+            }
+        } else {
+            operation.type = OperationType::CrossDeviceMove;
+        }
+    }
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(MAX_PARALLEL_MOVES);
+    // Each task only modifies its own operation. Don't detach the vector while tasks are running.
+    Operation* operations = m_operations.data();
+    for (elch_ssize_t i = 0; i < m_operations.size(); ++i) {
+        Operation* operation = operations + i;
+        if (operation->type != OperationType::CrossDeviceMove || operation->status != OperationStatus::Planned) {
+            continue;
+        }
+        QtConcurrent::run(&pool, [operation, progress]() {
+            const bool success = moveAcrossDevices(operation->source, operation->destination, progress);
+            operation->status = success ? OperationStatus::Done : OperationStatus::Failed;
+        });
+    }
+    pool.waitForDone();
+
+    m_report = Report{};
+    m_report.elapsedMs = timer.elapsed();
+    for (const Operation& operation : asConst(m_operations)) {
+        if (operation.status == OperationStatus::Done) {
+            ++m_report.done;
+            m_report.bytesMoved += operation.size;
+        } else if (operation.status == OperationStatus::Failed) {
+            ++m_report.failed;
+        }
+    }
+
+    return m_report.failed == 0;
+}
+
+bool FileOperationBatch::rollback()
+{
+    bool success = true;
+    for (auto it = m_operations.rbegin(); it != m_operations.rend(); ++it) {
+        Operation& operation = *it;
+        if (operation.status != OperationStatus::Done) {
+            continue;
+        }
+        const bool restored = operation.type == OperationType::Rename
+                                  ? QDir().rename(operation.destination, operation.source)
+                                  : moveAcrossDevices(operation.destination, operation.source, {});
+        if (restored) {
+            operation.status = OperationStatus::RolledBack;
+        } else {
+            qCWarning(generic) << "[FileOperationBatch] Could not roll back move of" << operation.source << "to"
+                               << operation.destination;
+            success = false;
+        }
+    }
+    return success;
+}
+
+bool FileOperationBatch::move(const QString& source, const QString& destination)
+{
+    FileOperationBatch batch;
+    batch.addMove(source, destination);
+    return batch.execute();
+}
+
+} // namespace mediaelch
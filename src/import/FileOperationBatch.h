@@ -0,0 +1,94 @@
+#pragma once
+
+#include "import/FileCopier.h"
+
+#include <QString>
+#include <QVector>
+
+namespace mediaelch {
+
+/// \brief Plans and executes a batch of file moves.
+///
+/// Moves on the same filesystem are plain renames and executed instantly.
+/// Moves to another filesystem are streamed copies that are synced to disk and
+/// verified using a checksum before the source file is removed. These moves are
+/// run in parallel.
+///
+/// The batch keeps track of all executed operations so that they can be rolled
+/// back if a single operation failed.
+///
+/// \code{cpp}
+///   FileOperationBatch batch;
+///   batch.addMove("/media/in/movie.mkv", "/media/movies/Movie/movie.mkv");
+///   if (!batch.execute()) {
+///       batch.rollback();
+///   }
+/// \endcode
+class FileOperationBatch
+{
+public:
+    enum class OperationType : int8_t
+    {
+        /// Source and destination are on the same filesystem.
+        Rename,
+        /// Copy, sync, verify and remove the source.
+        CrossDeviceMove
+    };
+
+    enum class OperationStatus : int8_t
+    {
+        Planned,
+        Done,
+        Failed,
+        RolledBack
+    };
+
+    struct Operation
+    {
+        QString source;
+        QString destination;
+        OperationType type = OperationType::Rename;
+        OperationStatus status = OperationStatus::Planned;
+        qint64 size = 0;
+    };
+
+    struct Report
+    {
+        int done = 0;
+        int failed = 0;
+        qint64 bytesMoved = 0;
+        qint64 elapsedMs = 0;
+
+        qint64 bytesPerSecond() const { return elapsedMs > 0 ? bytesMoved * 1000 / elapsedMs : 0; }
+    };
+
+public:
+    void addMove(const QString& source, const QString& destination);
+
+    /// \brief Determine the type and size of all operations without touching any file.
+    /// \details Can be used for a dry run.
+    const QVector<Operation>& plan();
+    const QVector<Operation>& operations() const { return m_operations; }
+
+    /// \brief Execute all planned operations. Blocks until all are finished.
+    /// \param progress Called with the number of moved bytes, possibly from other threads.
+    /// \return True if all operations succeeded.
+    bool execute(const FileCopier::ProgressCallback& progress = {});
+
+    /// \brief Undo all operations that were executed successfully, in reverse order.
+    /// \return True if all of them could be undone.
+    bool rollback();
+
+    /// \brief Statistics of the last call to execute().
+    const Report& report() const { return m_report; }
+
+    /// \brief Move a single file. Convenience function for a batch with one operation.
+    static bool move(const QString& source, const QString& destination);
+
+private:
+    QVector<Operation> m_operations;
+    Report m_report;
+    bool m_planned = false;
+};
+
+} // namespace mediaelch
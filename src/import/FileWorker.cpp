@@ -1,8 +1,34 @@
 #include "FileWorker.h"
 
+#include "import/FileCopier.h"
+#include "import/FileOperationBatch.h"
 #include "log/Log.h"
+#include "utils/Meta.h"
 
-#include <QFile>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QStorageInfo>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <algorithm>
+#include <memory>
+
+namespace {
+
+// Number of files that are copied at the same time from one device.
+// More concurrent copies only result in more disk seeks on spinning disks.
+constexpr int MAX_COPIES_PER_DEVICE = 2;
+// Interval in milliseconds in which progress is reported.
+constexpr int PROGRESS_INTERVAL = 250;
+
+/// \brief Files that are read from the same device.
+struct DeviceQueue
+{
+    QVector<QPair<QString, QString>> files;
+    std::atomic_int next{0};
+};
+
+} // namespace
 
 FileWorker::FileWorker(QObject* parent) : QObject(parent)
 {
@@ -20,22 +46,90 @@ QMap<QString, QString> FileWorker::files()
 
 void FileWorker::copyFiles()
 {
+    qint64 bytesTotal = 0;
+    QMap<QByteArray, std::shared_ptr<DeviceQueue>> queues;
     QMapIterator<QString, QString> it(files());
     while (it.hasNext()) {
         it.next();
-        MyFile file(it.key());
-        file.copy(it.value());
+        const QByteArray device = QStorageInfo(it.key()).device();
+        auto& queue = queues[device];
+        if (!queue) {
+            queue = std::make_shared<DeviceQueue>();
+        }
+        queue->files.append({it.key(), it.value()});
+        bytesTotal += QFileInfo(it.key()).size();
     }
+
+    m_bytesCopied = 0;
+    const auto addCopied = [this](qint64 bytes) { m_bytesCopied += bytes; };
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(std::max(1, qsizetype_to_int(queues.size()) * MAX_COPIES_PER_DEVICE));
+
+    for (const auto& queue : asConst(queues)) {
+        const int workers = std::min(MAX_COPIES_PER_DEVICE, qsizetype_to_int(queue->files.size()));
+        for (int i = 0; i < workers; ++i) {
+            // Each worker takes the next file of its device until none are left.
+            QtConcurrent::run(&pool, [queue, addCopied]() {
+                for (int next = queue->next++; next < queue->files.size(); next = queue->next++) {
+                    const auto& file = queue->files.at(next);
+                    if (!mediaelch::FileCopier::copy(file.first, file.second, addCopied)) {
+                        qCWarning(generic) << "[FileWorker] Could not copy file" << file.first << "to" << file.second;
+                    }
+                }
+            });
+        }
+    }
+
+    waitAndReportProgress(pool, bytesTotal);
     emit sigFinished();
 }
 
 void FileWorker::moveFiles()
 {
+    mediaelch::FileOperationBatch batch;
     QMapIterator<QString, QString> it(files());
     while (it.hasNext()) {
         it.next();
-        MyFile file(it.key());
-        file.rename(it.value());
+        batch.addMove(it.key(), it.value());
     }
+
+    qint64 bytesTotal = 0;
+    for (const auto& operation : batch.plan()) {
+        bytesTotal += operation.size;
+    }
+
+    m_bytesCopied = 0;
+    const auto addMoved = [this](qint64 bytes) { m_bytesCopied += bytes; };
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(1);
+    QtConcurrent::run(&pool, [&batch, addMoved]() {
+        // Either all files are imported or none: Restore the source files on error.
+        if (!batch.execute(addMoved) && !batch.rollback()) {
+            qCWarning(generic) << "[FileWorker] Some imported files could not be moved back";
+        }
+    });
+    waitAndReportProgress(pool, bytesTotal);
+
+    const auto& report = batch.report();
+    qCInfo(generic) << "[FileWorker] Moved" << report.done << "files," << report.failed << "failed;"
+                    << report.bytesMoved << "bytes in" << report.elapsedMs << "ms";
+
     emit sigFinished();
 }
+
+void FileWorker::waitAndReportProgress(QThreadPool& pool, qint64 bytesTotal)
+{
+    QElapsedTimer timer;
+    timer.start();
+    const auto reportProgress = [&]() {
+        const qint64 copied = m_bytesCopied.load();
+        const qint64 elapsed = std::max<qint64>(1, timer.elapsed());
+        emit sigProgress(copied, bytesTotal, copied * 1000 / elapsed);
+    };
+    while (!pool.waitForDone(PROGRESS_INTERVAL)) {
+        reportProgress();
+    }
+    reportProgress();
+}
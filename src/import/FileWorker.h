@@ -1,9 +1,10 @@
 #pragma once
 
-#include "import/MyFile.h"
-
 #include <QMap>
 #include <QObject>
+#include <atomic>
+
+class QThreadPool;
 
 class FileWorker : public QObject
 {
@@ -14,12 +15,23 @@ public:
     QMap<QString, QString> files();
 
 public slots:
+    /// \brief Copy all files concurrently. Files on the same device are copied
+    ///        with limited concurrency to avoid seek thrashing.
     void copyFiles();
+    /// \brief Move all files. If a single file can't be moved, all files are moved back.
     void moveFiles();
 
 signals:
     void sigFinished();
+    /// \brief Emitted regularly while copying or moving files.
+    /// \param bytesPerSecond Average throughput since copying started.
+    void sigProgress(qint64 bytesCopied, qint64 bytesTotal, qint64 bytesPerSecond);
+
+private:
+    /// \brief Block until all tasks of the pool are done and emit sigProgress() regularly.
+    void waitAndReportProgress(QThreadPool& pool, qint64 bytesTotal);
 
 private:
     QMap<QString, QString> m_files;
+    std::atomic<qint64> m_bytesCopied{0};
 };
@@ -1,14 +1,41 @@
 #include "log/Log.h"
 
+#include "log/LogWriter.h"
 #include "utils/Meta.h"
 
-#include <QFile>
-#include <QMessageBox>
+#include <QDateTime>
+#include <QJsonDocument>
+#include <QJsonObject>
 
 Q_LOGGING_CATEGORY(generic, "generic")
 Q_LOGGING_CATEGORY(c_movie, "movie")
-
-static QFile data;
+Q_LOGGING_CATEGORY(c_database, "database")
+Q_LOGGING_CATEGORY(c_scanner, "scanner")
+Q_LOGGING_CATEGORY(c_network, "network")
+Q_LOGGING_CATEGORY(c_kodi, "kodi")
+Q_LOGGING_CATEGORY(c_export, "export")
+Q_LOGGING_CATEGORY(c_image_cache, "imagecache")
+Q_LOGGING_CATEGORY(c_media, "media")
+Q_LOGGING_CATEGORY(c_scraper, "scraper")
+Q_LOGGING_CATEGORY(c_scraper_adultdvdempire, "scraper.adultdvdempire")
+Q_LOGGING_CATEGORY(c_scraper_aebn, "scraper.aebn")
+Q_LOGGING_CATEGORY(c_scraper_custom, "scraper.custom")
+Q_LOGGING_CATEGORY(c_scraper_fanarttv, "scraper.fanarttv")
+Q_LOGGING_CATEGORY(c_scraper_fernsehserien_de, "scraper.fernsehserien_de")
+Q_LOGGING_CATEGORY(c_scraper_hotmovies, "scraper.hotmovies")
+Q_LOGGING_CATEGORY(c_scraper_imdb, "scraper.imdb")
+Q_LOGGING_CATEGORY(c_scraper_music, "scraper.music")
+Q_LOGGING_CATEGORY(c_scraper_thetvdb, "scraper.thetvdb")
+Q_LOGGING_CATEGORY(c_scraper_tmdb, "scraper.tmdb")
+Q_LOGGING_CATEGORY(c_scraper_tvmaze, "scraper.tvmaze")
+Q_LOGGING_CATEGORY(c_scraper_videobuster, "scraper.videobuster")
+
+/// Created on first use, i.e. after the message handler is installed.
+static mediaelch::LogWriter& logWriter()
+{
+    static mediaelch::LogWriter writer;
+    return writer;
+}
 
 #if defined(Q_OS_MAC) || defined(Q_OS_LINUX)
 #    include <unistd.h>
@@ -80,44 +107,124 @@ void initLoggingPattern()
     qSetMessagePattern(pattern);
 }
 
+bool logLevelFromString(const QString& str, LogLevel& level)
+{
+    const QString lower = str.trimmed().toLower();
+    if (lower == "debug") {
+        level = LogLevel::Debug;
+    } else if (lower == "info") {
+        level = LogLevel::Info;
+    } else if (lower == "warning") {
+        level = LogLevel::Warning;
+    } else if (lower == "critical") {
+        level = LogLevel::Critical;
+    } else if (lower == "off") {
+        level = LogLevel::Off;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+QString logLevelToString(LogLevel level)
+{
+    switch (level) {
+    case LogLevel::Debug: return QStringLiteral("debug");
+    case LogLevel::Info: return QStringLiteral("info");
+    case LogLevel::Warning: return QStringLiteral("warning");
+    case LogLevel::Critical: return QStringLiteral("critical");
+    case LogLevel::Off: return QStringLiteral("off");
+    }
+    return QStringLiteral("unknown");
+}
+
+QString logFilterRules(const QMap<QString, LogLevel>& levels)
+{
+    const auto rule = [](const QString& category, const char* type, bool enabled) {
+        return QStringLiteral("%1.%2=%3\n").arg(category, type, enabled ? "true" : "false");
+    };
+
+    QString rules;
+    for (auto it = levels.constBegin(); it != levels.constEnd(); ++it) {
+        const LogLevel level = it.value();
+        rules += rule(it.key(), "debug", level <= LogLevel::Debug);
+        rules += rule(it.key(), "info", level <= LogLevel::Info);
+        rules += rule(it.key(), "warning", level <= LogLevel::Warning);
+        rules += rule(it.key(), "critical", level <= LogLevel::Critical);
+    }
+    return rules;
+}
+
+void setLogLevels(const QMap<QString, LogLevel>& levels)
+{
+    QLoggingCategory::setFilterRules(logFilterRules(levels));
+}
+
+static QString logLevel(QtMsgType type)
+{
+    switch (type) {
+    case QtDebugMsg: return QStringLiteral("debug");
+    case QtInfoMsg: return QStringLiteral("info");
+    case QtWarningMsg: return QStringLiteral("warning");
+    case QtCriticalMsg: return QStringLiteral("critical");
+    case QtFatalMsg: return QStringLiteral("fatal");
+    }
+    return QStringLiteral("unknown");
+}
+
+static QByteArray formatJsonLine(QtMsgType type, const QMessageLogContext& context, const QString& msg)
+{
+    QJsonObject line;
+    line.insert("time", QDateTime::currentDateTime().toString(Qt::ISODateWithMs));
+    line.insert("level", logLevel(type));
+    line.insert("category", QString::fromLatin1(context.category != nullptr ? context.category : "default"));
+    if (context.file != nullptr) {
+        line.insert("file", QString::fromUtf8(context.file));
+        line.insert("line", context.line);
+    }
+    if (context.function != nullptr) {
+        line.insert("function", QString::fromUtf8(context.function));
+    }
+    line.insert("message", msg);
+    return QJsonDocument(line).toJson(QJsonDocument::Compact);
+}
+
 void messageHandler(QtMsgType type, const QMessageLogContext& context, const QString& msg)
 {
 #ifdef Q_OS_WIN
-    const QString newLine = "\r\n";
+    const char* newLine = "\r\n";
 #else
-    const QString newLine = "\n";
+    const char* newLine = "\n";
 #endif
 
-    QTextStream out(stderr);
-    if (data.isOpen()) {
-        out.setDevice(&data);
+    // Format the message on the calling thread: The context is only valid during this call.
+    QByteArray line;
+    if (logWriter().format() == LogFormat::Json) {
+        line = formatJsonLine(type, context, msg);
+    } else {
+        line = qFormatLogMessage(type, context, msg).toUtf8();
     }
-
-    out << qFormatLogMessage(type, context, msg) << newLine;
+    line.append(newLine);
+    logWriter().append(std::move(line));
 
     if (type == QtFatalMsg) {
+        logWriter().flush();
         MEDIAELCH_PRINT_STACKTRACE;
-        out.flush();
         abort();
     }
 }
 
-bool openLogFile(const QString& filePath)
+bool openLogFile(const QString& filePath, const LogFileOptions& options)
 {
     if (filePath.isEmpty()) {
         return true;
     }
-
-    data.setFileName(filePath);
-
-    return data.open(QFile::WriteOnly | QFile::Truncate);
+    return logWriter().open(filePath, options);
 }
 
 void closeLogFile()
 {
-    if (data.isOpen()) {
-        data.close();
-    }
+    logWriter().close();
 }
 
 } // namespace mediaelch
@@ -2,15 +2,85 @@
 
 #include <QDebug>
 #include <QLoggingCategory>
+#include <QMap>
+#include <QString>
 
-// There is currently only one logging category.
-// We plan on adding more put to make the switch from qCDebug(generic) to qCDebug() easier,
-// we create a common category that can be used by all modules.
+// Logging categories.  Each subsystem has its own category, so that debug
+// output can be enabled for it alone, e.g. using "scraper.tmdb=debug" in
+// advancedsettings.xml.  Use "generic" if no other category fits.
+//
+// Note that qCDebug() etc. check whether the category is enabled before any
+// argument is evaluated.  On hot paths, guard expensive log-only work with
+// e.g. `if (c_scanner().isDebugEnabled())`.
 Q_DECLARE_LOGGING_CATEGORY(generic)
 Q_DECLARE_LOGGING_CATEGORY(c_movie)
+Q_DECLARE_LOGGING_CATEGORY(c_database)
+Q_DECLARE_LOGGING_CATEGORY(c_scanner)
+Q_DECLARE_LOGGING_CATEGORY(c_network)
+Q_DECLARE_LOGGING_CATEGORY(c_kodi)
+Q_DECLARE_LOGGING_CATEGORY(c_export)
+Q_DECLARE_LOGGING_CATEGORY(c_image_cache)
+Q_DECLARE_LOGGING_CATEGORY(c_media)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_adultdvdempire)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_aebn)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_custom)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_fanarttv)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_fernsehserien_de)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_hotmovies)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_imdb)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_music)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_thetvdb)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_tmdb)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_tvmaze)
+Q_DECLARE_LOGGING_CATEGORY(c_scraper_videobuster)
 
 namespace mediaelch {
 
+enum class LogFormat
+{
+    /// Lines formatted using Qt's message pattern, see initLoggingPattern().
+    Text,
+    /// One JSON object per line.
+    Json
+};
+
+/// \brief Minimum level of messages that are logged for a category.
+enum class LogLevel
+{
+    Debug,
+    Info,
+    Warning,
+    Critical,
+    /// No messages are logged.
+    Off
+};
+
+/// \brief Parses "debug", "info", "warning", "critical" or "off" (case-insensitive).
+/// \returns False if the string is no valid level. level is left unchanged in that case.
+bool logLevelFromString(const QString& str, LogLevel& level);
+QString logLevelToString(LogLevel level);
+
+/// \brief Rules for QLoggingCategory::setFilterRules() for the given categories and levels.
+/// \details Category names may contain wildcards, e.g. "scraper.*".  Rules are
+///          ordered by category name, so that "scraper.tmdb" comes after "scraper.*"
+///          and wins.
+QString logFilterRules(const QMap<QString, LogLevel>& levels);
+
+/// \brief Sets the minimum log levels of the given categories.
+/// \details Replaces levels set before.  Categories that are not part of levels
+///          log all messages (Qt's default).
+void setLogLevels(const QMap<QString, LogLevel>& levels);
+
+struct LogFileOptions
+{
+    LogFormat format = LogFormat::Text;
+    /// The log file is rotated once it gets larger than this. 0 disables rotation.
+    qint64 maxFileSize = 0;
+    /// Number of rotated log files that are kept, e.g. "MediaElch.log.1".
+    int maxFiles = 0;
+};
+
 /// \brief Sets the default message pattern of Qt's logging framework.
 ///
 /// As per Qt documentation, the pattern can be overwritten using the
@@ -22,16 +92,17 @@ void initLoggingPattern();
 ///
 /// If a debug log file is set in MediaElch's advanced settings then all debug
 /// messages are redirected to that.  Otherwise stderr is used.
-/// Repects QT_MESSAGE_PATTERN.
+/// Repects QT_MESSAGE_PATTERN.  Messages are written asynchronously by a
+/// LogWriter once the log file is opened.
 ///
 /// \see initLoggingPattern()
 void messageHandler(QtMsgType type, const QMessageLogContext& context, const QString& msg);
 
-/// \brief Opens the given log file for logging.
+/// \brief Opens the given log file for logging and starts writing messages asynchronously.
 /// \returns True if the file was opened for writing successfully.
-bool openLogFile(const QString& filePath);
+bool openLogFile(const QString& filePath, const LogFileOptions& options = {});
 
-/// \brief Closes the currently used log file if it is opened.
+/// \brief Writes all pending messages and closes the currently used log file if it is opened.
 void closeLogFile();
 
 } // namespace mediaelch
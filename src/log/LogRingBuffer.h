@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace mediaelch {
+
+/// \brief Bounded, lock-free queue for log messages.
+///
+/// Any number of threads may push and pop at the same time.  Each slot has a
+/// sequence number that tells producers and consumers whether the slot is
+/// free or filled, so that no thread has to take a lock.  This is the
+/// well-known bounded MPMC queue by Dmitry Vyukov.
+///
+/// The queue never allocates after construction.  If it is full, tryPush()
+/// returns false and the caller has to decide what to do.
+template<typename T>
+class LogRingBuffer
+{
+public:
+    /// \param capacity Maximum number of elements; rounded up to the next power of two.
+    explicit LogRingBuffer(std::size_t capacity)
+    {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+        m_mask = size - 1;
+        m_cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LogRingBuffer(const LogRingBuffer&) = delete;
+    LogRingBuffer& operator=(const LogRingBuffer&) = delete;
+
+    std::size_t capacity() const { return m_mask + 1; }
+
+    /// \brief Appends the value if the queue is not full.
+    /// \returns False if the queue is full. The value is left untouched in that case.
+    bool tryPush(T&& value)
+    {
+        std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // full
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// \brief Removes the oldest value and stores it in value.
+    /// \returns False if the queue is empty.
+    bool tryPop(T& value)
+    {
+        std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // empty
+            } else {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->value);
+        cell->value = T();
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence{0};
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    std::size_t m_mask = 0;
+    // Producers and consumers modify different positions. Keep them on
+    // different cache lines to avoid false sharing.
+    char m_padding1[64] = {};
+    std::atomic<std::size_t> m_enqueuePos{0};
+    char m_padding2[64] = {};
+    std::atomic<std::size_t> m_dequeuePos{0};
+};
+
+} // namespace mediaelch
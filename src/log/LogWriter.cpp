@@ -0,0 +1,190 @@
+#include "log/LogWriter.h"
+
+#include <QMutexLocker>
+#include <cstdio>
+
+namespace {
+
+/// Number of lines that are written at once.
+constexpr int maxBatchLines = 512;
+/// Number of times that a thread tries to queue a line if the queue is full.
+constexpr int maxPushAttempts = 1000;
+/// Milliseconds that the idle writer thread waits for new lines.
+constexpr unsigned long idleWaitMs = 50;
+
+} // namespace
+
+namespace mediaelch {
+
+LogWriter::LogWriter(std::size_t capacity) : m_queue{capacity}
+{
+}
+
+LogWriter::~LogWriter()
+{
+    close();
+}
+
+bool LogWriter::open(const QString& filePath, const LogFileOptions& options)
+{
+    close();
+
+    m_options = options;
+    m_format.store(options.format, std::memory_order_relaxed);
+
+    if (!filePath.isEmpty()) {
+        m_file.setFileName(filePath);
+        if (!m_file.open(QFile::WriteOnly | QFile::Truncate)) {
+            return false;
+        }
+    }
+
+    m_stopRequested.store(false);
+    m_running.store(true, std::memory_order_release);
+    m_thread.start();
+    return true;
+}
+
+void LogWriter::close()
+{
+    if (!m_running.exchange(false)) {
+        return;
+    }
+    // From now on, new lines are written synchronously to stderr.
+    m_stopRequested.store(true);
+    m_wakeUp.wakeOne();
+    m_thread.wait();
+
+    // Lines that were queued while the writer stopped.
+    QByteArray batch;
+    QByteArray line;
+    while (m_queue.tryPop(line)) {
+        batch.append(line);
+    }
+    if (!batch.isEmpty()) {
+        writeBatch(batch);
+    }
+
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+}
+
+void LogWriter::append(QByteArray line)
+{
+    if (!m_running.load(std::memory_order_acquire)) {
+        writeToStderr(line);
+        return;
+    }
+
+    int attempts = 0;
+    while (!m_queue.tryPush(std::move(line))) {
+        // The writer does not keep up.  Give it some time before dropping the line.
+        ++attempts;
+        if (attempts >= maxPushAttempts || !m_running.load(std::memory_order_acquire)) {
+            m_dropped.fetch_add(1);
+            return;
+        }
+        m_wakeUp.wakeOne();
+        QThread::yieldCurrentThread();
+    }
+    m_appended.fetch_add(1);
+
+    if (m_idle.load(std::memory_order_acquire)) {
+        m_wakeUp.wakeOne();
+    }
+}
+
+void LogWriter::flush()
+{
+    const quint64 target = m_appended.load();
+    while (m_running.load(std::memory_order_acquire) && m_written.load() < target) {
+        m_wakeUp.wakeOne();
+        QThread::msleep(1);
+    }
+    if (!m_running.load(std::memory_order_acquire)) {
+        std::fflush(stderr);
+    }
+}
+
+void LogWriter::writeQueuedLines()
+{
+    QByteArray batch;
+    QByteArray line;
+    while (true) {
+        batch.clear();
+        int lines = 0;
+        while (lines < maxBatchLines && m_queue.tryPop(line)) {
+            batch.append(line);
+            ++lines;
+        }
+
+        const quint64 dropped = m_dropped.exchange(0);
+        if (dropped > 0) {
+            batch.append(QByteArrayLiteral("[LogWriter] ")
+                         + QByteArray::number(dropped)
+                         + QByteArrayLiteral(" log messages were dropped because the log queue was full\n"));
+        }
+
+        if (!batch.isEmpty()) {
+            writeBatch(batch);
+            m_written.fetch_add(static_cast<quint64>(lines));
+            continue;
+        }
+
+        if (m_stopRequested.load()) {
+            return;
+        }
+
+        // A line that is queued right before m_idle is set is written after
+        // the timeout at the latest.
+        QMutexLocker locker(&m_wakeMutex);
+        m_idle.store(true, std::memory_order_release);
+        m_wakeUp.wait(&m_wakeMutex, idleWaitMs);
+        m_idle.store(false, std::memory_order_release);
+    }
+}
+
+void LogWriter::writeBatch(const QByteArray& batch)
+{
+    if (!m_file.isOpen()) {
+        writeToStderr(batch);
+        return;
+    }
+
+    if (m_options.maxFileSize > 0 && m_file.size() > 0 && m_file.size() + batch.size() > m_options.maxFileSize) {
+        rotate();
+    }
+    m_file.write(batch);
+    m_file.flush();
+}
+
+void LogWriter::writeToStderr(const QByteArray& lines)
+{
+    QMutexLocker locker(&m_stderrMutex);
+    std::fwrite(lines.constData(), 1, static_cast<std::size_t>(lines.size()), stderr);
+    std::fflush(stderr);
+}
+
+void LogWriter::rotate()
+{
+    const QString filePath = m_file.fileName();
+    m_file.close();
+
+    // MediaElch.log -> MediaElch.log.1 -> MediaElch.log.2 -> ...
+    if (m_options.maxFiles > 0) {
+        const auto rotatedName = [&filePath](int i) { return QStringLiteral("%1.%2").arg(filePath).arg(i); };
+        QFile::remove(rotatedName(m_options.maxFiles));
+        for (int i = m_options.maxFiles - 1; i >= 1; --i) {
+            QFile::rename(rotatedName(i), rotatedName(i + 1));
+        }
+        QFile::rename(filePath, rotatedName(1));
+    }
+
+    m_file.setFileName(filePath);
+    if (!m_file.open(QFile::WriteOnly | QFile::Truncate)) {
+        writeToStderr(QByteArrayLiteral("[LogWriter] Could not reopen the log file after rotating it\n"));
+    }
+}
+
+} // namespace mediaelch
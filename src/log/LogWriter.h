@@ -0,0 +1,89 @@
+#pragma once
+
+#include "log/Log.h"
+#include "log/LogRingBuffer.h"
+
+#include <QByteArray>
+#include <QFile>
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <QWaitCondition>
+#include <atomic>
+
+namespace mediaelch {
+
+/// \brief Writes log lines on a dedicated thread.
+///
+/// Log messages are formatted by the thread that logs them and are then
+/// appended to a lock-free ring buffer.  A single writer thread takes all
+/// queued lines and writes them with a single write call.  That way, logging
+/// threads don't wait for the disk and lines of different threads don't
+/// interleave.
+///
+/// If the writer does not keep up and the buffer stays full, lines are
+/// dropped and a note about it is written instead.  As long as no log file
+/// is opened, lines are written synchronously to stderr.
+class LogWriter
+{
+public:
+    explicit LogWriter(std::size_t capacity = 8192);
+    ~LogWriter();
+
+    /// \brief Opens the log file and starts the writer thread.
+    /// \details If filePath is empty, lines are written to stderr.
+    /// \returns False if the log file could not be opened.
+    bool open(const QString& filePath, const LogFileOptions& options = {});
+    /// \brief Writes all queued lines and stops the writer thread.
+    void close();
+
+    bool isRunning() const { return m_running.load(std::memory_order_acquire); }
+    LogFormat format() const { return m_format.load(std::memory_order_relaxed); }
+
+    /// \brief Queues a line for writing.  The line must end with a new line.
+    /// \details Thread-safe.
+    void append(QByteArray line);
+    /// \brief Blocks until all lines that were appended before are written.
+    void flush();
+
+private:
+    class WriterThread : public QThread
+    {
+    public:
+        explicit WriterThread(LogWriter& writer) : m_writer{writer} {}
+
+    protected:
+        void run() override { m_writer.writeQueuedLines(); }
+
+    private:
+        LogWriter& m_writer;
+    };
+
+    void writeQueuedLines();
+    void writeBatch(const QByteArray& batch);
+    void writeToStderr(const QByteArray& lines);
+    void rotate();
+
+private:
+    LogRingBuffer<QByteArray> m_queue;
+    WriterThread m_thread{*this};
+
+    std::atomic<bool> m_running{false};
+    std::atomic<bool> m_stopRequested{false};
+    std::atomic<bool> m_idle{false};
+    std::atomic<LogFormat> m_format{LogFormat::Text};
+    std::atomic<quint64> m_appended{0};
+    std::atomic<quint64> m_written{0};
+    std::atomic<quint64> m_dropped{0};
+
+    QMutex m_wakeMutex;
+    QWaitCondition m_wakeUp;
+    /// Used for synchronous writes to stderr.
+    QMutex m_stderrMutex;
+
+    // Only used by the writer thread while it is running.
+    QFile m_file;
+    LogFileOptions m_options;
+};
+
+} // namespace mediaelch
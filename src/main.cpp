@@ -24,7 +24,7 @@ static void initLogFile()
         return;
     }
     const QString logFile = Settings::instance()->advanced()->logFile();
-    bool success = mediaelch::openLogFile(logFile);
+    bool success = mediaelch::openLogFile(logFile, Settings::instance()->advanced()->logFileOptions());
     if (success) {
         return;
     }
@@ -185,6 +185,7 @@ int main(int argc, char* argv[])
     // Load the system's settings, e.g. window position, etc.
     Settings::instance()->loadSettings();
 
+    mediaelch::setLogLevels(Settings::instance()->advanced()->logLevels());
     initLogFile();
 
     ThemeWatcher w(app);
@@ -1,9 +1,11 @@
 #include "media/AsyncImage.h"
 
 #include "log/Log.h"
+#include "media/ImageMetadataCache.h"
 #include "media/ImageUtils.h"
 
 #include <QFuture>
+#include <QImageReader>
 #include <QtConcurrent>
 #include <chrono>
 
@@ -31,33 +33,59 @@ bool isLastModifiedTheSame(const mediaelch::FilePath& fileName, std::chrono::sec
 mediaelch::impl::ResizedImage readImageSync(mediaelch::FilePath path)
 {
     mediaelch::impl::ResizedImage img;
-    QFile file(path.toString());
-    if (file.open(QIODevice::ReadOnly)) {
-        img.image = QImage::fromData(file.readAll());
-        file.close();
-        img.originalSize = img.image.size();
-        img.resizedSize = img.originalSize;
-    } else {
-        qCWarning(generic) << "[AsyncImage] Could not load image from:" << path.toNativePathString();
+    // Decode directly from the file instead of reading all of it into memory first.
+    QImageReader reader(path.toString());
+    img.image = reader.read();
+    if (img.image.isNull()) {
+        qCWarning(c_image_cache) << "[AsyncImage] Could not load image from:" << path.toNativePathString() << "|"
+                                 << reader.errorString();
     }
+    img.originalSize = img.image.size();
+    img.resizedSize = img.originalSize;
     return img;
 }
 
-mediaelch::impl::ResizedImage readAndResizeImageSync(mediaelch::FilePath path, QSize targetSize)
+mediaelch::impl::ResizedImage
+readAndResizeImageSync(mediaelch::FilePath path, QSize targetSize, mediaelch::ImageMetadataCache* metadata)
 {
-    mediaelch::impl::ResizedImage img = readImageSync(std::move(path));
+    mediaelch::impl::ResizedImage img;
     img.resizedSize = targetSize;
-    if (!img.image.isNull()) {
+
+    // With the original size from the image's header, image plugins can decode a smaller image
+    // right away, e.g. JPEGs at 1/2, 1/4 or 1/8 of their size, instead of the full-size artwork.
+    const QString fileName = path.toString();
+    const mediaelch::ImageHeader header =
+        (metadata != nullptr) ? metadata->header(fileName) : mediaelch::ImageHeader::fromFile(fileName);
+    QImageReader reader(fileName);
+    img.originalSize = header.isValid() ? header.size : reader.size();
+
+    const QSize decodeSize = mediaelch::scaledSize(img.originalSize, targetSize);
+    if (decodeSize.isValid() && decodeSize.width() < img.originalSize.width()) {
+        reader.setScaledSize(decodeSize);
+    }
+    img.image = reader.read();
+
+    if (img.image.isNull()) {
+        qCWarning(c_image_cache) << "[AsyncImage] Could not load image from:" << path.toNativePathString() << "|"
+                                 << reader.errorString();
+        return img;
+    }
+    if (!img.originalSize.isValid()) {
+        img.originalSize = img.image.size();
+    }
+    if (img.image.size() != decodeSize) {
         img.image = mediaelch::scaledImage(img.image, targetSize);
     }
     return img;
 }
 
-mediaelch::impl::ResizedImage
-readAndResizeAndCacheImageSync(mediaelch::DirectoryPath cacheDir, mediaelch::FilePath imgPath, QSize targetSize)
+mediaelch::impl::ResizedImage readAndResizeAndCacheImageSync(mediaelch::DirectoryPath cacheDir,
+    mediaelch::ImageMetadataCache* metadata,
+    mediaelch::FilePath imgPath,
+    QSize targetSize)
 {
     if (!cacheDir.isValid()) {
-        return readAndResizeImageSync(imgPath, targetSize);
+        return readAndResizeImageSync(imgPath, targetSize, metadata);
     }
 
     QString hash = mediaelch::pathHash(imgPath);
@@ -93,7 +121,7 @@ readAndResizeAndCacheImageSync(mediaelch::DirectoryPath cacheDir, mediaelch::Fil
             QFile::remove(cacheDir.filePath(file));
         }
 
-        auto origImg = readAndResizeImageSync(imgPath, targetSize);
+        auto origImg = readAndResizeImageSync(imgPath, targetSize, metadata);
         QString cacheFileName = QStringLiteral("%1_%2_%3_%4_%5_%6_.png")
                                     .arg(hash)
                                     .arg(targetSize.width())
@@ -117,8 +145,8 @@ readAndResizeAndCacheImageSync(mediaelch::DirectoryPath cacheDir, mediaelch::Fil
 
             img.image = mediaelch::scaledImage(img.image, targetSize);
         } else {
-            qCWarning(generic) << "[Image] Couldn't load cached image of" << imgPath.toNativePathString() << "at"
-                               << QDir::toNativeSeparators(cachedImagePath);
+            qCWarning(c_image_cache) << "[Image] Couldn't load cached image of" << imgPath.toNativePathString() << "at"
+                                     << QDir::toNativeSeparators(cachedImagePath);
         }
         return img;
     }
@@ -139,19 +167,29 @@ std::unique_ptr<AsyncImage> AsyncImage::fromPath(mediaelch::FilePath path)
     return img;
 }
 
-std::unique_ptr<AsyncImage>
-AsyncImage::fromPathCached(mediaelch::DirectoryPath cacheDir, mediaelch::FilePath path, QSize targetSize)
+std::unique_ptr<AsyncImage> AsyncImage::fromPathCached(mediaelch::DirectoryPath cacheDir,
+    ImageMetadataCache* metadata,
+    mediaelch::FilePath path,
+    QSize targetSize)
 {
     // std::make_unique() can't access private constructor; and we are neither exception safe
     // to begin with nor do we try to reduce allocations, so no big deal.
     auto img = std::unique_ptr<AsyncImage>(new AsyncImage());
     img->m_path = path;
     connect(&img->m_watcher, &QFutureWatcher<QImage>::finished, img.get(), &AsyncImage::onLoaded);
-    img->m_watcher.setFuture(
-        QtConcurrent::run(readAndResizeAndCacheImageSync, std::move(cacheDir), std::move(path), std::move(targetSize)));
+    img->m_watcher.setFuture(QtConcurrent::run(
+        readAndResizeAndCacheImageSync, std::move(cacheDir), metadata, std::move(path), std::move(targetSize)));
     return img;
 }
 
+QImage AsyncImage::loadCachedSync(mediaelch::DirectoryPath cacheDir,
+    ImageMetadataCache* metadata,
+    mediaelch::FilePath path,
+    QSize targetSize)
+{
+    return readAndResizeAndCacheImageSync(std::move(cacheDir), metadata, std::move(path), std::move(targetSize)).image;
+}
+
 void AsyncImage::onLoaded()
 {
     m_img = m_watcher.result();
@@ -9,6 +9,8 @@
 
 namespace mediaelch {
 
+class ImageMetadataCache;
+
 namespace impl {
 
 struct ResizedImage
@@ -35,8 +37,16 @@ class AsyncImage : public QObject
 
 public:
     static std::unique_ptr<AsyncImage> fromPath(mediaelch::FilePath path);
-    static std::unique_ptr<AsyncImage>
-    fromPathCached(mediaelch::DirectoryPath cacheDir, mediaelch::FilePath path, QSize targetSize);
+    /// \param metadata Optional cache of image headers that is used to get the original image size.
+    static std::unique_ptr<AsyncImage> fromPathCached(mediaelch::DirectoryPath cacheDir,
+        ImageMetadataCache* metadata,
+        mediaelch::FilePath path,
+        QSize targetSize);
+    /// \brief Blocking variant of fromPathCached(). May be called from any thread.
+    static QImage loadCachedSync(mediaelch::DirectoryPath cacheDir,
+        ImageMetadataCache* metadata,
+        mediaelch::FilePath path,
+        QSize targetSize);
 
     /// \brief Returns a reference to the image, possibly 0.
     ELCH_NODISCARD QImage& image() { return m_img.image; }
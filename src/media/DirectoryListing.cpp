@@ -0,0 +1,137 @@
+#include "media/DirectoryListing.h"
+
+#include "utils/Meta.h"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QReadLocker>
+#include <QWriteLocker>
+#include <algorithm>
+
+namespace mediaelch {
+
+DirectoryListing DirectoryListing::read(const QString& path)
+{
+    DirectoryListing listing;
+    listing.m_path = path;
+
+    const QFileInfo dirInfo(path);
+    if (!dirInfo.isDir() || !dirInfo.isReadable()) {
+        return listing;
+    }
+
+    // QDirIterator uses the entry type returned by readdir() where available,
+    // so that no stat() is necessary for each entry.
+    QDirIterator it(path, QDir::Files | QDir::Dirs | QDir::Hidden | QDir::System | QDir::NoDotAndDotDot);
+    while (it.hasNext()) {
+        it.next();
+        const QString name = it.fileName();
+        if (it.fileInfo().isDir()) {
+            listing.m_dirs.insert(key(name));
+        } else {
+            listing.m_files.insert(key(name), name);
+        }
+    }
+
+    listing.m_isValid = true;
+    return listing;
+}
+
+bool DirectoryListing::hasFile(const QString& fileName) const
+{
+    return m_files.contains(key(fileName));
+}
+
+bool DirectoryListing::hasDir(const QString& dirName) const
+{
+    return m_dirs.contains(key(dirName));
+}
+
+QStringList DirectoryListing::filesWithSuffix(const QStringList& suffixes) const
+{
+    QStringList files;
+    for (const QString& fileName : m_files) {
+        // Hidden files are skipped, same as QDir::entryList() does by default.
+        const int dot = qsizetype_to_int(fileName.lastIndexOf('.'));
+        if (dot <= 0 || fileName.startsWith('.')) {
+            continue;
+        }
+        const QString suffix = fileName.mid(dot + 1);
+        if (suffixes.contains(suffix, Qt::CaseInsensitive)) {
+            files << fileName;
+        }
+    }
+    // Same order as QDir::entryList() with its default sorting.
+    std::sort(files.begin(), files.end(), [](const QString& a, const QString& b) {
+        return QString::compare(a, b, Qt::CaseInsensitive) < 0;
+    });
+    return files;
+}
+
+QString DirectoryListing::key(const QString& name)
+{
+#if defined(Q_OS_WIN) || defined(Q_OS_MACOS)
+    return name.toLower();
+#else
+    return name;
+#endif
+}
+
+DirectoryListing DirectoryListingCache::add(const QString& path)
+{
+    const QString normalized = normalizedPath(path);
+    {
+        QReadLocker locker(&m_lock);
+        const auto listing = m_listings.constFind(normalized);
+        if (listing != m_listings.constEnd()) {
+            return listing.value();
+        }
+    }
+
+    // Read the directory without holding the lock: It may take a while on network shares.
+    DirectoryListing listing = DirectoryListing::read(normalized);
+    QWriteLocker locker(&m_lock);
+    m_listings.insert(normalized, listing);
+    return listing;
+}
+
+DirectoryListing DirectoryListingCache::find(const QString& path) const
+{
+    QReadLocker locker(&m_lock);
+    return m_listings.value(normalizedPath(path));
+}
+
+void DirectoryListingCache::remove(const QStringList& paths)
+{
+    QWriteLocker locker(&m_lock);
+    for (const QString& path : paths) {
+        m_listings.remove(normalizedPath(path));
+    }
+}
+
+void DirectoryListingCache::clear()
+{
+    QWriteLocker locker(&m_lock);
+    m_listings.clear();
+}
+
+bool DirectoryListingCache::isFile(const QString& dirPath, const QString& fileName) const
+{
+    // Names of data files may contain sub-directories, which are not part of a listing.
+    if (!fileName.contains('/') && !fileName.contains('\\')) {
+        const DirectoryListing listing = find(dirPath);
+        if (listing.isValid()) {
+            return listing.hasFile(fileName);
+        }
+    }
+    return QFileInfo(dirPath + "/" + fileName).isFile();
+}
+
+QString DirectoryListingCache::normalizedPath(const QString& path)
+{
+    // Does not access the filesystem.
+    return QDir::cleanPath(QDir::fromNativeSeparators(path));
+}
+
+} // namespace mediaelch
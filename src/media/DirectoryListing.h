@@ -0,0 +1,81 @@
+#pragma once
+
+#include <QHash>
+#include <QReadWriteLock>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+namespace mediaelch {
+
+/// \brief Snapshot of the names of all files and sub-directories of a directory.
+///
+/// Checking whether a file exists requires a stat() call. Artwork, NFO and
+/// subtitle files are looked up using many possible names for each movie.
+/// On network shares, each stat() is a round trip to the server.
+/// A listing reads the directory only once and answers these lookups in memory.
+///
+/// Names are compared case-insensitively on Windows and macOS, same as their
+/// default filesystems do.
+class DirectoryListing
+{
+public:
+    DirectoryListing() = default;
+
+    /// \brief Read all entries of the given directory. Does not recurse.
+    /// \details The returned listing is invalid if the directory can't be read.
+    static DirectoryListing read(const QString& path);
+
+    bool isValid() const { return m_isValid; }
+    const QString& path() const { return m_path; }
+
+    bool hasFile(const QString& fileName) const;
+    bool hasDir(const QString& dirName) const;
+
+    /// \brief Names of all files that have one of the given suffixes (without dot),
+    ///        sorted case-insensitively.  Suffixes are compared case-insensitively.
+    ///        Hidden files are skipped.
+    QStringList filesWithSuffix(const QStringList& suffixes) const;
+
+private:
+    static QString key(const QString& name);
+
+private:
+    QString m_path;
+    bool m_isValid = false;
+    /// Key is the name used for lookups, value the actual file name.
+    QHash<QString, QString> m_files;
+    QSet<QString> m_dirs;
+};
+
+/// \brief Thread-safe store of directory listings.
+///
+/// Directory scanners add listings of all directories that they create media
+/// items for, so that MediaCenterInterface implementations can use them while
+/// loading the items.  Listings become outdated as soon as files are written,
+/// which is why scanners must remove them once they're done.
+class DirectoryListingCache
+{
+public:
+    /// \brief Read the given directory and store its listing.
+    /// \details If the directory has already been read, the stored listing is returned.
+    DirectoryListing add(const QString& path);
+    /// \brief Returns the stored listing or an invalid one if the directory was not read.
+    DirectoryListing find(const QString& path) const;
+
+    void remove(const QStringList& paths);
+    void clear();
+
+    /// \brief Whether a file with the given name exists in the given directory.
+    /// \details Uses the stored listing if there is one and falls back to QFileInfo otherwise.
+    bool isFile(const QString& dirPath, const QString& fileName) const;
+
+private:
+    static QString normalizedPath(const QString& path);
+
+private:
+    mutable QReadWriteLock m_lock;
+    QHash<QString, DirectoryListing> m_listings;
+};
+
+} // namespace mediaelch
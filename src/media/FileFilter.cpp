@@ -4,23 +4,31 @@ namespace mediaelch {
 
 bool FileFilter::isFileExcluded(const QString& filename) const
 {
-    for (const QRegularExpression& rx : fileExcludes) {
-        if (rx.isValid() && rx.match(filename).hasMatch()) {
-            return true;
-        }
-    }
-    return false;
+    return m_fileMatcher.matches(filename);
 }
 
 bool FileFilter::isFolderExcluded(const QString& folder) const
 {
-    for (const QRegularExpression& rx : folderExcludes) {
-        if (rx.isValid() && rx.match(folder).hasMatch()) {
-            return true;
-        }
-    }
-    return false;
+    return m_folderMatcher.matches(folder);
 }
 
+void FileFilter::setExcludes(QVector<QRegularExpression> fileExcludes, QVector<QRegularExpression> folderExcludes)
+{
+    m_fileExcludes = std::move(fileExcludes);
+    m_folderExcludes = std::move(folderExcludes);
+    compile();
+}
+
+void FileFilter::excludeFileNamesContaining(const QStringList& parts)
+{
+    m_excludedFileNameParts.append(parts);
+    compile();
+}
+
+void FileFilter::compile()
+{
+    m_fileMatcher = NameMatcher(m_fileExcludes, m_excludedFileNameParts);
+    m_folderMatcher = NameMatcher(m_folderExcludes);
+}
 
 } // namespace mediaelch
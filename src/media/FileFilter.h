@@ -1,5 +1,7 @@
 #pragma once
 
+#include "media/NameMatcher.h"
+
 #include <QRegularExpression>
 #include <QString>
 #include <QStringList>
@@ -10,6 +12,7 @@ namespace mediaelch {
 /// \brief Filter which files should be used and which ignored.
 /// \details Qt's QDir::entryList supports a positive filter list such as *.mp3, etc.
 ///          This class does exactly that.  Filter what's allowed and what not.
+///          Exclude patterns are compiled into a NameMatcher when they are set.
 class FileFilter
 {
 public:
@@ -21,10 +24,26 @@ public:
     bool isFileExcluded(const QString& filename) const;
     bool isFolderExcluded(const QString& folder) const;
 
+    const QVector<QRegularExpression>& fileExcludes() const { return m_fileExcludes; }
+    const QVector<QRegularExpression>& folderExcludes() const { return m_folderExcludes; }
+    void setExcludes(QVector<QRegularExpression> fileExcludes, QVector<QRegularExpression> folderExcludes);
+
+    /// \brief Additionally exclude all files whose name contains one of the given
+    ///        parts, compared case-insensitively, e.g. "-trailer".
+    void excludeFileNamesContaining(const QStringList& parts);
+
 public:
     QStringList fileGlob = {{"*"}};
-    QVector<QRegularExpression> fileExcludes;
-    QVector<QRegularExpression> folderExcludes;
+
+private:
+    void compile();
+
+    QVector<QRegularExpression> m_fileExcludes;
+    QVector<QRegularExpression> m_folderExcludes;
+    QStringList m_excludedFileNameParts;
+
+    NameMatcher m_fileMatcher;
+    NameMatcher m_folderMatcher;
 };
 
 } // namespace mediaelch
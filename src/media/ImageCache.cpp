@@ -4,6 +4,7 @@
 #include "media/ImageUtils.h"
 #include "settings/Settings.h"
 
+#include <QCryptographicHash>
 #include <QDir>
 #include <QFileInfo>
 #include <QtConcurrent>
@@ -15,18 +16,24 @@ ImageCache::ImageCache(QObject* parent) : QObject(parent)
     if (!dir.exists()) {
         dir.mkdir(location.toString());
     }
-    location = location.subDir("images");
-    dir.setPath(location.toString());
-    bool exists = dir.exists();
-    if (!exists) {
-        exists = dir.mkdir(location.toString());
-    }
-    if (exists) {
-        m_cacheDir = location;
-    }
-    qCDebug(generic) << "[ImageCache] Using cache directory:" << m_cacheDir;
+    const auto createSubDir = [&location](const QString& name) -> mediaelch::DirectoryPath {
+        mediaelch::DirectoryPath subDir = location.subDir(name);
+        QDir dir(subDir.toString());
+        if (dir.exists() || dir.mkdir(subDir.toString())) {
+            return subDir;
+        }
+        return {};
+    };
+    m_cacheDir = createSubDir("images");
+    m_previewCacheDir = createSubDir("previews");
+    qCDebug(c_image_cache) << "[ImageCache] Using cache directory:" << m_cacheDir;
+
+    const QString metadataFile = location.isValid() ? location.filePath("image_metadata.cache") : QString();
+    m_metadata = std::make_unique<mediaelch::ImageMetadataCache>(metadataFile);
 }
 
+ImageCache::~ImageCache() = default;
+
 ImageCache* ImageCache::instance()
 {
     static ImageCache s_instance;
@@ -35,6 +42,7 @@ ImageCache* ImageCache::instance()
 
 void ImageCache::invalidateImages(const mediaelch::FilePath& path)
 {
+    m_metadata->invalidate(path.toString());
     if (!m_cacheDir.isValid()) {
         return;
     }
@@ -49,16 +57,39 @@ void ImageCache::invalidateImages(const mediaelch::FilePath& path)
 
 void ImageCache::clearCache()
 {
-    if (!m_cacheDir.isValid()) {
-        return;
-    }
-    const auto entries = m_cacheDir.dir().entryInfoList(QDir::Files | QDir::NoDotAndDotDot);
-    for (const QFileInfo& file : entries) {
-        QFile(file.absoluteFilePath()).remove();
+    m_metadata->clear();
+    m_metadata->save();
+    for (const mediaelch::DirectoryPath& cacheDir : {m_cacheDir, m_previewCacheDir}) {
+        if (!cacheDir.isValid()) {
+            continue;
+        }
+        const auto entries = cacheDir.dir().entryInfoList(QDir::Files | QDir::NoDotAndDotDot);
+        for (const QFileInfo& file : entries) {
+            QFile(file.absoluteFilePath()).remove();
+        }
     }
 }
 
 std::unique_ptr<mediaelch::AsyncImage> ImageCache::loadImageAsync(const mediaelch::FilePath& path, QSize targetSize)
 {
-    return mediaelch::AsyncImage::fromPathCached(m_cacheDir, path, targetSize);
+    return mediaelch::AsyncImage::fromPathCached(m_cacheDir, m_metadata.get(), path, targetSize);
+}
+
+QImage ImageCache::loadImageSync(const mediaelch::FilePath& path, QSize targetSize) const
+{
+    return mediaelch::AsyncImage::loadCachedSync(m_cacheDir, m_metadata.get(), path, targetSize);
+}
+
+QString ImageCache::previewCacheFilePath(const QUrl& url) const
+{
+    if (!m_previewCacheDir.isValid()) {
+        return {};
+    }
+    const QByteArray hash = QCryptographicHash::hash(url.toEncoded(), QCryptographicHash::Sha1).toHex();
+    return m_previewCacheDir.filePath(QString::fromLatin1(hash));
+}
+
+mediaelch::ImageHeader ImageCache::imageHeader(const mediaelch::FilePath& path) const
+{
+    return m_metadata->header(path.toString());
 }
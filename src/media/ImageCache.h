@@ -1,16 +1,20 @@
 #pragma once
 
 #include "media/AsyncImage.h"
+#include "media/ImageMetadataCache.h"
 #include "media/Path.h"
 
 #include <QSize>
 #include <QString>
+#include <QUrl>
+#include <memory>
 
 class ImageCache : public QObject
 {
     Q_OBJECT
 public:
     explicit ImageCache(QObject* parent = nullptr);
+    ~ImageCache() override;
     static ImageCache* instance();
 
     void invalidateImages(const mediaelch::FilePath& path);
@@ -23,7 +27,20 @@ public:
     ///   is cached on disk and loaded instead of the original on subsequent requests.
     ///   No in-memory caching is performed.
     std::unique_ptr<mediaelch::AsyncImage> loadImageAsync(const mediaelch::FilePath& path, QSize targetSize);
+    /// \brief Blocking variant of loadImageAsync(). Thread-safe, i.e. can be used by worker threads
+    ///        that scale many images at once, e.g. for exports.
+    QImage loadImageSync(const mediaelch::FilePath& path, QSize targetSize) const;
+
+    /// \brief File path at which the downloaded preview of the given remote image is cached.
+    /// \details Returns an empty string if there is no cache directory. The file may not exist.
+    QString previewCacheFilePath(const QUrl& url) const;
+
+    /// \brief Format, size and orientation of the given image file, read from its header.
+    /// \details Headers are cached persistently.  Thread-safe.
+    mediaelch::ImageHeader imageHeader(const mediaelch::FilePath& path) const;
 
 private:
     mediaelch::DirectoryPath m_cacheDir;
+    mediaelch::DirectoryPath m_previewCacheDir;
+    std::unique_ptr<mediaelch::ImageMetadataCache> m_metadata;
 };
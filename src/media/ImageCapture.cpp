@@ -5,8 +5,23 @@
 #include "utils/Time.h"
 
 #include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QProcess>
-#include <QTemporaryFile>
+
+namespace {
+
+QString ffmpegBinary()
+{
+#ifdef Q_OS_MACOS
+    return QCoreApplication::applicationDirPath() + "/ffmpeg";
+#elif defined(Q_OS_WIN)
+    return QCoreApplication::applicationDirPath() + "/vendor/ffmpeg.exe";
+#else
+    return "ffmpeg";
+#endif
+}
+
+} // namespace
 
 namespace mediaelch {
 
@@ -30,16 +45,6 @@ bool ImageCapture::captureImage(FilePath file,
         }
     }
 
-#ifdef Q_OS_MACOS
-    QString ffmpegbin = QCoreApplication::applicationDirPath() + "/ffmpeg";
-#elif defined(Q_OS_WIN)
-    QString ffmpegbin = QCoreApplication::applicationDirPath() + "/vendor/ffmpeg.exe";
-#else
-    QString ffmpegbin = "ffmpeg";
-#endif
-
-    QProcess ffmpeg;
-
     unsigned duration =
         streamDetails->videoDetails().value(StreamDetails::VideoDetails::DurationInSeconds, nullptr).toUInt();
 
@@ -48,69 +53,111 @@ bool ImageCapture::captureImage(FilePath file,
         return false;
     }
 
-    const unsigned t = mediaelch::randomUnsignedInt() % duration;
-    QString timeCode = mediaelch::secondsToTimeCode(t);
-
-    QTemporaryFile tmpFile;
-    if (!tmpFile.open()) {
-        NotificationBox::instance()->showError(tr("Temporary output file could not be opened"));
+    QString errorString;
+    if (!captureFrame(file, randomTime(duration), img, errorString)) {
+        NotificationBox::instance()->showError(errorString);
         return false;
     }
-    tmpFile.close();
 
-    ffmpeg.start(ffmpegbin,
-        QStringList() << "-y"
-                      << "-ss" << timeCode << "-i" << file.toNativePathString() << "-frames:v"
+    img = scaledToDimensions(img, dim, cropFromCenter);
+    return true;
+}
+
+bool ImageCapture::captureFrame(const FilePath& file,
+    unsigned timeInSeconds,
+    QImage& img,
+    QString& errorString,
+    const std::atomic_bool* canceled)
+{
+    // "-ss" before "-i" seeks in the input, i.e. ffmpeg jumps to the closest keyframe instead of
+    // decoding the video up to the given time.  Only keyframes are decoded at all, which is
+    // good enough for a screenshot and a lot faster for long videos.
+    QProcess ffmpeg;
+    ffmpeg.start(ffmpegBinary(),
+        QStringList() << "-nostdin"
+                      << "-hide_banner"
+                      << "-loglevel"
+                      << "error"
+                      << "-skip_frame"
+                      << "nokey"
+                      << "-noaccurate_seek"
+                      << "-ss" << mediaelch::secondsToTimeCode(timeInSeconds) //
+                      << "-i" << file.toNativePathString() //
+                      << "-an"
+                      << "-sn"
+                      << "-frames:v"
                       << "1"
                       << "-q:v"
                       << "2"
                       << "-f"
-                      << "mjpeg" << tmpFile.fileName());
+                      << "image2pipe"
+                      << "-c:v"
+                      << "mjpeg"
+                      << "-");
     if (!ffmpeg.waitForStarted()) {
 #if defined(Q_OS_WIN) || defined(Q_OS_MACOS)
-        NotificationBox::instance()->showError(tr("Could not start ffmpeg"));
+        errorString = tr("Could not start ffmpeg");
 #else
-        NotificationBox::instance()->showError(
-            tr("Could not start ffmpeg. Please install it and make it available in your $PATH"));
+        errorString = tr("Could not start ffmpeg. Please install it and make it available in your $PATH");
 #endif
         return false;
     }
 
-    if (!ffmpeg.waitForFinished(10000)) {
-        NotificationBox::instance()->showError(tr("ffmpeg did not finish"));
-        return false;
+    // Wait in small steps, so that a canceled capture does not have to wait for ffmpeg.
+    // QProcess reads ffmpeg's output into its buffer while waiting.
+    QElapsedTimer timer;
+    timer.start();
+    while (!ffmpeg.waitForFinished(100) && ffmpeg.state() != QProcess::NotRunning) {
+        const bool isCanceled = canceled != nullptr && canceled->load();
+        if (isCanceled || timer.hasExpired(10000)) {
+            ffmpeg.kill();
+            ffmpeg.waitForFinished();
+            errorString = isCanceled ? tr("Canceled") : tr("ffmpeg did not finish");
+            return false;
+        }
     }
-    if (!tmpFile.open()) {
-        NotificationBox::instance()->showError(tr("Temporary output file could not be opened"));
+
+    img = QImage::fromData(ffmpeg.readAllStandardOutput(), "JPG");
+    if (img.isNull()) {
+        const QString ffmpegError = QString::fromLocal8Bit(ffmpeg.readAllStandardError()).trimmed();
+        errorString = tr("ffmpeg could not capture an image: %1").arg(ffmpegError);
         return false;
     }
+    return true;
+}
 
-    img = QImage::fromData(tmpFile.readAll());
-    tmpFile.close();
-
+QImage ImageCapture::scaledToDimensions(const QImage& img, ThumbnailDimensions dim, bool cropFromCenter)
+{
     // 0 => no scaling
     if (dim.width == 0 || dim.height == 0) {
-        return true;
+        return img;
     }
 
     if (cropFromCenter) {
-        img = img.scaled(dim.width, dim.height, Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation);
+        QImage scaled = img.scaled(dim.width, dim.height, Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation);
 
-        int offsetLeft = (img.width() - dim.width) / 2;
+        int offsetLeft = (scaled.width() - dim.width) / 2;
         offsetLeft = (offsetLeft < 0) ? 0 : offsetLeft;
 
-        int offsetTop = (img.height() - dim.height) / 2;
+        int offsetTop = (scaled.height() - dim.height) / 2;
         offsetTop = (offsetTop < 0) ? 0 : offsetTop;
 
         // Crop the image
-        img = img.copy(QRect(offsetLeft, offsetTop, dim.width, dim.height));
-
-    } else {
-        // Only resize the image to the wanted dimensions and keep the aspect ratio.
-        img = img.scaled(dim.width, dim.height, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        return scaled.copy(QRect(offsetLeft, offsetTop, dim.width, dim.height));
     }
 
-    return true;
+    // Only resize the image to the wanted dimensions and keep the aspect ratio.
+    return img.scaled(dim.width, dim.height, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+}
+
+unsigned ImageCapture::randomTime(unsigned durationInSeconds)
+{
+    if (durationInSeconds < 20) {
+        return durationInSeconds == 0 ? 0 : mediaelch::randomUnsignedInt() % durationInSeconds;
+    }
+    // Opening and closing credits are usually not what users want to see.
+    const unsigned margin = durationInSeconds / 10;
+    return margin + mediaelch::randomUnsignedInt() % (durationInSeconds - 2 * margin);
 }
 
 } // namespace mediaelch
@@ -4,7 +4,9 @@
 #include "media/Path.h"
 #include "media/StreamDetails.h"
 
+#include <QImage>
 #include <QObject>
+#include <atomic>
 
 namespace mediaelch {
 
@@ -27,6 +29,23 @@ public:
         ThumbnailDimensions dim,
         QImage& img,
         bool cropFromCenter = false);
+
+    /// \brief Captures the first keyframe at or before the given time of a video file using ffmpeg.
+    ///
+    /// Does not show any notifications and can therefore be used in worker threads.
+    /// The frame is read from ffmpeg's stdout; no temporary file is created.
+    /// \param canceled If set and it becomes true, ffmpeg is stopped and false is returned.
+    static bool captureFrame(const FilePath& file,
+        unsigned timeInSeconds,
+        QImage& img,
+        QString& errorString,
+        const std::atomic_bool* canceled = nullptr);
+
+    /// \brief Scales the image to the given dimensions.  See captureImage() for details.
+    static QImage scaledToDimensions(const QImage& img, ThumbnailDimensions dim, bool cropFromCenter);
+
+    /// \brief Random time for a screenshot, which avoids the very start and end of the video.
+    static unsigned randomTime(unsigned durationInSeconds);
 };
 
 } // namespace mediaelch
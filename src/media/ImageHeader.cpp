@@ -0,0 +1,193 @@
+#include "media/ImageHeader.h"
+
+#include <QFile>
+#include <cstring>
+
+namespace {
+
+using mediaelch::ImageHeader;
+
+class ByteReader
+{
+public:
+    explicit ByteReader(const QByteArray& data) :
+        m_data{reinterpret_cast<const uchar*>(data.constData())}, m_size{static_cast<qint64>(data.size())}
+    {
+    }
+
+    bool has(qint64 pos, qint64 count) const { return pos >= 0 && count >= 0 && pos + count <= m_size; }
+
+    uchar u8(qint64 pos) const { return m_data[pos]; }
+    quint32 u16be(qint64 pos) const { return (quint32(m_data[pos]) << 8) | m_data[pos + 1]; }
+    quint32 u16le(qint64 pos) const { return (quint32(m_data[pos + 1]) << 8) | m_data[pos]; }
+    quint32 u24le(qint64 pos) const { return (quint32(m_data[pos + 2]) << 16) | u16le(pos); }
+    quint32 u32be(qint64 pos) const { return (u16be(pos) << 16) | u16be(pos + 2); }
+    quint32 u32le(qint64 pos) const { return (u16le(pos + 2) << 16) | u16le(pos); }
+
+    bool matches(qint64 pos, const char* bytes, qint64 count) const
+    {
+        return has(pos, count) && memcmp(m_data + pos, bytes, static_cast<size_t>(count)) == 0;
+    }
+
+private:
+    const uchar* m_data;
+    qint64 m_size;
+};
+
+/// Reads the orientation tag from IFD0 of the given Exif APP1 segment's payload.
+int readExifOrientation(const ByteReader& reader, qint64 start, qint64 length)
+{
+    // "Exif\0\0", then a TIFF header: byte order (2), magic 42 (2), offset of IFD0 (4)
+    const qint64 tiff = start + 6;
+    const qint64 end = start + length;
+    // The segment may be cut off, because only the start of a file is read.
+    if (tiff + 8 > end || !reader.has(tiff, 8) || !reader.matches(start, "Exif\0\0", 6)) {
+        return 1;
+    }
+    const bool littleEndian = reader.matches(tiff, "II", 2);
+    if (!littleEndian && !reader.matches(tiff, "MM", 2)) {
+        return 1;
+    }
+    const auto u16 = [&](qint64 pos) { return littleEndian ? reader.u16le(pos) : reader.u16be(pos); };
+    const auto u32 = [&](qint64 pos) { return littleEndian ? reader.u32le(pos) : reader.u32be(pos); };
+
+    const qint64 ifd = tiff + u32(tiff + 4);
+    if (ifd + 2 > end || !reader.has(ifd, 2)) {
+        return 1;
+    }
+    const qint64 entries = u16(ifd);
+    for (qint64 i = 0; i < entries; ++i) {
+        // tag (2), type (2), count (4), value (4)
+        const qint64 entry = ifd + 2 + i * 12;
+        if (entry + 12 > end || !reader.has(entry, 12)) {
+            break;
+        }
+        if (u16(entry) == 0x0112) {
+            const int orientation = static_cast<int>(u16(entry + 8));
+            return (orientation >= 1 && orientation <= 8) ? orientation : 1;
+        }
+    }
+    return 1;
+}
+
+bool isJpegStartOfFrame(uchar marker)
+{
+    // SOF0-SOF15 except DHT (C4), JPG (C8) and DAC (CC), which share the range.
+    return marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+}
+
+ImageHeader readJpeg(const ByteReader& reader)
+{
+    ImageHeader header;
+    header.format = ImageHeader::Format::Jpeg;
+
+    qint64 pos = 2; // after SOI
+    while (reader.has(pos, 4)) {
+        if (reader.u8(pos) != 0xFF) {
+            break; // corrupt
+        }
+        const uchar marker = reader.u8(pos + 1);
+        if (marker == 0xFF) {
+            ++pos; // fill byte
+            continue;
+        }
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8)) {
+            pos += 2; // markers without a segment
+            continue;
+        }
+        if (marker == 0xD9 || marker == 0xDA) {
+            break; // end of image or start of scan: there was no frame header
+        }
+
+        const qint64 length = reader.u16be(pos + 2);
+        if (marker == 0xE1) {
+            header.orientation = readExifOrientation(reader, pos + 4, length - 2);
+        }
+        if (isJpegStartOfFrame(marker)) {
+            // length (2), precision (1), height (2), width (2)
+            if (reader.has(pos + 4, 5)) {
+                header.size = QSize(static_cast<int>(reader.u16be(pos + 7)), static_cast<int>(reader.u16be(pos + 5)));
+            }
+            return header;
+        }
+        pos += 2 + length;
+    }
+    return header;
+}
+
+ImageHeader readPng(const ByteReader& reader)
+{
+    ImageHeader header;
+    header.format = ImageHeader::Format::Png;
+    // The IHDR chunk must come first: length (4), type (4), width (4), height (4)
+    if (reader.matches(12, "IHDR", 4) && reader.has(16, 8)) {
+        header.size = QSize(static_cast<int>(reader.u32be(16)), static_cast<int>(reader.u32be(20)));
+    }
+    return header;
+}
+
+ImageHeader readWebP(const ByteReader& reader)
+{
+    ImageHeader header;
+    header.format = ImageHeader::Format::WebP;
+
+    if (reader.matches(12, "VP8 ", 4) && reader.has(20, 10)) {
+        // Lossy: frame tag (3), start code (3), 14 bit width and height
+        if (reader.u8(23) == 0x9D && reader.u8(24) == 0x01 && reader.u8(25) == 0x2A) {
+            header.size = QSize(static_cast<int>(reader.u16le(26) & 0x3FFF), //
+                static_cast<int>(reader.u16le(28) & 0x3FFF));
+        }
+
+    } else if (reader.matches(12, "VP8L", 4) && reader.has(20, 5)) {
+        // Lossless: signature (1), then 14 bit width - 1 and 14 bit height - 1
+        if (reader.u8(20) == 0x2F) {
+            const quint32 bits = reader.u32le(21);
+            header.size = QSize(static_cast<int>((bits & 0x3FFF) + 1), static_cast<int>(((bits >> 14) & 0x3FFF) + 1));
+        }
+
+    } else if (reader.matches(12, "VP8X", 4) && reader.has(20, 10)) {
+        // Extended: flags (1), reserved (3), 24 bit canvas width - 1 and height - 1
+        header.size = QSize(static_cast<int>(reader.u24le(24) + 1), static_cast<int>(reader.u24le(27) + 1));
+    }
+    return header;
+}
+
+} // namespace
+
+namespace mediaelch {
+
+ImageHeader ImageHeader::fromData(const QByteArray& data)
+{
+    const ByteReader reader(data);
+    if (reader.matches(0, "\xFF\xD8\xFF", 3)) {
+        return readJpeg(reader);
+    }
+    if (reader.matches(0, "\x89PNG\r\n\x1A\n", 8)) {
+        return readPng(reader);
+    }
+    if (reader.matches(0, "RIFF", 4) && reader.matches(8, "WEBP", 4)) {
+        return readWebP(reader);
+    }
+    return {};
+}
+
+ImageHeader ImageHeader::fromFile(const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+    // Almost all headers are in the first few kilobytes.  JPEGs may have large
+    // Exif or ICC segments before the frame header, so read more if necessary.
+    qint64 bytesToRead = 64 * 1024;
+    QByteArray data = file.read(bytesToRead);
+    ImageHeader header = fromData(data);
+    while (header.format == Format::Jpeg && !header.isValid() && !file.atEnd()) {
+        bytesToRead *= 4;
+        data.append(file.read(bytesToRead - data.size()));
+        header = fromData(data);
+    }
+    return header;
+}
+
+} // namespace mediaelch
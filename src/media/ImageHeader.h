@@ -0,0 +1,43 @@
+#pragma once
+
+#include <QByteArray>
+#include <QSize>
+
+namespace mediaelch {
+
+/// \brief Format, dimensions and orientation of an encoded image, read from its header only.
+///
+/// Decoding a full-size backdrop just to learn its resolution takes longer than
+/// downloading it.  JPEG, PNG and WebP store their dimensions in the first few
+/// bytes (JPEG: in its start-of-frame segment), so that no pixel data has to be
+/// decoded.  Other formats are not supported and result in an invalid header.
+/// See ImageMetadataCache for a persistent cache of headers of local files.
+struct ImageHeader
+{
+    enum class Format : int8_t
+    {
+        Unknown,
+        Jpeg,
+        Png,
+        WebP
+    };
+
+    /// \brief Read the header of the given encoded image.
+    /// \details The data may be truncated as long as the header is complete.
+    static ImageHeader fromData(const QByteArray& data);
+    /// \brief Read the header of the given image file.
+    /// \details Only reads the start of the file, unless a JPEG has large metadata segments.
+    static ImageHeader fromFile(const QString& filePath);
+
+    bool isValid() const { return format != Format::Unknown && !size.isEmpty(); }
+    /// \brief Size of the image as shown, i.e. with width and height swapped if it is rotated by 90°.
+    QSize displaySize() const { return orientation >= 5 ? size.transposed() : size; }
+
+    Format format = Format::Unknown;
+    /// Width and height as stored, i.e. without applying the orientation.
+    QSize size;
+    /// EXIF orientation (1-8) of JPEG images.  1 means "not rotated or mirrored".
+    int orientation = 1;
+};
+
+} // namespace mediaelch
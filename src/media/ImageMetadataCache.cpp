@@ -0,0 +1,156 @@
+#include "media/ImageMetadataCache.h"
+
+#include "log/Log.h"
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QSaveFile>
+
+namespace {
+
+// Increase if the stored format changes; old caches are discarded.
+constexpr quint32 cacheMagic = 0x4D454D44; // "MEMD"
+constexpr quint32 cacheVersion = 1;
+// Magic number, version and entry count.
+constexpr qint64 cacheHeaderSize = 12;
+// Lower bound of an entry's size: path (at least its length), file size, last modified
+// (at least its date), format, image size and orientation.
+constexpr qint64 minEntrySize = 4 + 8 + 8 + 1 + 8 + 1;
+
+} // namespace
+
+namespace mediaelch {
+
+ImageMetadataCache::ImageMetadataCache(QString cacheFile) : m_cacheFile{std::move(cacheFile)}
+{
+    load();
+}
+
+ImageMetadataCache::~ImageMetadataCache()
+{
+    save();
+}
+
+ImageHeader ImageMetadataCache::header(const QString& filePath)
+{
+    const QFileInfo fi(filePath);
+    if (!fi.isFile()) {
+        return {};
+    }
+    const qint64 fileSize = fi.size();
+    const qint64 lastModified = fi.lastModified().toMSecsSinceEpoch();
+
+    {
+        QMutexLocker locker(&m_mutex);
+        const auto entry = m_entries.constFind(filePath);
+        if (entry != m_entries.constEnd() && entry->fileSize == fileSize && entry->lastModified == lastModified) {
+            return entry->header;
+        }
+    }
+
+    // Don't block other threads while reading the file.
+    Entry entry;
+    entry.fileSize = fileSize;
+    entry.lastModified = lastModified;
+    entry.header = ImageHeader::fromFile(filePath);
+
+    QMutexLocker locker(&m_mutex);
+    m_entries.insert(filePath, entry);
+    m_changed = true;
+    return entry.header;
+}
+
+void ImageMetadataCache::invalidate(const QString& filePath)
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_entries.remove(filePath) > 0) {
+        m_changed = true;
+    }
+}
+
+void ImageMetadataCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_entries.clear();
+    m_changed = true;
+}
+
+int ImageMetadataCache::size() const
+{
+    QMutexLocker locker(&m_mutex);
+    return static_cast<int>(m_entries.size());
+}
+
+void ImageMetadataCache::save()
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_changed || m_cacheFile.isEmpty()) {
+        return;
+    }
+
+    QSaveFile file(m_cacheFile);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(c_image_cache) << "[ImageMetadataCache] Could not write" << m_cacheFile;
+        return;
+    }
+    QDataStream out(&file);
+    out << cacheMagic << cacheVersion << static_cast<quint32>(m_entries.size());
+    for (auto entry = m_entries.constBegin(); entry != m_entries.constEnd(); ++entry) {
+        out << entry.key() << entry->fileSize << entry->lastModified //
+            << static_cast<qint8>(entry->header.format) << entry->header.size
+            << static_cast<qint8>(entry->header.orientation);
+    }
+    if (out.status() == QDataStream::Ok && file.commit()) {
+        m_changed = false;
+    }
+}
+
+void ImageMetadataCache::load()
+{
+    if (m_cacheFile.isEmpty()) {
+        return;
+    }
+    QFile file(m_cacheFile);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream in(&file);
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint32 count = 0;
+    in >> magic >> version >> count;
+    if (magic != cacheMagic || version != cacheVersion) {
+        qCInfo(c_image_cache) << "[ImageMetadataCache] Discarding cache with unknown format:" << m_cacheFile;
+        return;
+    }
+
+    // The count is read from disk: Don't trust it for allocations.
+    if (count > static_cast<quint64>(qMax<qint64>(0, file.size() - cacheHeaderSize) / minEntrySize)) {
+        qCWarning(c_image_cache) << "[ImageMetadataCache] Cache file is corrupt:" << m_cacheFile;
+        return;
+    }
+
+    QHash<QString, Entry> entries;
+    entries.reserve(static_cast<int>(count));
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        QString path;
+        Entry entry;
+        qint8 format = 0;
+        qint8 orientation = 0;
+        in >> path >> entry.fileSize >> entry.lastModified >> format >> entry.header.size >> orientation;
+        entry.header.format = static_cast<ImageHeader::Format>(format);
+        entry.header.orientation = orientation;
+        entries.insert(path, entry);
+    }
+    if (in.status() != QDataStream::Ok) {
+        qCWarning(c_image_cache) << "[ImageMetadataCache] Cache file is corrupt:" << m_cacheFile;
+        return;
+    }
+    m_entries = std::move(entries);
+}
+
+} // namespace mediaelch
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "media/ImageHeader.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QString>
+
+namespace mediaelch {
+
+/// \brief Persistent cache of image headers of local files.
+///
+/// Reading an image's header is cheap, but still requires opening the file,
+/// which is slow on network shares.  Headers are cached by the file's path,
+/// size and modification time, so that a changed file is probed again.
+/// The cache is stored in a binary file and loaded on construction.
+///
+/// All functions are thread-safe, so that the cache can be used by workers
+/// that load many images at once, e.g. for exports.
+class ImageMetadataCache
+{
+public:
+    /// \param cacheFile File in which the cache is stored.  If empty, the cache is not persisted.
+    explicit ImageMetadataCache(QString cacheFile = {});
+    ~ImageMetadataCache();
+
+    /// \brief Header of the given image file.  Probes the file if it is not cached or has changed.
+    ImageHeader header(const QString& filePath);
+
+    void invalidate(const QString& filePath);
+    void clear();
+    /// \brief Write the cache to disk if it has changed.
+    void save();
+
+    int size() const;
+
+private:
+    struct Entry
+    {
+        qint64 fileSize = 0;
+        qint64 lastModified = 0;
+        ImageHeader header;
+    };
+
+    void load();
+
+private:
+    QString m_cacheFile;
+    mutable QMutex m_mutex;
+    QHash<QString, Entry> m_entries;
+    bool m_changed = false;
+};
+
+} // namespace mediaelch
@@ -1,28 +1,50 @@
 #include "media/ImageUtils.h"
 
+#include "media/ImageHeader.h"
+
 #include <QBuffer>
 #include <QFile>
+#include <QImageReader>
 
 namespace mediaelch {
 
-void resizeBackdrop(QImage& image, bool& resized)
+QSize backdropResizeTarget(QSize size)
 {
-    resized = false;
-    if ((image.width() != 1920 || image.height() != 1080) && image.width() > 1915 && image.width() < 1925
-        && image.height() > 1075 && image.height() < 1085) {
-        image = image.scaled(1920, 1080, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-        resized = true;
+    // Backdrops that are a few pixels off from full HD or HD are scaled to the exact resolution.
+    if (size != QSize(1920, 1080) && size.width() > 1915 && size.width() < 1925 && size.height() > 1075
+        && size.height() < 1085) {
+        return {1920, 1080};
+    }
+    if (size != QSize(1280, 720) && size.width() > 1275 && size.width() < 1285 && size.height() > 715
+        && size.height() < 725) {
+        return {1280, 720};
     }
+    return {};
+}
 
-    if ((image.width() != 1280 || image.height() != 720) && image.width() > 1275 && image.width() < 1285
-        && image.height() > 715 && image.height() < 725) {
-        image = image.scaled(1280, 720, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-        resized = true;
+void resizeBackdrop(QImage& image, bool& resized)
+{
+    const QSize target = backdropResizeTarget(image.size());
+    resized = target.isValid();
+    if (resized) {
+        image = image.scaled(target, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
     }
 }
 
 void resizeBackdrop(QByteArray& image)
 {
+    // Only decode and re-encode if the image has to be resized.  Otherwise the downloaded
+    // bytes are kept as they are: Re-encoding takes time and degrades JPEG quality.
+    QSize size = ImageHeader::fromData(image).size;
+    if (size.isEmpty()) {
+        // Unsupported format: Let Qt's image plugins read the size, which most do without decoding.
+        QBuffer buffer(&image);
+        size = QImageReader(&buffer).size();
+    }
+    if (!backdropResizeTarget(size).isValid()) {
+        return;
+    }
+
     bool resized = false;
     QImage img = QImage::fromData(image);
     resizeBackdrop(img, resized);
@@ -33,7 +55,6 @@ void resizeBackdrop(QByteArray& image)
     img.save(&buffer, "jpg", 100);
 }
 
-
 QImage getImage(mediaelch::FilePath path)
 {
     QImage img;
@@ -46,6 +67,25 @@ QImage getImage(mediaelch::FilePath path)
 }
 
 
+QSize scaledSize(QSize size, QSize targetSize)
+{
+    if (size.isEmpty()) {
+        return size;
+    }
+    const int width = targetSize.width();
+    const int height = targetSize.height();
+    if (width != 0 && height != 0) {
+        return size.scaled(width, height, Qt::KeepAspectRatio);
+    }
+    if (width != 0) {
+        return {width, qMax(1, qRound(static_cast<qreal>(size.height()) * width / size.width()))};
+    }
+    if (height != 0) {
+        return {qMax(1, qRound(static_cast<qreal>(size.width()) * height / size.height())), height};
+    }
+    return size;
+}
+
 QImage scaledImage(const QImage& img, int width, int height)
 {
     if (width != 0 && height != 0) {
@@ -7,11 +7,17 @@
 
 namespace mediaelch {
 
+/// \brief The exact resolution a backdrop of the given size should be scaled to.
+/// \returns An invalid size if the backdrop does not need to be resized.
+QSize backdropResizeTarget(QSize size);
 void resizeBackdrop(QImage& image, bool& resized);
+/// \brief Resize the encoded backdrop if necessary.  The data is only decoded if it is resized.
 void resizeBackdrop(QByteArray& image);
 
 QImage getImage(mediaelch::FilePath path);
 
+/// \brief Size of an image of the given size after scaling it with scaledImage().
+QSize scaledSize(QSize size, QSize targetSize);
 QImage scaledImage(const QImage& img, int width, int height);
 QImage scaledImage(const QImage& img, QSize size);
 
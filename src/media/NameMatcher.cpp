@@ -0,0 +1,212 @@
+#include "media/NameMatcher.h"
+
+#include "utils/Meta.h"
+
+namespace {
+
+/// \brief Stores the plain text that the pattern matches in literal.
+/// \return False if the pattern uses any regular expression feature apart from
+///         escaped characters and single-character classes such as "[.]".
+bool toLiteral(const QString& pattern, QString& literal)
+{
+    static const QString specialChars = QStringLiteral("^$.|?*+()[]{}");
+
+    literal.clear();
+    literal.reserve(pattern.size());
+    const int size = qsizetype_to_int(pattern.size());
+    for (int i = 0; i < size; ++i) {
+        const QChar c = pattern.at(i);
+        if (c == '\\') {
+            // Escaped letters and numbers have a special meaning, e.g. \d, \w or \1.
+            if (i + 1 >= size || pattern.at(i + 1).isLetterOrNumber()) {
+                return false;
+            }
+            literal.append(pattern.at(++i));
+
+        } else if (c == '[') {
+            const bool isSingleCharacter =
+                i + 2 < size && pattern.at(i + 2) == ']' && pattern.at(i + 1) != '\\' && pattern.at(i + 1) != '^';
+            if (!isSingleCharacter) {
+                return false;
+            }
+            literal.append(pattern.at(i + 1));
+            i += 2;
+
+        } else if (specialChars.contains(c)) {
+            return false;
+
+        } else {
+            literal.append(c);
+        }
+    }
+    return true;
+}
+
+/// \brief Whether the pattern can be part of an alternation with other patterns.
+/// \details Back references and named groups refer to group numbers or names that
+///          change or clash when patterns are combined.  Inline options are
+///          excluded as well to be on the safe side.
+bool canBeCombined(const QString& pattern)
+{
+    static const QRegularExpression notCombinable(R"(\\[1-9gk]|\(\?(?!:|=|!|<=|<!))");
+    return !notCombinable.match(pattern).hasMatch();
+}
+
+} // namespace
+
+namespace mediaelch {
+
+NameMatcher::NameMatcher(const QVector<QRegularExpression>& patterns, const QStringList& partsCaseInsensitive)
+{
+    for (const QString& part : partsCaseInsensitive) {
+        m_caseInsensitive.parts.append(part.toCaseFolded());
+    }
+
+    QVector<QRegularExpression> regexes;
+    for (const QRegularExpression& pattern : patterns) {
+        if (!pattern.isValid()) {
+            continue;
+        }
+        if (!addLiteral(pattern)) {
+            regexes.append(pattern);
+        }
+    }
+    addRegularExpressions(regexes);
+}
+
+bool NameMatcher::isEmpty() const
+{
+    return m_caseSensitive.isEmpty() && m_caseInsensitive.isEmpty() && m_regexes.isEmpty();
+}
+
+bool NameMatcher::matches(const QString& name) const
+{
+    if (m_caseSensitive.matches(name)) {
+        return true;
+    }
+    if (!m_caseInsensitive.isEmpty() && m_caseInsensitive.matches(name.toCaseFolded())) {
+        return true;
+    }
+    for (const QRegularExpression& regex : m_regexes) {
+        if (regex.match(name).hasMatch()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NameMatcher::addLiteral(const QRegularExpression& regex)
+{
+    const QRegularExpression::PatternOptions options = regex.patternOptions();
+    const QRegularExpression::PatternOptions allowedOptions =
+        QRegularExpression::CaseInsensitiveOption | QRegularExpression::DontCaptureOption;
+    if ((options | allowedOptions) != allowedOptions) {
+        return false;
+    }
+
+    QString pattern = regex.pattern();
+    const bool atStart = pattern.startsWith('^');
+    if (atStart) {
+        pattern.remove(0, 1);
+    }
+    bool atEnd = false;
+    if (pattern.endsWith('$')) {
+        // "\$" is an escaped dollar sign, "\\$" an escaped backslash followed by an anchor.
+        int backslashes = 0;
+        for (int i = qsizetype_to_int(pattern.size()) - 2; i >= 0 && pattern.at(i) == '\\'; --i) {
+            ++backslashes;
+        }
+        if (backslashes % 2 == 0) {
+            atEnd = true;
+            pattern.chop(1);
+        }
+    }
+
+    QString literal;
+    if (!toLiteral(pattern, literal)) {
+        return false;
+    }
+
+    const bool caseInsensitive = options.testFlag(QRegularExpression::CaseInsensitiveOption);
+    Literals& literals = caseInsensitive ? m_caseInsensitive : m_caseSensitive;
+    if (caseInsensitive) {
+        literal = literal.toCaseFolded();
+    }
+
+    if (atStart && atEnd) {
+        literals.exact.insert(literal);
+    } else if (atStart) {
+        literals.prefixes.append(literal);
+    } else if (atEnd) {
+        literals.suffixes.append(literal);
+    } else {
+        literals.parts.append(literal);
+    }
+    return true;
+}
+
+void NameMatcher::addRegularExpressions(const QVector<QRegularExpression>& patterns)
+{
+    // Only patterns with the same options can be combined.
+    QVector<QRegularExpression::PatternOptions> groupOptions;
+    QVector<QStringList> groups;
+    for (const QRegularExpression& pattern : patterns) {
+        if (!canBeCombined(pattern.pattern())) {
+            m_regexes.append(pattern);
+            continue;
+        }
+        const int index = qsizetype_to_int(groupOptions.indexOf(pattern.patternOptions()));
+        if (index == -1) {
+            groupOptions.append(pattern.patternOptions());
+            groups.append(QStringList{pattern.pattern()});
+        } else {
+            groups[index].append(pattern.pattern());
+        }
+    }
+
+    for (int i = 0; i < groups.size(); ++i) {
+        QStringList alternatives;
+        for (const QString& pattern : asConst(groups[i])) {
+            alternatives.append(QStringLiteral("(?:%1)").arg(pattern));
+        }
+        QRegularExpression combined(alternatives.join('|'), groupOptions[i]);
+        if (combined.isValid()) {
+            combined.optimize();
+            m_regexes.append(combined);
+        } else {
+            for (const QString& pattern : asConst(groups[i])) {
+                m_regexes.append(QRegularExpression(pattern, groupOptions[i]));
+            }
+        }
+    }
+}
+
+bool NameMatcher::Literals::isEmpty() const
+{
+    return exact.isEmpty() && prefixes.isEmpty() && suffixes.isEmpty() && parts.isEmpty();
+}
+
+bool NameMatcher::Literals::matches(const QString& name) const
+{
+    if (exact.contains(name)) {
+        return true;
+    }
+    for (const QString& prefix : prefixes) {
+        if (name.startsWith(prefix)) {
+            return true;
+        }
+    }
+    for (const QString& suffix : suffixes) {
+        if (name.endsWith(suffix)) {
+            return true;
+        }
+    }
+    for (const QString& part : parts) {
+        if (name.contains(part)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace mediaelch
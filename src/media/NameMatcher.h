@@ -0,0 +1,62 @@
+#pragma once
+
+#include <QRegularExpression>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+namespace mediaelch {
+
+/// \brief Matches file and folder names against many patterns at once.
+///
+/// Scanners check each file and folder name against all exclude patterns of
+/// the advanced settings. Running each regular expression one after another
+/// is expensive for large libraries. Most patterns are plain text anyway,
+/// e.g. "^[.]git$" or "-trailer".
+///
+/// The matcher sorts patterns into tables of exact names, prefixes, suffixes
+/// and name parts. Patterns that really are regular expressions are combined
+/// into a single alternation. A name is matched in a single pass over these
+/// tables and at most one regular expression per set of pattern options.
+///
+/// \code{cpp}
+///   NameMatcher matcher({QRegularExpression("^[.]git$")}, {"-trailer"});
+///   matcher.matches(".git");            // true
+///   matcher.matches("Movie-TRAILER.mkv"); // true
+/// \endcode
+class NameMatcher
+{
+public:
+    NameMatcher() = default;
+    /// \param patterns Regular expressions of which one has to match (anywhere in the name).
+    /// \param partsCaseInsensitive Plain text that has to be contained in the name, compared case-insensitively.
+    explicit NameMatcher(const QVector<QRegularExpression>& patterns, const QStringList& partsCaseInsensitive = {});
+
+    bool isEmpty() const;
+    bool matches(const QString& name) const;
+
+private:
+    struct Literals
+    {
+        QSet<QString> exact;
+        QStringList prefixes;
+        QStringList suffixes;
+        QStringList parts;
+
+        bool isEmpty() const;
+        bool matches(const QString& name) const;
+    };
+
+    /// \brief Add the pattern to the literal tables if it only matches plain text.
+    bool addLiteral(const QRegularExpression& pattern);
+    void addRegularExpressions(const QVector<QRegularExpression>& patterns);
+
+private:
+    Literals m_caseSensitive;
+    /// Literals are stored case-folded, see QString::toCaseFolded().
+    Literals m_caseInsensitive;
+    QVector<QRegularExpression> m_regexes;
+};
+
+} // namespace mediaelch
@@ -0,0 +1,107 @@
+#include "media/ThumbnailCaptureJob.h"
+
+#include "log/Log.h"
+#include "media/ImageCapture.h"
+#include "media/MediaInfoFile.h"
+
+#include <QBuffer>
+#include <QThread>
+#include <QTimer>
+#include <QtConcurrent>
+
+namespace mediaelch {
+
+int ThumbnailCaptureJob::maxConcurrentCaptures()
+{
+    return qBound(1, QThread::idealThreadCount() / 2, 4);
+}
+
+ThumbnailCaptureJob::ThumbnailCaptureJob(QVector<Video> videos,
+    ThumbnailDimensions dimensions,
+    bool cropFromCenter,
+    QObject* parent) :
+    QObject(parent), m_videos{std::move(videos)}, m_dimensions{dimensions}, m_cropFromCenter{cropFromCenter}
+{
+    m_pool.setMaxThreadCount(maxConcurrentCaptures());
+    connect(this, &ThumbnailCaptureJob::videoDone, this, &ThumbnailCaptureJob::onVideoDone, Qt::QueuedConnection);
+}
+
+ThumbnailCaptureJob::~ThumbnailCaptureJob()
+{
+    m_canceled = true;
+    m_pool.waitForDone();
+}
+
+void ThumbnailCaptureJob::start()
+{
+    qCInfo(c_media) << "[ThumbnailCaptureJob] Capturing" << m_videos.size() << "videos using"
+                    << m_pool.maxThreadCount() << "ffmpeg processes";
+    if (m_videos.isEmpty()) {
+        QTimer::singleShot(0, this, [this]() { emit finished(false); });
+        return;
+    }
+    emit progress(0, total());
+    for (int i = 0; i < m_videos.size(); ++i) {
+        QtConcurrent::run(&m_pool, [this, i]() { captureVideo(i); });
+    }
+}
+
+void ThumbnailCaptureJob::cancel()
+{
+    m_canceled = true;
+}
+
+void ThumbnailCaptureJob::captureVideo(int index)
+{
+    if (m_canceled) {
+        emit videoDone(index, {}, {});
+        return;
+    }
+
+    const Video& video = m_videos.at(index);
+    unsigned duration = video.durationInSeconds;
+    if (duration == 0) {
+        MediaInfoFile mediaInfo(video.file.toString());
+        if (mediaInfo.isReady()) {
+            duration = static_cast<unsigned>(mediaInfo.duration(0).count() / 1000);
+        }
+    }
+    if (duration == 0) {
+        emit videoDone(index, {}, ImageCapture::tr("Could not detect runtime of file"));
+        return;
+    }
+
+    QImage img;
+    QString errorString;
+    if (!ImageCapture::captureFrame(video.file, ImageCapture::randomTime(duration), img, errorString, &m_canceled)) {
+        emit videoDone(index, {}, m_canceled ? QString() : errorString);
+        return;
+    }
+    img = ImageCapture::scaledToDimensions(img, m_dimensions, m_cropFromCenter);
+
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    img.save(&buffer, "JPG", 85);
+    emit videoDone(index, data, {});
+}
+
+void ThumbnailCaptureJob::onVideoDone(int index, QByteArray image, QString errorString)
+{
+    ++m_processed;
+    if (!image.isEmpty()) {
+        emit thumbnailCaptured(index, image);
+    } else if (!errorString.isEmpty()) {
+        ++m_failed;
+        qCWarning(c_media) << "[ThumbnailCaptureJob] Could not capture" << m_videos.at(index).file.toNativePathString()
+                           << "|" << errorString;
+        emit captureFailed(index, errorString);
+    }
+    emit progress(m_processed, total());
+
+    if (m_processed == total()) {
+        emit finished(m_canceled);
+    }
+}
+
+} // namespace mediaelch
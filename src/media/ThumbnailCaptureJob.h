@@ -0,0 +1,84 @@
+#pragma once
+
+#include "data/ThumbnailDimensions.h"
+#include "media/Path.h"
+#include "utils/Meta.h"
+
+#include <QByteArray>
+#include <QObject>
+#include <QString>
+#include <QThreadPool>
+#include <QVector>
+#include <atomic>
+
+namespace mediaelch {
+
+/// \brief Captures screenshots of many video files in the background, e.g. episode thumbnails.
+///
+/// Each video is captured by its own ffmpeg process, see ImageCapture::captureFrame().
+/// Only a few processes run at the same time, because ffmpeg uses multiple threads
+/// and mostly waits for the disk anyway.  Captured images are scaled to the given
+/// dimensions and encoded as JPEG in the worker threads.
+///
+/// The job must only be used from the thread that it lives in, usually the GUI thread.
+/// All signals are emitted in that thread as well.
+class ThumbnailCaptureJob : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Video
+    {
+        FilePath file;
+        /// Duration of the video.  If 0, the duration is read using MediaInfo.
+        unsigned durationInSeconds = 0;
+    };
+
+    /// Number of ffmpeg processes that run at the same time.
+    static int maxConcurrentCaptures();
+
+public:
+    ThumbnailCaptureJob(QVector<Video> videos,
+        ThumbnailDimensions dimensions,
+        bool cropFromCenter,
+        QObject* parent = nullptr);
+    /// \brief Cancels the job and waits for running ffmpeg processes to be stopped.
+    ~ThumbnailCaptureJob() override;
+
+    void start();
+    /// \brief Stop all running captures and skip all remaining videos.
+    /// \details finished() is emitted once all running captures are stopped.
+    void cancel();
+
+    bool isCanceled() const { return m_canceled.load(); }
+    int total() const { return qsizetype_to_int(m_videos.size()); }
+    /// \brief Number of videos that could not be captured.  Canceled captures are not counted.
+    int failedCount() const { return m_failed; }
+
+signals:
+    /// \brief The video at the given index of the job's list was captured.
+    /// \param image JPEG encoded image
+    void thumbnailCaptured(int index, QByteArray image);
+    void captureFailed(int index, QString errorString);
+    void progress(int processed, int total);
+    void finished(bool canceled);
+
+    /// \brief Emitted from worker threads.  Internal signal; use the ones above.
+    void videoDone(int index, QByteArray image, QString errorString);
+
+private:
+    void captureVideo(int index);
+    void onVideoDone(int index, QByteArray image, QString errorString);
+
+private:
+    QVector<Video> m_videos;
+    ThumbnailDimensions m_dimensions;
+    bool m_cropFromCenter = false;
+
+    QThreadPool m_pool;
+    std::atomic_bool m_canceled{false};
+    int m_processed = 0;
+    int m_failed = 0;
+};
+
+} // namespace mediaelch
@@ -20,6 +20,7 @@
 #include "media_center/kodi/MovieXmlWriter.h"
 #include "media_center/kodi/TvShowXmlReader.h"
 #include "media_center/kodi/TvShowXmlWriter.h"
+#include "media_center/SaveQueue.h"
 #include "settings/Settings.h"
 
 #include <QApplication>
@@ -28,9 +29,46 @@
 #include <QFileInfo>
 #include <QXmlStreamReader>
 #include <QXmlStreamWriter>
+#include <algorithm>
 #include <array>
 #include <memory>
 
+namespace {
+
+// Keys that identify items in the save queue.  Callers ensure that items have files or a path.
+QString saveQueueKey(const Movie* movie)
+{
+    return "movie:" + movie->files().first().toString();
+}
+
+QString saveQueueKey(const Concert* concert)
+{
+    return "concert:" + concert->files().first().toString();
+}
+
+QString saveQueueKey(const TvShow* show)
+{
+    return "tvshow:" + show->dir().toString();
+}
+
+QString saveQueueKey(const TvShowEpisode* episode)
+{
+    // All episodes of a multi-episode file share the same NFO file.
+    return "episode:" + episode->files().first().toString();
+}
+
+QString saveQueueKey(const Artist* artist)
+{
+    return "artist:" + artist->path().toString();
+}
+
+QString saveQueueKey(const Album* album)
+{
+    return "album:" + album->path().toString();
+}
+
+} // namespace
+
 KodiXml::KodiXml(QObject* parent)
 {
     setParent(parent);
@@ -60,11 +98,11 @@ QByteArray KodiXml::getMovieXml(Movie* movie)
 /// \see KodiXml::writeMovieXml
 bool KodiXml::saveMovie(Movie* movie)
 {
-    qCDebug(generic) << "Save movie as Kodi NFO file; movie: " << movie->name();
+    qCDebug(c_kodi) << "Save movie as Kodi NFO file; movie: " << movie->name();
     QByteArray xmlContent = getMovieXml(movie);
 
     if (movie->files().isEmpty()) {
-        qCWarning(generic) << "Movie has no files";
+        qCWarning(c_kodi) << "Movie has no files";
         return false;
     }
 
@@ -76,22 +114,15 @@ bool KodiXml::saveMovie(Movie* movie)
     for (DataFile& dataFile : dataFiles) {
         QString saveFileName = dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, movie->files().count() > 1);
         QString saveFilePath = fi.absolutePath() + "/" + saveFileName;
-        QDir saveFileDir = QFileInfo(saveFilePath).dir();
-        if (!saveFileDir.exists()) {
-            saveFileDir.mkpath(".");
-        }
-        QFile file(saveFilePath);
-        qCDebug(generic) << "Saving to" << file.fileName();
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            qCWarning(generic) << "File could not be opened for writing";
+        qCDebug(c_kodi) << "Saving to" << saveFilePath;
+        if (writeFile(saveFilePath, xmlContent, true)) {
+            saved = true;
         } else {
-            const auto bytesWritten = file.write(xmlContent);
-            file.close();
-            // if an error occurred, -1 is returned
-            saved = bytesWritten != -1;
+            qCWarning(c_kodi) << "File could not be written";
         }
     }
     if (!saved) {
+        m_operations.clear();
         return false;
     }
 
@@ -109,7 +140,7 @@ bool KodiXml::saveMovie(Movie* movie)
                     && (movie->discType() == DiscType::BluRay || movie->discType() == DiscType::Dvd)) {
                     saveFileName = "fanart.jpg";
                 }
-                saveFile(getPath(movie).filePath(saveFileName), movie->images().image(imageType));
+                writeFile(getPath(movie).filePath(saveFileName), movie->images().image(imageType));
             }
         }
 
@@ -125,38 +156,35 @@ bool KodiXml::saveMovie(Movie* movie)
                     && (movie->discType() == DiscType::BluRay || movie->discType() == DiscType::Dvd)) {
                     saveFileName = "fanart.jpg";
                 }
-                QFile(getPath(movie).filePath(saveFileName)).remove();
+                removeFile(getPath(movie).filePath(saveFileName));
             }
         }
     }
 
     if (movie->inSeparateFolder() && !movie->files().isEmpty()) {
         for (const QString& file : movie->images().extraFanartsToRemove()) {
-            QFile::remove(file);
+            removeFile(file);
         }
         QDir dir(movie->files().first().dir().toString() + "/extrafanart");
-        if (!dir.exists() && !movie->images().extraFanartToAdd().isEmpty()) {
-            QDir(movie->files().first().dir().toString()).mkdir("extrafanart");
-        }
         for (const QByteArray& img : movie->images().extraFanartToAdd()) {
             int num = 1;
-            while (QFileInfo::exists(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num))) {
+            while (fileExists(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num))) {
                 ++num;
             }
-            saveFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
+            writeFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
         }
     }
 
     for (const Actor* actor : movie->actors()) {
         if (!actor->image.isNull()) {
-            QDir dir;
-            dir.mkdir(fi.absolutePath() + "/" + ".actors");
             QString actorName = actor->name;
             actorName = actorName.replace(" ", "_");
-            saveFile(fi.absolutePath() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image);
+            writeFile(fi.absolutePath() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image);
         }
     }
 
+    queueSave(saveQueueKey(movie));
+
     for (Subtitle* subtitle : movie->subtitles()) {
         if (subtitle->changed()) {
             QString subFileName = fi.completeBaseName();
@@ -175,7 +203,7 @@ bool KodiXml::saveMovie(Movie* movie)
                 if (f.rename(fi.absolutePath() + "/" + newFileName)) {
                     newFiles << newFileName;
                 } else {
-                    qCWarning(generic) << "Could not rename" << subFi.absoluteFilePath() << "to"
+                    qCWarning(c_kodi) << "Could not rename" << subFi.absoluteFilePath() << "to"
                                        << fi.absolutePath() + "/" + newFileName;
                     newFiles << subFi.fileName();
                 }
@@ -199,19 +227,18 @@ QString KodiXml::nfoFilePath(Movie* movie)
 {
     QString nfoFile;
     if (movie->files().isEmpty()) {
-        qCWarning(generic) << "Movie has no files";
+        qCWarning(c_kodi) << "Movie has no files";
         return nfoFile;
     }
     QFileInfo fi(movie->files().first().toString());
-    if (!fi.isFile()) {
-        qCWarning(generic) << "First file of the movie is not readable" << movie->files().at(0);
+    if (!m_directoryListings.isFile(fi.absolutePath(), fi.fileName())) {
+        qCWarning(c_kodi) << "First file of the movie is not readable" << movie->files().at(0);
         return nfoFile;
     }
 
     for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::MovieNfo)) {
         QString file = dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, movie->files().count() > 1);
-        QFileInfo nfoFi(fi.absolutePath() + "/" + file);
-        if (nfoFi.exists()) {
+        if (m_directoryListings.isFile(fi.absolutePath(), file)) {
             nfoFile = fi.absolutePath() + "/" + file;
             break;
         }
@@ -224,12 +251,12 @@ QString KodiXml::nfoFilePath(TvShowEpisode* episode)
 {
     QString nfoFile;
     if (episode->files().isEmpty()) {
-        qCWarning(generic) << "[KodiXml] Episode has no files";
+        qCWarning(c_kodi) << "[KodiXml] Episode has no files";
         return nfoFile;
     }
     QFileInfo fi(episode->files().first().toString());
     if (!fi.isFile()) {
-        qCWarning(generic) << "[KodiXml] First file of the episode is not readable" << episode->files().first();
+        qCWarning(c_kodi) << "[KodiXml] First file of the episode is not readable" << episode->files().first();
         return nfoFile;
     }
 
@@ -249,7 +276,7 @@ QString KodiXml::nfoFilePath(TvShow* show)
 {
     QString nfoFile;
     if (!show->dir().isValid()) {
-        qCWarning(generic) << "[KodiXml] Show dir is empty";
+        qCWarning(c_kodi) << "[KodiXml] Show dir is empty";
         return nfoFile;
     }
 
@@ -273,12 +300,12 @@ QString KodiXml::nfoFilePath(Concert* concert)
 {
     QString nfoFile;
     if (concert->files().isEmpty()) {
-        qCWarning(generic) << "[KodiXml] Concert has no files";
+        qCWarning(c_kodi) << "[KodiXml] Concert has no files";
         return nfoFile;
     }
     QFileInfo fi(concert->files().first().toString());
     if (!fi.isFile()) {
-        qCWarning(generic) << "[KodiXml] First file of the concert is not readable" << concert->files().at(0);
+        qCWarning(c_kodi) << "[KodiXml] First file of the concert is not readable" << concert->files().at(0);
         return nfoFile;
     }
 
@@ -306,6 +333,9 @@ bool KodiXml::loadMovie(Movie* movie, QString initialNfoContent)
 
     QString nfoContent;
     if (initialNfoContent.isEmpty()) {
+        if (!movie->files().isEmpty()) {
+            waitForPendingSave(saveQueueKey(movie));
+        }
         QString nfoFile = nfoFilePath(movie);
         if (nfoFile.isEmpty()) {
             return false;
@@ -313,7 +343,7 @@ bool KodiXml::loadMovie(Movie* movie, QString initialNfoContent)
 
         QFile file(nfoFile);
         if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            qCWarning(generic) << "[KodiXml] File" << nfoFile << "could not be opened for reading";
+            qCWarning(c_kodi) << "[KodiXml] File" << nfoFile << "could not be opened for reading";
             return false;
         }
         nfoContent = QString::fromUtf8(file.readAll());
@@ -557,7 +587,7 @@ bool KodiXml::saveConcert(Concert* concert)
     QByteArray xmlContent = getConcertXml(concert);
 
     if (concert->files().isEmpty()) {
-        qCWarning(generic) << "[KodiXml] Concert has no files";
+        qCWarning(c_kodi) << "[KodiXml] Concert has no files";
         return false;
     }
 
@@ -570,21 +600,15 @@ bool KodiXml::saveConcert(Concert* concert)
         QString saveFileName =
             dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, concert->files().size() > 1);
         QString saveFilePath = mediaelch::DirectoryPath(fi.absolutePath()).filePath(saveFileName);
-        QDir saveFileDir = QFileInfo(saveFilePath).dir();
-        if (!saveFileDir.exists()) {
-            saveFileDir.mkpath(".");
-        }
-        QFile file(saveFilePath);
-        qCDebug(generic) << "[KodiXml] Saving to" << file.fileName();
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            qCWarning(generic) << "[KodiXml] File could not be openend";
-        } else {
-            file.write(xmlContent);
-            file.close();
+        qCDebug(c_kodi) << "[KodiXml] Saving to" << saveFilePath;
+        if (writeFile(saveFilePath, xmlContent, true)) {
             saved = true;
+        } else {
+            qCWarning(c_kodi) << "[KodiXml] File could not be written";
         }
     }
     if (!saved) {
+        m_operations.clear();
         return false;
     }
 
@@ -602,7 +626,7 @@ bool KodiXml::saveConcert(Concert* concert)
                     && (concert->discType() == DiscType::BluRay || concert->discType() == DiscType::Dvd)) {
                     saveFileName = "fanart.jpg";
                 }
-                saveFile(getPath(concert).filePath(saveFileName), concert->image(imageType));
+                writeFile(getPath(concert).filePath(saveFileName), concert->image(imageType));
             }
         }
         if (concert->imagesToRemove().contains(imageType)) {
@@ -617,28 +641,27 @@ bool KodiXml::saveConcert(Concert* concert)
                     && (concert->discType() == DiscType::BluRay || concert->discType() == DiscType::Dvd)) {
                     saveFileName = "fanart.jpg";
                 }
-                QFile(getPath(concert).filePath(saveFileName)).remove();
+                removeFile(getPath(concert).filePath(saveFileName));
             }
         }
     }
 
     if (concert->inSeparateFolder() && !concert->files().isEmpty()) {
         for (const QString& file : concert->extraFanartsToRemove()) {
-            QFile::remove(file);
+            removeFile(file);
         }
         QDir dir(QFileInfo(concert->files().first().toString()).absolutePath() + "/extrafanart");
-        if (!dir.exists() && !concert->extraFanartImagesToAdd().isEmpty()) {
-            QDir(QFileInfo(concert->files().first().toString()).absolutePath()).mkdir("extrafanart");
-        }
         for (const QByteArray& img : concert->extraFanartImagesToAdd()) {
             int num = 1;
-            while (QFileInfo::exists(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num))) {
+            while (fileExists(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num))) {
                 ++num;
             }
-            saveFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
+            writeFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
         }
     }
 
+    queueSave(saveQueueKey(concert));
+
     return true;
 }
 
@@ -654,6 +677,9 @@ bool KodiXml::loadConcert(Concert* concert, QString initialNfoContent)
 
     QString nfoContent;
     if (initialNfoContent.isEmpty()) {
+        if (!concert->files().isEmpty()) {
+            waitForPendingSave(saveQueueKey(concert));
+        }
         QString nfoFile = nfoFilePath(concert);
         if (nfoFile.isEmpty()) {
             return false;
@@ -661,7 +687,7 @@ bool KodiXml::loadConcert(Concert* concert, QString initialNfoContent)
 
         QFile file(nfoFile);
         if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            qCWarning(generic) << "[KodiXml] File" << nfoFile << "could not be opened for reading";
+            qCWarning(c_kodi) << "[KodiXml] File" << nfoFile << "could not be opened for reading";
             return false;
         }
         nfoContent = QString::fromUtf8(file.readAll());
@@ -676,7 +702,7 @@ bool KodiXml::loadConcert(Concert* concert, QString initialNfoContent)
         mediaelch::kodi::ConcertXmlReader concertReader(*concert);
         concertReader.parse(reader);
         if (reader.hasError()) {
-            qCCritical(generic) << "[KodiXml] Error parsing NFO file" << reader.errorString();
+            qCCritical(c_kodi) << "[KodiXml] Error parsing NFO file" << reader.errorString();
         }
     }
 
@@ -741,6 +767,7 @@ bool KodiXml::loadTvShow(TvShow* show, QString initialNfoContent)
         if (!show->dir().isValid()) {
             return false;
         }
+        waitForPendingSave(saveQueueKey(show));
 
         QString nfoFile;
         for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::TvShowNfo)) {
@@ -757,7 +784,7 @@ bool KodiXml::loadTvShow(TvShow* show, QString initialNfoContent)
         }
         QFile file(nfoFile);
         if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            qCWarning(generic) << "[KodiXml] NFO file could not be opened for reading" << nfoFile;
+            qCWarning(c_kodi) << "[KodiXml] NFO file could not be opened for reading" << nfoFile;
             return false;
         }
         nfoContent = QString::fromUtf8(file.readAll());
@@ -782,7 +809,7 @@ bool KodiXml::loadTvShow(TvShow* show, QString initialNfoContent)
 bool KodiXml::loadTvShowEpisode(TvShowEpisode* episode, QString initialNfoContent)
 {
     if (episode == nullptr) {
-        qCWarning(generic) << "[KodiXml] Passed an empty (null) episode to loadTvShowEpisode";
+        qCWarning(c_kodi) << "[KodiXml] Passed an empty (null) episode to loadTvShowEpisode";
         return false;
     }
     episode->clear();
@@ -790,6 +817,9 @@ bool KodiXml::loadTvShowEpisode(TvShowEpisode* episode, QString initialNfoConten
 
     QString nfoContent;
     if (initialNfoContent.isEmpty()) {
+        if (!episode->files().isEmpty()) {
+            waitForPendingSave(saveQueueKey(episode));
+        }
         QString nfoFile = nfoFilePath(episode);
         if (nfoFile.isEmpty()) {
             return false;
@@ -797,7 +827,7 @@ bool KodiXml::loadTvShowEpisode(TvShowEpisode* episode, QString initialNfoConten
 
         QFile file(nfoFile);
         if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            qCWarning(generic) << "[KodiXml] File" << nfoFile << "could not be opened for reading";
+            qCWarning(c_kodi) << "[KodiXml] File" << nfoFile << "could not be opened for reading";
             return false;
         }
         nfoContent = QString::fromUtf8(file.readAll());
@@ -871,17 +901,11 @@ bool KodiXml::saveTvShow(TvShow* show)
 
     for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::TvShowNfo)) {
         QString saveFilePath = show->dir().filePath(dataFile.saveFileName(""));
-        QDir saveFileDir = QFileInfo(saveFilePath).dir();
-        if (!saveFileDir.exists()) {
-            saveFileDir.mkpath(".");
-        }
-        QFile file(saveFilePath);
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            qCWarning(generic) << "[KodiXml] NFO file could not be openend for writing" << file.fileName();
+        if (!writeFile(saveFilePath, xmlContent, true)) {
+            qCWarning(c_kodi) << "[KodiXml] NFO file could not be written" << saveFilePath;
+            m_operations.clear();
             return false;
         }
-        file.write(xmlContent);
-        file.close();
     }
 
     for (const auto imageType : TvShow::imageTypes()) {
@@ -890,14 +914,14 @@ bool KodiXml::saveTvShow(TvShow* show)
             auto dataFiles = Settings::instance()->dataFiles(dataFileType);
             for (DataFile& dataFile : dataFiles) {
                 QString saveFileName = dataFile.saveFileName("");
-                saveFile(show->dir().filePath(saveFileName), show->image(imageType));
+                writeFile(show->dir().filePath(saveFileName), show->image(imageType));
             }
         }
         if (show->imagesToRemove().contains(imageType)) {
             auto dataFiles = Settings::instance()->dataFiles(dataFileType);
             for (DataFile& dataFile : dataFiles) {
                 QString saveFileName = dataFile.saveFileName("");
-                QFile(show->dir().filePath(saveFileName)).remove();
+                removeFile(show->dir().filePath(saveFileName));
             }
         }
     }
@@ -908,14 +932,14 @@ bool KodiXml::saveTvShow(TvShow* show)
             if (show->seasonImageHasChanged(season, imageType) && !show->seasonImage(season, imageType).isNull()) {
                 for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                     QString saveFileName = dataFile.saveFileName("", season);
-                    saveFile(show->dir().filePath(saveFileName), show->seasonImage(season, imageType));
+                    writeFile(show->dir().filePath(saveFileName), show->seasonImage(season, imageType));
                 }
             }
             if (show->imagesToRemove().contains(imageType)
                 && show->imagesToRemove().value(imageType).contains(season)) {
                 for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                     QString saveFileName = dataFile.saveFileName("", season);
-                    QFile(show->dir().filePath(saveFileName)).remove();
+                    removeFile(show->dir().filePath(saveFileName));
                 }
             }
         }
@@ -923,31 +947,28 @@ bool KodiXml::saveTvShow(TvShow* show)
 
     if (show->dir().isValid()) {
         for (const QString& file : show->extraFanartsToRemove()) {
-            QFile::remove(file);
+            removeFile(file);
         }
         QDir dir(show->dir().toString() + "/extrafanart");
-        if (!dir.exists() && !show->extraFanartImagesToAdd().isEmpty()) {
-            QDir(show->dir().toString()).mkdir("extrafanart");
-        }
         for (const QByteArray& img : show->extraFanartImagesToAdd()) {
             int num = 1;
-            while (QFileInfo::exists(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num))) {
+            while (fileExists(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num))) {
                 ++num;
             }
-            saveFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
+            writeFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
         }
     }
 
     for (const Actor* actor : show->actors()) {
         if (!actor->image.isNull()) {
-            QDir dir;
-            dir.mkdir(show->dir().toString() + "/" + ".actors");
             QString actorName = actor->name;
             actorName = actorName.replace(" ", "_");
-            saveFile(show->dir().toString() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image);
+            writeFile(show->dir().toString() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image);
         }
     }
 
+    queueSave(saveQueueKey(show));
+
     return true;
 }
 
@@ -970,7 +991,7 @@ bool KodiXml::saveTvShowEpisode(TvShowEpisode* episode)
     }
 
     if (episode->files().isEmpty()) {
-        qCWarning(generic) << "[KodiXml] Episode has no files";
+        qCWarning(c_kodi) << "[KodiXml] Episode has no files";
         return false;
     }
 
@@ -987,17 +1008,11 @@ bool KodiXml::saveTvShowEpisode(TvShowEpisode* episode)
         QString saveFileName =
             dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, episode->files().count() > 1);
         QString saveFilePath = fi.absolutePath() + "/" + saveFileName;
-        QDir saveFileDir = QFileInfo(saveFilePath).dir();
-        if (!saveFileDir.exists()) {
-            saveFileDir.mkpath(".");
-        }
-        QFile file(saveFilePath);
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            qCCritical(generic) << "[KodiXml] NFO file could not be opened for writing" << saveFileName;
+        if (!writeFile(saveFilePath, xmlContent, true)) {
+            qCCritical(c_kodi) << "[KodiXml] NFO file could not be written" << saveFileName;
+            m_operations.clear();
             return false;
         }
-        file.write(xmlContent);
-        file.close();
     }
 
     fi.setFile(episode->files().first().toString());
@@ -1005,14 +1020,14 @@ bool KodiXml::saveTvShowEpisode(TvShowEpisode* episode)
         if (helper::isBluRay(episode->files().at(0)) || helper::isDvd(episode->files().first())) {
             QDir dir = fi.dir();
             dir.cdUp();
-            saveFile(dir.absolutePath() + "/thumb.jpg", episode->thumbnailImage());
+            writeFile(dir.absolutePath() + "/thumb.jpg", episode->thumbnailImage());
         } else if (helper::isDvd(episode->files().first(), true)) {
-            saveFile(fi.dir().absolutePath() + "/thumb.jpg", episode->thumbnailImage());
+            writeFile(fi.dir().absolutePath() + "/thumb.jpg", episode->thumbnailImage());
         } else {
             for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::TvShowEpisodeThumb)) {
                 QString saveFileName =
                     dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, episode->files().count() > 1);
-                saveFile(fi.absolutePath() + "/" + saveFileName, episode->thumbnailImage());
+                writeFile(fi.absolutePath() + "/" + saveFileName, episode->thumbnailImage());
             }
         }
     }
@@ -1022,14 +1037,14 @@ bool KodiXml::saveTvShowEpisode(TvShowEpisode* episode)
         if (helper::isBluRay(episode->files().first()) || helper::isDvd(episode->files().at(0))) {
             QDir dir = fi.dir();
             dir.cdUp();
-            QFile(dir.absolutePath() + "/thumb.jpg").remove();
+            removeFile(dir.absolutePath() + "/thumb.jpg");
         } else if (helper::isDvd(episode->files().first(), true)) {
-            QFile(fi.dir().absolutePath() + "/thumb.jpg").remove();
+            removeFile(fi.dir().absolutePath() + "/thumb.jpg");
         } else {
             for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::TvShowEpisodeThumb)) {
                 QString saveFileName =
                     dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, episode->files().count() > 1);
-                QFile(fi.absolutePath() + "/" + saveFileName).remove();
+                removeFile(fi.absolutePath() + "/" + saveFileName);
             }
         }
     }
@@ -1037,14 +1052,14 @@ bool KodiXml::saveTvShowEpisode(TvShowEpisode* episode)
     fi.setFile(episode->files().first().toString());
     for (const Actor* actor : episode->actors()) {
         if (!actor->image.isNull()) {
-            QDir dir;
-            dir.mkdir(fi.absolutePath() + "/" + ".actors");
             QString actorName = actor->name;
             actorName = actorName.replace(" ", "_");
-            saveFile(fi.absolutePath() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image);
+            writeFile(fi.absolutePath() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image);
         }
     }
 
+    queueSave(saveQueueKey(episode));
+
     return true;
 }
 
@@ -1076,6 +1091,10 @@ QStringList KodiXml::extraFanartNames(Movie* movie)
         return QStringList();
     }
     QFileInfo fi(movie->files().first().toString());
+    const mediaelch::DirectoryListing listing = m_directoryListings.find(fi.absolutePath());
+    if (listing.isValid() && !listing.hasDir("extrafanart")) {
+        return QStringList();
+    }
     QDir dir(fi.absolutePath() + "/extrafanart");
     QStringList filters = {"*.jpg", "*.jpeg", "*.JPEG", "*.Jpeg", "*.JPeg"};
     QStringList files;
@@ -1175,20 +1194,47 @@ void KodiXml::saveMovieSetBackdrop(QString setName, QImage backdrop)
     }
 }
 
-bool KodiXml::saveFile(QString filename, QByteArray data)
+bool KodiXml::writeFile(const QString& filePath, const QByteArray& data, bool isText)
 {
-    QDir saveFileDir = QFileInfo(filename).dir();
-    if (!saveFileDir.exists()) {
-        saveFileDir.mkpath(".");
+    auto operation = mediaelch::FileOperation::write(filePath, data, isText);
+    if (m_saveQueue != nullptr) {
+        m_operations << operation;
+        return true;
     }
-    QFile file(filename);
+    return mediaelch::SaveQueue::execute(operation);
+}
 
-    if (file.open(QIODevice::WriteOnly)) {
-        file.write(data);
-        file.close();
+bool KodiXml::removeFile(const QString& filePath)
+{
+    auto operation = mediaelch::FileOperation::remove(filePath);
+    if (m_saveQueue != nullptr) {
+        m_operations << operation;
         return true;
     }
-    return false;
+    return mediaelch::SaveQueue::execute(operation);
+}
+
+bool KodiXml::fileExists(const QString& filePath) const
+{
+    return QFileInfo::exists(filePath) || (m_saveQueue != nullptr && m_saveQueue->isWritePending(filePath))
+           || std::any_of(m_operations.cbegin(), m_operations.cend(), [&filePath](const auto& operation) {
+                  return operation.kind == mediaelch::FileOperation::Kind::Write && operation.filePath == filePath;
+              });
+}
+
+void KodiXml::queueSave(const QString& itemKey)
+{
+    if (m_saveQueue != nullptr) {
+        m_saveQueue->enqueue(itemKey, m_operations);
+    }
+    m_operations.clear();
+}
+
+void KodiXml::waitForPendingSave(const QString& itemKey)
+{
+    if (m_saveQueue != nullptr) {
+        m_saveQueue->waitForItem(itemKey);
+    }
 }
 
 mediaelch::DirectoryPath KodiXml::getPath(const Movie* movie)
@@ -1283,7 +1329,7 @@ QString KodiXml::imageFileName(const Movie* movie, ImageType type, QVector<DataF
     }
 
     if (movie->files().isEmpty()) {
-        qCWarning(generic) << "Movie has no files";
+        qCWarning(c_kodi) << "Movie has no files";
         return "";
     }
 
@@ -1303,8 +1349,7 @@ QString KodiXml::imageFileName(const Movie* movie, ImageType type, QVector<DataF
             }
         }
         mediaelch::DirectoryPath path = getPath(movie);
-        QFileInfo pFi(path.filePath(file));
-        if (pFi.isFile() || constructName) {
+        if (constructName || m_directoryListings.isFile(path.toString(), file)) {
             fileName = path.filePath(file);
             break;
         }
@@ -1326,7 +1371,7 @@ QString KodiXml::imageFileName(const Concert* concert, ImageType type, QVector<D
     }
 
     if (concert->files().isEmpty()) {
-        qCWarning(generic) << "[KodiXml] Concert has no files";
+        qCWarning(c_kodi) << "[KodiXml] Concert has no files";
         return "";
     }
 
@@ -1454,6 +1499,7 @@ bool KodiXml::loadArtist(Artist* artist, QString initialNfoContent)
 
     QString nfoContent;
     if (initialNfoContent.isEmpty()) {
+        waitForPendingSave(saveQueueKey(artist));
         QString nfoFile = nfoFilePath(artist);
         if (nfoFile.isEmpty()) {
             return false;
@@ -1464,7 +1510,7 @@ bool KodiXml::loadArtist(Artist* artist, QString initialNfoContent)
             return false;
         }
         if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            qCWarning(generic) << "[KodiXml] File" << nfoFile << "could not be opened for reading";
+            qCWarning(c_kodi) << "[KodiXml] File" << nfoFile << "could not be opened for reading";
             return false;
         }
         nfoContent = QString::fromUtf8(file.readAll());
@@ -1491,6 +1537,7 @@ bool KodiXml::loadAlbum(Album* album, QString initialNfoContent)
 
     QString nfoContent;
     if (initialNfoContent.isEmpty()) {
+        waitForPendingSave(saveQueueKey(album));
         QString nfoFile = nfoFilePath(album);
         if (nfoFile.isEmpty()) {
             return false;
@@ -1501,7 +1548,7 @@ bool KodiXml::loadAlbum(Album* album, QString initialNfoContent)
             return false;
         }
         if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            qCWarning(generic) << "[KodiXml] File" << nfoFile << "could not be opened for reading";
+            qCWarning(c_kodi) << "[KodiXml] File" << nfoFile << "could not be opened for reading";
             return false;
         }
         nfoContent = QString::fromUtf8(file.readAll());
@@ -1593,18 +1640,10 @@ bool KodiXml::saveArtist(Artist* artist)
         return false;
     }
 
-    QDir saveFileDir = QFileInfo(fileName).dir();
-    if (!saveFileDir.exists()) {
-        saveFileDir.mkpath(".");
-    }
-    {
-        QFile file(fileName);
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            qCWarning(generic) << "[KodiXml] File could not be openend";
-            return false;
-        }
-        file.write(xmlContent);
-        file.close();
+    if (!writeFile(fileName, xmlContent, true)) {
+        qCWarning(c_kodi) << "[KodiXml] File could not be written";
+        m_operations.clear();
+        return false;
     }
     for (const auto imageType : Artist::imageTypes()) {
         DataFileType dataFileType = DataFile::dataFileTypeForImageType(imageType);
@@ -1613,7 +1652,7 @@ bool KodiXml::saveArtist(Artist* artist)
             for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName(QString());
                 if (!saveFileName.isEmpty()) {
-                    QFile(artist->path().filePath(saveFileName)).remove();
+                    removeFile(artist->path().filePath(saveFileName));
                 }
             }
         }
@@ -1621,26 +1660,25 @@ bool KodiXml::saveArtist(Artist* artist)
         if (!artist->rawImage(imageType).isNull()) {
             for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName(QString());
-                saveFile(artist->path().filePath(saveFileName), artist->rawImage(imageType));
+                writeFile(artist->path().filePath(saveFileName), artist->rawImage(imageType));
             }
         }
     }
 
     for (const QString& file : artist->extraFanartsToRemove()) {
-        QFile::remove(file);
+        removeFile(file);
     }
     QDir dir(artist->path().subDir("extrafanart").toString());
-    if (!dir.exists() && !artist->extraFanartImagesToAdd().isEmpty()) {
-        QDir(artist->path().toString()).mkdir("extrafanart");
-    }
     for (const QByteArray& img : artist->extraFanartImagesToAdd()) {
         int num = 1;
-        while (QFileInfo::exists(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num))) {
+        while (fileExists(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num))) {
             ++num;
         }
-        saveFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
+        writeFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
     }
 
+    queueSave(saveQueueKey(artist));
+
     return true;
 }
 
@@ -1660,17 +1698,11 @@ bool KodiXml::saveAlbum(Album* album)
         return false;
     }
 
-    QDir saveFileDir = QFileInfo(nfoFileName).dir();
-    if (!saveFileDir.exists()) {
-        saveFileDir.mkpath(".");
-    }
-    QFile nfo(nfoFileName);
-    if (!nfo.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        qCWarning(generic) << "[KodiXml] File could not be openend";
+    if (!writeFile(nfoFileName, xmlContent, true)) {
+        qCWarning(c_kodi) << "[KodiXml] File could not be written";
+        m_operations.clear();
         return false;
     }
-    nfo.write(xmlContent);
-    nfo.close();
 
     for (const auto imageType : Album::imageTypes()) {
         DataFileType dataFileType = DataFile::dataFileTypeForImageType(imageType);
@@ -1679,7 +1711,7 @@ bool KodiXml::saveAlbum(Album* album)
             for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName(QString());
                 if (!saveFileName.isEmpty()) {
-                    QFile(album->path().filePath(saveFileName)).remove();
+                    removeFile(album->path().filePath(saveFileName));
                 }
             }
         }
@@ -1687,17 +1719,12 @@ bool KodiXml::saveAlbum(Album* album)
         if (!album->rawImage(imageType).isNull()) {
             for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName(QString());
-                saveFile(album->path().filePath(saveFileName), album->rawImage(imageType));
+                writeFile(album->path().filePath(saveFileName), album->rawImage(imageType));
             }
         }
     }
 
     if (album->bookletModel()->hasChanged()) {
-        QDir dir(album->path().subDir("booklet").toString());
-        if (!dir.exists()) {
-            QDir(album->path().toString()).mkdir("booklet");
-        }
-
         // TODO: This coding is broken!
         //   It originally went through all images, and deleted those that marked "delete".
         //   Then it went through _all remaining images_ and saved them with a new name.
@@ -1712,7 +1739,7 @@ bool KodiXml::saveAlbum(Album* album)
                 image->load(); // load to get binary
             }
             if (image->filePath().isValid()) { // TODO: `image->deletion() &&`
-                QFile::remove(image->filePath().toString());
+                removeFile(image->filePath().toString());
             }
         }
         int bookletNum = 1;
@@ -1720,16 +1747,14 @@ bool KodiXml::saveAlbum(Album* album)
             if (!image->deletion()) {
                 QString imageFileName = "booklet" + QString("%1").arg(bookletNum, 2, 10, QChar('0')) + ".jpg";
                 QString imageFilePath = album->path().subDir("booklet").filePath(imageFileName);
-                QFile file(imageFilePath);
-                if (file.open(QIODevice::WriteOnly)) {
-                    file.write(image->rawData());
-                    file.close();
-                }
+                writeFile(imageFilePath, image->rawData());
                 bookletNum++;
             }
         }
     }
 
+    queueSave(saveQueueKey(album));
+
     return true;
 }
 
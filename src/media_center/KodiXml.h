@@ -5,6 +5,7 @@
 #include "data/music/Artist.h"
 #include "media_center/KodiVersion.h"
 #include "media_center/MediaCenterInterface.h"
+#include "media_center/SaveQueue.h"
 
 #include <QByteArray>
 #include <QDomDocument>
@@ -114,11 +115,22 @@ private:
     QByteArray getAlbumXml(Album* album);
     bool loadStreamDetails(StreamDetails* streamDetails, QDomDocument domDoc);
     bool loadStreamDetails(StreamDetails* streamDetails, QDomElement elem);
-    bool saveFile(QString filename, QByteArray data);
+    /// Write the file or, if a save queue is set, collect the operation for queueSave().
+    bool writeFile(const QString& filePath, const QByteArray& data, bool isText = false);
+    /// Remove the file or, if a save queue is set, collect the operation for queueSave().
+    bool removeFile(const QString& filePath);
+    /// True if the file exists or if it will be written by a collected or queued operation.
+    bool fileExists(const QString& filePath) const;
+    /// Queue all collected file operations of the item.
+    void queueSave(const QString& itemKey);
+    /// Wait until queued files of the item are written, so that we don't read outdated files.
+    void waitForPendingSave(const QString& itemKey);
     mediaelch::DirectoryPath getPath(const Movie* movie);
     mediaelch::DirectoryPath getPath(const Concert* concert);
     QString movieSetFileName(QString setName, DataFile* dataFile);
 
 private:
     mediaelch::KodiVersion m_version;
+    /// File operations of the item that is currently saved.
+    QVector<mediaelch::FileOperation> m_operations;
 };
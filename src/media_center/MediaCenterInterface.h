@@ -3,6 +3,7 @@
 #include "data/Actor.h"
 #include "data/tv_show/SeasonNumber.h"
 #include "globals/Globals.h"
+#include "media/DirectoryListing.h"
 #include "settings/DataFile.h"
 
 #include <QImage>
@@ -17,6 +18,10 @@ class Movie;
 class TvShow;
 class TvShowEpisode;
 
+namespace mediaelch {
+class SaveQueue;
+}
+
 /// \brief The MediaCenterInterface class
 /// This class is the base for every MediaCenter.
 class MediaCenterInterface : public QObject
@@ -77,4 +82,17 @@ public:
     // clang-format on
 
     virtual void loadBooklets(Album* album) = 0;
+
+    /// \brief Listings of directories that are currently scanned.
+    /// \details Used to look up NFO and artwork files without a stat() call per file name.
+    mediaelch::DirectoryListingCache& directoryListings() { return m_directoryListings; }
+
+    /// \brief Queue that writes NFO and artwork files in the background.
+    /// \details If no queue is set, files are written synchronously when saving an item.
+    void setSaveQueue(mediaelch::SaveQueue* saveQueue) { m_saveQueue = saveQueue; }
+    mediaelch::SaveQueue* saveQueue() const { return m_saveQueue; }
+
+protected:
+    mediaelch::DirectoryListingCache m_directoryListings;
+    mediaelch::SaveQueue* m_saveQueue = nullptr;
 };
@@ -0,0 +1,236 @@
+#include "media_center/SaveQueue.h"
+
+#include "log/Log.h"
+#include "utils/Meta.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QTimer>
+#include <QtConcurrent>
+#include <algorithm>
+
+namespace mediaelch {
+
+FileOperation FileOperation::write(QString filePath, QByteArray data, bool isText)
+{
+    FileOperation operation;
+    operation.kind = Kind::Write;
+    operation.filePath = std::move(filePath);
+    operation.data = std::move(data);
+    operation.isText = isText;
+    return operation;
+}
+
+FileOperation FileOperation::remove(QString filePath)
+{
+    FileOperation operation;
+    operation.kind = Kind::Remove;
+    operation.filePath = std::move(filePath);
+    return operation;
+}
+
+SaveQueue::SaveQueue(QObject* parent) : QObject(parent)
+{
+    // Writing files is I/O bound.  More threads would only lead to seek thrashing on hard disks.
+    m_pool.setMaxThreadCount(maxConcurrentItems);
+    connect(this, &SaveQueue::allSaved, this, &SaveQueue::runIdleCallbacks, Qt::QueuedConnection);
+}
+
+SaveQueue::~SaveQueue()
+{
+    m_pool.waitForDone();
+}
+
+void SaveQueue::enqueue(const QString& itemKey, const QVector<FileOperation>& operations)
+{
+    if (operations.isEmpty()) {
+        return;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    auto item = m_items.find(itemKey);
+    if (item == m_items.end()) {
+        Item newItem;
+        newItem.pending = operations;
+        m_items.insert(itemKey, newItem);
+        ++m_totalItems;
+        schedule(itemKey);
+        return;
+    }
+
+    // If the item is scheduled, the operations are merged into the not yet started save.
+    // If it is running, the item is scheduled again once the running save is done.
+    qCDebug(c_kodi) << "[SaveQueue] Merging save of" << itemKey << "into the queued one";
+    merge(item->pending, operations);
+}
+
+bool SaveQueue::isItemPending(const QString& itemKey) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_items.contains(itemKey);
+}
+
+bool SaveQueue::isWritePending(const QString& filePath) const
+{
+    QMutexLocker locker(&m_mutex);
+    for (const Item& item : m_items) {
+        for (const QVector<FileOperation>* operations : {&item.running, &item.pending}) {
+            for (const FileOperation& operation : *operations) {
+                if (operation.kind == FileOperation::Kind::Write && operation.filePath == filePath) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+void SaveQueue::waitForItem(const QString& itemKey)
+{
+    QMutexLocker locker(&m_mutex);
+    while (m_items.contains(itemKey)) {
+        m_itemFinished.wait(&m_mutex);
+    }
+}
+
+void SaveQueue::waitForDone()
+{
+    m_pool.waitForDone();
+}
+
+void SaveQueue::whenIdle(QObject* context, std::function<void()> callback)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!m_items.isEmpty()) {
+            m_idleCallbacks.append({context, std::move(callback)});
+            return;
+        }
+    }
+    QTimer::singleShot(0, context, std::move(callback));
+}
+
+bool SaveQueue::execute(const FileOperation& operation, QString* errorString)
+{
+    if (operation.kind == FileOperation::Kind::Remove) {
+        QFile file(operation.filePath);
+        if (file.exists() && !file.remove()) {
+            if (errorString != nullptr) {
+                *errorString = file.errorString();
+            }
+            return false;
+        }
+        return true;
+    }
+
+    const QDir dir = QFileInfo(operation.filePath).dir();
+    if (!dir.exists()) {
+        dir.mkpath(".");
+    }
+
+    QSaveFile file(operation.filePath);
+    // On some network shares, no temporary file can be created next to the target.
+    file.setDirectWriteFallback(true);
+
+    const QIODevice::OpenMode mode = operation.isText ? (QIODevice::WriteOnly | QIODevice::Text) //
+                                                      : QIODevice::WriteOnly;
+    const bool success = file.open(mode) && file.write(operation.data) != -1 && file.commit();
+    if (!success && errorString != nullptr) {
+        *errorString = file.errorString();
+    }
+    return success;
+}
+
+void SaveQueue::schedule(const QString& itemKey)
+{
+    QtConcurrent::run(&m_pool, [this, itemKey]() { saveItem(itemKey); });
+}
+
+void SaveQueue::saveItem(const QString& itemKey)
+{
+    QVector<FileOperation> operations;
+    {
+        QMutexLocker locker(&m_mutex);
+        Item& item = m_items[itemKey];
+        item.running = std::move(item.pending);
+        item.pending.clear();
+        operations = item.running;
+    }
+
+    for (const FileOperation& operation : asConst(operations)) {
+        QString errorString;
+        if (!execute(operation, &errorString)) {
+            qCWarning(c_kodi) << "[SaveQueue] Could not save" << operation.filePath << "|" << errorString;
+            emit saveFailed(itemKey, operation.filePath, errorString);
+        }
+    }
+
+    bool scheduledAgain = false;
+    bool idle = false;
+    int savedItems = 0;
+    int totalItems = 0;
+    {
+        QMutexLocker locker(&m_mutex);
+        auto item = m_items.find(itemKey);
+        ++m_savedItems;
+        if (item->pending.isEmpty()) {
+            m_items.erase(item);
+        } else {
+            // The item was saved again in the meantime.
+            item->running.clear();
+            ++m_totalItems;
+            schedule(itemKey);
+            scheduledAgain = true;
+        }
+        savedItems = m_savedItems;
+        totalItems = m_totalItems;
+        idle = m_items.isEmpty();
+        if (idle) {
+            m_savedItems = 0;
+            m_totalItems = 0;
+        }
+        m_itemFinished.wakeAll();
+    }
+
+    emit progress(savedItems, totalItems);
+    if (!scheduledAgain) {
+        emit itemSaved(itemKey);
+    }
+    if (idle) {
+        emit allSaved();
+    }
+}
+
+void SaveQueue::runIdleCallbacks()
+{
+    QVector<IdleCallback> callbacks;
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!m_items.isEmpty()) {
+            // New items were queued in the meantime.  allSaved() will be emitted again.
+            return;
+        }
+        callbacks.swap(m_idleCallbacks);
+    }
+    for (const IdleCallback& idle : asConst(callbacks)) {
+        if (!idle.context.isNull()) {
+            idle.callback();
+        }
+    }
+}
+
+void SaveQueue::merge(QVector<FileOperation>& operations, const QVector<FileOperation>& newOperations)
+{
+    for (const FileOperation& operation : newOperations) {
+        operations.erase(std::remove_if(operations.begin(),
+                             operations.end(),
+                             [&operation](const FileOperation& old) { return old.filePath == operation.filePath; }),
+            operations.end());
+        operations.append(operation);
+    }
+}
+
+} // namespace mediaelch
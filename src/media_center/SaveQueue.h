@@ -0,0 +1,125 @@
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QThreadPool>
+#include <QVector>
+#include <QWaitCondition>
+#include <functional>
+
+namespace mediaelch {
+
+/// \brief A single file operation of an item that is saved by SaveQueue.
+struct FileOperation
+{
+    enum class Kind : int8_t
+    {
+        Write,
+        Remove
+    };
+
+    static FileOperation write(QString filePath, QByteArray data, bool isText = false);
+    static FileOperation remove(QString filePath);
+
+    Kind kind = Kind::Write;
+    QString filePath;
+    QByteArray data;
+    /// Write in text mode, i.e. with native line endings.  Used for NFO files.
+    bool isText = false;
+};
+
+/// \brief Writes NFO and artwork files of media items on a pool of worker threads.
+///
+/// Saving used to write an item's NFO file and all of its artwork on the GUI thread,
+/// so that bulk edits of thousands of items froze MediaElch, especially on network shares.
+/// If a MediaCenterInterface has a save queue, it only collects the file operations of
+/// an item and queues them.
+///
+///  - Files of an item are written in order.  An item is never saved concurrently.
+///  - If an item is saved again before its files were written, both saves are merged
+///    and only the latest data of each file is written.
+///  - Files are written to a temporary file first, which is then renamed.  An NFO file
+///    is never left half-written.
+///  - Errors are reported using saveFailed(), the progress using progress().
+///
+/// The queue must only be used from the thread that it lives in, usually the GUI thread.
+/// Its signals are emitted from worker threads.
+class SaveQueue : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// Number of items that are saved at the same time.
+    static constexpr int maxConcurrentItems = 4;
+
+public:
+    explicit SaveQueue(QObject* parent = nullptr);
+    ~SaveQueue() override;
+
+    /// \brief Queue the given file operations of an item.
+    /// \param itemKey Identifies the item, e.g. the path of a movie's first file.
+    ///                Operations of the same item are merged if they have not been started, yet.
+    void enqueue(const QString& itemKey, const QVector<FileOperation>& operations);
+
+    /// \brief True if the item has file operations that are not done, yet.
+    bool isItemPending(const QString& itemKey) const;
+    /// \brief True if the given file will be written by a queued operation.
+    bool isWritePending(const QString& filePath) const;
+
+    /// \brief Block until all file operations of the given item are done.
+    void waitForItem(const QString& itemKey);
+    /// \brief Block until all queued file operations are done.
+    /// \details Must be called before files of items are moved or renamed, e.g. by the renamer.
+    void waitForDone();
+    /// \brief Call the callback once all items queued so far are saved.
+    /// \details The callback is called in the queue's thread, but only if context still exists.
+    void whenIdle(QObject* context, std::function<void()> callback);
+
+    /// \brief Execute the given file operation right away.
+    /// \returns False if the operation failed.  The reason is stored in errorString.
+    static bool execute(const FileOperation& operation, QString* errorString = nullptr);
+
+signals:
+    void progress(int savedItems, int totalItems);
+    void itemSaved(QString itemKey);
+    void saveFailed(QString itemKey, QString filePath, QString errorString);
+    /// \brief Emitted once all queued items are saved.
+    void allSaved();
+
+private:
+    struct Item
+    {
+        /// Operations that are not started, yet.
+        QVector<FileOperation> pending;
+        /// Operations that are currently executed.
+        QVector<FileOperation> running;
+    };
+
+    struct IdleCallback
+    {
+        QPointer<QObject> context;
+        std::function<void()> callback;
+    };
+
+    /// Start saving the item on the pool.  m_mutex must be locked.
+    void schedule(const QString& itemKey);
+    void saveItem(const QString& itemKey);
+    void runIdleCallbacks();
+    /// Append the operations and drop older operations on the same files.
+    static void merge(QVector<FileOperation>& operations, const QVector<FileOperation>& newOperations);
+
+private:
+    mutable QMutex m_mutex;
+    QWaitCondition m_itemFinished;
+    QHash<QString, Item> m_items;
+    int m_savedItems = 0;
+    int m_totalItems = 0;
+    QVector<IdleCallback> m_idleCallbacks;
+    QThreadPool m_pool;
+};
+
+} // namespace mediaelch
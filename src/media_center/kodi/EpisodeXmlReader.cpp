@@ -59,7 +59,7 @@ bool EpisodeXmlReader::parseNfoDom(QDomElement episodeDetails)
         } else if (type == "tvmaze") {
             m_episode.setTvMazeId(TvMazeId(value));
         } else {
-            qCWarning(generic) << "[EpisodeXmlReader] Unsupported unique id type:" << type << "with value" << value;
+            qCWarning(c_kodi) << "[EpisodeXmlReader] Unsupported unique id type:" << type << "with value" << value;
         }
     }
 
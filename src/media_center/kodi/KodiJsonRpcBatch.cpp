@@ -0,0 +1,89 @@
+#include "media_center/kodi/KodiJsonRpcBatch.h"
+
+#include "log/Log.h"
+#include "utils/Meta.h"
+
+#include <QJsonDocument>
+#include <QtGlobal>
+
+namespace mediaelch {
+namespace kodi {
+
+JsonRpcBatch::JsonRpcBatch(int batchSize) : m_batchSize{qMax(1, batchSize)}
+{
+}
+
+void JsonRpcBatch::addCall(const QString& method, const QJsonObject& params)
+{
+    QJsonObject call;
+    call.insert("jsonrpc", QString("2.0"));
+    call.insert("method", method);
+    if (!params.isEmpty()) {
+        call.insert("params", params);
+    }
+    m_calls.append(call);
+}
+
+int JsonRpcBatch::callCount() const
+{
+    return qsizetype_to_int(m_calls.size());
+}
+
+bool JsonRpcBatch::isEmpty() const
+{
+    return m_calls.isEmpty();
+}
+
+QVector<JsonRpcBatch::Request> JsonRpcBatch::toRequests(int& requestId) const
+{
+    QVector<Request> requests;
+    requests.reserve((callCount() + m_batchSize - 1) / m_batchSize);
+
+    QJsonArray batch;
+    for (const QJsonValue& value : m_calls) {
+        QJsonObject call = value.toObject();
+        call.insert("id", ++requestId);
+        batch.append(call);
+        if (batch.size() == m_batchSize) {
+            requests.append({QJsonDocument(batch).toJson(QJsonDocument::Compact), m_batchSize});
+            batch = QJsonArray();
+        }
+    }
+    if (!batch.isEmpty()) {
+        requests.append({QJsonDocument(batch).toJson(QJsonDocument::Compact), qsizetype_to_int(batch.size())});
+    }
+    return requests;
+}
+
+int JsonRpcBatch::countErrors(const QByteArray& response, int callCount)
+{
+    QJsonParseError parseError{};
+    const QJsonDocument json = QJsonDocument::fromJson(response, &parseError);
+    if (parseError.error != QJsonParseError::NoError) {
+        qCWarning(c_kodi) << "[Kodi] Invalid JSON-RPC response:" << parseError.errorString();
+        return callCount;
+    }
+
+    if (json.isObject()) {
+        // Kodi answers with a single error object if the whole batch is invalid.
+        qCWarning(c_kodi) << "[Kodi] JSON-RPC batch failed:" << json.object().value("error").toObject();
+        return callCount;
+    }
+
+    int errors = 0;
+    const QJsonArray responses = json.array();
+    for (const QJsonValue& value : responses) {
+        const QJsonObject obj = value.toObject();
+        if (obj.contains("error")) {
+            qCWarning(c_kodi) << "[Kodi] JSON-RPC call" << obj.value("id").toInt()
+                               << "failed:" << obj.value("error").toObject().value("message").toString();
+            ++errors;
+        }
+    }
+    // Calls without a response were not executed.
+    errors += qMax(0, callCount - qsizetype_to_int(responses.size()));
+    return errors;
+}
+
+} // namespace kodi
+} // namespace mediaelch
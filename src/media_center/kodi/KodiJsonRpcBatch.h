@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QByteArray>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QString>
+#include <QVector>
+
+namespace mediaelch {
+namespace kodi {
+
+/// \brief Collects Kodi JSON-RPC calls and splits them into batch requests.
+/// \details
+///   JSON-RPC 2.0 allows sending an array of calls in a single HTTP request, to which
+///   Kodi answers with an array of responses. To keep requests (and Kodi's response
+///   time) small, calls are split into batches of at most batchSize calls.
+///   See: https://kodi.wiki/view/JSON-RPC_API
+class JsonRpcBatch
+{
+public:
+    /// A single HTTP request containing one or more calls.
+    struct Request
+    {
+        QByteArray body;
+        int callCount = 0;
+    };
+
+    explicit JsonRpcBatch(int batchSize);
+
+    void addCall(const QString& method, const QJsonObject& params);
+    int callCount() const;
+    bool isEmpty() const;
+
+    /// \brief Create the request bodies of all calls.
+    /// \param requestId Last used JSON-RPC id. Each call gets its own id; the last one is stored.
+    QVector<Request> toRequests(int& requestId) const;
+
+    /// \brief Number of failed calls in Kodi's response to a request with callCount calls.
+    /// \details Errors are logged. If the response can't be parsed, all calls are counted as failed.
+    static int countErrors(const QByteArray& response, int callCount);
+
+private:
+    int m_batchSize = 1;
+    QJsonArray m_calls;
+};
+
+} // namespace kodi
+} // namespace mediaelch
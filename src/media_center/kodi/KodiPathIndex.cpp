@@ -0,0 +1,102 @@
+#include "media_center/kodi/KodiPathIndex.h"
+
+#include <algorithm>
+
+namespace mediaelch {
+
+void KodiPathIndex::insert(int kodiId, const QString& kodiFile)
+{
+    const QStringList files = stackFiles(kodiFile);
+    QString key;
+    for (int level = 0; level <= maxLevel; ++level) {
+        if (!makeKey(files, level, key)) {
+            // Higher levels require even more path components.
+            break;
+        }
+        m_levels[level][key].append(kodiId);
+    }
+}
+
+void KodiPathIndex::clear()
+{
+    for (auto& level : m_levels) {
+        level.clear();
+    }
+}
+
+bool KodiPathIndex::isEmpty() const
+{
+    return m_levels[0].isEmpty();
+}
+
+int KodiPathIndex::findId(const QStringList& files) const
+{
+    if (files.isEmpty()) {
+        return -1;
+    }
+
+    QVector<int> matches;
+    QString key;
+    for (int level = 0; level <= maxLevel; ++level) {
+        if (!makeKey(files, level, key)) {
+            // The local path is too short to tell the remaining items apart.  Don't guess.
+            break;
+        }
+        matches = m_levels[level].value(key);
+        if (matches.count() <= 1) {
+            break;
+        }
+    }
+
+    if (matches.count() == 1) {
+        return matches.at(0);
+    }
+    if (matches.isEmpty()) {
+        return 0;
+    }
+    return -1;
+}
+
+QStringList KodiPathIndex::stackFiles(const QString& kodiFile)
+{
+    if (kodiFile.startsWith("stack://")) {
+        return kodiFile.mid(8).split(" , ");
+    }
+    return {kodiFile};
+}
+
+QStringList KodiPathIndex::splitFile(const QString& file)
+{
+    // Windows file names must not contain /
+    if (file.contains("/")) {
+        return file.split("/");
+    }
+    return file.split("\\");
+}
+
+bool KodiPathIndex::makeKey(const QStringList& files, int level, QString& key)
+{
+    QStringList suffixes;
+    suffixes.reserve(files.count());
+    for (const QString& file : files) {
+        const QStringList parts = splitFile(file);
+        if (parts.count() <= level) {
+            return false;
+        }
+        // Path components never contain "/", so joining them is unambiguous.
+        suffixes << parts.mid(parts.count() - level - 1).join("/");
+    }
+
+    // The number of files is part of the key: a single file never matches a stack.
+    key = QString::number(files.count()) + '\n';
+    if (files.count() == 1) {
+        // Single files are compared case-insensitively, stacks are not.
+        key += suffixes.first().toCaseFolded();
+    } else {
+        std::sort(suffixes.begin(), suffixes.end());
+        key += suffixes.join('\n');
+    }
+    return true;
+}
+
+} // namespace mediaelch
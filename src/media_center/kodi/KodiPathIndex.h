@@ -0,0 +1,50 @@
+#pragma once
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <array>
+
+namespace mediaelch {
+
+/// \brief Index of Kodi library items by the trailing components of their file paths.
+/// \details
+///   Kodi and MediaElch may see the same file through different mount points, e.g.
+///   "smb://nas/movies/Up (2009)/Up.mkv" and "/mnt/movies/Up (2009)/Up.mkv". Items
+///   are therefore matched by their last path components: first by the file name only,
+///   and if that is ambiguous, by one additional parent directory at a time.
+///   Stacked files ("stack://a , b") only match the same set of files.
+///
+///   Each item's suffix keys are computed once on insertion, so that looking up
+///   a local item is a hash lookup instead of a comparison with every Kodi item.
+class KodiPathIndex
+{
+public:
+    /// Maximum number of parent directories that are used to resolve ambiguous file names.
+    static constexpr int maxLevel = 4;
+
+    /// \brief Add a Kodi item with the file path reported by Kodi's JSON-RPC API.
+    void insert(int kodiId, const QString& kodiFile);
+    void clear();
+    bool isEmpty() const;
+
+    /// \brief Find the Kodi item that matches the given local files.
+    /// \returns The Kodi id of the item, 0 if no item matches and -1 if the
+    ///          files are empty or several items match.
+    int findId(const QStringList& files) const;
+
+private:
+    /// Splits "stack://" paths into their individual files.
+    static QStringList stackFiles(const QString& kodiFile);
+    static QStringList splitFile(const QString& file);
+    /// Creates the lookup key of the given files for the given level.
+    /// \returns false if a file has not enough path components for that level.
+    static bool makeKey(const QStringList& files, int level, QString& key);
+
+private:
+    /// One hash per level. Maps the suffix key to all Kodi ids with that key.
+    std::array<QHash<QString, QVector<int>>, maxLevel + 1> m_levels;
+};
+
+} // namespace mediaelch
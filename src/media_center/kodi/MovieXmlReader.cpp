@@ -28,7 +28,7 @@ MovieXmlReader::MovieXmlReader(Movie& movie) : m_movie{movie}
 bool MovieXmlReader::parseNfoDom(QDomDocument domDoc)
 {
     if (domDoc.elementsByTagName("movie").isEmpty()) {
-        qCWarning(generic) << "[MovieXmlReader] No <movie> tag in the document";
+        qCWarning(c_kodi) << "[MovieXmlReader] No <movie> tag in the document";
         return false;
     }
     QDomElement movieElement = domDoc.elementsByTagName("movie").at(0).toElement();
@@ -57,7 +57,7 @@ bool TvShowXmlReader::parseNfoDom(QDomDocument domDoc)
         } else if (type == "tvmaze") {
             m_show.setTvMazeId(TvMazeId(value));
         } else if (type != "mediaelch_fallback") {
-            qCWarning(generic) << "[TvShowXmlReader] Unsupported unique id type:" << type << "with value" << value;
+            qCWarning(c_kodi) << "[TvShowXmlReader] Unsupported unique id type:" << type << "with value" << value;
         }
     }
     if (!domDoc.elementsByTagName("title").isEmpty()) {
@@ -197,24 +197,41 @@ void TvShowModel::appendShow(TvShow* show)
     const int size = qsizetype_to_int(m_rootItem.shows().size());
 
     beginInsertRows(QModelIndex{}, size, size);
-    {
-        TvShowModelItem* showItem = m_rootItem.appendShow(show);
+    insertShowItems(show);
+    endInsertRows();
+}
 
-        connect(showItem, &TvShowModelItem::sigChanged, this, &TvShowModel::onSigChanged);
-        connect(show, &TvShow::sigChanged, this, &TvShowModel::onShowChanged);
+void TvShowModel::appendShows(const QVector<TvShow*>& shows)
+{
+    if (shows.isEmpty()) {
+        return;
+    }
+    const int size = qsizetype_to_int(m_rootItem.shows().size());
 
-        QMap<SeasonNumber, SeasonModelItem*> seasonItems;
-        for (TvShowEpisode* episode : show->episodes()) {
-            if (!seasonItems.contains(episode->seasonNumber())) {
-                seasonItems.insert(episode->seasonNumber(),
-                    showItem->appendSeason(episode->seasonNumber(), episode->seasonString(), show));
-            }
-            seasonItems.value(episode->seasonNumber())->appendEpisode(episode);
-        }
+    beginInsertRows(QModelIndex{}, size, size + qsizetype_to_int(shows.size()) - 1);
+    for (TvShow* show : shows) {
+        insertShowItems(show);
     }
     endInsertRows();
 }
 
+void TvShowModel::insertShowItems(TvShow* show)
+{
+    TvShowModelItem* showItem = m_rootItem.appendShow(show);
+
+    connect(showItem, &TvShowModelItem::sigChanged, this, &TvShowModel::onSigChanged);
+    connect(show, &TvShow::sigChanged, this, &TvShowModel::onShowChanged);
+
+    QMap<SeasonNumber, SeasonModelItem*> seasonItems;
+    for (TvShowEpisode* episode : show->episodes()) {
+        if (!seasonItems.contains(episode->seasonNumber())) {
+            seasonItems.insert(episode->seasonNumber(),
+                showItem->appendSeason(episode->seasonNumber(), episode->seasonString(), show));
+        }
+        seasonItems.value(episode->seasonNumber())->appendEpisode(episode);
+    }
+}
+
 bool TvShowModel::removeShow(TvShow* show)
 {
     TvShowModelItem* showModel = findModelForShow(show);
@@ -53,6 +53,8 @@ public:
 
     /// Append a TV show and its seasons and episodes to the tree view.
     void appendShow(TvShow* show);
+    /// Append multiple TV shows at once. Views are only notified once.
+    void appendShows(const QVector<TvShow*>& shows);
     /// Remove a show from the TreeView
     /// \return true if the show was found and removed, false otherwise
     bool removeShow(TvShow* show);
@@ -74,6 +76,8 @@ private slots:
 
 private:
     TvShowModelItem* findModelForShow(TvShow* show);
+    /// Add the show's items to the root item. Must be surrounded by begin/endInsertRows().
+    void insertShowItems(TvShow* show);
 
 private:
     TvShowRootModelItem m_rootItem;
@@ -3,6 +3,7 @@
 #include "data/music/Album.h"
 #include "globals/Helper.h"
 #include "model/music/MusicModelRoles.h"
+#include "utils/Meta.h"
 
 MusicModel::MusicModel(QObject* parent) : QAbstractItemModel(parent), m_rootItem{new MusicModelItem(nullptr)}
 {
@@ -87,13 +88,38 @@ MusicModelItem* MusicModel::appendChild(Artist* artist)
     MusicModelItem* item = m_rootItem->appendChild(artist);
     endInsertRows();
 
+    connectArtistItem(item, artist);
+    return item;
+}
+
+QVector<MusicModelItem*> MusicModel::appendChildren(const QVector<Artist*>& artists)
+{
+    QVector<MusicModelItem*> items;
+    if (artists.isEmpty()) {
+        return items;
+    }
+    items.reserve(artists.size());
+
+    const int first = m_rootItem->childCount();
+    beginInsertRows(QModelIndex(), first, first + qsizetype_to_int(artists.size()) - 1);
+    for (Artist* artist : artists) {
+        items << m_rootItem->appendChild(artist);
+    }
+    endInsertRows();
+
+    for (elch_ssize_t i = 0; i < artists.size(); ++i) {
+        connectArtistItem(items[i], artists[i]);
+    }
+    return items;
+}
+
+void MusicModel::connectArtistItem(MusicModelItem* item, Artist* artist)
+{
     connect(item, &MusicModelItem::sigChanged, this, &MusicModel::onSigChanged, Qt::UniqueConnection);
     connect(artist, &Artist::sigChanged, this, &MusicModel::onArtistChanged, Qt::UniqueConnection);
     connect(
         artist->controller(), &ArtistController::sigSaved, this, &MusicModel::onArtistChanged, Qt::UniqueConnection);
     connect(item, &MusicModelItem::sigIntChanged, this, &MusicModel::onSigChanged, Qt::UniqueConnection);
-
-    return item;
 }
 
 QModelIndex MusicModel::parent(const QModelIndex& index) const
@@ -22,6 +22,8 @@ public:
     bool removeRows(int row, int count, const QModelIndex& parent = QModelIndex()) override;
 
     MusicModelItem* appendChild(Artist* artist);
+    /// \brief Append multiple artists at once. Views are only notified once.
+    QVector<MusicModelItem*> appendChildren(const QVector<Artist*>& artists);
     void clear();
     MusicModelItem* getItem(const QModelIndex& index) const;
     QVector<Artist*> artists();
@@ -33,5 +35,7 @@ private slots:
     void onArtistChanged(Artist* artist);
 
 private:
+    void connectArtistItem(MusicModelItem* item, Artist* artist);
+
     MusicModelItem* m_rootItem;
 };
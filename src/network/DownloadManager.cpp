@@ -30,8 +30,8 @@ bool DownloadManager::isLocalFile(const QUrl& url)
 
 void DownloadManager::logCurrentDownloads() const
 {
-    qCDebug(generic) << "[DownloadManager] Start next download | Files left:" << m_queue.size()
-                     << "| Running:" << m_currentReplies.size();
+    qCDebug(c_network) << "[DownloadManager] Start next download | Files left:" << m_queue.size()
+                       << "| Running:" << m_currentReplies.size();
 }
 
 void DownloadManager::setDownloads(QVector<DownloadManagerElement> elements)
@@ -80,7 +80,7 @@ void DownloadManager::addDownload(DownloadManagerElement elem)
     // The mutexes have been removed but the code still needs to be refactored.
     //
 
-    qCDebug(generic) << "[DownloadManager] Enqueue download at pos " << downloadQueueSize() << "|" << elem.url;
+    qCDebug(c_network) << "[DownloadManager] Enqueue download at pos " << downloadQueueSize() << "|" << elem.url;
 
     m_queue.enqueue(elem);
 
@@ -133,7 +133,7 @@ int DownloadManager::numberOfDownloadsLeft(T*& elementToCheck)
 
 void DownloadManager::abortDownloads()
 {
-    qCInfo(generic) << "[DownloadsManager] Abort Downloads";
+    qCInfo(c_network) << "[DownloadsManager] Abort Downloads";
 
     m_queue.clear();
 
@@ -154,7 +154,7 @@ void DownloadManager::startNextDownload()
 {
     if (m_queue.isEmpty()) {
         if (m_currentReplies.isEmpty()) {
-            qCInfo(generic) << "[DownloadManager] All downloads finished";
+            qCInfo(c_network) << "[DownloadManager] All downloads finished";
             emit allDownloadsFinished();
         } else {
             logCurrentDownloads();
@@ -213,7 +213,7 @@ void DownloadManager::downloadProgress(qint64 received, qint64 total)
 {
     auto* reply = dynamic_cast<QNetworkReply*>(QObject::sender());
     if (reply == nullptr) {
-        qCCritical(generic) << "[DownloadManager] dynamic_cast<QNetworkReply*> failed for downloadProgress!";
+        qCCritical(c_network) << "[DownloadManager] dynamic_cast<QNetworkReply*> failed for downloadProgress!";
         return;
     }
 
@@ -230,14 +230,14 @@ void DownloadManager::restartDownloadAfterTimeout(QNetworkReply* reply)
     ++download.retries;
     reply->deleteLater();
 
-    qCWarning(generic) << "[DownloadManager] Download timed out:" << download.url;
+    qCWarning(c_network) << "[DownloadManager] Download timed out:" << download.url;
 
     if (download.retries < 3) {
-        qCDebug(generic) << "[DownloadManager] Re-enqueuing the download, tries:" << download.retries << "/ 3";
+        qCDebug(c_network) << "[DownloadManager] Re-enqueuing the download, tries:" << download.retries << "/ 3";
         m_queue.prepend(download);
 
     } else {
-        qCDebug(generic) << "[DownloadManager] Giving up on this file, tried 3 times";
+        qCDebug(c_network) << "[DownloadManager] Giving up on this file, tried 3 times";
     }
 
     // Should always be true because we're replacing the previous request
@@ -251,13 +251,13 @@ void DownloadManager::downloadFinished()
 {
     auto* reply = dynamic_cast<QNetworkReply*>(QObject::sender());
     if (reply == nullptr) {
-        qCCritical(generic) << "[DownloadManager] dynamic_cast<QNetworkReply*> failed for downloadFinished!";
+        qCCritical(c_network) << "[DownloadManager] dynamic_cast<QNetworkReply*> failed for downloadFinished!";
         return;
     }
 
     bool wasRemoved = m_currentReplies.removeOne(reply);
     if (!wasRemoved) {
-        qCCritical(generic) << "[DownloadManager] downloadFinished() called for reply which wasn't tracked";
+        qCCritical(c_network) << "[DownloadManager] downloadFinished() called for reply which wasn't tracked";
     }
 
     QByteArray data;
@@ -266,7 +266,7 @@ void DownloadManager::downloadFinished()
             restartDownloadAfterTimeout(reply); // also deletes the reply
             return;
         }
-        qCWarning(generic) << "[DownloadManager] Network Error:" << reply->errorString() << "|" << reply->url();
+        qCWarning(c_network) << "[DownloadManager] Network Error:" << reply->errorString() << "|" << reply->url();
 
     } else {
         data = reply->readAll();
@@ -323,7 +323,7 @@ int DownloadManager::downloadQueueSize()
 int DownloadManager::downloadsLeftForShow(TvShow* show)
 {
     if (show == nullptr) {
-        qCCritical(generic) << "[DownloadManager] Cannot count downloads left for nullptr show";
+        qCCritical(c_network) << "[DownloadManager] Cannot count downloads left for nullptr show";
         return 0;
     }
     return numberOfDownloadsLeft<TvShow>(show);
@@ -74,7 +74,7 @@ void WebsiteCache::clearOldCacheEntries()
 {
     auto it = m_cache.begin();
     while (it != m_cache.end()) {
-        if (it.value().date >= QDateTime::currentDateTime().addSecs(-timeoutSeconds)) {
+        if (it.value().date < QDateTime::currentDateTime().addSecs(-timeoutSeconds)) {
             it = m_cache.erase(it);
         } else {
             ++it;
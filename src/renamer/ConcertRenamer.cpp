@@ -17,7 +17,7 @@ ConcertRenamer::RenameError ConcertRenamer::renameConcert(Concert& concert)
     QFileInfo concertInfo(concert.files().first().toString());
     QString fiCanonicalPath = concertInfo.canonicalPath();
     QDir dir(concertInfo.canonicalPath());
-    QString newFolderName = m_config.directoryPattern;
+    QString newFolderName;
     QString newFileName;
     QStringList newConcertFiles;
     QString parentDirName;
@@ -43,39 +43,26 @@ ConcertRenamer::RenameError ConcertRenamer::renameConcert(Concert& concert)
         dir.cdUp();
     }
 
+    mediaelch::RenamerValues concertValues;
+    concertValues.insert("title", concert.title());
+    concertValues.insert("artist", concert.artist());
+    concertValues.insert("album", concert.album());
+    concertValues.insert("year", concert.released().toString("yyyy"));
+    insertStreamDetails(concertValues, *concert.streamDetails());
+
     if (!isBluRay && !isDvd && m_config.renameFiles) {
         newConcertFiles.clear();
         int partNo = 0;
-        const auto videoDetails = concert.streamDetails()->videoDetails();
+        const mediaelch::RenamerTemplate& pattern = (concert.files().count() == 1) ? m_filePattern : m_filePatternMulti;
         for (const mediaelch::FilePath& file : concert.files()) {
-            newFileName = (concert.files().count() == 1) ? m_config.filePattern : m_config.filePatternMulti;
             QFileInfo fi(file.toString());
             QString baseName = fi.completeBaseName();
             QDir currentDir = fi.dir();
 
-            Renamer::replace(newFileName, "title", concert.title());
-            Renamer::replace(newFileName, "artist", concert.artist());
-            Renamer::replace(newFileName, "album", concert.album());
-            Renamer::replace(newFileName, "year", concert.released().toString("yyyy"));
-            Renamer::replace(newFileName, "extension", fi.suffix());
-            Renamer::replace(newFileName, "partNo", QString::number(++partNo));
-            Renamer::replace(newFileName, "videoCodec", concert.streamDetails()->videoCodec());
-            Renamer::replace(newFileName, "audioCodec", concert.streamDetails()->audioCodec());
-            // TODO: Let the user decide whether only the first should be used or
-            //       if a space should be the separator.
-            Renamer::replace(newFileName, "audioLanguage", concert.streamDetails()->allAudioLanguages().join("-"));
-            // TODO: Let the user decide whether only the first should be used or
-            //       if a space should be the separator.
-            Renamer::replace(
-                newFileName, "subtitleLanguage", concert.streamDetails()->allSubtitleLanguages().join("-"));
-            Renamer::replace(newFileName, "channels", QString::number(concert.streamDetails()->audioChannels()));
-            Renamer::replace(newFileName,
-                "resolution",
-                helper::matchResolution(videoDetails.value(StreamDetails::VideoDetails::Width).toInt(),
-                    videoDetails.value(StreamDetails::VideoDetails::Height).toInt(),
-                    videoDetails.value(StreamDetails::VideoDetails::ScanType)));
-            Renamer::replaceCondition(
-                newFileName, "3D", videoDetails.value(StreamDetails::VideoDetails::StereoMode) != "");
+            mediaelch::RenamerValues fileValues = concertValues;
+            fileValues.insert("extension", fi.suffix());
+            fileValues.insert("partNo", QString::number(++partNo));
+            newFileName = pattern.render(fileValues);
             helper::sanitizeFileName(newFileName);
             if (fi.fileName() != newFileName) {
                 if (!m_config.dryRun) {
@@ -154,29 +141,10 @@ ConcertRenamer::RenameError ConcertRenamer::renameConcert(Concert& concert)
 
     int renameRow = -1;
     if (m_config.renameDirectories && concert.inSeparateFolder()) {
-        const auto videoDetails = concert.streamDetails()->videoDetails();
-        Renamer::replace(newFolderName, "title", concert.title());
-        Renamer::replace(newFolderName, "artist", concert.artist());
-        Renamer::replace(newFolderName, "album", concert.album());
-        Renamer::replace(newFolderName, "year", concert.released().toString("yyyy"));
-        Renamer::replaceCondition(newFolderName, "bluray", isBluRay);
-        Renamer::replaceCondition(newFolderName, "dvd", isDvd);
-        Renamer::replaceCondition(
-            newFolderName, "3D", videoDetails.value(StreamDetails::VideoDetails::StereoMode) != "");
-        Renamer::replace(newFolderName, "videoCodec", concert.streamDetails()->videoCodec());
-        Renamer::replace(newFolderName, "audioCodec", concert.streamDetails()->audioCodec());
-        // TODO: Let the user decide whether only the first should be used or
-        //       if a space should be the separator.
-        Renamer::replace(newFolderName, "audioLanguage", concert.streamDetails()->allAudioLanguages().join("-"));
-        // TODO: Let the user decide whether only the first should be used or
-        //       if a space should be the separator.
-        Renamer::replace(newFolderName, "subtitleLanguage", concert.streamDetails()->allSubtitleLanguages().join("-"));
-        Renamer::replace(newFolderName, "channels", QString::number(concert.streamDetails()->audioChannels()));
-        Renamer::replace(newFolderName,
-            "resolution",
-            helper::matchResolution(videoDetails.value(StreamDetails::VideoDetails::Width).toInt(),
-                videoDetails.value(StreamDetails::VideoDetails::Height).toInt(),
-                videoDetails.value(StreamDetails::VideoDetails::ScanType)));
+        mediaelch::RenamerValues directoryValues = concertValues;
+        directoryValues.insertCondition("bluray", isBluRay);
+        directoryValues.insertCondition("dvd", isDvd);
+        newFolderName = m_directoryPattern.render(directoryValues);
         helper::sanitizeFolderName(newFolderName);
         if (dir.dirName() != newFolderName) {
             renameRow = m_dialog->addResultToTable(dir.dirName(), newFolderName, Renamer::RenameOperation::Rename);
@@ -15,7 +15,6 @@ EpisodeRenamer::EpisodeRenamer(RenamerConfig renamerConfig, RenamerDialog* dialo
 EpisodeRenamer::RenameError EpisodeRenamer::renameEpisode(TvShowEpisode& episode,
     QVector<TvShowEpisode*>& episodesRenamed)
 {
-    const QString& seasonPattern = m_config.directoryPattern;
     const bool useSeasonDirectories = m_config.renameDirectories;
 
     bool errorOccured = false;
@@ -53,48 +52,34 @@ EpisodeRenamer::RenameError EpisodeRenamer::renameEpisode(TvShowEpisode& episode
         episodeFiles.clear();
 
         newEpisodeFiles.clear();
+        mediaelch::RenamerValues episodeValues;
+        episodeValues.insert("title", episode.title());
+        episodeValues.insert("showTitle", episode.showTitle());
+        episodeValues.insert("year", episode.firstAired().toString("yyyy"));
+        episodeValues.insert("season", episode.seasonString());
+        insertStreamDetails(episodeValues, *episode.streamDetails());
+        if (multiEpisodes.count() > 1) {
+            QStringList episodeStrings;
+            for (TvShowEpisode* subEpisode : multiEpisodes) {
+                episodeStrings.append(subEpisode->episodeString());
+            }
+            std::sort(episodeStrings.begin(), episodeStrings.end());
+            episodeValues.insert("episode", episodeStrings.join("-"));
+        } else {
+            episodeValues.insert("episode", episode.episodeString());
+        }
+
         int partNo = 0;
-        const auto videoDetails = episode.streamDetails()->videoDetails();
+        const mediaelch::RenamerTemplate& pattern = (episode.files().count() == 1) ? m_filePattern : m_filePatternMulti;
         for (const mediaelch::FilePath& file : episode.files()) {
-            newFileName = (episode.files().count() == 1) ? m_config.filePattern : m_config.filePatternMulti;
             QFileInfo episodeFileInfo(file.toString());
             QString baseName = episodeFileInfo.completeBaseName();
             QDir currentDir = episodeFileInfo.dir();
-            Renamer::replace(newFileName, "title", episode.title());
-            Renamer::replace(newFileName, "showTitle", episode.showTitle());
-            Renamer::replace(newFileName, "year", episode.firstAired().toString("yyyy"));
-            Renamer::replace(newFileName, "extension", episodeFileInfo.suffix());
-            Renamer::replace(newFileName, "season", episode.seasonString());
-            Renamer::replace(newFileName, "partNo", QString::number(++partNo));
-            Renamer::replace(newFileName, "videoCodec", episode.streamDetails()->videoCodec());
-            Renamer::replace(newFileName, "audioCodec", episode.streamDetails()->audioCodec());
-            // TODO: Let the user decide whether only the first should be used or
-            //       if a space should be the separator.
-            Renamer::replace(newFileName, "audioLanguage", episode.streamDetails()->allAudioLanguages().join("-"));
-            // TODO: Let the user decide whether only the first should be used or
-            //       if a space should be the separator.
-            Renamer::replace(
-                newFileName, "subtitleLanguage", episode.streamDetails()->allSubtitleLanguages().join("-"));
-            Renamer::replace(newFileName, "channels", QString::number(episode.streamDetails()->audioChannels()));
-            Renamer::replace(newFileName,
-                "resolution",
-                helper::matchResolution(videoDetails.value(StreamDetails::VideoDetails::Width).toInt(),
-                    videoDetails.value(StreamDetails::VideoDetails::Height).toInt(),
-                    videoDetails.value(StreamDetails::VideoDetails::ScanType)));
-            Renamer::replaceCondition(
-                newFileName, "3D", videoDetails.value(StreamDetails::VideoDetails::StereoMode) != "");
-
-            if (multiEpisodes.count() > 1) {
-                QStringList episodeStrings;
-                for (TvShowEpisode* subEpisode : multiEpisodes) {
-                    episodeStrings.append(subEpisode->episodeString());
-                }
-                std::sort(episodeStrings.begin(), episodeStrings.end());
-                Renamer::replace(newFileName, "episode", episodeStrings.join("-"));
-            } else {
-                Renamer::replace(newFileName, "episode", episode.episodeString());
-            }
 
+            mediaelch::RenamerValues fileValues = episodeValues;
+            fileValues.insert("extension", episodeFileInfo.suffix());
+            fileValues.insert("partNo", QString::number(++partNo));
+            newFileName = pattern.render(fileValues);
             helper::sanitizeFileName(newFileName);
             if (episodeFileInfo.fileName() != newFileName) {
                 const int episodeRow = m_dialog->addResultToTable(
@@ -182,11 +167,11 @@ EpisodeRenamer::RenameError EpisodeRenamer::renameEpisode(TvShowEpisode& episode
 
     if (useSeasonDirectories) {
         QDir showDir(episode.tvShow()->dir().toString());
-        QString seasonDirName = seasonPattern;
-        Renamer::replace(seasonDirName, "season", episode.seasonString());
-        Renamer::replace(seasonDirName, "seasonName", episode.seasonName());
-        Renamer::replace(seasonDirName, "showTitle", episode.showTitle());
-        Renamer::replaceCondition(seasonDirName, "seasonName", !episode.seasonName().isEmpty());
+        mediaelch::RenamerValues seasonValues;
+        seasonValues.insert("season", episode.seasonString());
+        seasonValues.insert("seasonName", episode.seasonName());
+        seasonValues.insert("showTitle", episode.showTitle());
+        QString seasonDirName = m_directoryPattern.render(seasonValues);
         helper::sanitizeFolderName(seasonDirName);
         QDir seasonDir(showDir.path() + "/" + seasonDirName);
         if (!seasonDir.exists()) {
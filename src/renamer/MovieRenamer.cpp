@@ -4,20 +4,117 @@
 #include "globals/Helper.h"
 #include "globals/Manager.h"
 #include "media_center/MediaCenterInterface.h"
+#include "utils/Meta.h"
 
 #include <QDir>
 #include <QFileInfo>
+#include <QHash>
 
 MovieRenamer::MovieRenamer(RenamerConfig renamerConfig, RenamerDialog* dialog) : Renamer(renamerConfig, dialog)
 {
 }
 
+mediaelch::RenamerValues MovieRenamer::values(Movie& movie) const
+{
+    mediaelch::RenamerValues values;
+    values.insert("title", movie.name());
+    values.insert("originalTitle", movie.originalName().isEmpty() ? movie.name() : movie.originalName());
+    values.insert("sortTitle", movie.sortTitle());
+    values.insert("director", movie.director());
+    // TODO: Let the user decide whether only the first should be used or
+    //       if a space should be the separator.
+    values.insert("studio", movie.studios().join(","));
+    values.insert("year", movie.released().toString("yyyy"));
+    values.insert("imdbId", movie.imdbId().toString());
+    values.insert("tmdbId", movie.tmdbId().toString());
+    values.insert("movieset", movie.set().name);
+    insertStreamDetails(values, *movie.streamDetails());
+    return values;
+}
+
+MovieRenamer::Names MovieRenamer::names(Movie& movie) const
+{
+    Names names;
+
+    QDir movieDir(QFileInfo(movie.files().first().toString()).canonicalPath());
+    // Parent directory of this movie's folder
+    QDir baseDir = movieDir;
+    baseDir.cdUp();
+    names.isBluRay = helper::isBluRay(baseDir.path());
+    names.isDvd = helper::isDvd(baseDir.path());
+    if (names.isBluRay || names.isDvd) {
+        movieDir = baseDir;
+    }
+
+    const mediaelch::RenamerValues movieValues = values(movie);
+
+    // BluRay and DVD folder content must not be renamed.
+    if (!names.isBluRay && !names.isDvd && m_config.renameFiles) {
+        const auto& files = movie.files();
+        const mediaelch::RenamerTemplate& pattern = (files.count() == 1) ? m_filePattern : m_filePatternMulti;
+        int partNo = 0;
+        for (const mediaelch::FilePath& file : files) {
+            mediaelch::RenamerValues fileValues = movieValues;
+            fileValues.insert("extension", file.fileSuffix());
+            fileValues.insert("partNo", QString::number(++partNo));
+            QString newFileName = pattern.render(fileValues);
+            helper::sanitizeFileName(newFileName);
+            names.files << newFileName;
+        }
+    }
+
+    if (m_config.renameDirectories) {
+        mediaelch::RenamerValues directoryValues = movieValues;
+        directoryValues.insert("extension", movie.files().first().fileSuffix());
+        directoryValues.insertCondition("bluray", names.isBluRay);
+        directoryValues.insertCondition("dvd", names.isDvd);
+        names.directory = m_directoryPattern.render(directoryValues);
+        helper::sanitizeFolderName(names.directory);
+
+        if (movie.inSeparateFolder()) {
+            QDir parentDir = movieDir;
+            parentDir.cdUp();
+            names.targets << parentDir.path() + "/" + names.directory;
+        }
+        // Otherwise a new directory with a unique name is created for the movie.
+
+    } else {
+        for (const QString& file : asConst(names.files)) {
+            names.targets << movieDir.path() + "/" + file;
+        }
+    }
+
+    return names;
+}
+
+QSet<int> MovieRenamer::findConflicts(const QVector<Names>& names)
+{
+    QSet<int> conflicts;
+    QHash<QString, int> owners;
+    for (int i = 0; i < qsizetype_to_int(names.size()); ++i) {
+        for (const QString& target : names[i].targets) {
+            const auto owner = owners.constFind(target);
+            if (owner == owners.constEnd()) {
+                owners.insert(target, i);
+            } else if (owner.value() != i) {
+                conflicts << owner.value() << i;
+            }
+        }
+    }
+    return conflicts;
+}
+
 MovieRenamer::RenameError MovieRenamer::renameMovie(Movie& movie)
+{
+    return renameMovie(movie, names(movie));
+}
+
+MovieRenamer::RenameError MovieRenamer::renameMovie(Movie& movie, const Names& names)
 {
     QFileInfo movieInfo(movie.files().first().toString());
     QString fiCanonicalPath = movieInfo.canonicalPath();
     QDir dir(movieInfo.canonicalPath());
-    QString newFolderName = m_config.directoryPattern;
+    QString newFolderName = names.directory;
 
     MediaCenterInterface* mediaCenter = Manager::instance()->mediaCenterInterface();
     QString nfo = mediaCenter->nfoFilePath(&movie);
@@ -32,15 +129,8 @@ MovieRenamer::RenameError MovieRenamer::renameMovie(Movie& movie)
         newMovieFiles.append(file.fileName());
     }
 
-    // Parent directory of this movie's folder
-    QString baseDir = [&movieInfo]() {
-        QDir chkDir(movieInfo.canonicalPath());
-        chkDir.cdUp();
-        return chkDir.path();
-    }();
-
-    const bool isBluRay = helper::isBluRay(baseDir);
-    const bool isDvd = helper::isDvd(baseDir);
+    const bool isBluRay = names.isBluRay;
+    const bool isDvd = names.isDvd;
 
     // BluRay and DVD folder content must not be renamed.
     if (isBluRay || isDvd) {
@@ -50,45 +140,12 @@ MovieRenamer::RenameError MovieRenamer::renameMovie(Movie& movie)
 
     if (!isBluRay && !isDvd && m_config.renameFiles) {
         newMovieFiles.clear();
-        int partNo = 0;
-        const auto videoDetails = movie.streamDetails()->videoDetails();
-        const auto& files = movie.files();
-        for (const mediaelch::FilePath& file : files) {
-            newFileName = (files.count() == 1) ? m_config.filePattern : m_config.filePatternMulti;
+        int fileIndex = 0;
+        for (const mediaelch::FilePath& file : movie.files()) {
+            newFileName = names.files.at(fileIndex++);
             QFileInfo fi(file.toString());
             QString baseName = fi.completeBaseName();
             QDir currentDir = fi.dir();
-            MovieRenamer::replace(newFileName, "title", movie.name());
-            MovieRenamer::replace(
-                newFileName, "originalTitle", movie.originalName().isEmpty() ? movie.name() : movie.originalName());
-            MovieRenamer::replace(newFileName, "sortTitle", movie.sortTitle());
-            MovieRenamer::replace(newFileName, "director", movie.director());
-            // TODO: Let the user decide whether only the first should be used or
-            //       if a space should be the separator.
-            MovieRenamer::replace(newFileName, "studio", movie.studios().join(","));
-            MovieRenamer::replace(newFileName, "year", movie.released().toString("yyyy"));
-            MovieRenamer::replace(newFileName, "extension", fi.suffix());
-            MovieRenamer::replace(newFileName, "partNo", QString::number(++partNo));
-            MovieRenamer::replace(newFileName, "videoCodec", movie.streamDetails()->videoCodec());
-            MovieRenamer::replace(newFileName, "audioCodec", movie.streamDetails()->audioCodec());
-            // TODO: Let the user decide whether only the first should be used or
-            //       if a space should be the separator.
-            MovieRenamer::replace(newFileName, "audioLanguage", movie.streamDetails()->allAudioLanguages().join("-"));
-            // TODO: Let the user decide whether only the first should be used or
-            //       if a space should be the separator.
-            Renamer::replace(newFileName, "subtitleLanguage", movie.streamDetails()->allSubtitleLanguages().join("-"));
-            MovieRenamer::replace(newFileName, "channels", QString::number(movie.streamDetails()->audioChannels()));
-            MovieRenamer::replace(newFileName,
-                "resolution",
-                helper::matchResolution(videoDetails.value(StreamDetails::VideoDetails::Width).toInt(),
-                    videoDetails.value(StreamDetails::VideoDetails::Height).toInt(),
-                    videoDetails.value(StreamDetails::VideoDetails::ScanType)));
-            MovieRenamer::replaceCondition(newFileName, "imdbId", movie.imdbId().toString());
-            MovieRenamer::replaceCondition(newFileName, "tmdbId", movie.tmdbId().toString());
-            MovieRenamer::replaceCondition(newFileName, "movieset", movie.set().name);
-            MovieRenamer::replaceCondition(
-                newFileName, "3D", videoDetails.value(StreamDetails::VideoDetails::StereoMode) != "");
-            helper::sanitizeFileName(newFileName);
             if (fi.fileName() != newFileName) {
                 {
                     const int row = m_dialog->addResultToTable(fi.fileName(), newFileName, RenameOperation::Rename);
@@ -249,81 +306,14 @@ MovieRenamer::RenameError MovieRenamer::renameMovie(Movie& movie)
 
     int renameRow = -1;
     QString newMovieFolder = dir.path();
-    QString extension = !movie.files().isEmpty() ? movie.files().first().fileSuffix() : "";
-    const auto videoDetails = movie.streamDetails()->videoDetails();
     // rename dir for already existing movie dir
     if (m_config.renameDirectories && movie.inSeparateFolder()) {
-        Renamer::replace(newFolderName, "title", movie.name());
-        Renamer::replace(newFolderName, "extension", extension);
-        Renamer::replace(
-            newFolderName, "originalTitle", movie.originalName().isEmpty() ? movie.name() : movie.originalName());
-        Renamer::replace(newFolderName, "sortTitle", movie.sortTitle());
-        Renamer::replace(newFolderName, "director", movie.director());
-        // TODO: Let the user decide whether only the first should be used or
-        //       if a space should be the separator.
-        Renamer::replace(newFolderName, "studio", movie.studios().join(","));
-        Renamer::replace(newFolderName, "year", movie.released().toString("yyyy"));
-        Renamer::replace(newFolderName, "videoCodec", movie.streamDetails()->videoCodec());
-        // TODO: Let the user decide whether only the first should be used or
-        //       if a space should be the separator.
-        Renamer::replace(newFolderName, "audioLanguage", movie.streamDetails()->allAudioLanguages().join("-"));
-        // TODO: Let the user decide whether only the first should be used or
-        //       if a space should be the separator.
-        Renamer::replace(newFolderName, "subtitleLanguage", movie.streamDetails()->allSubtitleLanguages().join("-"));
-        Renamer::replace(newFolderName, "audioCodec", movie.streamDetails()->audioCodec());
-        Renamer::replace(newFolderName, "channels", QString::number(movie.streamDetails()->audioChannels()));
-        Renamer::replace(newFolderName,
-            "resolution",
-            helper::matchResolution(videoDetails.value(StreamDetails::VideoDetails::Width).toInt(),
-                videoDetails.value(StreamDetails::VideoDetails::Height).toInt(),
-                videoDetails.value(StreamDetails::VideoDetails::ScanType)));
-        Renamer::replaceCondition(newFolderName, "bluray", isBluRay);
-        Renamer::replaceCondition(newFolderName, "dvd", isDvd);
-        Renamer::replaceCondition(
-            newFolderName, "3D", videoDetails.value(StreamDetails::VideoDetails::StereoMode) != "");
-        Renamer::replaceCondition(newFolderName, "movieset", movie.set().name);
-        Renamer::replaceCondition(newFolderName, "imdbId", movie.imdbId().toString());
-        Renamer::replaceCondition(newFolderName, "tmdbId", movie.tmdbId().toString());
-        helper::sanitizeFolderName(newFolderName);
         if (dir.dirName() != newFolderName) {
             renameRow = m_dialog->addResultToTable(dir.dirName(), newFolderName, RenameOperation::Rename);
         }
     }
     // create dir for new dir structure
     else if (m_config.renameDirectories) {
-        Renamer::replace(newFolderName, "title", movie.name());
-        Renamer::replace(newFolderName, "extension", extension);
-        Renamer::replace(
-            newFolderName, "originalTitle", movie.originalName().isEmpty() ? movie.name() : movie.originalName());
-        Renamer::replace(newFolderName, "sortTitle", movie.sortTitle());
-        Renamer::replace(newFolderName, "director", movie.director());
-        // TODO: Let the user decide whether only the first should be used or
-        //       if a space should be the separator.
-        Renamer::replace(newFolderName, "studio", movie.studios().join(","));
-        Renamer::replace(newFolderName, "year", movie.released().toString("yyyy"));
-        Renamer::replace(newFolderName, "videoCodec", movie.streamDetails()->videoCodec());
-        Renamer::replace(newFolderName, "audioCodec", movie.streamDetails()->audioCodec());
-        // TODO: Let the user decide whether only the first should be used or
-        //       if a space should be the separator.
-        Renamer::replace(newFolderName, "audioLanguage", movie.streamDetails()->allAudioLanguages().join("-"));
-        // TODO: Let the user decide whether only the first should be used or
-        //       if a space should be the separator.
-        Renamer::replace(newFolderName, "subtitleLanguage", movie.streamDetails()->allSubtitleLanguages().join("-"));
-        Renamer::replace(newFolderName, "channels", QString::number(movie.streamDetails()->audioChannels()));
-        Renamer::replace(newFolderName,
-            "resolution",
-            helper::matchResolution(videoDetails.value(StreamDetails::VideoDetails::Width).toInt(),
-                videoDetails.value(StreamDetails::VideoDetails::Height).toInt(),
-                videoDetails.value(StreamDetails::VideoDetails::ScanType)));
-        Renamer::replaceCondition(newFolderName, "bluray", isBluRay);
-        Renamer::replaceCondition(newFolderName, "dvd", isDvd);
-        Renamer::replaceCondition(
-            newFolderName, "3D", videoDetails.value(StreamDetails::VideoDetails::StereoMode) != "");
-        Renamer::replaceCondition(newFolderName, "movieset", movie.set().name);
-        Renamer::replaceCondition(newFolderName, "imdbId", movie.imdbId().toString());
-        Renamer::replaceCondition(newFolderName, "tmdbId", movie.tmdbId().toString());
-        helper::sanitizeFolderName(newFolderName);
-
         if (dir.dirName() != newFolderName) { // check if movie is not already on good folder
             int i = 0;
             while (dir.exists(newFolderName)) {
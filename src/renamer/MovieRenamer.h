@@ -2,12 +2,44 @@
 
 #include "renamer/Renamer.h"
 
+#include <QSet>
+
 class RenamerDialog;
 class Movie;
 
 class MovieRenamer : public Renamer
 {
 public:
+    /// \brief New names of a movie's files and directory.
+    struct Names
+    {
+        /// New names of the movie's files in the same order as Movie::files().
+        /// Empty if files are not renamed.
+        QStringList files;
+        /// New name of the movie's directory. Empty if directories are not renamed.
+        QString directory;
+        /// Absolute paths that the movie's files or directory will have after renaming.
+        /// Used to detect conflicts between movies, see findConflicts().
+        QStringList targets;
+        bool isBluRay = false;
+        bool isDvd = false;
+    };
+
     MovieRenamer(RenamerConfig renamerConfig, RenamerDialog* dialog);
+
+    /// \brief Generate the new names of the movie's files and directory.
+    /// \details Does not modify the movie or any file. Can be called for
+    ///          multiple movies from multiple threads at the same time.
+    Names names(Movie& movie) const;
+
+    /// \brief Find movies that would be renamed to the same path.
+    /// \return Indices into the given list of all movies that are in conflict with another one.
+    static QSet<int> findConflicts(const QVector<Names>& names);
+
     RenameError renameMovie(Movie& movie);
+    /// \brief Rename the movie using names that were generated by names().
+    RenameError renameMovie(Movie& movie, const Names& names);
+
+private:
+    mediaelch::RenamerValues values(Movie& movie) const;
 };
@@ -2,7 +2,9 @@
 
 #include "data/movie/Movie.h"
 #include "globals/Helper.h"
+#include "import/FileOperationBatch.h"
 #include "log/Log.h"
+#include "media/StreamDetails.h"
 #include "settings/Settings.h"
 #include "utils/Meta.h"
 
@@ -36,9 +38,31 @@ QString renamerTypeToString(RenameType type)
 Renamer::Renamer(RenamerConfig renamerConfig, RenamerDialog* dialog) :
     m_config(std::move(renamerConfig)),
     m_dialog{dialog},
-    m_extraFiles(Settings::instance()->advanced()->subtitleFilters())
+    m_extraFiles(Settings::instance()->advanced()->subtitleFilters()),
+    m_filePattern(m_config.filePattern),
+    m_filePatternMulti(m_config.filePatternMulti),
+    m_directoryPattern(m_config.directoryPattern)
 {
 }
+
+void Renamer::insertStreamDetails(mediaelch::RenamerValues& values, StreamDetails& streamDetails)
+{
+    const auto videoDetails = streamDetails.videoDetails();
+    values.insert("videoCodec", streamDetails.videoCodec());
+    values.insert("audioCodec", streamDetails.audioCodec());
+    // TODO: Let the user decide whether only the first should be used or
+    //       if a space should be the separator.
+    values.insert("audioLanguage", streamDetails.allAudioLanguages().join("-"));
+    // TODO: Let the user decide whether only the first should be used or
+    //       if a space should be the separator.
+    values.insert("subtitleLanguage", streamDetails.allSubtitleLanguages().join("-"));
+    values.insert("channels", QString::number(streamDetails.audioChannels()));
+    values.insert("resolution",
+        helper::matchResolution(videoDetails.value(StreamDetails::VideoDetails::Width).toInt(),
+            videoDetails.value(StreamDetails::VideoDetails::Height).toInt(),
+            videoDetails.value(StreamDetails::VideoDetails::ScanType)));
+    values.insertCondition("3D", !videoDetails.value(StreamDetails::VideoDetails::StereoMode).isEmpty());
+}
 QString Renamer::replace(QString& text, const QString& search, QString replacement)
 {
     text.replace("<" + search + ">", replacement.trimmed());
@@ -86,12 +110,14 @@ bool Renamer::rename(const QString& file, const QString& newName)
     }
 
     if (newFile.exists()) {
+        // Only the case differs: both names are in the same directory.
         if (!f.rename(newName + ".tmp")) {
             return false;
         }
         return f.rename(newName);
     }
-    return f.rename(newName);
+    // Verified move if the new name is on another filesystem.
+    return mediaelch::FileOperationBatch::move(file, newName);
 }
 
 bool Renamer::rename(QDir& dir, QString newName)
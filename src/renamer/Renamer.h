@@ -1,6 +1,7 @@
 #pragma once
 
 #include "media/FileFilter.h"
+#include "renamer/RenamerTemplate.h"
 
 #include <QDir>
 #include <QString>
@@ -9,6 +10,7 @@
 
 class Movie;
 class RenamerDialog;
+class StreamDetails;
 
 
 enum class RenameType : int8_t
@@ -60,8 +62,16 @@ public:
     static bool rename(QDir& dir, QString newName);
     static bool rename(const QString& file, const QString& newName);
 
+    /// \brief Add the placeholder values that all renamers provide for stream details,
+    ///        e.g. <videoCodec> or {3D}.
+    static void insertStreamDetails(mediaelch::RenamerValues& values, StreamDetails& streamDetails);
+
 protected:
     RenamerConfig m_config;
     RenamerDialog* m_dialog;
     const mediaelch::FileFilter& m_extraFiles;
+    /// Patterns of m_config, compiled once per renamer.
+    mediaelch::RenamerTemplate m_filePattern;
+    mediaelch::RenamerTemplate m_filePatternMulti;
+    mediaelch::RenamerTemplate m_directoryPattern;
 };
@@ -0,0 +1,152 @@
+#include "renamer/RenamerTemplate.h"
+
+#include "utils/Meta.h"
+
+namespace {
+
+bool isName(const QString& name)
+{
+    if (name.isEmpty()) {
+        return false;
+    }
+    for (const QChar c : name) {
+        if (!c.isLetterOrNumber() && c != '_') {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+namespace mediaelch {
+
+RenamerTemplate::RenamerTemplate(const QString& pattern)
+{
+    compile(pattern, 0, qsizetype_to_int(pattern.size()));
+}
+
+void RenamerTemplate::compile(const QString& pattern, int begin, int end)
+{
+    QString text;
+    int pos = begin;
+    while (pos < end) {
+        const QChar c = pattern.at(pos);
+
+        if (c == '<') {
+            const int close = qsizetype_to_int(pattern.indexOf('>', pos + 1));
+            if (close != -1 && close < end) {
+                const QString name = pattern.mid(pos + 1, close - pos - 1);
+                if (isName(name)) {
+                    appendText(text);
+                    text.clear();
+                    Instruction placeholder;
+                    placeholder.op = OpCode::Placeholder;
+                    placeholder.value = name;
+                    m_instructions.append(placeholder);
+                    pos = close + 1;
+                    continue;
+                }
+            }
+
+        } else if (c == '{') {
+            const int close = qsizetype_to_int(pattern.indexOf('}', pos + 1));
+            if (close != -1 && close < end) {
+                const QString name = pattern.mid(pos + 1, close - pos - 1);
+                const QString endTag = QStringLiteral("{/%1}").arg(name);
+                // Same as the former regular expression: The first end tag closes the condition.
+                const int endPos = qsizetype_to_int(pattern.indexOf(endTag, close + 1));
+                if (isName(name) && endPos != -1 && endPos + endTag.size() <= end) {
+                    appendText(text);
+                    text.clear();
+
+                    const int beginIndex = qsizetype_to_int(m_instructions.size());
+                    Instruction beginCondition;
+                    beginCondition.op = OpCode::BeginCondition;
+                    beginCondition.value = name;
+                    m_instructions.append(beginCondition);
+
+                    compile(pattern, close + 1, endPos);
+
+                    Instruction endCondition;
+                    endCondition.op = OpCode::EndCondition;
+                    endCondition.value = name;
+                    m_instructions.append(endCondition);
+                    m_instructions[beginIndex].jump = qsizetype_to_int(m_instructions.size()) - 1;
+
+                    pos = endPos + qsizetype_to_int(endTag.size());
+                    continue;
+                }
+            }
+        }
+
+        text.append(c);
+        ++pos;
+    }
+    appendText(text);
+}
+
+void RenamerTemplate::appendText(const QString& text)
+{
+    if (text.isEmpty()) {
+        return;
+    }
+    Instruction instruction;
+    instruction.op = OpCode::Text;
+    instruction.value = text;
+    m_instructions.append(instruction);
+}
+
+QString RenamerTemplate::render(const RenamerValues& values) const
+{
+    const QHash<QString, QString>& placeholders = values.values();
+    const QHash<QString, bool>& conditions = values.conditions();
+
+    QString result;
+    result.reserve(128);
+
+    const int count = qsizetype_to_int(m_instructions.size());
+    for (int i = 0; i < count; ++i) {
+        const Instruction& instruction = m_instructions.at(i);
+        switch (instruction.op) {
+        case OpCode::Text: {
+            result.append(instruction.value);
+            break;
+        }
+        case OpCode::Placeholder: {
+            const auto value = placeholders.constFind(instruction.value);
+            if (value != placeholders.constEnd()) {
+                result.append(value.value().trimmed());
+            } else {
+                result.append('<').append(instruction.value).append('>');
+            }
+            break;
+        }
+        case OpCode::BeginCondition: {
+            const auto value = placeholders.constFind(instruction.value);
+            const auto condition = conditions.constFind(instruction.value);
+            if (value != placeholders.constEnd()) {
+                if (value.value().isEmpty()) {
+                    i = instruction.jump;
+                }
+            } else if (condition != conditions.constEnd()) {
+                if (!condition.value()) {
+                    i = instruction.jump;
+                }
+            } else {
+                result.append('{').append(instruction.value).append('}');
+            }
+            break;
+        }
+        case OpCode::EndCondition: {
+            if (!placeholders.contains(instruction.value) && !conditions.contains(instruction.value)) {
+                result.append("{/").append(instruction.value).append('}');
+            }
+            break;
+        }
+        }
+    }
+    return result;
+}
+
+} // namespace mediaelch
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+namespace mediaelch {
+
+/// \brief Values for the placeholders and conditions of a RenamerTemplate.
+class RenamerValues
+{
+public:
+    /// \brief Set the value of <name>. Conditions {name}...{/name} are
+    ///        rendered if the value is not empty.
+    void insert(const QString& name, const QString& value) { m_values.insert(name, value); }
+    /// \brief Set a condition {name}...{/name} that has no placeholder value.
+    void insertCondition(const QString& name, bool isSet) { m_conditions.insert(name, isSet); }
+
+    const QHash<QString, QString>& values() const { return m_values; }
+    const QHash<QString, bool>& conditions() const { return m_conditions; }
+
+private:
+    QHash<QString, QString> m_values;
+    QHash<QString, bool> m_conditions;
+};
+
+/// \brief A renamer pattern such as "{movieset}<movieset> - {/movieset}<title> (<year>)"
+///        that is compiled once and can then be rendered for many items.
+///
+/// Previously, each placeholder was replaced one after another using
+/// Renamer::replace() and Renamer::replaceCondition(), which scanned the
+/// whole pattern and compiled a regular expression for each condition and item.
+/// A template is parsed only once into a flat list of instructions and is
+/// rendered in a single pass.
+///
+/// Placeholders and conditions without a value are kept as-is, same as before.
+/// A RenamerTemplate is immutable after construction and can be rendered
+/// from multiple threads.
+///
+/// \code{cpp}
+///   RenamerTemplate pattern("<title> (<year>)");
+///   RenamerValues values;
+///   values.insert("title", "Alien");
+///   values.insert("year", "1979");
+///   QString name = pattern.render(values); // "Alien (1979)"
+/// \endcode
+class RenamerTemplate
+{
+public:
+    RenamerTemplate() = default;
+    explicit RenamerTemplate(const QString& pattern);
+
+    QString render(const RenamerValues& values) const;
+
+    bool isEmpty() const { return m_instructions.isEmpty(); }
+
+private:
+    enum class OpCode : int8_t
+    {
+        Text,
+        Placeholder,
+        BeginCondition,
+        EndCondition
+    };
+
+    struct Instruction
+    {
+        OpCode op = OpCode::Text;
+        QString value;
+        /// For BeginCondition: index of the matching EndCondition.
+        int jump = -1;
+    };
+
+    void compile(const QString& pattern, int begin, int end);
+    void appendText(const QString& text);
+
+    QVector<Instruction> m_instructions;
+};
+
+} // namespace mediaelch
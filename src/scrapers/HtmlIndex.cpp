@@ -0,0 +1,398 @@
+#include "scrapers/HtmlIndex.h"
+
+#include "globals/Globals.h"
+#include "scrapers/ScraperUtils.h"
+#include "utils/Meta.h"
+
+namespace {
+
+bool isVoidElement(const QString& tag)
+{
+    static const QStringList voidElements{"area",
+        "base",
+        "br",
+        "col",
+        "embed",
+        "hr",
+        "img",
+        "input",
+        "link",
+        "meta",
+        "param",
+        "source",
+        "track",
+        "wbr"};
+    return voidElements.contains(tag);
+}
+
+bool isTagNameChar(QChar c)
+{
+    return c.isLetterOrNumber() || c == '-' || c == ':' || c == '_';
+}
+
+/// Some end tags are optional, e.g. "<li>a<li>b": The start tag of a sibling closes the open element.
+bool closesOpenElement(const QString& tag, const QString& openTag)
+{
+    static const QStringList optionalEndTags{"dd", "dt", "li", "option", "p", "td", "th", "tr"};
+    if (!optionalEndTags.contains(tag) || !optionalEndTags.contains(openTag)) {
+        return false;
+    }
+    return tag == openTag || (tag == "dd" && openTag == "dt") || (tag == "dt" && openTag == "dd")
+           || (tag == "td" && openTag == "th") || (tag == "th" && openTag == "td");
+}
+
+bool startsWithAt(const QString& str, int pos, const char* needle)
+{
+    for (int i = 0; needle[i] != '\0'; ++i) {
+        if (pos + i >= str.size() || str.at(pos + i) != QLatin1Char(needle[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+namespace mediaelch {
+namespace scraper {
+
+HtmlIndex::HtmlIndex(QString html) : m_html{std::move(html)}
+{
+    parse();
+}
+
+const HtmlIndex::Element* HtmlIndex::elementById(const QString& id) const
+{
+    const auto elements = m_byId.constFind(id);
+    if (elements == m_byId.constEnd() || elements->isEmpty()) {
+        return nullptr;
+    }
+    return &m_elements.at(elements->first());
+}
+
+QVector<const HtmlIndex::Element*> HtmlIndex::elementsByClass(const QString& className) const
+{
+    return lookup(m_byClass, className);
+}
+
+QVector<const HtmlIndex::Element*> HtmlIndex::elementsByAttribute(const QString& name, const QString& value) const
+{
+    return lookup(m_byAttribute, name.toLower() + '=' + value);
+}
+
+QVector<const HtmlIndex::Element*> HtmlIndex::elementsByTag(const QString& tag) const
+{
+    return lookup(m_byTag, tag);
+}
+
+const HtmlIndex::Element* HtmlIndex::firstDescendant(const Element& parent, const QString& tag) const
+{
+    // Elements are stored in document order, i.e. all descendants directly follow their parent.
+    const int count = qsizetype_to_int(m_elements.size());
+    for (int i = static_cast<int>(&parent - m_elements.constData()) + 1; i < count; ++i) {
+        const Element& element = m_elements.at(i);
+        if (element.start >= parent.contentEnd) {
+            break;
+        }
+        if (element.tag == tag) {
+            return &element;
+        }
+    }
+    return nullptr;
+}
+
+QVector<const HtmlIndex::Element*> HtmlIndex::descendants(const Element& parent, const QString& tag) const
+{
+    QVector<const Element*> elements;
+    const int count = qsizetype_to_int(m_elements.size());
+    for (int i = static_cast<int>(&parent - m_elements.constData()) + 1; i < count; ++i) {
+        const Element& element = m_elements.at(i);
+        if (element.start >= parent.contentEnd) {
+            break;
+        }
+        if (tag.isEmpty() || element.tag == tag) {
+            elements << &element;
+        }
+    }
+    return elements;
+}
+
+const HtmlIndex::Element* HtmlIndex::nextElement(const Element& element, const QString& tag) const
+{
+    const int count = qsizetype_to_int(m_elements.size());
+    for (int i = static_cast<int>(&element - m_elements.constData()) + 1; i < count; ++i) {
+        const Element& next = m_elements.at(i);
+        if (next.start >= element.end && (tag.isEmpty() || next.tag == tag)) {
+            return &next;
+        }
+    }
+    return nullptr;
+}
+
+bool HtmlIndex::contains(const Element& parent, const Element& element)
+{
+    return &element != &parent && element.start >= parent.contentStart && element.end <= parent.contentEnd;
+}
+
+QString HtmlIndex::innerHtml(const Element& element) const
+{
+    return m_html.mid(element.contentStart, element.contentEnd - element.contentStart);
+}
+
+bool HtmlIndex::hasInnerHtml(const Element& element, const QString& html) const
+{
+    int begin = element.contentStart;
+    int end = element.contentEnd;
+    while (begin < end && m_html.at(begin).isSpace()) {
+        ++begin;
+    }
+    while (end > begin && m_html.at(end - 1).isSpace()) {
+        --end;
+    }
+    if (end - begin != html.size()) {
+        return false;
+    }
+    for (int i = 0; i < end - begin; ++i) {
+        if (m_html.at(begin + i) != html.at(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+QString HtmlIndex::text(const Element& element) const
+{
+    return normalizeFromHtml(innerHtml(element));
+}
+
+QString HtmlIndex::textBefore(const Element& element) const
+{
+    const int tagEnd = element.start > 0 ? qsizetype_to_int(m_html.lastIndexOf('>', element.start - 1)) : -1;
+    return m_html.mid(tagEnd + 1, element.start - tagEnd - 1).trimmed();
+}
+
+QString HtmlIndex::attribute(const Element& element, const QString& name)
+{
+    for (const auto& attribute : element.attributes) {
+        if (attribute.first == name) {
+            return attribute.second;
+        }
+    }
+    return {};
+}
+
+void HtmlIndex::parse()
+{
+    const int size = qsizetype_to_int(m_html.size());
+    // Indices of elements whose end tag was not found, yet.
+    QVector<int> openElements;
+
+    int pos = qsizetype_to_int(m_html.indexOf('<'));
+    while (pos != -1 && pos + 1 < size) {
+        const QChar next = m_html.at(pos + 1);
+
+        if (startsWithAt(m_html, pos, "<!--")) {
+            const int commentEnd = qsizetype_to_int(m_html.indexOf(QStringLiteral("-->"), pos + 4));
+            pos = (commentEnd == -1) ? size : commentEnd + 3;
+
+        } else if (next == '!' || next == '?') {
+            // Doctype or processing instruction
+            const int tagEnd = qsizetype_to_int(m_html.indexOf('>', pos));
+            pos = (tagEnd == -1) ? size : tagEnd + 1;
+
+        } else if (next == '/') {
+            int nameEnd = pos + 2;
+            while (nameEnd < size && isTagNameChar(m_html.at(nameEnd))) {
+                ++nameEnd;
+            }
+            const QString tag = m_html.mid(pos + 2, nameEnd - pos - 2).toLower();
+            const int tagEnd = qsizetype_to_int(m_html.indexOf('>', nameEnd));
+            const int end = (tagEnd == -1) ? size : tagEnd + 1;
+
+            // Find the matching start tag.  All elements opened after it are implicitly
+            // closed.  End tags without a matching start tag are ignored.
+            for (int i = qsizetype_to_int(openElements.size()) - 1; i >= 0; --i) {
+                if (m_elements.at(openElements.at(i)).tag != tag) {
+                    continue;
+                }
+                for (int j = qsizetype_to_int(openElements.size()) - 1; j > i; --j) {
+                    closeElement(openElements.at(j), pos, pos);
+                }
+                closeElement(openElements.at(i), pos, end);
+                openElements.resize(i);
+                break;
+            }
+            pos = end;
+
+        } else if (next.isLetter()) {
+            pos = parseStartTag(pos, openElements);
+
+        } else {
+            // A literal '<' in text.
+            ++pos;
+        }
+
+        if (pos < size) {
+            pos = qsizetype_to_int(m_html.indexOf('<', pos));
+        }
+    }
+
+    for (const int index : asConst(openElements)) {
+        closeElement(index, size, size);
+    }
+}
+
+int HtmlIndex::parseStartTag(int pos, QVector<int>& openElements)
+{
+    const int size = qsizetype_to_int(m_html.size());
+
+    Element element;
+    element.start = pos;
+
+    int i = pos + 1;
+    while (i < size && isTagNameChar(m_html.at(i))) {
+        ++i;
+    }
+    element.tag = m_html.mid(pos + 1, i - pos - 1).toLower();
+
+    bool selfClosing = false;
+    while (i < size) {
+        const QChar c = m_html.at(i);
+        if (c == '>') {
+            ++i;
+            break;
+        }
+        if (c == '/') {
+            selfClosing = true;
+            ++i;
+            continue;
+        }
+        if (c.isSpace()) {
+            ++i;
+            continue;
+        }
+
+        selfClosing = false;
+        const int nameStart = i;
+        while (i < size && !m_html.at(i).isSpace() && m_html.at(i) != '=' && m_html.at(i) != '>'
+               && m_html.at(i) != '/') {
+            ++i;
+        }
+        const QString name = m_html.mid(nameStart, i - nameStart).toLower();
+
+        while (i < size && m_html.at(i).isSpace()) {
+            ++i;
+        }
+        QString value;
+        if (i < size && m_html.at(i) == '=') {
+            ++i;
+            while (i < size && m_html.at(i).isSpace()) {
+                ++i;
+            }
+            if (i < size && (m_html.at(i) == '"' || m_html.at(i) == '\'')) {
+                int valueEnd = qsizetype_to_int(m_html.indexOf(m_html.at(i), i + 1));
+                if (valueEnd == -1) {
+                    valueEnd = size;
+                }
+                value = m_html.mid(i + 1, valueEnd - i - 1);
+                i = valueEnd + 1;
+            } else {
+                const int valueStart = i;
+                while (i < size && !m_html.at(i).isSpace() && m_html.at(i) != '>') {
+                    ++i;
+                }
+                value = m_html.mid(valueStart, i - valueStart);
+            }
+        }
+        element.attributes.append({name, value});
+    }
+    element.contentStart = qMin(i, size);
+
+    if (!openElements.isEmpty() && closesOpenElement(element.tag, m_elements.at(openElements.last()).tag)) {
+        closeElement(openElements.takeLast(), pos, pos);
+    }
+
+    const int index = qsizetype_to_int(m_elements.size());
+
+    if (element.tag == "script" || element.tag == "style") {
+        // Raw text elements: Their content is not tokenized.
+        const QString endTag = QStringLiteral("</") + element.tag;
+        const int closeTag = qsizetype_to_int(m_html.indexOf(endTag, element.contentStart, Qt::CaseInsensitive));
+        if (closeTag == -1) {
+            element.contentEnd = size;
+            element.end = size;
+        } else {
+            const int tagEnd = qsizetype_to_int(m_html.indexOf('>', closeTag));
+            element.contentEnd = closeTag;
+            element.end = (tagEnd == -1) ? size : tagEnd + 1;
+        }
+
+        if (element.tag == "script") {
+            if (attribute(element, "type") == "application/ld+json") {
+                m_jsonLd << innerHtml(element).trimmed();
+            } else if (attribute(element, "id") == "__NEXT_DATA__") {
+                m_nextData = innerHtml(element).trimmed();
+            }
+        }
+        m_elements.append(element);
+        addToIndex(index);
+        return element.end;
+    }
+
+    if (selfClosing || isVoidElement(element.tag)) {
+        element.contentEnd = element.contentStart;
+        element.end = element.contentStart;
+        m_elements.append(element);
+        addToIndex(index);
+        return element.end;
+    }
+
+    m_elements.append(element);
+    addToIndex(index);
+    openElements.append(index);
+    return element.contentStart;
+}
+
+void HtmlIndex::closeElement(int index, int contentEnd, int end)
+{
+    Element& element = m_elements[index];
+    element.contentEnd = contentEnd;
+    element.end = end;
+}
+
+void HtmlIndex::addToIndex(int index)
+{
+    m_byTag[m_elements.at(index).tag].append(index);
+    for (const auto& attribute : asConst(m_elements.at(index).attributes)) {
+        const QString& name = attribute.first;
+        if (name == "id") {
+            m_byId[attribute.second].append(index);
+
+        } else if (name == "class") {
+            const QStringList classes = attribute.second.simplified().split(' ', ElchSplitBehavior::SkipEmptyParts);
+            for (const QString& className : classes) {
+                m_byClass[className].append(index);
+            }
+
+        } else if (name == "itemprop" || name == "property" || name == "name" || name.startsWith("data-")) {
+            m_byAttribute[name + '=' + attribute.second].append(index);
+        }
+    }
+}
+
+QVector<const HtmlIndex::Element*> HtmlIndex::lookup(const QHash<QString, QVector<int>>& index,
+    const QString& key) const
+{
+    QVector<const Element*> elements;
+    const auto indices = index.constFind(key);
+    if (indices != index.constEnd()) {
+        elements.reserve(indices->size());
+        for (const int i : *indices) {
+            elements << &m_elements.at(i);
+        }
+    }
+    return elements;
+}
+
+} // namespace scraper
+} // namespace mediaelch
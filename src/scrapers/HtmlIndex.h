@@ -0,0 +1,119 @@
+#pragma once
+
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+namespace mediaelch {
+namespace scraper {
+
+/// \brief Index of an HTML page's elements that is built in a single pass.
+///
+/// Scrapers used to run one regular expression per detail over the whole page,
+/// i.e. a page with 40 details was scanned 40 times.  The index tokenizes the
+/// page once and records where each element starts and ends.  Elements can then
+/// be looked up by tag name, id, CSS class and by the attributes itemprop, property,
+/// name and data-*.  Extractors only need to look at the (small) inner HTML of
+/// the elements they are interested in.
+///
+/// The tokenizer is lenient: Unclosed elements end where their parent ends and
+/// stray end tags are ignored.  Comments as well as the contents of \<script\>
+/// and \<style\> are not tokenized.  Embedded JSON-LD and Next.js data
+/// (`__NEXT_DATA__`) are collected as raw JSON strings.
+///
+/// \code{cpp}
+///   HtmlIndex page(html);
+///   for (const HtmlIndex::Element* meta : page.elementsByAttribute("itemprop", "genre")) {
+///       show.addGenre(HtmlIndex::attribute(*meta, "content"));
+///   }
+/// \endcode
+class HtmlIndex
+{
+public:
+    struct Element
+    {
+        /// Lower-case tag name, e.g. "div".
+        QString tag;
+        /// Attributes in document order.  Names are lower-case, values are not decoded.
+        QVector<QPair<QString, QString>> attributes;
+        /// Offset of the start tag's '<'.
+        int start = 0;
+        /// Offset directly after the start tag's '>'.
+        int contentStart = 0;
+        /// Offset of the end tag's '<'.  Same as contentStart for void elements.
+        int contentEnd = 0;
+        /// Offset directly after the end tag's '>'.
+        int end = 0;
+    };
+
+public:
+    explicit HtmlIndex(QString html);
+
+    const QString& html() const { return m_html; }
+    /// All elements in document order.
+    const QVector<Element>& elements() const { return m_elements; }
+
+    /// \brief First element with the given id or nullptr if there is none.
+    const Element* elementById(const QString& id) const;
+    /// \brief All elements that have the given CSS class, in document order.
+    QVector<const Element*> elementsByClass(const QString& className) const;
+    /// \brief All elements whose attribute has the given value, in document order.
+    /// \details Only itemprop, property, name and data-* attributes are indexed.
+    QVector<const Element*> elementsByAttribute(const QString& name, const QString& value) const;
+    /// \brief All elements with the given (lower-case) tag name, in document order.
+    QVector<const Element*> elementsByTag(const QString& tag) const;
+    /// \brief First element with the given tag name inside of parent or nullptr.
+    const Element* firstDescendant(const Element& parent, const QString& tag) const;
+    /// \brief All elements with the given tag name inside of parent, in document order.
+    /// \details Any tag matches if tag is empty.
+    QVector<const Element*> descendants(const Element& parent, const QString& tag = {}) const;
+    /// \brief First element that starts after element's end and has the given tag name.
+    /// \details Any tag matches if tag is empty.  Returns nullptr if there is no such element.
+    const Element* nextElement(const Element& element, const QString& tag = {}) const;
+    /// \brief True if element is a descendant of parent.
+    static bool contains(const Element& parent, const Element& element);
+
+    /// \brief The raw HTML between the element's start and end tag.
+    QString innerHtml(const Element& element) const;
+    /// \brief True if the element's inner HTML without surrounding whitespace is the given string.
+    /// \details Unlike innerHtml(), the content is not copied, which makes it cheap to find
+    ///          labels such as "<td>Genres</td>" among all elements with the same tag.
+    bool hasInnerHtml(const Element& element, const QString& html) const;
+    /// \brief The inner HTML without tags and HTML entities, see normalizeFromHtml().
+    QString text(const Element& element) const;
+    /// \brief The raw text between the previous tag and the element's start tag, trimmed.
+    /// \details Useful for labels that are not inside an element, e.g. "Directors:" in
+    ///          "<div>Directors: <ul>…</ul></div>".
+    QString textBefore(const Element& element) const;
+    /// \brief The element's attribute value or a null string if it has no such attribute.
+    static QString attribute(const Element& element, const QString& name);
+
+    /// \brief Contents of all \<script type="application/ld+json"\> elements.
+    const QStringList& jsonLd() const { return m_jsonLd; }
+    /// \brief Contents of \<script id="__NEXT_DATA__"\> or an empty string.
+    const QString& nextData() const { return m_nextData; }
+
+private:
+    void parse();
+    /// Parses the start tag at pos and returns the offset after its '>'.
+    int parseStartTag(int pos, QVector<int>& openElements);
+    void closeElement(int index, int contentEnd, int end);
+    void addToIndex(int index);
+    QVector<const Element*> lookup(const QHash<QString, QVector<int>>& index, const QString& key) const;
+
+private:
+    QString m_html;
+    QVector<Element> m_elements;
+    QHash<QString, QVector<int>> m_byTag;
+    QHash<QString, QVector<int>> m_byId;
+    QHash<QString, QVector<int>> m_byClass;
+    /// Key is "name=value".
+    QHash<QString, QVector<int>> m_byAttribute;
+    QStringList m_jsonLd;
+    QString m_nextData;
+};
+
+} // namespace scraper
+} // namespace mediaelch
@@ -0,0 +1,58 @@
+#include "scrapers/ScrapePrefetcher.h"
+
+#include "log/Log.h"
+#include "utils/Meta.h"
+
+namespace mediaelch {
+namespace scraper {
+
+ScrapePrefetcher::ScrapePrefetcher(QObject* parent) : QObject(parent)
+{
+    m_startTimer.setSingleShot(true);
+    m_startTimer.setInterval(startDelayMs);
+    connect(&m_startTimer, &QTimer::timeout, this, &ScrapePrefetcher::startNextJobs);
+}
+
+void ScrapePrefetcher::prefetch(QVector<JobFactory> jobs)
+{
+    m_queue = std::move(jobs);
+    // Give jobs that the user actually waits for, e.g. the preview of the selected
+    // result, a head start.
+    m_startTimer.start();
+}
+
+void ScrapePrefetcher::cancel()
+{
+    m_startTimer.stop();
+    m_queue.clear();
+}
+
+void ScrapePrefetcher::startNextJobs()
+{
+    while (!m_queue.isEmpty() && m_runningJobs < maxParallelJobs) {
+        worker::Job* job = m_queue.takeFirst()();
+        if (job == nullptr) {
+            continue;
+        }
+        ++m_runningJobs;
+        connect(job, &worker::Job::finished, this, &ScrapePrefetcher::onJobFinished);
+        job->start();
+    }
+}
+
+void ScrapePrefetcher::onJobFinished(worker::Job* job)
+{
+    // Scrape jobs are not auto-deleted.  Only their cached responses are of interest.
+    auto dls = makeDeleteLaterScope(job);
+    if (job->hasError()) {
+        // Not an issue: The job is repeated when the user selects the result.
+        qCDebug(c_scraper) << "[ScrapePrefetcher] Prefetching failed:" << job->errorString();
+    }
+    --m_runningJobs;
+    if (!m_startTimer.isActive()) {
+        startNextJobs();
+    }
+}
+
+} // namespace scraper
+} // namespace mediaelch
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "workers/Job.h"
+
+#include <QObject>
+#include <QTimer>
+#include <QVector>
+#include <functional>
+
+namespace mediaelch {
+namespace scraper {
+
+/// \brief Loads details of likely selections of a search dialog in the background.
+///
+/// Search dialogs only start a scrape job after the user has selected a search
+/// result. The prefetcher starts scrape jobs for the top results in advance.
+/// The results of these jobs are discarded. Because scrapers cache their
+/// responses (see network::WebsiteCache), a later scrape job for the same item
+/// and language completes from the cache.
+///
+/// Prefetching has a low priority: It starts after a short delay and only a few
+/// jobs run at the same time. Scrape jobs can't be killed, so cancel() only
+/// removes jobs that have not been started, yet.
+///
+/// \code{cpp}
+///   m_prefetcher->prefetch({[scraper, config]() { return scraper->loadMovie(config); }});
+/// \endcode
+class ScrapePrefetcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// \brief Creates a job that is started by the prefetcher.
+    using JobFactory = std::function<worker::Job*()>;
+
+    /// Number of search results that search dialogs should prefetch.
+    static constexpr int defaultResultCount = 3;
+    static constexpr int maxParallelJobs = 2;
+    static constexpr int startDelayMs = 500;
+
+public:
+    explicit ScrapePrefetcher(QObject* parent = nullptr);
+    ~ScrapePrefetcher() override = default;
+
+    /// \brief Replaces all queued jobs with the given ones.
+    void prefetch(QVector<JobFactory> jobs);
+    /// \brief Removes all queued jobs. Running jobs finish in the background.
+    void cancel();
+
+private:
+    void startNextJobs();
+    void onJobFinished(worker::Job* job);
+
+private:
+    QVector<JobFactory> m_queue;
+    int m_runningJobs = 0;
+    QTimer m_startTimer;
+};
+
+} // namespace scraper
+} // namespace mediaelch
@@ -16,7 +16,7 @@ TvShowUpdater::TvShowUpdater(QObject* parent) : QObject(parent), m_tmdb{nullptr}
 {
     m_tmdb = dynamic_cast<scraper::TmdbTv*>(Manager::instance()->scrapers().tvScraper(scraper::TmdbTv::ID));
     if (m_tmdb == nullptr) {
-        qCCritical(generic) << "[TvShowUpdater] Failing cast to TmdbTv scraper";
+        qCCritical(c_scraper) << "[TvShowUpdater] Failing cast to TmdbTv scraper";
     }
 }
 
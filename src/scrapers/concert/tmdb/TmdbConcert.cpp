@@ -278,13 +278,13 @@ void TmdbConcert::setupFinished()
     const auto parsedJson = QJsonDocument::fromJson(reply->readAll(), &parseError).object();
     reply->deleteLater();
     if (parseError.error != QJsonParseError::NoError) {
-        qCWarning(generic) << "Error parsing TMDB setup json " << parseError.errorString();
+        qCWarning(c_scraper_tmdb) << "Error parsing TMDB setup json " << parseError.errorString();
         return;
     }
 
     const auto imagesObject = parsedJson.value("images").toObject();
     m_baseUrl = imagesObject.value("base_url").toString();
-    qCDebug(generic) << "TMDB base url:" << m_baseUrl;
+    qCDebug(c_scraper_tmdb) << "TMDB base url:" << m_baseUrl;
 }
 
 /**
@@ -300,7 +300,7 @@ void TmdbConcert::setupFinished()
  */
 void TmdbConcert::loadData(TmdbId id, Concert* concert, QSet<ConcertScraperInfo> infos)
 {
-    qCDebug(generic) << "Entered, id=" << id << "concert=" << concert->title();
+    qCDebug(c_scraper_tmdb) << "Entered, id=" << id << "concert=" << concert->title();
     concert->setTmdbId(id);
     concert->clear(infos);
 
@@ -374,7 +374,7 @@ void TmdbConcert::loadFinished()
         QString msg = QString::fromUtf8(reply->readAll());
         parseAndAssignInfos(msg, concert, infos);
     } else {
-        qCWarning(generic) << "Network Error (load)" << reply->errorString();
+        qCWarning(c_scraper_tmdb) << "Network Error (load)" << reply->errorString();
     }
     concert->controller()->removeFromLoadsLeft(ScraperData::Infos);
 }
@@ -397,7 +397,7 @@ void TmdbConcert::loadTrailersFinished()
         QString msg = QString::fromUtf8(reply->readAll());
         parseAndAssignInfos(msg, concert, infos);
     } else {
-        qCDebug(generic) << "Network Error (trailers)" << reply->errorString();
+        qCDebug(c_scraper_tmdb) << "Network Error (trailers)" << reply->errorString();
     }
     concert->controller()->removeFromLoadsLeft(ScraperData::Trailers);
 }
@@ -420,7 +420,7 @@ void TmdbConcert::loadImagesFinished()
         QString msg = QString::fromUtf8(reply->readAll());
         parseAndAssignInfos(msg, concert, infos);
     } else {
-        qCWarning(generic) << "Network Error (images)" << reply->errorString();
+        qCWarning(c_scraper_tmdb) << "Network Error (images)" << reply->errorString();
     }
     concert->controller()->removeFromLoadsLeft(ScraperData::Images);
 }
@@ -443,7 +443,7 @@ void TmdbConcert::loadReleasesFinished()
         QString msg = QString::fromUtf8(reply->readAll());
         parseAndAssignInfos(msg, concert, infos);
     } else {
-        qCWarning(generic) << "Network Error (releases)" << reply->errorString();
+        qCWarning(c_scraper_tmdb) << "Network Error (releases)" << reply->errorString();
     }
     concert->controller()->removeFromLoadsLeft(ScraperData::Releases);
 }
@@ -460,7 +460,7 @@ void TmdbConcert::parseAndAssignInfos(QString json, Concert* concert, QSet<Conce
     QJsonParseError parseError{};
     const auto parsedJson = QJsonDocument::fromJson(json.toUtf8(), &parseError).object();
     if (parseError.error != QJsonParseError::NoError) {
-        qCWarning(generic) << "Error parsing concert info json " << parseError.errorString();
+        qCWarning(c_scraper_tmdb) << "Error parsing concert info json " << parseError.errorString();
         return;
     }
 
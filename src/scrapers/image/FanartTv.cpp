@@ -304,7 +304,7 @@ void FanartTv::loadMovieData(TmdbId tmdbId, ImageType type)
     QUrl url = QStringLiteral("https://webservice.fanart.tv/v3/movies/%1?%2").arg(tmdbId.toString(), keyParameter());
     QNetworkRequest request = mediaelch::network::jsonRequestWithDefaults(url);
 
-    qCDebug(generic) << "[FanartTv] Load movie data:" << url;
+    qCDebug(c_scraper_fanarttv) << "[FanartTv] Load movie data:" << url;
 
     QNetworkReply* reply = network()->get(request);
     reply->setProperty("infoToLoad", static_cast<int>(type));
@@ -316,8 +316,8 @@ void FanartTv::loadMovieData(TmdbId tmdbId, QSet<ImageType> types, Movie* movie)
     QUrl url = QStringLiteral("https://webservice.fanart.tv/v3/movies/%1?%2").arg(tmdbId.toString(), keyParameter());
     QNetworkRequest request = mediaelch::network::jsonRequestWithDefaults(url);
 
-    qCDebug(generic) << "[FanartTv] Load movie data with image types:"
-                     << url.toString(QUrl::RemoveQuery); // query not relevant as it only contains the API key
+    // query not relevant as it only contains the API key
+    qCDebug(c_scraper_fanarttv) << "[FanartTv] Load movie data with image types:" << url.toString(QUrl::RemoveQuery);
 
     QNetworkReply* reply = network()->get(request);
     reply->setProperty("storage", QVariant::fromValue(movie));
@@ -330,7 +330,7 @@ void FanartTv::loadConcertData(TmdbId tmdbId, QSet<ImageType> types, Concert* co
     QUrl url = QStringLiteral("https://webservice.fanart.tv/v3/movies/%1?%2").arg(tmdbId.toString(), keyParameter());
     QNetworkRequest request = mediaelch::network::jsonRequestWithDefaults(url);
 
-    qCDebug(generic) << "[FanartTv] Load concert data with image types:" << url;
+    qCDebug(c_scraper_fanarttv) << "[FanartTv] Load concert data with image types:" << url;
 
     QNetworkReply* reply = network()->get(request);
     reply->setProperty("infosToLoad", QVariant::fromValue(types));
@@ -443,7 +443,7 @@ QVector<Poster> FanartTv::parseMovieData(QString json, ImageType type)
     const auto parsedJson = QJsonDocument::fromJson(json.toUtf8(), &parseError).object();
 
     if (parseError.error != QJsonParseError::NoError) {
-        qCWarning(generic) << "Error parsing fanart movie json " << parseError.errorString();
+        qCWarning(c_scraper_fanarttv) << "Error parsing fanart movie json " << parseError.errorString();
         return posters;
     }
 
@@ -733,7 +733,7 @@ QVector<Poster> FanartTv::parseTvShowData(QString json, ImageType type, SeasonNu
     const auto parsedJson = QJsonDocument::fromJson(json.toUtf8(), &parseError).object();
 
     if (parseError.error != QJsonParseError::NoError) {
-        qCWarning(generic) << "Error parsing fanart TV show json " << parseError.errorString();
+        qCWarning(c_scraper_fanarttv) << "Error parsing fanart TV show json " << parseError.errorString();
         return posters;
     }
 
@@ -161,7 +161,7 @@ void FanartTvMusic::onSearchArtistFinished()
     if (reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 302
         || reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 301) {
         QUrl url = reply->attribute(QNetworkRequest::RedirectionTargetAttribute).toUrl();
-        qCDebug(generic) << "[FanartTvMusic] Got redirect" << url;
+        qCDebug(c_scraper_fanarttv) << "[FanartTvMusic] Got redirect" << url;
         QNetworkRequest request = mediaelch::network::requestWithDefaults(url);
         reply = network()->getWithWatcher(request);
         connect(reply, &QNetworkReply::finished, this, &FanartTvMusic::onSearchArtistFinished);
@@ -292,7 +292,7 @@ QVector<Poster> FanartTvMusic::parseData(QString json, ImageType type) const
     const auto parsedJson = QJsonDocument::fromJson(json.toUtf8(), &parseError);
 
     if (parseError.error != QJsonParseError::NoError) {
-        qCWarning(generic) << "Error parsing fanart music json: " << parseError.errorString();
+        qCWarning(c_scraper_fanarttv) << "Error parsing fanart music json: " << parseError.errorString();
         return posters;
     }
 
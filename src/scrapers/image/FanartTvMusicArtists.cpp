@@ -168,7 +168,7 @@ QVector<Poster> FanartTvMusicArtists::parseData(QString json, ImageType type)
     const auto parsedJson = QJsonDocument::fromJson(json.toUtf8(), &parseError).object();
 
     if (parseError.error != QJsonParseError::NoError) {
-        qCWarning(generic) << "Error parsing fanart music json: " << parseError.errorString();
+        qCWarning(c_scraper_fanarttv) << "Error parsing fanart music json: " << parseError.errorString();
         return posters;
     }
 
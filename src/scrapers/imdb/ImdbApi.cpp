@@ -55,7 +55,8 @@ void ImdbApi::sendGetRequest(const Locale& locale, const QUrl& url, ImdbApi::Api
                 m_network.cache().addElement(request, html);
             }
         } else {
-            qCWarning(generic) << "[ImdbTv][Api] Network Error:" << reply->errorString() << "for URL" << reply->url();
+            qCWarning(c_scraper_imdb) << "[ImdbTv][Api] Network Error:" << reply->errorString() << "for URL"
+                                      << reply->url();
         }
 
         ScraperError error = makeScraperError(html, *reply, {});
@@ -2,147 +2,161 @@
 
 #include "data/movie/Movie.h"
 #include "globals/Helper.h"
+#include "scrapers/HtmlIndex.h"
 #include "scrapers/ScraperUtils.h"
 
 #include <QDate>
 #include <QRegularExpression>
 #include <QTextDocument>
 
-namespace mediaelch {
-namespace scraper {
+namespace {
+
+using mediaelch::scraper::HtmlIndex;
 
-QString ImdbReferencePage::extractTitle(const QString& html)
+/// Texts of all links inside of parent whose target starts with the given prefix, e.g. "/name/".
+QStringList linkTexts(const HtmlIndex& page, const HtmlIndex::Element& parent, const QString& hrefPrefix)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match;
+    QStringList texts;
+    for (const HtmlIndex::Element* link : page.descendants(parent, "a")) {
+        if (HtmlIndex::attribute(*link, "href").startsWith(hrefPrefix)) {
+            const QString text = page.innerHtml(*link);
+            if (!text.contains('<')) {
+                texts << text.trimmed();
+            }
+        }
+    }
+    return texts;
+}
 
-    rx.setPattern(R"(<h3 itemprop="name">\n([^<]+)<span)");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        return match.captured(1).trimmed();
+/// The value cell of a row in the reference page's overview tables, e.g.
+/// <td class="ipl-zebra-list__label">Genres</td>\n<td>...</td>
+const HtmlIndex::Element* cellAfterLabel(const HtmlIndex& page, const QString& label)
+{
+    for (const HtmlIndex::Element* cell : page.elementsByTag("td")) {
+        if (page.hasInnerHtml(*cell, label)) {
+            return page.nextElement(*cell, "td");
+        }
     }
-    return {};
+    return nullptr;
 }
 
-QString ImdbReferencePage::extractOriginalTitle(const QString& html)
+/// The list following a label such as "Directors:" in <div>Directors:\n<ul class="...">...</ul></div>
+const HtmlIndex::Element* listAfterLabel(const HtmlIndex& page, const QStringList& labels)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match;
+    for (const HtmlIndex::Element* list : page.elementsByTag("ul")) {
+        if (labels.contains(page.textBefore(*list))) {
+            return list;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
 
-    // Original Title
-    rx.setPattern(R"(</h3>\n([^\n]+)\n\s+<span class="titlereference-original-title)");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        return match.captured(1).trimmed();
+namespace mediaelch {
+namespace scraper {
+
+QString ImdbReferencePage::extractTitle(const HtmlIndex& page)
+{
+    // <h3 itemprop="name">\nTitle<span class="titlereference-title-year">...</span></h3>
+    for (const HtmlIndex::Element* element : page.elementsByAttribute("itemprop", "name")) {
+        if (element->tag == "h3") {
+            const QString content = page.innerHtml(*element);
+            return content.left(content.indexOf('<')).trimmed();
+        }
     }
     return {};
 }
 
-QDate ImdbReferencePage::extractReleaseDate(const QString& html)
+QString ImdbReferencePage::extractOriginalTitle(const HtmlIndex& page)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match;
-
-    rx.setPattern(R"(<a href="/title/tt\d+/releaseinfo">([^<]+)</a>)");
-    match = rx.match(html);
-
-    if (match.hasMatch()) {
-        // Date format, e.g. "09 Mar 1995 (Germany)"
-        rx.setPattern(R"( \(.+\))");
-        const QString dateStr = match.captured(1).remove(rx).trimmed();
-        // Qt::RFC2822Date is basically "dd MMM yyyy"
-        return QDate::fromString(dateStr, Qt::RFC2822Date);
+    // <h3 itemprop="name">...</h3>\nOriginal Title\n<span class="titlereference-original-title-label">
+    for (const HtmlIndex::Element* element : page.elementsByAttribute("itemprop", "name")) {
+        if (element->tag != "h3") {
+            continue;
+        }
+        const HtmlIndex::Element* label = page.nextElement(*element);
+        if (label == nullptr
+            || !HtmlIndex::attribute(*label, "class").startsWith("titlereference-original-title")) {
+            return {};
+        }
+        const QString title = page.html().mid(element->end, label->start - element->end).trimmed();
+        return title.contains('\n') ? QString() : title;
     }
     return {};
 }
 
-void ImdbReferencePage::extractStudios(Movie* movie, const QString& html)
+QDate ImdbReferencePage::extractReleaseDate(const HtmlIndex& page)
 {
-    QRegularExpression rx(R"(Production Companies</h4>.+<ul class="simpleList">(.+)</ul>)",
+    static const QRegularExpression countryRx(R"( \(.+\))",
         QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
 
-    const QRegularExpressionMatch match = rx.match(html);
-
-    if (match.hasMatch()) {
-        QString listHtml = match.captured(1);
-        rx.setPattern(R"(<a href="/company/[^"]+">([^<]+)</a>)");
-        QRegularExpressionMatchIterator matches = rx.globalMatch(listHtml);
-
-        while (matches.hasNext()) {
-            movie->addStudio(helper::mapStudio(matches.next().captured(1).trimmed()));
+    // <a href="/title/tt0096697/releaseinfo">09 Mar 1995 (Germany)</a>
+    for (const HtmlIndex::Element* link : page.elementsByTag("a")) {
+        const QString href = HtmlIndex::attribute(*link, "href");
+        if (!href.startsWith("/title/tt") || !href.endsWith("/releaseinfo")) {
+            continue;
+        }
+        QString dateStr = page.innerHtml(*link);
+        if (dateStr.contains('<')) {
+            continue;
         }
+        dateStr = dateStr.remove(countryRx).trimmed();
+        // Qt::RFC2822Date is basically "dd MMM yyyy"
+        return QDate::fromString(dateStr, Qt::RFC2822Date);
     }
+    return {};
 }
 
-void ImdbReferencePage::extractDirectors(Movie* movie, const QString& html)
+void ImdbReferencePage::extractStudios(Movie* movie, const HtmlIndex& page)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match;
-
-    // Note: Either "Director" or "Directors", depending on their number.
-    rx.setPattern(R"re(Directors?:\s?\n\s+<ul class="[^"]+">(.*)</ul>)re");
-    match = rx.match(html);
-    if (!match.hasMatch()) {
+    // <h4 ...>Production Companies</h4> ... <ul class="simpleList"><li><a href="/company/...">
+    for (const HtmlIndex::Element* header : page.elementsByTag("h4")) {
+        if (!page.hasInnerHtml(*header, "Production Companies")) {
+            continue;
+        }
+        for (const HtmlIndex::Element* list : page.elementsByClass("simpleList")) {
+            if (list->tag == "ul" && list->start >= header->end) {
+                for (const QString& studio : linkTexts(page, *list, "/company/")) {
+                    movie->addStudio(helper::mapStudio(studio));
+                }
+                return;
+            }
+        }
         return;
     }
+}
 
-    QString directorsBlock = match.captured(1);
-    QStringList directors;
-
-    rx.setPattern(R"re(href="/name/[^"]+">([^<]+)</a>)re");
-    QRegularExpressionMatchIterator matches = rx.globalMatch(directorsBlock);
-
-    while (matches.hasNext()) {
-        directors << matches.next().captured(1).trimmed();
+void ImdbReferencePage::extractDirectors(Movie* movie, const HtmlIndex& page)
+{
+    // Note: Either "Director" or "Directors", depending on their number.
+    const HtmlIndex::Element* list = listAfterLabel(page, {"Director:", "Directors:"});
+    if (list != nullptr) {
+        movie->setDirector(linkTexts(page, *list, "/name/").join(", "));
     }
-    movie->setDirector(directors.join(", "));
 }
 
-void ImdbReferencePage::extractWriters(Movie* movie, const QString& html)
+void ImdbReferencePage::extractWriters(Movie* movie, const HtmlIndex& page)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match;
-
     // Note: Either "Writer" or "Writers", depending on their number.
-    rx.setPattern(R"re(Writers?:\s?\n\s+<ul class="[^"]+">(.*)</ul>)re");
-    match = rx.match(html);
-    if (!match.hasMatch()) {
-        return;
+    const HtmlIndex::Element* list = listAfterLabel(page, {"Writer:", "Writers:"});
+    if (list != nullptr) {
+        movie->setWriter(linkTexts(page, *list, "/name/").join(", "));
     }
-
-    QString writersBlock = match.captured(1);
-    QStringList writers;
-
-    rx.setPattern(R"re(href="/name/[^"]+">([^<]+)</a>)re");
-    QRegularExpressionMatchIterator matches = rx.globalMatch(writersBlock);
-
-    while (matches.hasNext()) {
-        writers << matches.next().captured(1).trimmed();
-    }
-    movie->setWriter(writers.join(", "));
 }
 
-void ImdbReferencePage::extractCertification(Movie* movie, const QString& html)
+void ImdbReferencePage::extractCertification(Movie* movie, const HtmlIndex& page)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatchIterator matches;
-
     // TODO: There are also other countries, e.g. DE
-    rx.setPattern(R"rx(<a href="/search/title\?certificates=US%3A[^"]+">([^<]+)</a>)rx");
-    matches = rx.globalMatch(html);
-
     QStringList certifications;
 
-    while (matches.hasNext()) {
-        QRegularExpressionMatch match = matches.next();
-        const QStringList cert = match.captured(1).split(":");
-        if (cert.size() == 2) {
+    // <a href="/search/title?certificates=US%3APG">United States:PG</a>
+    for (const HtmlIndex::Element* link : page.elementsByTag("a")) {
+        if (!HtmlIndex::attribute(*link, "href").startsWith("/search/title?certificates=US%3A")) {
+            continue;
+        }
+        const QStringList cert = page.innerHtml(*link).split(":");
+        if (cert.size() == 2 && !cert.at(1).contains('<')) {
             certifications << cert.at(1);
         }
     }
@@ -154,147 +168,175 @@ void ImdbReferencePage::extractCertification(Movie* movie, const QString& html)
     }
 }
 
-void ImdbReferencePage::extractGenres(Movie* movie, const QString& html)
+void ImdbReferencePage::extractGenres(Movie* movie, const HtmlIndex& page)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match;
-
-    rx.setPattern(R"(Genres</td>\n\s+<td>(.+)</td>)");
-    match = rx.match(html);
-
-    if (match.hasMatch()) {
-        const QString genreHtmlList = match.captured(1);
-        rx.setPattern(R"(<a href="/genre/[^"]+">([^<]+)</a>)");
-        QRegularExpressionMatchIterator matches = rx.globalMatch(genreHtmlList);
-
-        while (matches.hasNext()) {
-            movie->addGenre(helper::mapGenre(matches.next().captured(1).trimmed()));
+    const HtmlIndex::Element* cell = cellAfterLabel(page, "Genres");
+    if (cell != nullptr) {
+        for (const QString& genre : linkTexts(page, *cell, "/genre/")) {
+            movie->addGenre(helper::mapGenre(genre));
         }
     }
 }
 
-void ImdbReferencePage::extractRating(Movie* movie, const QString& html)
+void ImdbReferencePage::extractRating(Movie* movie, const HtmlIndex& page)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
+    static const QRegularExpression ratingRx(R"re(^([0-9.,]+)$)re");
+    static const QRegularExpression votesRx(R"re(^\(([0-9,.]+)\)$)re");
+    static const QRegularExpression top250MovieRx(R"re(Top Rated Movies:? #([0-9]{1,3})$)re");
+    static const QRegularExpression top250TvRx(R"re(Top Rated TV:? #([0-9]{1,3})$)re");
+
     QRegularExpressionMatch match;
 
     Rating rating;
     rating.source = "imdb";
     rating.maxRating = 10;
 
-    rx.setPattern(R"re(<span class="ipl-rating-star__rating">([0-9.,]+)</span>)re");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        rating.rating = match.captured(1).trimmed().replace(",", ".").toDouble();
+    // <span class="ipl-rating-star__rating">8.2</span>
+    for (const HtmlIndex::Element* element : page.elementsByClass("ipl-rating-star__rating")) {
+        match = ratingRx.match(page.innerHtml(*element).trimmed());
+        if (match.hasMatch()) {
+            rating.rating = match.captured(1).replace(",", ".").toDouble();
+            break;
+        }
     }
-    rx.setPattern(R"re(<span class="ipl-rating-star__total-votes">\(([0-9,.]+)\)</span>)re");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        rating.voteCount = match.captured(1).trimmed().remove(",").remove(".").toInt();
+    // <span class="ipl-rating-star__total-votes">(1,234)</span>
+    for (const HtmlIndex::Element* element : page.elementsByClass("ipl-rating-star__total-votes")) {
+        match = votesRx.match(page.innerHtml(*element).trimmed());
+        if (match.hasMatch()) {
+            rating.voteCount = match.captured(1).remove(",").remove(".").toInt();
+            break;
+        }
     }
     if (rating.rating > 0 || rating.voteCount > 0) {
         movie->ratings().setOrAddRating(rating);
     }
 
-    // Top250 for movies
-    rx.setPattern("Top Rated Movies:? #([0-9]{1,3})</a>");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        movie->setTop250(match.captured(1).toInt());
+    // Top250 for movies and TV shows (used by TheTvDb), e.g. <a href="/chart/top">Top Rated Movies #12</a>
+    int top250Movie = 0;
+    int top250Tv = 0;
+    for (const HtmlIndex::Element* link : page.elementsByTag("a")) {
+        // Most links are names and titles.  Don't copy links that are too short or too long.
+        const int length = link->contentEnd - link->contentStart;
+        if (length < 16 || length > 64) {
+            continue;
+        }
+        const QString text = page.innerHtml(*link).trimmed();
+        if (!text.startsWith("Top Rated")) {
+            continue;
+        }
+        if (top250Movie == 0 && (match = top250MovieRx.match(text)).hasMatch()) {
+            top250Movie = match.captured(1).toInt();
+        } else if (top250Tv == 0 && (match = top250TvRx.match(text)).hasMatch()) {
+            top250Tv = match.captured(1).toInt();
+        }
     }
-    // Top250 for TV shows (used by TheTvDb)
-    rx.setPattern("Top Rated TV:? #([0-9]{1,3})\\n</a>");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        movie->setTop250(match.captured(1).toInt());
+    if (top250Movie > 0) {
+        movie->setTop250(top250Movie);
+    }
+    if (top250Tv > 0) {
+        movie->setTop250(top250Tv);
     }
 }
 
-void ImdbReferencePage::extractOverview(Movie* movie, const QString& html)
+void ImdbReferencePage::extractOverview(Movie* movie, const HtmlIndex& page)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match;
-
     // Outline --------------------------
 
-    rx.setPattern(R"(<section class="titlereference-section-overview">\n\s+<div>(.+)</div>)");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        const QString outline = match.captured(1).trimmed();
-        if (!outline.isEmpty()) {
-            movie->setOutline(removeHtmlEntities(outline));
+    // <section class="titlereference-section-overview">\n<div>Outline</div>
+    const auto sections = page.elementsByClass("titlereference-section-overview");
+    if (!sections.isEmpty()) {
+        const HtmlIndex::Element* div = page.firstDescendant(*sections.first(), "div");
+        if (div != nullptr) {
+            const QString outline = page.innerHtml(*div).trimmed();
+            if (!outline.isEmpty()) {
+                movie->setOutline(removeHtmlEntities(outline));
+            }
         }
     }
 
     // Overview --------------------------
 
-    rx.setPattern(R"(Plot Summary</td>\n\s+<td>\n\s+<p>(.+)<)");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        const QString overview = match.captured(1).trimmed();
+    // <td>Plot Summary</td>\n<td>\n<p>Overview<em class="ipl-pipe">...</p></td>
+    const HtmlIndex::Element* cell = cellAfterLabel(page, "Plot Summary");
+    const HtmlIndex::Element* paragraph = (cell != nullptr) ? page.firstDescendant(*cell, "p") : nullptr;
+    if (paragraph != nullptr) {
+        const QString content = page.innerHtml(*paragraph);
+        const QString overview = content.left(content.indexOf('<')).trimmed();
         if (!overview.isEmpty()) {
             movie->setOverview(removeHtmlEntities(overview));
         }
     }
 }
 
-void ImdbReferencePage::extractTaglines(Movie* movie, const QString& html)
+void ImdbReferencePage::extractTaglines(Movie* movie, const HtmlIndex& page)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match;
-
-    rx.setPattern(R"(Taglines</td>\n\s+<td>(.*)<a href)");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        const QString tagline = match.captured(1).trimmed();
+    // <td>Taglines</td>\n<td>Tagline<a href="/title/tt.../taglines">See more</a></td>
+    const HtmlIndex::Element* cell = cellAfterLabel(page, "Taglines");
+    if (cell == nullptr) {
+        return;
+    }
+    const QString content = page.innerHtml(*cell);
+    const elch_ssize_t linkStart = content.indexOf("<a href");
+    if (linkStart != -1) {
+        const QString tagline = content.left(linkStart).trimmed();
         if (!tagline.isEmpty()) {
             movie->setTagline(tagline);
         }
     }
 }
 
-void ImdbReferencePage::extractTags(Movie* movie, const QString& html)
+void ImdbReferencePage::extractTags(Movie* movie, const HtmlIndex& page)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match;
+    const HtmlIndex::Element* cell = cellAfterLabel(page, "Plot Keywords");
+    if (cell == nullptr) {
+        return;
+    }
+    for (const QString& tag : linkTexts(page, *cell, "/keyword/")) {
+        if (!tag.isEmpty()) {
+            movie->addTag(tag);
+        }
+    }
+}
 
-    rx.setPattern(R"(Plot Keywords</td>\n\s+<td>(.*)</ul>)");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        const QString tagsHtml = match.captured(1);
-        rx.setPattern(R"(<a href="/keyword/[^"]+">([^<]+)</a>)");
-        QRegularExpressionMatchIterator tagMatches = rx.globalMatch(tagsHtml);
-
-        while (tagMatches.hasNext()) {
-            const QString tag = tagMatches.next().captured(1).trimmed();
-            if (!tag.isEmpty()) {
-                movie->addTag(tag);
-            }
+void ImdbReferencePage::extractCountries(Movie* movie, const HtmlIndex& page)
+{
+    const HtmlIndex::Element* cell = cellAfterLabel(page, "Country");
+    if (cell != nullptr) {
+        for (const QString& country : linkTexts(page, *cell, "/country/")) {
+            movie->addCountry(helper::mapCountry(country));
         }
     }
 }
 
-void ImdbReferencePage::extractCountries(Movie* movie, const QString& html)
+std::chrono::minutes ImdbReferencePage::extractRuntime(const HtmlIndex& page)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match;
+    static const QRegularExpression runtimeRx(R"re(^(\d+) min)re");
+    static const QRegularExpression runtimeTimeRx(R"re(^PT([0-9]+)M$)re");
+
+    // Reference page: <td>Runtime</td>\n<td><ul><li class="ipl-inline-list__item">\n 90 min\n</li>
+    const HtmlIndex::Element* cell = cellAfterLabel(page, "Runtime");
+    const HtmlIndex::Element* item = (cell != nullptr) ? page.firstDescendant(*cell, "li") : nullptr;
+    if (item != nullptr) {
+        const QRegularExpressionMatch match = runtimeRx.match(page.innerHtml(*item).trimmed());
+        if (match.hasMatch()) {
+            return std::chrono::minutes(match.captured(1).toInt());
+        }
+    }
 
-    rx.setPattern(R"(Country</td>(.*)</ul>)");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        const QString content = match.captured(1);
-        rx.setPattern(R"(<a href="/country/[^"]+">([^<]+)</a>)");
-        QRegularExpressionMatchIterator countryMatches = rx.globalMatch(content);
-        while (countryMatches.hasNext()) {
-            movie->addCountry(helper::mapCountry(countryMatches.next().captured(1).trimmed()));
+    // Old layout: <h4 class="inline">Runtime:</h4> <time datetime="PT90M">
+    for (const HtmlIndex::Element* header : page.elementsByTag("h4")) {
+        if (!page.hasInnerHtml(*header, "Runtime:")) {
+            continue;
+        }
+        const HtmlIndex::Element* time = page.nextElement(*header);
+        if (time != nullptr && time->tag == "time") {
+            const QRegularExpressionMatch match = runtimeTimeRx.match(HtmlIndex::attribute(*time, "datetime"));
+            if (match.hasMatch()) {
+                return std::chrono::minutes(match.captured(1).toInt());
+            }
         }
     }
+    return std::chrono::minutes(0);
 }
 
 } // namespace scraper
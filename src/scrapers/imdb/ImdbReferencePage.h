@@ -2,32 +2,41 @@
 
 #include <QDate>
 #include <QString>
+#include <chrono>
 
 class Movie;
 
 namespace mediaelch {
 namespace scraper {
 
+class HtmlIndex;
+
+/// \brief Extractors for IMDb's reference pages, e.g. https://www.imdb.com/title/tt0096697/reference
+///
+/// All extractors work on the same HtmlIndex, so that the page is only tokenized once.
+/// They look up labels and elements in the index and never scan the whole page.
 class ImdbReferencePage
 {
 public:
     /// Extract the release date from the given reference page.
     /// If no release date can be extracted, an invalid QDate is returned.
-    static QDate extractReleaseDate(const QString& html);
-
-    static QString extractTitle(const QString& html);
-    static QString extractOriginalTitle(const QString& html);
-
-    static void extractStudios(Movie* movie, const QString& html);
-    static void extractDirectors(Movie* movie, const QString& html);
-    static void extractWriters(Movie* movie, const QString& html);
-    static void extractCertification(Movie* movie, const QString& html);
-    static void extractGenres(Movie* movie, const QString& html);
-    static void extractRating(Movie* movie, const QString& html);
-    static void extractOverview(Movie* movie, const QString& html);
-    static void extractTaglines(Movie* movie, const QString& html);
-    static void extractTags(Movie* movie, const QString& html);
-    static void extractCountries(Movie* movie, const QString& html);
+    static QDate extractReleaseDate(const HtmlIndex& page);
+
+    static QString extractTitle(const HtmlIndex& page);
+    static QString extractOriginalTitle(const HtmlIndex& page);
+
+    static void extractStudios(Movie* movie, const HtmlIndex& page);
+    static void extractDirectors(Movie* movie, const HtmlIndex& page);
+    static void extractWriters(Movie* movie, const HtmlIndex& page);
+    static void extractCertification(Movie* movie, const HtmlIndex& page);
+    static void extractGenres(Movie* movie, const HtmlIndex& page);
+    static void extractRating(Movie* movie, const HtmlIndex& page);
+    static void extractOverview(Movie* movie, const HtmlIndex& page);
+    static void extractTaglines(Movie* movie, const HtmlIndex& page);
+    static void extractTags(Movie* movie, const HtmlIndex& page);
+    static void extractCountries(Movie* movie, const HtmlIndex& page);
+    /// Extract the runtime or return 0 minutes if the page contains none.
+    static std::chrono::minutes extractRuntime(const HtmlIndex& page);
 };
 
 } // namespace scraper
@@ -24,7 +24,7 @@ void copyDetailToMovie(Movie& target,
 
     switch (detail) {
     case MovieScraperInfo::Invalid: {
-        qCCritical(generic) << "[MovieMerger] Cannot copy details 'invalid'";
+        qCCritical(c_scraper) << "[MovieMerger] Cannot copy details 'invalid'";
         break;
     }
     case MovieScraperInfo::Title: {
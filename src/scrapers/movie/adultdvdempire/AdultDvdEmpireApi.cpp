@@ -37,8 +37,8 @@ void AdultDvdEmpireApi::sendGetRequest(const QUrl& url, AdultDvdEmpireApi::ApiCa
             data = QString::fromUtf8(reply->readAll());
 
         } else {
-            qCWarning(generic) << "[AdultDvdEmpireApi] Network Error:" << reply->errorString() << "for URL"
-                               << reply->url();
+            qCWarning(c_scraper_adultdvdempire) << "[AdultDvdEmpireApi] Network Error:" << reply->errorString()
+                                                << "for URL" << reply->url();
         }
 
         if (!data.isEmpty()) {
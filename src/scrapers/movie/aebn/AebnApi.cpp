@@ -34,7 +34,8 @@ void AebnApi::sendGetRequest(const QUrl& url, const Locale& locale, AebnApi::Api
             data = QString::fromUtf8(reply->readAll());
 
         } else {
-            qCWarning(generic) << "[AebnApi] Network Error:" << reply->errorString() << "for URL" << reply->url();
+            qCWarning(c_scraper_aebn) << "[AebnApi] Network Error:" << reply->errorString() << "for URL"
+                                      << reply->url();
         }
 
         if (!data.isEmpty()) {
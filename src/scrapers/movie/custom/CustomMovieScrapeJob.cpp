@@ -1,10 +1,13 @@
 #include "scrapers/movie/custom/CustomMovieScrapeJob.h"
 
 #include "data/movie/Movie.h"
+#include "log/Log.h"
 #include "scrapers/movie/MovieMerger.h"
 #include "scrapers/movie/MovieScraper.h"
 #include "settings/Settings.h"
 
+#include <QStringList>
+
 namespace {
 
 static QSet<MovieScraperInfo> combineScraperDetails(
@@ -28,6 +31,8 @@ CustomMovieScrapeJob::CustomMovieScrapeJob(CustomScraperConfig _config, QObject*
         parent),
     m_customScraperConfig{std::move(_config)}
 {
+    m_deadlineTimer.setSingleShot(true);
+    connect(&m_deadlineTimer, &QTimer::timeout, this, &CustomMovieScrapeJob::onDeadlineReached);
 }
 
 void CustomMovieScrapeJob::doStart()
@@ -37,16 +42,33 @@ void CustomMovieScrapeJob::doStart()
         return;
     }
 
+    m_elapsed.start();
+
+    // All scrapers are started at once. Without a deadline, the slowest one determines how long we wait.
     for (auto i = m_customScraperConfig.scraperMap.begin(); i != m_customScraperConfig.scraperMap.end(); ++i) {
+        SourceTiming timing;
+        timing.scraperId = i.key()->meta().identifier;
+
         MovieScrapeJob* job = i.key()->loadMovie(i.value());
         connect(job, &MovieScrapeJob::loadFinished, this, &CustomMovieScrapeJob::onScraperFinished);
+        m_timingIndex.insert(job, qsizetype_to_int(m_timings.size()));
+        m_timings.append(timing);
         m_jobs.push_back(job);
         job->start();
     }
+
+    if (m_customScraperConfig.deadline.count() > 0) {
+        m_deadlineTimer.start(static_cast<int>(m_customScraperConfig.deadline.count()));
+    }
 }
 
 void CustomMovieScrapeJob::onScraperFinished(MovieScrapeJob* scrapeJob)
 {
+    SourceTiming& timing = m_timings[m_timingIndex.value(scrapeJob)];
+    timing.elapsedMs = m_elapsed.elapsed();
+    timing.finished = true;
+    timing.hasError = scrapeJob->hasError();
+
     copyDetailsToMovie(*m_movie,
         scrapeJob->movie(),
         scrapeJob->config().details,
@@ -57,10 +79,51 @@ void CustomMovieScrapeJob::onScraperFinished(MovieScrapeJob* scrapeJob)
     const bool isRemoved = m_jobs.removeOne(scrapeJob);
     // If it does not exist, we have either multiple signals for the same job or other bugs.
     MediaElch_Assert(isRemoved);
+    m_timingIndex.remove(scrapeJob);
 
     if (m_jobs.isEmpty()) {
-        emitFinished();
+        finish();
+    }
+}
+
+void CustomMovieScrapeJob::onDeadlineReached()
+{
+    if (m_jobs.isEmpty()) {
+        return;
+    }
+
+    QStringList missing;
+    for (MovieScrapeJob* job : asConst(m_jobs)) {
+        // Scrape jobs can't be killed and are not auto-deleted. Let them finish in the
+        // background; they are owned by their scraper, so delete them once they're done.
+        disconnect(job, &MovieScrapeJob::loadFinished, this, &CustomMovieScrapeJob::onScraperFinished);
+        connect(job, &worker::Job::finished, job, &QObject::deleteLater);
+        SourceTiming& timing = m_timings[m_timingIndex.value(job)];
+        timing.elapsedMs = m_elapsed.elapsed();
+        missing << timing.scraperId;
+    }
+    m_jobs.clear();
+    m_timingIndex.clear();
+
+    ScraperError error;
+    error.error = ScraperError::Type::NetworkError;
+    error.message = tr("Some scrapers did not respond in time. Their details were not loaded: %1")
+                        .arg(missing.join(QStringLiteral(", ")));
+    error.technical = QStringLiteral("Deadline of %1ms reached").arg(m_customScraperConfig.deadline.count());
+    setScraperError(error);
+
+    finish();
+}
+
+void CustomMovieScrapeJob::finish()
+{
+    m_deadlineTimer.stop();
+    for (const SourceTiming& timing : asConst(m_timings)) {
+        const char* status = !timing.finished ? "(deadline reached)" : (timing.hasError ? "(with errors)" : "");
+        qCInfo(c_scraper_custom) << "[CustomMovieScrapeJob]" << timing.scraperId << "took" << timing.elapsedMs << "ms"
+                                 << status;
     }
+    emitFinished();
 }
 
 } // namespace scraper
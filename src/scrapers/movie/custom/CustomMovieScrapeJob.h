@@ -3,9 +3,12 @@
 #include "scrapers/ScraperInfos.h"
 #include "scrapers/movie/MovieScrapeJob.h"
 
+#include <QElapsedTimer>
 #include <QHash>
 #include <QMap>
+#include <QTimer>
 #include <QVector>
+#include <chrono>
 
 namespace mediaelch {
 namespace scraper {
@@ -21,6 +24,19 @@ public:
     {
         /// \brief Actual custom scraper configuration.
         QHash<MovieScraper*, MovieScrapeJob::Config> scraperMap;
+        /// \brief   Time after which the job stops waiting for scrapers.
+        /// \details Details of scrapers that have finished until then are used.
+        ///          Zero means that there is no deadline.
+        std::chrono::milliseconds deadline{0};
+    };
+
+    /// \brief Latency of a single scraper of the custom movie scraper.
+    struct SourceTiming
+    {
+        QString scraperId;
+        qint64 elapsedMs = 0;
+        bool finished = false;
+        bool hasError = false;
     };
 
 public:
@@ -29,16 +45,29 @@ public:
 
     void doStart() override;
 
+    /// \brief Timings of all scrapers. Scrapers that missed the deadline are not finished.
+    ELCH_NODISCARD const QVector<SourceTiming>& sourceTimings() const { return m_timings; }
+
 private slots:
     /// \brief   Signal handler when a sub-scraper is finished.
     /// \details The custom movie scraper only dispatches loading to other
     ///          scrapers.  If one of them is finished, this slot is called.
     ///          If all scrapers are finished, loadFinished() is emitted.
     void onScraperFinished(mediaelch::scraper::MovieScrapeJob* scrapeJob);
+    /// \brief Stops waiting for the remaining scrapers and finishes with the details loaded so far.
+    void onDeadlineReached();
+
+private:
+    void finish();
 
 private:
     CustomScraperConfig m_customScraperConfig;
     QVector<MovieScrapeJob*> m_jobs;
+    /// Index into m_timings for each running job.
+    QHash<MovieScrapeJob*, int> m_timingIndex;
+    QVector<SourceTiming> m_timings;
+    QElapsedTimer m_elapsed;
+    QTimer m_deadlineTimer;
 };
 
 } // namespace scraper
@@ -107,6 +107,7 @@ MovieScrapeJob* CustomMovieScraper::loadMovie(MovieScrapeJob::Config config)
 
     CustomMovieScrapeJob::CustomScraperConfig scraperConfig;
     scraperConfig.scraperMap = scraperMap;
+    scraperConfig.deadline = std::chrono::seconds(Settings::instance()->advanced()->customMovieScraperDeadline());
 
     return new CustomMovieScrapeJob(scraperConfig, this);
 }
@@ -181,8 +182,8 @@ QVector<MovieScraper*> CustomMovieScraper::scrapersNeedSearch(const QSet<MovieSc
             // Some details such as images aren't loaded from movie scrapers directly, hence
             // the list above.  But if it's missing for some other detail, we should log it.
             // The UI shouldn't allow scraping details that don't have a scraper set in the UI.
-            qCDebug(generic) << "[CustomerMovieScraper] Missing scraper for detail:"
-                             << movieScraperDetailToString(detail);
+            qCDebug(c_scraper_custom) << "[CustomerMovieScraper] Missing scraper for detail:"
+                                      << movieScraperDetailToString(detail);
         }
     }
 
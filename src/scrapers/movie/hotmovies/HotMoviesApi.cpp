@@ -34,7 +34,8 @@ void HotMoviesApi::sendGetRequest(const QUrl& url, HotMoviesApi::ApiCallback cal
             data = QString::fromUtf8(reply->readAll());
 
         } else {
-            qCWarning(generic) << "[HotMoviesApi] Network Error:" << reply->errorString() << "for URL" << reply->url();
+            qCWarning(c_scraper_hotmovies) << "[HotMoviesApi] Network Error:" << reply->errorString() << "for URL"
+                                           << reply->url();
         }
 
         if (!data.isEmpty()) {
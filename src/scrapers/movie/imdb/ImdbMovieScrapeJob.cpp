@@ -3,6 +3,7 @@
 #include "globals/Helper.h"
 #include "log/Log.h"
 #include "network/NetworkRequest.h"
+#include "scrapers/HtmlIndex.h"
 #include "scrapers/imdb/ImdbApi.h"
 #include "scrapers/imdb/ImdbReferencePage.h"
 #include "scrapers/movie/imdb/ImdbMovie.h"
@@ -35,9 +36,10 @@ void ImdbMovieScrapeJob::doStart()
             return;
         }
 
-        parseAndAssignInfos(html);
-        parseAndAssignPoster(html);
-        parseAndStoreActors(html);
+        const HtmlIndex page(html);
+        parseAndAssignInfos(page);
+        parseAndAssignPoster(page);
+        parseAndStoreActors(page);
 
         // How many pages do we have to download? Count them.
         m_itemsLeftToDownloads = 1;
@@ -67,111 +69,103 @@ void ImdbMovieScrapeJob::loadTags()
     m_api.loadTitle(config().locale, m_imdbId, ImdbApi::PageKind::Keywords, cb);
 }
 
-void ImdbMovieScrapeJob::parseAndAssignInfos(const QString& html)
+void ImdbMovieScrapeJob::parseAndAssignInfos(const HtmlIndex& page)
 {
-    using namespace std::chrono;
-
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match;
-
-    const QString title = ImdbReferencePage::extractTitle(html);
+    const QString title = ImdbReferencePage::extractTitle(page);
     if (!title.isEmpty()) {
         m_movie->setName(title);
     }
-    const QString originalTitle = ImdbReferencePage::extractOriginalTitle(html);
+    const QString originalTitle = ImdbReferencePage::extractOriginalTitle(page);
     if (!originalTitle.isEmpty()) {
         m_movie->setOriginalName(originalTitle);
     }
 
-    ImdbReferencePage::extractDirectors(m_movie, html);
-    ImdbReferencePage::extractWriters(m_movie, html);
-    ImdbReferencePage::extractGenres(m_movie, html);
-    ImdbReferencePage::extractTaglines(m_movie, html);
+    ImdbReferencePage::extractDirectors(m_movie, page);
+    ImdbReferencePage::extractWriters(m_movie, page);
+    ImdbReferencePage::extractGenres(m_movie, page);
+    ImdbReferencePage::extractTaglines(m_movie, page);
 
     if (!m_loadAllTags) {
-        ImdbReferencePage::extractTags(m_movie, html);
+        ImdbReferencePage::extractTags(m_movie, page);
     }
 
-    QDate date = ImdbReferencePage::extractReleaseDate(html);
+    QDate date = ImdbReferencePage::extractReleaseDate(page);
     if (date.isValid()) {
         m_movie->setReleased(date);
     }
 
-    ImdbReferencePage::extractCertification(m_movie, html);
-
-    rx.setPattern(R"re(Runtime</td>.*<li class="ipl-inline-list__item">\n\s+(\d+) min)re");
-    match = rx.match(html);
+    ImdbReferencePage::extractCertification(m_movie, page);
 
-    if (match.hasMatch()) {
-        minutes runtime = minutes(match.captured(1).toInt());
+    const std::chrono::minutes runtime = ImdbReferencePage::extractRuntime(page);
+    if (runtime.count() > 0) {
         m_movie->setRuntime(runtime);
     }
 
-    rx.setPattern(R"(<h4 class="inline">Runtime:</h4>[^<]*<time datetime="PT([0-9]+)M">)");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        m_movie->setRuntime(minutes(match.captured(1).toInt()));
-    }
-
-    ImdbReferencePage::extractOverview(m_movie, html);
-    ImdbReferencePage::extractRating(m_movie, html);
-    ImdbReferencePage::extractStudios(m_movie, html);
-    ImdbReferencePage::extractCountries(m_movie, html);
+    ImdbReferencePage::extractOverview(m_movie, page);
+    ImdbReferencePage::extractRating(m_movie, page);
+    ImdbReferencePage::extractStudios(m_movie, page);
+    ImdbReferencePage::extractCountries(m_movie, page);
 }
 
-void ImdbMovieScrapeJob::parseAndStoreActors(const QString& html)
+void ImdbMovieScrapeJob::parseAndStoreActors(const HtmlIndex& page)
 {
-    QRegularExpression rx(R"(<table class="cast_list">(.*)</table>)",
+    static const QRegularExpression rowRx(R"(<tr class="[^"]*">(.*)</tr>)",
+        QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
+    static const QRegularExpression nameRx(R"re(<span class="itemprop" itemprop="name">([^<]+)</span>)re",
         QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    QRegularExpressionMatch match = rx.match(html);
-    if (!match.hasMatch()) {
+    static const QRegularExpression urlRx(R"re(<a href="(/name/[^"]+)")re",
+        QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
+    static const QRegularExpression characterRx(R"(<td class="character">(.*)</td>)",
+        QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
+    static const QRegularExpression innerRx(
+        R"(>(.*)</)", QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
+    static const QRegularExpression spacesRx("\\s\\s+");
+    static const QRegularExpression thumbRx(R"re(loadlate="([^"]+)")re",
+        QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
+
+    // <table class="cast_list">
+    const auto tables = page.elementsByClass("cast_list");
+    if (tables.isEmpty()) {
         return;
     }
 
-    const QString content = match.captured(1);
-    rx.setPattern(R"(<tr class="[^"]*">(.*)</tr>)");
-
-    QRegularExpressionMatchIterator actorRowsMatch = rx.globalMatch(content);
+    const QString content = page.innerHtml(*tables.first());
+    QRegularExpressionMatchIterator actorRowsMatch = rowRx.globalMatch(content);
 
     while (actorRowsMatch.hasNext()) {
         QString actorHtml = actorRowsMatch.next().captured(1);
 
         QPair<Actor, QUrl> actorUrl;
+        QRegularExpressionMatch match;
 
         // Name
-        rx.setPattern(R"re(<span class="itemprop" itemprop="name">([^<]+)</span>)re");
-        match = rx.match(actorHtml);
+        match = nameRx.match(actorHtml);
         if (match.hasMatch()) {
             actorUrl.first.name = match.captured(1).trimmed();
         }
 
         // URL
-        rx.setPattern(R"re(<a href="(/name/[^"]+)")re");
-        match = rx.match(actorHtml);
+        match = urlRx.match(actorHtml);
         if (match.hasMatch()) {
             actorUrl.second = QUrl("https://www.imdb.com" + match.captured(1));
         }
 
         // Character
-        rx.setPattern(R"(<td class="character">(.*)</td>)");
-        match = rx.match(actorHtml);
+        match = characterRx.match(actorHtml);
         if (match.hasMatch()) {
             QString role = match.captured(1);
             // Everything between <div> and </div>
-            rx.setPattern(R"(>(.*)</)");
-            match = rx.match(role);
+            match = innerRx.match(role);
             if (match.hasMatch()) {
                 role = match.captured(1);
             }
             actorUrl.first.role = role.remove("(voice)")
                                       .trimmed() //
-                                      .replace(QRegularExpression("\\s\\s+"), " ")
+                                      .replace(spacesRx, " ")
                                       .trimmed();
         }
 
-        rx.setPattern(R"re(loadlate="([^"]+)")re");
-        match = rx.match(actorHtml);
+        match = thumbRx.match(actorHtml);
         if (match.hasMatch()) {
             actorUrl.first.thumb = sanitizeAmazonMediaUrl(match.captured(1));
         }
@@ -186,37 +180,38 @@ void ImdbMovieScrapeJob::parseAndStoreActors(const QString& html)
 
 void ImdbMovieScrapeJob::parseAndAssignTags(const QString& html)
 {
-    QRegularExpression rx;
-    rx.setPatternOptions(QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
-    if (m_loadAllTags) {
-        rx.setPattern(R"(<a[^>]+href="/search/keyword[^"]+"\n?>([^<]+)</a>)");
-    } else {
-        rx.setPattern(R"(<a[^>]+href="/keyword/[^"]+"[^>]*>([^<]+)</a>)");
-    }
+    static const QRegularExpression allTagsRx(R"(<a[^>]+href="/search/keyword[^"]+"\n?>([^<]+)</a>)",
+        QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
+    static const QRegularExpression tagsRx(R"(<a[^>]+href="/keyword/[^"]+"[^>]*>([^<]+)</a>)",
+        QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption);
 
-    QRegularExpressionMatchIterator match = rx.globalMatch(html);
+    QRegularExpressionMatchIterator match = (m_loadAllTags ? allTagsRx : tagsRx).globalMatch(html);
     while (match.hasNext()) {
         m_movie->addTag(match.next().captured(1).trimmed());
     }
 }
 
-void ImdbMovieScrapeJob::parseAndAssignPoster(const QString& html)
+void ImdbMovieScrapeJob::parseAndAssignPoster(const HtmlIndex& page)
 {
-    QString regex = QStringLiteral(R"url(<meta property='og:image' content="([^"]+)")url");
-    QRegularExpression rx(regex, QRegularExpression::InvertedGreedinessOption);
-
-    QRegularExpressionMatch match = rx.match(html);
-    if (match.hasMatch()) {
-        const QUrl url(sanitizeAmazonMediaUrl(match.captured(1)));
-        if (!url.isValid()) {
-            return;
-        }
+    // <meta property='og:image' content="https://m.media-amazon.com/images/M/...jpg">
+    const auto images = page.elementsByAttribute("property", "og:image");
+    if (images.isEmpty()) {
+        return;
+    }
 
-        Poster p;
-        p.thumbUrl = url;
-        p.originalUrl = url;
-        m_movie->images().addPoster(p);
+    const QString content = HtmlIndex::attribute(*images.first(), "content");
+    if (content.isEmpty()) {
+        return;
+    }
+    const QUrl url(sanitizeAmazonMediaUrl(content));
+    if (!url.isValid()) {
+        return;
     }
+
+    Poster p;
+    p.thumbUrl = url;
+    p.originalUrl = url;
+    m_movie->images().addPoster(p);
 }
 
 QString ImdbMovieScrapeJob::sanitizeAmazonMediaUrl(QString url)
@@ -225,10 +220,11 @@ QString ImdbMovieScrapeJob::sanitizeAmazonMediaUrl(QString url)
     //   https://m.media-amazon.com/images/M/<image ID>._V1_UY1400_CR90,0,630,1200_AL_.jpg
     // To get the original image, everything after `._V` can be removed.
 
+    static const QRegularExpression rx(R"re(._V([^/]+).jpg$)re", QRegularExpression::InvertedGreedinessOption);
+
     if (!url.endsWith(".jpg")) {
         return url;
     }
-    QRegularExpression rx(R"re(._V([^/]+).jpg$)re", QRegularExpression::InvertedGreedinessOption);
     url.replace(rx, ".jpg");
 
     return url;
@@ -8,6 +8,7 @@ namespace mediaelch {
 namespace scraper {
 
 class ImdbApi;
+class HtmlIndex;
 
 class ImdbMovieScrapeJob : public MovieScrapeJob
 {
@@ -21,9 +22,9 @@ public:
 private:
     void loadTags();
 
-    void parseAndAssignInfos(const QString& html);
-    void parseAndAssignPoster(const QString& html);
-    void parseAndStoreActors(const QString& html);
+    void parseAndAssignInfos(const HtmlIndex& page);
+    void parseAndAssignPoster(const HtmlIndex& page);
+    void parseAndStoreActors(const HtmlIndex& page);
     void parseAndAssignTags(const QString& html);
     QString sanitizeAmazonMediaUrl(QString url);
 
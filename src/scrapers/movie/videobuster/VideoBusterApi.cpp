@@ -34,8 +34,8 @@ void VideoBusterApi::sendGetRequest(const QUrl& url, VideoBusterApi::ApiCallback
             data = QString::fromUtf8(reply->readAll());
 
         } else {
-            qCWarning(generic) << "[VideoBusterApi] Network Error:" << reply->errorString() << "for URL"
-                               << reply->url();
+            qCWarning(c_scraper_videobuster) << "[VideoBusterApi] Network Error:" << reply->errorString() << "for URL"
+                                             << reply->url();
         }
 
         if (!data.isEmpty()) {
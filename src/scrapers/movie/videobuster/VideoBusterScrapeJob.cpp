@@ -32,7 +32,7 @@ void VideoBusterScrapeJob::doStart()
 
 void VideoBusterScrapeJob::parseAndAssignInfos(const QString& html)
 {
-    qCDebug(generic) << "[VideoBuster] Parse and assign movie details";
+    qCDebug(c_scraper_videobuster) << "[VideoBuster] Parse and assign movie details";
 
     QRegularExpression rx;
     rx.setPatternOptions(QRegularExpression::InvertedGreedinessOption | QRegularExpression::DotMatchesEverythingOption);
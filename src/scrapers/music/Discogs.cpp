@@ -77,7 +77,8 @@ void DiscogsApi::sendGetRequest(const QUrl& url, ApiCallback callback)
     connect(reply, &QNetworkReply::finished, this, [reply, cb = std::move(callback), request, this]() {
         auto dls = makeDeleteLaterScope(reply);
         if (reply->error() != QNetworkReply::NoError) {
-            qCWarning(generic) << "[Discogs][Api] Network Error:" << reply->errorString() << "for URL" << reply->url();
+            qCWarning(c_scraper_music) << "[Discogs][Api] Network Error:" << reply->errorString() << "for URL"
+                                       << reply->url();
             ScraperError error = makeScraperError(QString::fromUtf8(reply->readAll()), *reply, {});
             cb({}, error);
 
@@ -47,7 +47,8 @@ void MusicBrainzApi::sendGetRequest(const Locale& locale, const QUrl& url, Music
             data = QString::fromUtf8(reply->readAll());
 
         } else {
-            qCWarning(generic) << "[MusicBrainz] Network Error:" << reply->errorString() << "for URL" << reply->url();
+            qCWarning(c_scraper_music) << "[MusicBrainz] Network Error:" << reply->errorString() << "for URL"
+                                       << reply->url();
             // For debugging: << reply->readAll();
         }
 
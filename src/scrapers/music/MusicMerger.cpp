@@ -21,7 +21,7 @@ void copyDetailToArtist(Artist& target, const Artist& source, MusicScraperInfo d
 
     switch (detail) {
     case MusicScraperInfo::Invalid: {
-        qCCritical(generic) << "[ArtistMerger] Cannot copy details 'invalid'";
+        qCCritical(c_scraper_music) << "[ArtistMerger] Cannot copy details 'invalid'";
         break;
     }
     case MusicScraperInfo::Name:
@@ -97,7 +97,7 @@ void copyDetailToAlbum(Album& target, const Album& source, MusicScraperInfo deta
 
     switch (detail) {
     case MusicScraperInfo::Invalid: {
-        qCCritical(generic) << "[AlbumMerger] Cannot copy details 'invalid'";
+        qCCritical(c_scraper_music) << "[AlbumMerger] Cannot copy details 'invalid'";
         break;
     }
     case MusicScraperInfo::Title:
@@ -167,7 +167,7 @@ void copyDetailToArtistIfEmpty(Artist& target, const Artist& source, MusicScrape
 
     switch (detail) {
     case MusicScraperInfo::Invalid: {
-        qCCritical(generic) << "[ArtistMerger] Cannot copy details 'invalid'";
+        qCCritical(c_scraper_music) << "[ArtistMerger] Cannot copy details 'invalid'";
         break;
     }
     case MusicScraperInfo::Name:
@@ -243,7 +243,7 @@ void copyDetailToAlbumIfEmpty(Album& target, const Album& source, MusicScraperIn
 
     switch (detail) {
     case MusicScraperInfo::Invalid: {
-        qCCritical(generic) << "[AlbumMerger] Cannot copy details 'invalid'";
+        qCCritical(c_scraper_music) << "[AlbumMerger] Cannot copy details 'invalid'";
         break;
     }
     case MusicScraperInfo::Title:
@@ -40,7 +40,8 @@ void TheAudioDbApi::sendGetRequest(const Locale& locale, const QUrl& url, TheAud
             data = QString::fromUtf8(reply->readAll());
 
         } else {
-            qCWarning(generic) << "[MusicBrainz] Network Error:" << reply->errorString() << "for URL" << reply->url();
+            qCWarning(c_scraper_music) << "[MusicBrainz] Network Error:" << reply->errorString() << "for URL"
+                                       << reply->url();
         }
 
         if (!data.isEmpty()) {
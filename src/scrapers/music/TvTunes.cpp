@@ -17,7 +17,7 @@ TvTunes::TvTunes(QObject* parent) : QObject(parent)
 
 void TvTunes::search(QString searchStr)
 {
-    qCInfo(generic) << "[TvTunes] Search for show:" << searchStr;
+    qCInfo(c_scraper_music) << "[TvTunes] Search for show:" << searchStr;
 
     searchStr = searchStr.replace(" ", "+");
     searchStr = helper::urlEncode(searchStr);
@@ -39,7 +39,7 @@ void TvTunes::onSearchFinished()
     reply->deleteLater();
     QVector<ScraperSearchResult> results;
     if (reply->error() != QNetworkReply::NoError) {
-        qCWarning(generic) << "[TvTunes] Network Error:" << reply->errorString();
+        qCWarning(c_scraper_music) << "[TvTunes] Network Error:" << reply->errorString();
         emit sigSearchDone(results);
         return;
     }
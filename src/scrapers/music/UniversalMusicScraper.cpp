@@ -221,7 +221,8 @@ void UniversalArtistScrapeJob::onArtistLoadFinished()
     if (reply->error() == QNetworkReply::NoError) {
         m_artistDownloads[index].contents = QString::fromUtf8(reply->readAll());
     } else {
-        qCWarning(generic) << "[UniversalMusicScraper] Network Error while loading artist:" << reply->errorString();
+        qCWarning(c_scraper_music) << "[UniversalMusicScraper] Network Error while loading artist:"
+                                   << reply->errorString();
     }
     m_artistDownloads[index].downloaded = true;
     checkIfFinished();
@@ -284,7 +285,7 @@ void UniversalArtistScrapeJob::processDownloadElement(DownloadElement elem)
         QJsonParseError parseError{};
         const auto parsedJson = QJsonDocument::fromJson(elem.contents.toUtf8(), &parseError).object();
         if (parseError.error != QJsonParseError::NoError) {
-            qCWarning(generic) << "Error parsing music json: " << parseError.errorString();
+            qCWarning(c_scraper_music) << "Error parsing music json: " << parseError.errorString();
             return;
         }
 
@@ -425,7 +426,8 @@ void UniversalAlbumScrapeJob::onAlbumLoadFinished()
     if (reply->error() == QNetworkReply::NoError) {
         m_albumDownloads[index].contents = QString::fromUtf8(reply->readAll());
     } else {
-        qCWarning(generic) << "[UniversalMusicScraper] Network Error while loading album:" << reply->errorString();
+        qCWarning(c_scraper_music) << "[UniversalMusicScraper] Network Error while loading album:"
+                                   << reply->errorString();
     }
     m_albumDownloads[index].downloaded = true;
 
@@ -485,7 +487,7 @@ void UniversalAlbumScrapeJob::processDownloadElement(DownloadElement elem)
         QJsonParseError parseError{};
         const auto parsedJson = QJsonDocument::fromJson(elem.contents.toUtf8(), &parseError).object();
         if (parseError.error != QJsonParseError::NoError) {
-            qCWarning(generic) << "Error parsing music json: " << parseError.errorString();
+            qCWarning(c_scraper_music) << "Error parsing music json: " << parseError.errorString();
             return;
         }
 
@@ -37,7 +37,8 @@ void TmdbApi::initialize()
             m_config = TmdbApiConfiguration::from(QJsonDocument::fromJson(data.toUtf8()));
 
         } else {
-            qCWarning(generic) << "[TmdbApi] Network Error:" << reply->errorString() << "for URL" << reply->url();
+            qCWarning(c_scraper_tmdb) << "[TmdbApi] Network Error:" << reply->errorString() << "for URL"
+                                      << reply->url();
             m_isInitialized = false;
         }
 
@@ -79,7 +80,8 @@ void TmdbApi::sendGetRequest(const Locale& locale, const QUrl& url, TmdbApi::Api
             data = QString::fromUtf8(reply->readAll());
 
         } else {
-            qCWarning(generic) << "[TmdbApi] Network Error:" << reply->errorString() << "for URL" << reply->url();
+            qCWarning(c_scraper_tmdb) << "[TmdbApi] Network Error:" << reply->errorString() << "for URL"
+                                      << reply->url();
         }
 
         QJsonParseError parseError{};
@@ -123,6 +125,15 @@ void TmdbApi::loadEpisode(const Locale& locale,
     sendGetRequest(locale, getEpisodeUrl(showId, season, episode, locale), callback);
 }
 
+void TmdbApi::loadEpisodeExternalIds(const Locale& locale,
+    const TmdbId& showId,
+    SeasonNumber season,
+    EpisodeNumber episode,
+    ApiCallback callback)
+{
+    sendGetRequest(locale, getEpisodeExternalIdsUrl(showId, season, episode, locale), std::move(callback));
+}
+
 void TmdbApi::loadSeason(const Locale& locale,
     const TmdbId& showId,
     SeasonNumber season,
@@ -202,6 +213,16 @@ QUrl TmdbApi::getEpisodeUrl(const TmdbId& showId,
     return makeApiUrl(url, locale, queries);
 }
 
+QUrl TmdbApi::getEpisodeExternalIdsUrl(const TmdbId& showId,
+    SeasonNumber season,
+    EpisodeNumber episode,
+    const Locale& locale) const
+{
+    QString url = QStringLiteral("/tv/%1/season/%2/episode/%3/external_ids")
+                      .arg(showId.toString(), season.toString(), episode.toString());
+    return makeApiUrl(url, locale, {});
+}
+
 QUrl TmdbApi::getSeasonUrl(const TmdbId& showId, SeasonNumber season, const Locale& locale) const
 {
     QString url = QStringLiteral("/tv/%1/season/%2").arg(showId.toString(), season.toString());
@@ -250,7 +271,7 @@ QString TmdbApi::apiUrlParameterString(TmdbApi::ApiUrlParameter parameter) const
     case ApiUrlParameter::PAGE: return QStringLiteral("page");
     case ApiUrlParameter::INCLUDE_ADULT: return QStringLiteral("include_adult");
     }
-    qCCritical(generic) << "[TMDB] ApiUrlParameter: Unhandled enum case.";
+    qCCritical(c_scraper_tmdb) << "[TMDB] ApiUrlParameter: Unhandled enum case.";
     return QStringLiteral("unknown");
 }
 
@@ -83,6 +83,12 @@ public:
         SeasonNumber season,
         EpisodeNumber episode,
         ApiCallback callback);
+    /// \brief Load only the external IDs, e.g. IMDb and TheTvDb ID, of an episode.
+    void loadEpisodeExternalIds(const Locale& locale,
+        const TmdbId& showId,
+        SeasonNumber season,
+        EpisodeNumber episode,
+        ApiCallback callback);
     void loadSeason(const Locale& locale,
         const TmdbId& showId,
         SeasonNumber season,
@@ -105,6 +111,10 @@ private:
     QUrl getShowUrl(const TmdbId& id, const Locale& locale, bool onlyBasicDetails = false) const;
     QUrl getShowSearchUrl(const QString& searchStr, const Locale& locale, bool includeAdult) const;
     QUrl getEpisodeUrl(const TmdbId& showId, SeasonNumber season, EpisodeNumber episode, const Locale& locale) const;
+    QUrl getEpisodeExternalIdsUrl(const TmdbId& showId,
+        SeasonNumber season,
+        EpisodeNumber episode,
+        const Locale& locale) const;
     QUrl getSeasonUrl(const TmdbId& showId, SeasonNumber season, const Locale& locale) const;
 
 public:
@@ -0,0 +1,63 @@
+#include "scrapers/tv_show/BatchedEpisodeScrapeJob.h"
+
+#include "data/tv_show/TvShowEpisode.h"
+#include "log/Log.h"
+#include "scrapers/tv_show/SeasonBatcher.h"
+#include "scrapers/tv_show/ShowMerger.h"
+
+namespace mediaelch {
+namespace scraper {
+
+BatchedEpisodeScrapeJob::BatchedEpisodeScrapeJob(SeasonBatcher& batcher,
+    JobFactory fallback,
+    Config config,
+    QObject* parent) :
+    EpisodeScrapeJob(std::move(config), parent), m_batcher{batcher}, m_fallback{std::move(fallback)}
+{
+}
+
+void BatchedEpisodeScrapeJob::doStart()
+{
+    if (config().identifier.hasEpisodeIdentifier() || config().details.intersects(m_singleEpisodeDetails)) {
+        loadSingleEpisode();
+        return;
+    }
+
+    m_batcher.requestEpisode(config(), this, [this](const TvShowEpisode* seasonEpisode, ScraperError error) {
+        if (seasonEpisode == nullptr) {
+            qCDebug(c_scraper) << "[BatchedEpisodeScrapeJob] Episode not loaded with its season, load it on its own:"
+                               << config().identifier << error.message;
+            loadSingleEpisode();
+            return;
+        }
+        copyDetailsToEpisode(episode(), *seasonEpisode, config().details);
+        if (!m_completion) {
+            emitFinished();
+            return;
+        }
+        m_completion(config(), episode(), [this](ScraperError completionError) {
+            if (completionError.hasError()) {
+                setScraperError(completionError);
+            }
+            emitFinished();
+        });
+    });
+}
+
+void BatchedEpisodeScrapeJob::loadSingleEpisode()
+{
+    EpisodeScrapeJob* job = m_fallback(config());
+    connect(job, &EpisodeScrapeJob::loadFinished, this, [this](EpisodeScrapeJob* singleJob) {
+        if (singleJob->hasError()) {
+            setScraperError(singleJob->scraperError());
+        } else {
+            copyDetailsToEpisode(episode(), singleJob->episode(), config().details);
+        }
+        singleJob->deleteLater();
+        emitFinished();
+    });
+    job->start();
+}
+
+} // namespace scraper
+} // namespace mediaelch
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "scrapers/ScraperError.h"
+#include "scrapers/tv_show/EpisodeScrapeJob.h"
+
+#include <QSet>
+#include <functional>
+
+namespace mediaelch {
+namespace scraper {
+
+class SeasonBatcher;
+
+/// \brief Episode scrape job that loads the episode as part of its season.
+/// \details Requests for episodes of the same season are coalesced by the
+///          given SeasonBatcher. If the episode is identified by its own ID,
+///          if it is not part of the season's result or if details are requested
+///          that the season's result does not contain, the episode is loaded
+///          using a job that is created by the given factory.
+class BatchedEpisodeScrapeJob : public EpisodeScrapeJob
+{
+    Q_OBJECT
+
+public:
+    /// \brief Creates a scrape job that loads a single episode.
+    using JobFactory = std::function<EpisodeScrapeJob*(Config config)>;
+    /// \brief Loads details into the episode that the season's result does not contain, e.g. external IDs.
+    /// \details Must call \p done exactly once.
+    using Completion =
+        std::function<void(const Config& config, TvShowEpisode& episode, std::function<void(ScraperError)> done)>;
+
+public:
+    BatchedEpisodeScrapeJob(SeasonBatcher& batcher, JobFactory fallback, Config config, QObject* parent = nullptr);
+    ~BatchedEpisodeScrapeJob() override = default;
+
+    void doStart() override;
+
+    /// \brief Details that the season's result does not contain.  If any of them is
+    ///        requested, the episode is loaded on its own.
+    void setSingleEpisodeDetails(QSet<EpisodeScraperInfo> details) { m_singleEpisodeDetails = std::move(details); }
+    /// \brief Called after an episode was taken from its season's result.
+    void setCompletion(Completion completion) { m_completion = std::move(completion); }
+
+private:
+    void loadSingleEpisode();
+
+private:
+    SeasonBatcher& m_batcher;
+    JobFactory m_fallback;
+    QSet<EpisodeScraperInfo> m_singleEpisodeDetails;
+    Completion m_completion;
+};
+
+} // namespace scraper
+} // namespace mediaelch
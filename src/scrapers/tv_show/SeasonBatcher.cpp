@@ -0,0 +1,156 @@
+#include "scrapers/tv_show/SeasonBatcher.h"
+
+#include "data/tv_show/TvShowEpisode.h"
+#include "log/Log.h"
+#include "scrapers/tv_show/TvScraper.h"
+
+namespace mediaelch {
+namespace scraper {
+
+SeasonBatcher::SeasonBatcher(TvScraper& scraper, QObject* parent) : QObject(parent), m_scraper{scraper}
+{
+    m_cleanupTimer.setInterval(60 * 1000);
+    connect(&m_cleanupTimer, &QTimer::timeout, this, &SeasonBatcher::removeOldBatches);
+}
+
+void SeasonBatcher::requestEpisode(const EpisodeScrapeJob::Config& config, QObject* context, Callback callback)
+{
+    Request request;
+    request.episode = config.identifier.episodeNumber;
+    request.context = context;
+    request.callback = std::move(callback);
+
+    const QString key = batchKey(config);
+    auto batch = m_batches.find(key);
+
+    if (batch != m_batches.end()) {
+        if (batch->finishedTimer.isValid()) {
+            // The season was loaded shortly before. Answer asynchronously nonetheless,
+            // so that callers don't have to distinguish both cases.
+            QPointer<SeasonScrapeJob> job = batch->job;
+            QTimer::singleShot(0, context, [job, request]() {
+                if (job.isNull()) {
+                    request.callback(nullptr, {});
+                } else {
+                    answer(job, request);
+                }
+            });
+        } else {
+            batch->waiting.append(request);
+        }
+        return;
+    }
+
+    qCDebug(c_scraper) << "[SeasonBatcher] Load season" << config.identifier.seasonNumber
+                       << "for episode requests of show" << config.identifier.showIdentifier;
+
+    // Always load all details: Later requests may ask for other details than the first one.
+    SeasonScrapeJob::Config seasonConfig(ShowIdentifier(config.identifier.showIdentifier),
+        config.locale,
+        {config.identifier.seasonNumber},
+        config.identifier.seasonOrder,
+        m_scraper.meta().supportedEpisodeDetails);
+
+    Batch newBatch;
+    newBatch.job = m_scraper.loadSeasons(seasonConfig);
+    newBatch.job->setAutoDelete(false);
+    newBatch.waiting.append(request);
+    m_batches.insert(key, newBatch);
+
+    connect(newBatch.job, &SeasonScrapeJob::loadFinished, this, [this, key](SeasonScrapeJob* job) {
+        onSeasonLoaded(key, job);
+    });
+    newBatch.job->start();
+}
+
+void SeasonBatcher::clear()
+{
+    for (auto batch = m_batches.begin(); batch != m_batches.end();) {
+        if (batch->finishedTimer.isValid()) {
+            batch->job->deleteLater();
+            batch = m_batches.erase(batch);
+        } else {
+            ++batch;
+        }
+    }
+    if (m_batches.isEmpty()) {
+        m_cleanupTimer.stop();
+    }
+}
+
+QString SeasonBatcher::batchKey(const EpisodeScrapeJob::Config& config)
+{
+    const EpisodeIdentifier& id = config.identifier;
+    return QStringLiteral("%1/%2/%3/%4")
+        .arg(id.showIdentifier,
+            id.seasonNumber.toString(),
+            QString::number(static_cast<int>(id.seasonOrder)),
+            config.locale.toString());
+}
+
+void SeasonBatcher::onSeasonLoaded(const QString& key, SeasonScrapeJob* job)
+{
+    auto batch = m_batches.find(key);
+    if (batch == m_batches.end() || batch->job != job) {
+        job->deleteLater();
+        return;
+    }
+
+    const QVector<Request> waiting = batch->waiting;
+    batch->waiting.clear();
+
+    if (job->hasError()) {
+        // Don't keep failed requests. The next request may succeed.
+        m_batches.erase(batch);
+        for (const Request& request : waiting) {
+            if (!request.context.isNull()) {
+                request.callback(nullptr, job->scraperError());
+            }
+        }
+        job->deleteLater();
+        return;
+    }
+
+    qCDebug(c_scraper) << "[SeasonBatcher] Answering" << waiting.size() << "episode requests with season"
+                       << job->config().seasons.values() << "of show" << job->config().showIdentifier;
+
+    batch->finishedTimer.start();
+    if (!m_cleanupTimer.isActive()) {
+        m_cleanupTimer.start();
+    }
+
+    for (const Request& request : waiting) {
+        if (!request.context.isNull()) {
+            answer(job, request);
+        }
+    }
+}
+
+void SeasonBatcher::answer(SeasonScrapeJob* job, const Request& request)
+{
+    const SeasonNumber season = *job->config().seasons.constBegin();
+    const auto episode = job->episodes().constFind({season, request.episode});
+    if (episode == job->episodes().constEnd()) {
+        request.callback(nullptr, {});
+    } else {
+        request.callback(episode.value(), {});
+    }
+}
+
+void SeasonBatcher::removeOldBatches()
+{
+    for (auto batch = m_batches.begin(); batch != m_batches.end();) {
+        if (batch->finishedTimer.isValid() && batch->finishedTimer.hasExpired(timeoutSeconds * 1000)) {
+            batch->job->deleteLater();
+            batch = m_batches.erase(batch);
+        } else {
+            ++batch;
+        }
+    }
+    if (m_batches.isEmpty()) {
+        m_cleanupTimer.stop();
+    }
+}
+
+} // namespace scraper
+} // namespace mediaelch
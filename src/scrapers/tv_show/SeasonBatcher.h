@@ -0,0 +1,90 @@
+#pragma once
+
+#include "scrapers/ScraperError.h"
+#include "scrapers/tv_show/EpisodeScrapeJob.h"
+#include "scrapers/tv_show/SeasonScrapeJob.h"
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <QVector>
+#include <functional>
+
+class TvShowEpisode;
+
+namespace mediaelch {
+namespace scraper {
+
+class TvScraper;
+
+/// \brief Coalesces episode requests of the same season into a single season request.
+///
+/// Scraping all episodes of a season one by one results in one request per episode.
+/// Most scrapers return all episodes of a season in one response, though.
+/// The batcher loads the whole season once using TvScraper::loadSeasons() and
+/// answers all episode requests of that season from its result.
+///
+/// Episodes are usually scraped one after another, e.g. in the multi-scrape dialog.
+/// That's why finished seasons are kept for a few minutes, similar to
+/// network::WebsiteCache.  Failed season requests are not kept.
+///
+/// \code{cpp}
+///   m_batcher.requestEpisode(config, this, [this](const TvShowEpisode* episode, ScraperError error) {
+///       if (episode == nullptr) { /* load the episode on its own */ }
+///   });
+/// \endcode
+class SeasonBatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// \brief Called with the season's episode or nullptr if the season could not be
+    ///        loaded or does not contain the episode.  The episode is owned by the batcher.
+    using Callback = std::function<void(const TvShowEpisode* episode, ScraperError error)>;
+
+    /// Time in seconds that finished seasons are kept.
+    static constexpr int timeoutSeconds = 240;
+
+public:
+    explicit SeasonBatcher(TvScraper& scraper, QObject* parent = nullptr);
+    ~SeasonBatcher() override = default;
+
+    /// \brief Request the episode described by the config's season and episode number.
+    /// \details The callback is always called asynchronously, but only if the context
+    ///          object still exists.
+    void requestEpisode(const EpisodeScrapeJob::Config& config, QObject* context, Callback callback);
+
+    /// \brief Remove all finished seasons.
+    void clear();
+
+private:
+    struct Request
+    {
+        EpisodeNumber episode;
+        QPointer<QObject> context;
+        Callback callback;
+    };
+
+    struct Batch
+    {
+        SeasonScrapeJob* job = nullptr;
+        QVector<Request> waiting;
+        /// Invalid as long as the season job is running.
+        QElapsedTimer finishedTimer;
+    };
+
+    static QString batchKey(const EpisodeScrapeJob::Config& config);
+    void onSeasonLoaded(const QString& key, SeasonScrapeJob* job);
+    static void answer(SeasonScrapeJob* job, const Request& request);
+    void removeOldBatches();
+
+private:
+    TvScraper& m_scraper;
+    QHash<QString, Batch> m_batches;
+    QTimer m_cleanupTimer;
+};
+
+} // namespace scraper
+} // namespace mediaelch
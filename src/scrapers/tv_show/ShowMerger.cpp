@@ -166,7 +166,7 @@ static void copyDetailToEpisode(TvShowEpisode& target, const TvShowEpisode& sour
     }
     switch (detail) {
     case EpisodeScraperInfo::Invalid: {
-        qCCritical(generic) << "[ShowMerger] Cannot copy details 'invalid'";
+        qCCritical(c_scraper) << "[ShowMerger] Cannot copy details 'invalid'";
         break;
     }
     case EpisodeScraperInfo::Actors: {
@@ -262,8 +262,8 @@ void copyDetailsToShowEpisodes(TvShow& target,
         if (scraped != nullptr) {
             copyDetailsToEpisode(*episode, *scraped, details);
         } else if (!episode->isDummy()) {
-            qCCritical(generic) << "[TvShow] Cannot merge episode that wasn't scraped. This should not happen! For:"
-                                << episode->seasonNumber() << "," << episode->episodeNumber();
+            qCCritical(c_scraper) << "[TvShow] Cannot merge episode that wasn't scraped. This should not happen! For:"
+                                  << episode->seasonNumber() << "," << episode->episodeNumber();
         }
     }
 }
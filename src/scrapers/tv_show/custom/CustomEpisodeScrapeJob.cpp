@@ -73,7 +73,8 @@ void CustomEpisodeScrapeJob::loadWithScraper(const QString& scraperId, const Epi
 
     TvScraper* scraper = m_customConfig.scraperForId(scraperId);
     if (scraper == nullptr) {
-        qCCritical(generic) << "[CustomEpisodeScrapeJob] Invalid scraper ID for custom tv scraper:" << scraperId;
+        qCCritical(c_scraper_custom) << "[CustomEpisodeScrapeJob] Invalid scraper ID for custom tv scraper:"
+                                     << scraperId;
         decreaseCounterAndCheckIfFinished();
         return;
     }
@@ -121,7 +122,7 @@ Locale CustomEpisodeScrapeJob::localeFor(const QString& scraperId) const
     ScraperSettings* settings = Settings::instance()->scraperSettings(scraperId);
 
     if (scraper == nullptr) {
-        qCCritical(generic) << "[CustomEpisodeScrapeJob] Scraper not supported:" << scraperId;
+        qCCritical(c_scraper_custom) << "[CustomEpisodeScrapeJob] Scraper not supported:" << scraperId;
         return mediaelch::Locale::English;
     }
     if (settings == nullptr) {
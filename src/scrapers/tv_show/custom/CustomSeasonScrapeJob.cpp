@@ -75,7 +75,8 @@ void CustomSeasonScrapeJob::loadWithScraper(const QString& scraperId, const Show
 
     TvScraper* scraper = m_customConfig.scraperForId(scraperId);
     if (scraper == nullptr) {
-        qCCritical(generic) << "[CustomSeasonScrapeJob] Invalid scraper ID for custom tv scraper:" << scraperId;
+        qCCritical(c_scraper_custom) << "[CustomSeasonScrapeJob] Invalid scraper ID for custom tv scraper:"
+                                     << scraperId;
         decreaseCounterAndCheckIfFinished();
         return;
     }
@@ -122,7 +123,7 @@ Locale CustomSeasonScrapeJob::localeFor(const QString& scraperId) const
     ScraperSettings* settings = Settings::instance()->scraperSettings(scraperId);
 
     if (scraper == nullptr) {
-        qCCritical(generic) << "[CustomSeasonScrapeJob] Scraper not supported:" << scraperId;
+        qCCritical(c_scraper_custom) << "[CustomSeasonScrapeJob] Scraper not supported:" << scraperId;
         return mediaelch::Locale::English;
     }
     if (settings == nullptr) {
@@ -73,7 +73,7 @@ void CustomShowScrapeJob::loadWithScraper(const QString& scraperId, const ShowId
 
     TvScraper* scraper = m_customConfig.scraperForId(scraperId);
     if (scraper == nullptr) {
-        qCCritical(generic) << "[CustomShowScrapeJob] Invalid scraper ID for custom tv scraper:" << scraperId;
+        qCCritical(c_scraper_custom) << "[CustomShowScrapeJob] Invalid scraper ID for custom tv scraper:" << scraperId;
         decreaseCounterAndCheckIfFinished();
         return;
     }
@@ -120,7 +120,7 @@ Locale CustomShowScrapeJob::localeFor(const QString& scraperId) const
     ScraperSettings* settings = Settings::instance()->scraperSettings(scraperId);
 
     if (scraper == nullptr) {
-        qCCritical(generic) << "[CustomShowScrapeJob] Scraper not supported:" << scraperId;
+        qCCritical(c_scraper_custom) << "[CustomShowScrapeJob] Scraper not supported:" << scraperId;
         return mediaelch::Locale::English;
     }
     if (settings == nullptr) {
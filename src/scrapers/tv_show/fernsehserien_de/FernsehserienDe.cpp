@@ -4,6 +4,7 @@
 #include "data/tv_show/TvShowEpisode.h"
 #include "log/Log.h"
 #include "network/NetworkRequest.h"
+#include "scrapers/HtmlIndex.h"
 #include "scrapers/ScraperUtils.h"
 #include "scrapers/tv_show/ShowMerger.h"
 
@@ -412,72 +413,80 @@ void FernsehserienDeShowScrapeJob::doStart()
 
 void FernsehserienDeShowScrapeJob::parseTvShow(const QString& html)
 {
-    static QRegularExpression titleRegEx(
-        R"(<div class="seriestitle">(.*?)</div>)", QRegularExpression::DotMatchesEverythingOption);
-    static QRegularExpression originalTitleRegEx(R"re(<span lang="[^"]+?" itemprop="alternateName">(.*?)</span>)re",
-        QRegularExpression::DotMatchesEverythingOption);
-    static QRegularExpression overviewRegEx(
-        R"("serie-beschreibung"[^>]*>(.*?)</div><)", QRegularExpression::DotMatchesEverythingOption);
-    // Note: There are possibly multiple "first aired"-dates ("Premiere"). Take the first, which
-    //       is most likely the German one.
-    static QRegularExpression firstAiredRegEx(R"re(<ea-angabe-datum><time datetime="(\d{4}-\d{2}-\d{2})">)re");
-    static QRegularExpression genresRegEx(R"re(<meta itemprop="genre" content="([^"]+?)">)re");
-
-    static QRegularExpression actorsRegEx(
-        R"re(data-event-category="liste-cast-crew".*?</a>)re", QRegularExpression::DotMatchesEverythingOption);
-    static QRegularExpression actorNameRegEx(
-        R"re(<dt itemprop="name">(.*?)</dt>)re", QRegularExpression::DotMatchesEverythingOption);
-    static QRegularExpression actorRoleRegEx(R"re(<dd>(.*?)</dd>)re", QRegularExpression::DotMatchesEverythingOption);
-    static QRegularExpression actorImageRegEx(
-        R"re(data-src="(https://bilder.fernsehserien.de/[^"]+?)")re", QRegularExpression::DotMatchesEverythingOption);
-
     // Poster is more of a thumbnail.
     static QRegularExpression posterRegEx(
-        R"re(<meta itemprop="image" content="(https://bilder.fernsehserien.de/gfx/logo/[^"]+?[.](?:png|jpg|jpeg))")re");
+        R"re(^https://bilder.fernsehserien.de/gfx/logo/[^"]+?[.](?:png|jpg|jpeg)$)re");
     static QRegularExpression bannerRegEx(
-        R"re(<meta itemprop="image" content="(https://bilder.fernsehserien.de/sendung/hr/[^"]+?[.](?:png|jpg|jpeg))")re");
+        R"re(^https://bilder.fernsehserien.de/sendung/hr/[^"]+?[.](?:png|jpg|jpeg)$)re");
 
-    MediaElch_Debug_Ensures(titleRegEx.isValid());
-    MediaElch_Debug_Ensures(originalTitleRegEx.isValid());
-    MediaElch_Debug_Ensures(overviewRegEx.isValid());
-    MediaElch_Debug_Ensures(firstAiredRegEx.isValid());
-    MediaElch_Debug_Ensures(genresRegEx.isValid());
-    MediaElch_Debug_Ensures(actorsRegEx.isValid());
-    MediaElch_Debug_Ensures(actorNameRegEx.isValid());
-    MediaElch_Debug_Ensures(actorRoleRegEx.isValid());
-    MediaElch_Debug_Ensures(actorImageRegEx.isValid());
     MediaElch_Debug_Ensures(posterRegEx.isValid());
     MediaElch_Debug_Ensures(bannerRegEx.isValid());
 
+    // All details are looked up in the page's index instead of scanning the page for each of them.
+    const HtmlIndex page(html);
+
     // Add a dash between title and addendum. Typical German thing.  For example, "Scrubs"
     // is "Scrubs - Die Anfänger". "Die Anfänger" is in the second row on fernsehserien.de.
-    QString seriesTitle = titleRegEx.match(html).captured(1);
-    seriesTitle.replace("<span>", "<span> - ");
+    const auto titles = page.elementsByClass("seriestitle");
+    if (!titles.isEmpty()) {
+        QString seriesTitle = page.innerHtml(*titles.first());
+        seriesTitle.replace("<span>", "<span> - ");
+        tvShow().setTitle(normalizeFromHtml(seriesTitle));
+    }
 
-    tvShow().setTitle(normalizeFromHtml(seriesTitle));
-    tvShow().setOriginalTitle(normalizeFromHtml(originalTitleRegEx.match(html).captured(1)));
-    tvShow().setOverview(normalizeFromHtml(overviewRegEx.match(html).captured(1)));
-    tvShow().setFirstAired(QDate::fromString(firstAiredRegEx.match(html).captured(1), "yyyy-MM-dd"));
+    // <span lang="en" itemprop="alternateName">Original Title</span>
+    for (const HtmlIndex::Element* name : page.elementsByAttribute("itemprop", "alternateName")) {
+        if (name->tag == "span" && !HtmlIndex::attribute(*name, "lang").isEmpty()) {
+            tvShow().setOriginalTitle(page.text(*name));
+            break;
+        }
+    }
 
-    QRegularExpressionMatchIterator matches = genresRegEx.globalMatch(html);
-    while (matches.hasNext()) {
-        const QString genre = normalizeFromHtml(matches.next().captured(1));
-        tvShow().addGenre(genre);
+    auto overviews = page.elementsByClass("serie-beschreibung");
+    if (overviews.isEmpty() && page.elementById("serie-beschreibung") != nullptr) {
+        overviews << page.elementById("serie-beschreibung");
+    }
+    if (!overviews.isEmpty()) {
+        tvShow().setOverview(page.text(*overviews.first()));
     }
 
-    matches = actorsRegEx.globalMatch(html);
-    while (matches.hasNext()) {
-        const QString actorHtml = matches.next().captured(0);
+    // Note: There are possibly multiple "first aired"-dates ("Premiere"). Take the first, which
+    //       is most likely the German one.
+    // <ea-angabe-datum><time datetime="2001-10-02">
+    for (const HtmlIndex::Element* date : page.elementsByTag("ea-angabe-datum")) {
+        const HtmlIndex::Element* time = page.firstDescendant(*date, "time");
+        if (time != nullptr) {
+            tvShow().setFirstAired(QDate::fromString(HtmlIndex::attribute(*time, "datetime"), "yyyy-MM-dd"));
+            break;
+        }
+    }
 
-        QString roles = actorRoleRegEx.match(actorHtml).captured(1);
+    for (const HtmlIndex::Element* meta : page.elementsByAttribute("itemprop", "genre")) {
+        const QString genre = normalizeFromHtml(HtmlIndex::attribute(*meta, "content"));
+        if (!genre.isEmpty()) {
+            tvShow().addGenre(genre);
+        }
+    }
+
+    // <a data-event-category="liste-cast-crew" ...><img data-src="..."><dl><dt itemprop="name">...</dt><dd>...</dd>
+    for (const HtmlIndex::Element* actorElement : page.elementsByAttribute("data-event-category", "liste-cast-crew")) {
+        const HtmlIndex::Element* nameElement = page.firstDescendant(*actorElement, "dt");
+        const HtmlIndex::Element* roleElement = page.firstDescendant(*actorElement, "dd");
+
+        QString roles = (roleElement != nullptr) ? page.innerHtml(*roleElement) : QString();
         normalizeActorRole(roles);
 
         Actor actor;
-        actor.name = normalizeFromHtml(actorNameRegEx.match(actorHtml).captured(1));
+        actor.name = (nameElement != nullptr) ? page.text(*nameElement) : QString();
         actor.role = normalizeFromHtml(roles);
-        QString thumb = actorImageRegEx.match(actorHtml).captured(1);
-        if (!thumb.endsWith(".svg")) { // e.g. Person.svg, i.e. placeholder
-            actor.thumb = normalizeFromHtml(thumb);
+        for (const HtmlIndex::Element* image : page.descendants(*actorElement)) {
+            const QString thumb = HtmlIndex::attribute(*image, "data-src");
+            if (thumb.startsWith("https://bilder.fernsehserien.de/")) {
+                if (!thumb.endsWith(".svg")) { // e.g. Person.svg, i.e. placeholder
+                    actor.thumb = normalizeFromHtml(thumb);
+                }
+                break;
+            }
         }
 
         if (isFernsehserienDeActorRole(actor.role)) {
@@ -485,18 +494,27 @@ void FernsehserienDeShowScrapeJob::parseTvShow(const QString& html)
         }
     }
 
-    QRegularExpressionMatch imageMatch = bannerRegEx.match(html);
-    if (imageMatch.hasMatch()) {
+    QString bannerUrl;
+    QString posterUrl;
+    for (const HtmlIndex::Element* meta : page.elementsByAttribute("itemprop", "image")) {
+        const QString url = HtmlIndex::attribute(*meta, "content");
+        if (bannerUrl.isEmpty() && bannerRegEx.match(url).hasMatch()) {
+            bannerUrl = url;
+        } else if (posterUrl.isEmpty() && posterRegEx.match(url).hasMatch()) {
+            posterUrl = url;
+        }
+    }
+
+    if (!bannerUrl.isEmpty()) {
         Poster banner;
-        banner.originalUrl = imageMatch.captured(1);
+        banner.originalUrl = bannerUrl;
         banner.language = "de-DE";
         tvShow().addBanner(banner);
     }
 
-    imageMatch = posterRegEx.match(html);
-    if (imageMatch.hasMatch()) {
+    if (!posterUrl.isEmpty()) {
         Poster poster;
-        poster.originalUrl = imageMatch.captured(1);
+        poster.originalUrl = posterUrl;
         poster.language = "de-DE";
         tvShow().addPoster(poster);
     }
@@ -635,8 +653,9 @@ void FernsehserienDeSeasonScrapeJob::loadNextEpisode()
             m_episodes[{episode->seasonNumber(), episode->episodeNumber()}] = episode;
         } else {
             // TODO: Some way to let the user know? Log for now:
-            qCInfo(generic) << "[Fernsehserien] Could not scrape episode" << next.episodeNumber.toPaddedString()
-                            << "of season" << next.seasonNumber.toPaddedString();
+            qCInfo(c_scraper_fernsehserien_de) << "[Fernsehserien] Could not scrape episode"
+                                               << next.episodeNumber.toPaddedString() << "of season"
+                                               << next.seasonNumber.toPaddedString();
         }
 
         loadNextEpisode();
@@ -67,25 +67,25 @@ bool ImdbTv::isInitialized() const
 
 ShowSearchJob* ImdbTv::search(ShowSearchJob::Config config)
 {
-    qCInfo(generic) << "[ImdbTv] Search for:" << config.query;
+    qCInfo(c_scraper_imdb) << "[ImdbTv] Search for:" << config.query;
     return new ImdbTvShowSearchJob(m_api, config, this);
 }
 
 ShowScrapeJob* ImdbTv::loadShow(ShowScrapeJob::Config config)
 {
-    qCInfo(generic) << "[ImdbTv] Load TV show with id:" << config.identifier;
+    qCInfo(c_scraper_imdb) << "[ImdbTv] Load TV show with id:" << config.identifier;
     return new ImdbTvShowScrapeJob(m_api, config, this);
 }
 
 SeasonScrapeJob* ImdbTv::loadSeasons(SeasonScrapeJob::Config config)
 {
-    qCInfo(generic) << "[ImdbTv] Load season with show id:" << config.showIdentifier;
+    qCInfo(c_scraper_imdb) << "[ImdbTv] Load season with show id:" << config.showIdentifier;
     return new ImdbTvSeasonScrapeJob(m_api, config, this);
 }
 
 EpisodeScrapeJob* ImdbTv::loadEpisode(EpisodeScrapeJob::Config config)
 {
-    qCDebug(generic) << "[ImdbTv] Load single episode of TV show with id:" << config.identifier;
+    qCDebug(c_scraper_imdb) << "[ImdbTv] Load single episode of TV show with id:" << config.identifier;
     return new ImdbTvEpisodeScrapeJob(m_api, config, this);
 }
 
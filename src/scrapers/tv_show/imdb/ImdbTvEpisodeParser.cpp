@@ -4,95 +4,122 @@
 #include "data/TvDbId.h"
 #include "data/tv_show/TvShowEpisode.h"
 #include "globals/Helper.h"
+#include "scrapers/HtmlIndex.h"
 #include "scrapers/ScraperUtils.h"
 #include "scrapers/imdb/ImdbReferencePage.h"
 
 #include <QRegularExpression>
 #include <chrono>
 
+namespace {
+
+using mediaelch::scraper::HtmlIndex;
+
+/// Texts of all links inside of parent that end before stop, e.g. a "ghost" span.
+QStringList linkTexts(const HtmlIndex& page, const HtmlIndex::Element& parent, int stop)
+{
+    QStringList texts;
+    for (const HtmlIndex::Element* link : page.descendants(parent, "a")) {
+        if (link->end > stop) {
+            break;
+        }
+        const QString text = page.innerHtml(*link);
+        if (!HtmlIndex::attribute(*link, "href").isNull() && !text.contains('<')) {
+            texts << text;
+        }
+    }
+    return texts;
+}
+
+/// Names of the directors or writers, depending on the given item property and labels.
+QStringList extractCredits(const HtmlIndex& page, const QString& itemprop, const QStringList& labels)
+{
+    // <div class="txt-block" itemprop="director" itemscope itemtype="http://schema.org/Person">
+    for (const HtmlIndex::Element* block : page.elementsByAttribute("itemprop", itemprop)) {
+        if (block->tag == "div" && HtmlIndex::attribute(*block, "class") == "txt-block") {
+            return linkTexts(page, *block, block->contentEnd);
+        }
+    }
+
+    // <div class="credit_summary_item">\n<h4 class="inline">Directors:</h4>...<span class="ghost">
+    // The ghost span may only exist if there are more than 2 credits.
+    for (const HtmlIndex::Element* block : page.elementsByClass("credit_summary_item")) {
+        const HtmlIndex::Element* header = page.firstDescendant(*block, "h4");
+        if (header == nullptr || !labels.contains(page.innerHtml(*header))) {
+            continue;
+        }
+        int stop = block->contentEnd;
+        for (const HtmlIndex::Element* span : page.descendants(*block, "span")) {
+            if (HtmlIndex::attribute(*span, "class") == "ghost") {
+                stop = span->start;
+                break;
+            }
+        }
+        return linkTexts(page, *block, stop);
+    }
+    return {};
+}
+
+/// First element with the given class and tag inside of parent.
+const HtmlIndex::Element*
+firstByClass(const HtmlIndex& page, const HtmlIndex::Element& parent, const QString& className, const QString& tag)
+{
+    for (const HtmlIndex::Element* element : page.elementsByClass(className)) {
+        if (element->tag == tag && HtmlIndex::contains(parent, *element)) {
+            return element;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
 namespace mediaelch {
 namespace scraper {
 
 void ImdbTvEpisodeParser::parseInfos(TvShowEpisode& episode, const QString& html)
 {
     // Note: Expects HTML from https://www.imdb.com/title/tt________/reference
-    using namespace std::chrono;
+    //       All details are looked up in the page's index instead of scanning the page for each of them.
+    const HtmlIndex page(html);
 
     QRegularExpression rx;
     rx.setPatternOptions(QRegularExpression::InvertedGreedinessOption | QRegularExpression::DotMatchesEverythingOption);
     QRegularExpressionMatch match;
 
-    rx.setPattern(R"re(<meta property="pageId" content="(tt\d+)" />)re");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        episode.setImdbId(ImdbId(match.captured(1).trimmed()));
+    // <meta property="pageId" content="tt0096697" />
+    const auto pageIds = page.elementsByAttribute("property", "pageId");
+    if (!pageIds.isEmpty()) {
+        const QString imdbId = HtmlIndex::attribute(*pageIds.first(), "content").trimmed();
+        if (imdbId.startsWith("tt")) {
+            episode.setImdbId(ImdbId(imdbId));
+        }
     }
 
-    const QString title = ImdbReferencePage::extractTitle(html);
+    const QString title = ImdbReferencePage::extractTitle(page);
     if (!title.isEmpty()) {
         episode.setTitle(title);
     }
 
     // Enable once original titles exist for episodes.
-    // const QString originalTitle = ImdbReferencePage::extractOriginalTitle(html);
+    // const QString originalTitle = ImdbReferencePage::extractOriginalTitle(page);
     // if (!originalTitle.isEmpty()) {
     //     episode.setOriginalTitle(originalTitle);
     // }
 
     // --------------------------------------
 
-    rx.setPattern(
-        R"(<div class="txt-block" itemprop="director" itemscope itemtype="http://schema.org/Person">(.*)</div>)");
-    match = rx.match(html);
-    QString directorsBlock;
-    if (match.hasMatch()) {
-        directorsBlock = match.captured(1);
-    } else {
-        // the ghost span may only exist if there are more than 2 directors
-        rx.setPattern(
-            R"(<div class="credit_summary_item">\n +<h4 class="inline">Directors?:</h4>(.*)(?:<span class="ghost">|</div>))");
-        match = rx.match(html);
-        if (match.hasMatch()) {
-            directorsBlock = match.captured(1);
-        }
-    }
-
-    if (!directorsBlock.isEmpty()) {
-        QStringList directors;
-        rx.setPattern(R"(<a href="[^"]*"[^>]*>([^<]*)</a>)");
-
-        QRegularExpressionMatchIterator matches = rx.globalMatch(directorsBlock);
-        while (matches.hasNext()) {
-            directors << matches.next().captured(1);
-        }
+    const QStringList directors = extractCredits(page, "director", {"Director:", "Directors:"});
+    if (!directors.isEmpty()) {
         episode.setDirectors(directors);
     }
 
     // --------------------------------------
 
-    rx.setPattern(
-        R"(<div class="txt-block" itemprop="creator" itemscope itemtype="http://schema.org/Person">(.*)</div>)");
-    match = rx.match(html);
-    QString writersBlock;
-    if (match.hasMatch()) {
-        writersBlock = match.captured(1);
-
-    } else {
-        // the ghost span may only exist if there are more than 2 writers
-        rx.setPattern(
-            R"(<div class="credit_summary_item">\n +<h4 class="inline">Writers?:</h4>(.*)(?:<span class="ghost">|</div>))");
-        match = rx.match(html);
-        if (match.hasMatch()) {
-            writersBlock = match.captured(1);
-        }
-    }
-
-    if (!writersBlock.isEmpty()) {
-        QStringList writers;
-        rx.setPattern(R"(<a href="[^"]*"[^>]*>([^<]*)</a>)");
-        QRegularExpressionMatchIterator matches = rx.globalMatch(writersBlock);
-        while (matches.hasNext()) {
-            writers << matches.next().captured(1).trimmed();
+    QStringList writers = extractCredits(page, "creator", {"Writer:", "Writers:"});
+    if (!writers.isEmpty()) {
+        for (QString& writer : writers) {
+            writer = writer.trimmed();
         }
         episode.setWriters(writers);
     }
@@ -136,7 +163,7 @@ void ImdbTvEpisodeParser::parseInfos(TvShowEpisode& episode, const QString& html
 
     // --------------------------------------
 
-    const QDate released = ImdbReferencePage::extractReleaseDate(html);
+    const QDate released = ImdbReferencePage::extractReleaseDate(page);
     if (released.isValid()) {
         episode.setFirstAired(released);
     }
@@ -144,9 +171,12 @@ void ImdbTvEpisodeParser::parseInfos(TvShowEpisode& episode, const QString& html
     // --------------------------------------
 
     rx.setPattern(R"rx("contentRating": "([^"]*)",)rx");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        episode.setCertification(Certification(match.captured(1).trimmed()));
+    for (const QString& json : page.jsonLd()) {
+        match = rx.match(json);
+        if (match.hasMatch()) {
+            episode.setCertification(Certification(match.captured(1).trimmed()));
+            break;
+        }
     }
 
     // --------------------------------------
@@ -168,29 +198,41 @@ void ImdbTvEpisodeParser::parseInfos(TvShowEpisode& episode, const QString& html
     // }
 
     // --------------------------------------
-    rx.setPattern("<p itemprop=\"description\">(.*)</p>");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        QString outline = match.captured(1);
-        outline = outline.remove("See full summary&nbsp;&raquo;").trimmed();
-        episode.setOverview(removeHtmlEntities(outline));
+    for (const HtmlIndex::Element* description : page.elementsByAttribute("itemprop", "description")) {
+        if (description->tag == "p") {
+            QString outline = page.innerHtml(*description);
+            outline = outline.remove("See full summary&nbsp;&raquo;").trimmed();
+            episode.setOverview(removeHtmlEntities(outline));
+            break;
+        }
     }
 
     // --------------------------------------
-    rx.setPattern(R"(<div class="summary_text">(.*)</div>)");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        QString outline = match.captured(1);
-        outline = outline.remove("See full summary&nbsp;&raquo;").trimmed();
-        episode.setOverview(removeHtmlEntities(outline));
+    for (const HtmlIndex::Element* summary : page.elementsByClass("summary_text")) {
+        if (summary->tag == "div") {
+            QString outline = page.innerHtml(*summary);
+            outline = outline.remove("See full summary&nbsp;&raquo;").trimmed();
+            episode.setOverview(removeHtmlEntities(outline));
+            break;
+        }
     }
     // --------------------------------------
 
-    rx.setPattern(R"(<h2>Storyline</h2>\n +\n +<div class="inline canwrap">\n +<p>\n +<span>(.*)</span>)");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        QString overview = removeHtmlEntities(match.captured(1));
-        episode.setOverview(overview);
+    // <h2>Storyline</h2>\n<div class="inline canwrap">\n<p>\n<span>Overview</span>
+    for (const HtmlIndex::Element* header : page.elementsByTag("h2")) {
+        if (!page.hasInnerHtml(*header, "Storyline")) {
+            continue;
+        }
+        const HtmlIndex::Element* div = page.nextElement(*header);
+        if (div != nullptr && div->tag == "div" && HtmlIndex::attribute(*div, "class") == "inline canwrap") {
+            const HtmlIndex::Element* paragraph = page.firstDescendant(*div, "p");
+            const HtmlIndex::Element* span =
+                (paragraph != nullptr) ? page.firstDescendant(*paragraph, "span") : nullptr;
+            if (span != nullptr) {
+                episode.setOverview(removeHtmlEntities(page.innerHtml(*span)));
+            }
+        }
+        break;
     }
 
     // --------------------------------------
@@ -198,27 +240,35 @@ void ImdbTvEpisodeParser::parseInfos(TvShowEpisode& episode, const QString& html
     Rating rating;
     rating.source = "imdb";
     rating.maxRating = 10;
-    rx.setPattern("<div class=\"ipl-rating-star ?\">(.*)</div>");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        QString content = match.captured(1);
-        rx.setPattern("<span class=\"ipl-rating-star__rating\">(.*)</span>");
-        match = rx.match(content);
-        if (match.hasMatch()) {
-            rating.rating = match.captured(1).trimmed().replace(",", ".").toDouble();
+
+    const HtmlIndex::Element* ratingStar = nullptr;
+    for (const HtmlIndex::Element* element : page.elementsByClass("ipl-rating-star")) {
+        if (element->tag == "div") {
+            ratingStar = element;
+            break;
         }
+    }
+    const auto imdbRatings = page.elementsByClass("imdbRating");
 
-        rx.setPattern(R"(<span class="ipl-rating-star__total-votes">\((.*)\)</span>)");
-        match = rx.match(content);
-        if (match.hasMatch()) {
-            rating.voteCount = match.captured(1).replace(",", "").replace(".", "").toInt();
+    if (ratingStar != nullptr) {
+        const HtmlIndex::Element* value = firstByClass(page, *ratingStar, "ipl-rating-star__rating", "span");
+        if (value != nullptr) {
+            rating.rating = page.innerHtml(*value).trimmed().replace(",", ".").toDouble();
         }
 
-    } else {
-        rx.setPattern(R"(<div class="imdbRating"[^>]*>\n +<div class="ratingValue">(.*)</div>)");
-        match = rx.match(html);
-        if (match.hasMatch()) {
-            QString content = match.captured(1);
+        const HtmlIndex::Element* votes = firstByClass(page, *ratingStar, "ipl-rating-star__total-votes", "span");
+        if (votes != nullptr) {
+            QString voteCount = page.innerHtml(*votes);
+            if (voteCount.startsWith('(') && voteCount.endsWith(')')) {
+                voteCount = voteCount.mid(1, voteCount.length() - 2);
+                rating.voteCount = voteCount.replace(",", "").replace(".", "").toInt();
+            }
+        }
+
+    } else if (!imdbRatings.isEmpty()) {
+        const HtmlIndex::Element* value = firstByClass(page, *imdbRatings.first(), "ratingValue", "div");
+        if (value != nullptr) {
+            const QString content = page.innerHtml(*value);
             rx.setPattern("([0-9]\\.[0-9]) based on ([0-9\\,]*) ");
             match = rx.match(content);
             if (match.hasMatch()) {
@@ -239,11 +289,15 @@ void ImdbTvEpisodeParser::parseInfos(TvShowEpisode& episode, const QString& html
         episode.ratings().setOrAddRating(rating);
     }
 
-    // Top250 for TV shows (used by TheTvDb)
-    rx.setPattern(R"re(<link rel='image_src' href="(https://[^"]+.jpg)")re");
-    match = rx.match(html);
-    if (match.hasMatch()) {
-        QString thumbUrlRaw = match.captured(1);
+    // <link rel='image_src' href="https://....jpg">
+    for (const HtmlIndex::Element* link : page.elementsByTag("link")) {
+        if (HtmlIndex::attribute(*link, "rel") != "image_src") {
+            continue;
+        }
+        QString thumbUrlRaw = HtmlIndex::attribute(*link, "href");
+        if (!thumbUrlRaw.startsWith("https://") || !thumbUrlRaw.endsWith(".jpg")) {
+            break;
+        }
         if (thumbUrlRaw.contains("media-amazon.com")) {
             // Neither the season nor episode page have a proper thumb. But because
             // media-amazon has some auto-crop magic, we can specify the format ourselves.
@@ -258,6 +312,7 @@ void ImdbTvEpisodeParser::parseInfos(TvShowEpisode& episode, const QString& html
             }
         }
         episode.setThumbnail(QUrl(thumbUrlRaw));
+        break;
     }
 
     // --------------------------------------
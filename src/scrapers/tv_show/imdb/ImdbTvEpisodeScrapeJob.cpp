@@ -26,12 +26,12 @@ void ImdbTvEpisodeScrapeJob::doStart()
 
 void ImdbTvEpisodeScrapeJob::loadSeason()
 {
-    qCDebug(generic) << "[ImdbTvEpisodeScrapeJob] Have to load season first.";
+    qCDebug(c_scraper_imdb) << "[ImdbTvEpisodeScrapeJob] Have to load season first.";
 
     ImdbId showId(config().identifier.showIdentifier);
 
     if (!showId.isValid()) {
-        qCWarning(generic) << "[ImdbTvEpisodeScrapeJob] Invalid IMDb ID for TV show, cannot scrape episode!";
+        qCWarning(c_scraper_imdb) << "[ImdbTvEpisodeScrapeJob] Invalid IMDb ID for TV show, cannot scrape episode!";
         ScraperError error;
         error.error = ScraperError::Type::ConfigError;
         error.message = tr("Neither IMDb show ID nor episode ID are valid! Cannot load requested episode.");
@@ -54,7 +54,8 @@ void ImdbTvEpisodeScrapeJob::loadSeason()
             }
             ImdbTvEpisodeParser::parseIdFromSeason(episode(), html);
             if (!episode().imdbId().isValid()) {
-                qCWarning(generic) << "[ImdbTvEpisodeScrapeJob] Could not parse IMDb ID for episode from season page!";
+                qCWarning(c_scraper_imdb)
+                    << "[ImdbTvEpisodeScrapeJob] Could not parse IMDb ID for episode from season page!";
                 ScraperError configError;
                 configError.error = ScraperError::Type::ConfigError;
                 configError.message =
@@ -70,7 +71,7 @@ void ImdbTvEpisodeScrapeJob::loadSeason()
 void ImdbTvEpisodeScrapeJob::loadEpisode(const ImdbId& episodeId)
 {
     if (!episodeId.isValid()) {
-        qCWarning(generic) << "[ImdbTvEpisodeScrapeJob] Invalid IMDb ID, cannot scrape episode!";
+        qCWarning(c_scraper_imdb) << "[ImdbTvEpisodeScrapeJob] Invalid IMDb ID, cannot scrape episode!";
         ScraperError error;
         error.error = ScraperError::Type::ConfigError;
         error.message = tr("IMDb ID is invalid! Cannot load requested episode.");
@@ -79,12 +80,12 @@ void ImdbTvEpisodeScrapeJob::loadEpisode(const ImdbId& episodeId)
         return;
     }
 
-    qCInfo(generic) << "[ImdbTvEpisodeScrapeJob] Loading episode with IMDb ID" << episodeId.toString();
+    qCInfo(c_scraper_imdb) << "[ImdbTvEpisodeScrapeJob] Loading episode with IMDb ID" << episodeId.toString();
     m_api.loadTitle(config().locale, episodeId, ImdbApi::PageKind::Reference, [this](QString html, ScraperError error) {
         if (error.hasError()) {
             setScraperError(error);
         } else if (html.isEmpty()) {
-            qCWarning(generic) << "[ImdbTvEpisodeScrapeJob] Empty episode HTML!";
+            qCWarning(c_scraper_imdb) << "[ImdbTvEpisodeScrapeJob] Empty episode HTML!";
             ScraperError networkError;
             networkError.error = ScraperError::Type::NetworkError;
             networkError.message = tr("Loaded IMDb content is empty. Cannot load requested episode.");
@@ -19,7 +19,7 @@ ImdbTvSeasonScrapeJob::ImdbTvSeasonScrapeJob(ImdbApi& api, SeasonScrapeJob::Conf
 void ImdbTvSeasonScrapeJob::doStart()
 {
     if (!m_showId.isValid()) {
-        qCWarning(generic) << "[ImdbTv] Provided IMDb id is invalid:" << config().showIdentifier;
+        qCWarning(c_scraper_imdb) << "[ImdbTv] Provided IMDb id is invalid:" << config().showIdentifier;
         ScraperError error;
         error.error = ScraperError::Type::ConfigError;
         error.message = tr("Show is missing an IMDb id");
@@ -65,8 +65,8 @@ void ImdbTvSeasonScrapeJob::loadEpisodes(QMap<SeasonNumber, QMap<EpisodeNumber,
     episode->setEpisode(nextEpisode);
     episode->setImdbId(nextEpisodeId);
 
-    qCInfo(generic) << "[ImdbTvSeasonScrapeJob] Start loading season" << nextSeason.toInt() << "episode"
-                    << nextEpisode.toInt() << "of show" << config().showIdentifier.str();
+    qCInfo(c_scraper_imdb) << "[ImdbTvSeasonScrapeJob] Start loading season" << nextSeason.toInt() << "episode"
+                           << nextEpisode.toInt() << "of show" << config().showIdentifier.str();
 
     m_api.loadTitle(config().locale,
         nextEpisodeId,
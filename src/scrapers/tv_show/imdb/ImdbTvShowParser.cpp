@@ -90,7 +90,7 @@ QJsonDocument ImdbTvShowParser::extractMetaJson(const QString& html, ScraperErro
     if (!match.hasMatch()) {
         error.error = ScraperError::Type::InternalError;
         error.message = tr("Could not extract JSON details from IMDb page!");
-        qCWarning(generic) << "[ImdbTvShowParser] Could not extract JSON details from IMDb page!";
+        qCWarning(c_scraper_imdb) << "[ImdbTvShowParser] Could not extract JSON details from IMDb page!";
         return {};
     }
 
@@ -100,13 +100,13 @@ QJsonDocument ImdbTvShowParser::extractMetaJson(const QString& html, ScraperErro
     if (parseError.error != QJsonParseError::NoError) {
         error.error = ScraperError::Type::InternalError;
         error.message = tr("Could not parse JSON from IMDb page!");
-        qCWarning(generic) << "[ImdbTvShowParser] Could not parse IMDb json:" << parseError.errorString() //
-                           << "at offset" << parseError.offset;
+        qCWarning(c_scraper_imdb) << "[ImdbTvShowParser] Could not parse IMDb json:" << parseError.errorString() //
+                                  << "at offset" << parseError.offset;
 
     } else if (!parsedJson.isObject()) {
         error.error = ScraperError::Type::InternalError;
         error.message = tr("Expected parsed IMDb JSON to be an object!");
-        qCWarning(generic) << "[ImdbTvShowParser] IMDb json is not an object!";
+        qCWarning(c_scraper_imdb) << "[ImdbTvShowParser] IMDb json is not an object!";
     }
 
     return parsedJson;
@@ -28,7 +28,7 @@ ImdbTvShowScrapeJob::ImdbTvShowScrapeJob(ImdbApi& api, ShowScrapeJob::Config _co
 void ImdbTvShowScrapeJob::doStart()
 {
     if (!m_id.isValid()) {
-        qCWarning(generic) << "[ImdbTv] Provided IMDb id is invalid:" << config().identifier;
+        qCWarning(c_scraper_imdb) << "[ImdbTv] Provided IMDb id is invalid:" << config().identifier;
         ScraperError error;
         error.error = ScraperError::Type::ConfigError;
         error.message = tr("Show is missing an IMDb id");
@@ -88,8 +88,8 @@ void ImdbTvShowScrapeJob::setIsLoaded(ShowScraperInfo info)
     if (m_notLoaded.contains(info)) {
         m_notLoaded.remove(info);
     } else {
-        qCCritical(generic) << "[ImdbTvShowScrapeJob] Loaded detail that should not be loaded?"
-                            << static_cast<int>(info);
+        qCCritical(c_scraper_imdb) << "[ImdbTvShowScrapeJob] Loaded detail that should not be loaded?"
+                                   << static_cast<int>(info);
     }
 }
 
@@ -103,28 +103,28 @@ bool TheTvDb::isInitialized() const
 
 ShowSearchJob* TheTvDb::search(ShowSearchJob::Config config)
 {
-    qCInfo(generic) << "[TheTvDb] Search for:" << config.query;
+    qCInfo(c_scraper_thetvdb) << "[TheTvDb] Search for:" << config.query;
     auto* searchJob = new TheTvDbShowSearchJob(m_api, std::move(config));
     return searchJob;
 }
 
 ShowScrapeJob* TheTvDb::loadShow(ShowScrapeJob::Config config)
 {
-    qCInfo(generic) << "[TheTvDb] Load TV show with id:" << config.identifier;
+    qCInfo(c_scraper_thetvdb) << "[TheTvDb] Load TV show with id:" << config.identifier;
     auto* loader = new TheTvDbShowScrapeJob(m_api, config, this);
     return loader;
 }
 
 SeasonScrapeJob* TheTvDb::loadSeasons(SeasonScrapeJob::Config config)
 {
-    qCInfo(generic) << "[TheTvDb] Load season with show id:" << config.showIdentifier;
+    qCInfo(c_scraper_thetvdb) << "[TheTvDb] Load season with show id:" << config.showIdentifier;
     auto* loader = new TheTvDbSeasonScrapeJob(m_api, config, this);
     return loader;
 }
 
 EpisodeScrapeJob* TheTvDb::loadEpisode(EpisodeScrapeJob::Config config)
 {
-    qCDebug(generic) << "[TheTvDb] Load single episode of TV show with id:" << config.identifier;
+    qCDebug(c_scraper_thetvdb) << "[TheTvDb] Load single episode of TV show with id:" << config.identifier;
     auto* loader = new TheTvDbEpisodeScrapeJob(m_api, config, this);
     return loader;
 }
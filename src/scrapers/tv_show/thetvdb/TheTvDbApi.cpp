@@ -34,11 +34,11 @@ void TheTvDbApi::initialize()
             parsedJson = QJsonDocument::fromJson(reply->readAll(), &parseError);
 
             if (parseError.error != QJsonParseError::NoError) {
-                qCWarning(generic) << "[JsonPostRequest] Error while parsing JSON";
+                qCWarning(c_scraper_thetvdb) << "[JsonPostRequest] Error while parsing JSON";
             }
 
         } else {
-            qCWarning(generic) << "[JsonPostRequest] Network Error:" << reply->errorString();
+            qCWarning(c_scraper_thetvdb) << "[JsonPostRequest] Network Error:" << reply->errorString();
         }
 
         reply->deleteLater();
@@ -48,7 +48,7 @@ void TheTvDbApi::initialize()
             return;
         }
 
-        qCDebug(generic) << "[TheTvDbApi] Received JSON web token";
+        qCDebug(c_scraper_thetvdb) << "[TheTvDbApi] Received JSON web token";
 
         ApiToken token(parsedJson.object().value("token").toString());
         if (token.isValid()) {
@@ -89,7 +89,8 @@ void TheTvDbApi::sendGetRequest(const Locale& locale, const QUrl& url, TheTvDbAp
             data = QString::fromUtf8(reply->readAll());
 
         } else {
-            qCWarning(generic) << "[TheTvDbApi] Network Error:" << reply->errorString() << "for URL" << reply->url();
+            qCWarning(c_scraper_thetvdb) << "[TheTvDbApi] Network Error:" << reply->errorString() << "for URL"
+                                         << reply->url();
         }
 
         QJsonParseError parseError{};
@@ -202,7 +203,7 @@ QUrl TheTvDbApi::getShowUrl(ApiShowDetails type, const TvDbId& id) const
         case ApiShowDetails::ACTORS: return QStringLiteral("/actors");
         case ApiShowDetails::INFOS: return QString{};
         }
-        qCWarning(generic) << "[TheTvDbApi] Unknown ApiShowDetails";
+        qCWarning(c_scraper_thetvdb) << "[TheTvDbApi] Unknown ApiShowDetails";
         return QString{};
     }();
 
@@ -218,7 +219,7 @@ QUrl TheTvDbApi::getImagesUrl(ShowScraperInfo type, const TvDbId& id) const
         case ShowScraperInfo::SeasonPoster: return QStringLiteral("season");
         case ShowScraperInfo::SeasonBanner: return QStringLiteral("seasonwide");
         case ShowScraperInfo::Banner: return QStringLiteral("series");
-        default: qCWarning(generic) << "[TheTvDbApi] Invalid image type"; return QStringLiteral("invalid");
+        default: qCWarning(c_scraper_thetvdb) << "[TheTvDbApi] Invalid image type"; return QStringLiteral("invalid");
         }
     }();
 
@@ -249,7 +250,7 @@ QString TheTvDbApi::seasonOrderToUrlArg(SeasonOrder order) const
     case SeasonOrder::Dvd: return "dvdSeason";
     case SeasonOrder::Aired: return "airedSeason";
     }
-    qCCritical(generic) << "[TheTvDbApi] Unhandled SeasonOrder case!";
+    qCCritical(c_scraper_thetvdb) << "[TheTvDbApi] Unhandled SeasonOrder case!";
     return "airedSeason";
 }
 
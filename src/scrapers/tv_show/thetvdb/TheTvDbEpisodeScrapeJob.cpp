@@ -31,8 +31,8 @@ void TheTvDbEpisodeScrapeJob::doStart()
 
 void TheTvDbEpisodeScrapeJob::loadSeason()
 {
-    qCDebug(generic) << "[TheTvDbEpisodeScrapeJob] Have to load season first for show:"
-                     << config().identifier.showIdentifier;
+    qCDebug(c_scraper_thetvdb) << "[TheTvDbEpisodeScrapeJob] Have to load season first for show:"
+                               << config().identifier.showIdentifier;
 
     // The episode parser requires season/episode to be set when
     // calling parseIdFromSeason()
@@ -59,7 +59,7 @@ void TheTvDbEpisodeScrapeJob::loadSeason()
 void TheTvDbEpisodeScrapeJob::loadEpisode(const TvDbId& episodeId)
 {
     if (!episodeId.isValid()) {
-        qCWarning(generic) << "[TheTvDbEpisodeScrapeJob] Invalid TheTvDb ID, cannot scrape episode!";
+        qCWarning(c_scraper_thetvdb) << "[TheTvDbEpisodeScrapeJob] Invalid TheTvDb ID, cannot scrape episode!";
         ScraperError error;
         error.error = ScraperError::Type::ConfigError;
         error.message = tr("TheTvDb ID is invalid! Cannot load requested episode.");
@@ -68,7 +68,7 @@ void TheTvDbEpisodeScrapeJob::loadEpisode(const TvDbId& episodeId)
         return;
     }
 
-    qCDebug(generic) << "[TheTvDbEpisodeScrapeJob] Loading episode with id:" << episodeId;
+    qCDebug(c_scraper_thetvdb) << "[TheTvDbEpisodeScrapeJob] Loading episode with id:" << episodeId;
     m_api.loadEpisode(config().locale, episodeId, [this](QJsonDocument json, ScraperError error) {
         if (!error.hasError()) {
             TheTvDbEpisodeParser parser(episode(), config().identifier.seasonOrder);
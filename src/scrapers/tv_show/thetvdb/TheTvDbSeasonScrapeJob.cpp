@@ -20,7 +20,7 @@ TheTvDbSeasonScrapeJob::TheTvDbSeasonScrapeJob(TheTvDbApi& api, Config _config,
 void TheTvDbSeasonScrapeJob::doStart()
 {
     if (!m_showId.isValid()) {
-        qCWarning(generic) << "[TheTvDb] Provided TheTvDb id is invalid:" << config().showIdentifier;
+        qCWarning(c_scraper_thetvdb) << "[TheTvDb] Provided TheTvDb id is invalid:" << config().showIdentifier;
         ScraperError error;
         error.error = ScraperError::Type::ConfigError;
         error.message = tr("Show is missing a TheTvDb id");
@@ -40,7 +40,7 @@ TheTvDbShowScrapeJob::TheTvDbShowScrapeJob(TheTvDbApi& api, Config _config, QObj
 void TheTvDbShowScrapeJob::doStart()
 {
     if (!m_id.isValid()) {
-        qCWarning(generic) << "[TheTvDb] Provided TheTvDb id is invalid:" << config().identifier;
+        qCWarning(c_scraper_thetvdb) << "[TheTvDb] Provided TheTvDb id is invalid:" << config().identifier;
         ScraperError error;
         error.error = ScraperError::Type::ConfigError;
         error.message = tr("Show is missing a TheTvDb id");
@@ -148,8 +148,8 @@ void TheTvDbShowScrapeJob::setIsLoaded(ShowScraperInfo info)
     if (m_notLoaded.contains(info)) {
         m_notLoaded.remove(info);
     } else {
-        qCCritical(generic) << "[TheTvDbShowScrapeJob] Loaded detail that should not be loaded?"
-                            << static_cast<int>(info);
+        qCCritical(c_scraper_thetvdb) << "[TheTvDbShowScrapeJob] Loaded detail that should not be loaded?"
+                                      << static_cast<int>(info);
     }
 }
 
@@ -1,6 +1,8 @@
 #include "scrapers/tv_show/tmdb/TmdbTv.h"
 
 #include "log/Log.h"
+#include "scrapers/tv_show/BatchedEpisodeScrapeJob.h"
+#include "scrapers/tv_show/tmdb/TmdbTvEpisodeParser.h"
 #include "scrapers/tv_show/tmdb/TmdbTvEpisodeScrapeJob.h"
 #include "scrapers/tv_show/tmdb/TmdbTvSeasonScrapeJob.h"
 #include "scrapers/tv_show/tmdb/TmdbTvShowScrapeJob.h"
@@ -145,26 +147,49 @@ bool TmdbTv::isInitialized() const
 
 ShowSearchJob* TmdbTv::search(ShowSearchJob::Config config)
 {
-    qCInfo(generic) << "[TmdbTv] Search for:" << config.query;
+    qCInfo(c_scraper_tmdb) << "[TmdbTv] Search for:" << config.query;
     return new TmdbTvShowSearchJob(m_api, config, this);
 }
 
 ShowScrapeJob* TmdbTv::loadShow(ShowScrapeJob::Config config)
 {
-    qCInfo(generic) << "[TmdbTv] Load TV show with id:" << config.identifier;
+    qCInfo(c_scraper_tmdb) << "[TmdbTv] Load TV show with id:" << config.identifier;
     return new TmdbTvShowScrapeJob(m_api, config, this);
 }
 
 SeasonScrapeJob* TmdbTv::loadSeasons(SeasonScrapeJob::Config config)
 {
-    qCInfo(generic) << "[TmdbTv] Load season with show id:" << config.showIdentifier;
+    qCInfo(c_scraper_tmdb) << "[TmdbTv] Load season with show id:" << config.showIdentifier;
     return new TmdbTvSeasonScrapeJob(m_api, config, this);
 }
 
 EpisodeScrapeJob* TmdbTv::loadEpisode(EpisodeScrapeJob::Config config)
 {
-    qCDebug(generic) << "[TmdbTv] Load single episode of TV show with id:" << config.identifier;
-    return new TmdbTvEpisodeScrapeJob(m_api, config, this);
+    qCDebug(c_scraper_tmdb) << "[TmdbTv] Load single episode of TV show with id:" << config.identifier;
+    // TMDB returns all episodes of a season in one response. Scraping many episodes
+    // of a season therefore results in only one request.
+    const auto loadSingleEpisode = [this](EpisodeScrapeJob::Config singleConfig) -> EpisodeScrapeJob* {
+        return new TmdbTvEpisodeScrapeJob(m_api, singleConfig, this);
+    };
+    auto* job = new BatchedEpisodeScrapeJob(m_seasonBatcher, loadSingleEpisode, config, this);
+    // The season's result only contains the guest stars of an episode, but not its regular cast.
+    job->setSingleEpisodeDetails({EpisodeScraperInfo::Actors});
+    // It doesn't contain the episode's external IDs either.  Those are small requests, though.
+    job->setCompletion([this](const EpisodeScrapeJob::Config& episodeConfig,
+                           TvShowEpisode& episode,
+                           std::function<void(ScraperError)> done) {
+        m_api.loadEpisodeExternalIds(episodeConfig.locale,
+            TmdbId(episodeConfig.identifier.showIdentifier),
+            episodeConfig.identifier.seasonNumber,
+            episodeConfig.identifier.episodeNumber,
+            [&episode, done](QJsonDocument json, ScraperError error) {
+                if (!error.hasError()) {
+                    TmdbTvEpisodeParser::parseExternalIds(episode, json.object());
+                }
+                done(error);
+            });
+    });
+    return job;
 }
 
 } // namespace scraper
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "scrapers/tmdb/TmdbApi.h"
+#include "scrapers/tv_show/SeasonBatcher.h"
 #include "scrapers/tv_show/TvScraper.h"
 #include "utils/Meta.h"
 
@@ -31,6 +32,8 @@ public:
 private:
     ScraperMeta m_meta;
     TmdbApi m_api;
+    /// Episodes are loaded together with their season, see loadEpisode().
+    SeasonBatcher m_seasonBatcher{*this};
 };
 
 } // namespace scraper
@@ -32,17 +32,7 @@ void TmdbTvEpisodeParser::parseInfos(const TmdbApi& api, TvShowEpisode& episode,
     episode.setFirstAired(QDate::fromString(data["air_date"].toString(), "yyyy-MM-dd"));
 
     // -------------------------------------
-    QJsonObject externalIds = data["external_ids"].toObject();
-
-    ImdbId imdbId(externalIds["imdb_id"].toString());
-    if (imdbId.isValid()) {
-        episode.setImdbId(imdbId);
-    }
-
-    QString tvdbId(QStringLiteral("id%1").arg(externalIds["tvdb_id"].toInt(-1)));
-    if (TvDbId::isValidPrefixedFormat(tvdbId)) {
-        episode.setTvdbId(TvDbId(tvdbId));
-    }
+    parseExternalIds(episode, data["external_ids"].toObject());
 
     // -------------------------------------
     {
@@ -118,5 +108,18 @@ void TmdbTvEpisodeParser::parseInfos(const TmdbApi& api, TvShowEpisode& episode,
     }
 }
 
+void TmdbTvEpisodeParser::parseExternalIds(TvShowEpisode& episode, const QJsonObject& externalIds)
+{
+    ImdbId imdbId(externalIds["imdb_id"].toString());
+    if (imdbId.isValid()) {
+        episode.setImdbId(imdbId);
+    }
+
+    QString tvdbId(QStringLiteral("id%1").arg(externalIds["tvdb_id"].toInt(-1)));
+    if (TvDbId::isValidPrefixedFormat(tvdbId)) {
+        episode.setTvdbId(TvDbId(tvdbId));
+    }
+}
+
 } // namespace scraper
 } // namespace mediaelch
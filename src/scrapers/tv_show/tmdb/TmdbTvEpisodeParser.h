@@ -16,6 +16,8 @@ public:
     /// \param episode Where to store the episode details into.
     /// \param data JSON document from TMDB
     static void parseInfos(const TmdbApi& api, TvShowEpisode& episode, const QJsonObject& data);
+    /// \brief Assign IMDb and TheTvDb ID of TMDB's "external_ids" object to the given episode.
+    static void parseExternalIds(TvShowEpisode& episode, const QJsonObject& externalIds);
 };
 
 } // namespace scraper
@@ -20,7 +20,7 @@ void TmdbTvEpisodeScrapeJob::doStart()
     TmdbId showId(config().identifier.showIdentifier);
 
     if (!showId.isValid()) {
-        qCWarning(generic) << "[TmdbTvEpisodeScrapeJob] Invalid TMDB ID for TV show, cannot scrape episode!";
+        qCWarning(c_scraper_tmdb) << "[TmdbTvEpisodeScrapeJob] Invalid TMDB ID for TV show, cannot scrape episode!";
         ScraperError configError;
         configError.error = ScraperError::Type::ConfigError;
         configError.message = tr("TMDB show ID is invalid! Cannot load requested episode.");
@@ -29,7 +29,7 @@ void TmdbTvEpisodeScrapeJob::doStart()
         return;
     }
 
-    qCInfo(generic) << "[TmdbTvEpisodeScrapeJob] Have to load season first.";
+    qCInfo(c_scraper_tmdb) << "[TmdbTvEpisodeScrapeJob] Have to load season first.";
 
     m_api.loadEpisode(config().locale,
         showId,
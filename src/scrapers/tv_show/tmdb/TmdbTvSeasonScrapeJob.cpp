@@ -19,7 +19,7 @@ TmdbTvSeasonScrapeJob::TmdbTvSeasonScrapeJob(TmdbApi& api, SeasonScrapeJob::Conf
 void TmdbTvSeasonScrapeJob::doStart()
 {
     if (!m_showId.isValid()) {
-        qCWarning(generic) << "[TmdbTv] Provided Tmdb id is invalid:" << config().showIdentifier;
+        qCWarning(c_scraper_tmdb) << "[TmdbTv] Provided Tmdb id is invalid:" << config().showIdentifier;
         ScraperError error;
         error.error = ScraperError::Type::ConfigError;
         error.message = tr("Show is missing a TMDB id");
@@ -17,7 +17,7 @@ TmdbTvShowScrapeJob::TmdbTvShowScrapeJob(TmdbApi& api, ShowScrapeJob::Config _co
 void TmdbTvShowScrapeJob::doStart()
 {
     if (!m_id.isValid()) {
-        qCWarning(generic) << "[TmdbTv] Provided TMDB id is invalid:" << config().identifier;
+        qCWarning(c_scraper_tmdb) << "[TmdbTv] Provided TMDB id is invalid:" << config().identifier;
         ScraperError error;
         error.error = ScraperError::Type::ConfigError;
         error.message = tr("Show is missing a TMDB id");
@@ -65,28 +65,28 @@ bool TvMaze::isInitialized() const
 
 ShowSearchJob* TvMaze::search(ShowSearchJob::Config config)
 {
-    qCInfo(generic) << "[TvMaze] Search for:" << config.query;
+    qCInfo(c_scraper_tvmaze) << "[TvMaze] Search for:" << config.query;
     auto* searchJob = new TvMazeShowSearchJob(m_api, std::move(config));
     return searchJob;
 }
 
 ShowScrapeJob* TvMaze::loadShow(ShowScrapeJob::Config config)
 {
-    qCInfo(generic) << "[TvMaze] Load TV show with id:" << config.identifier;
+    qCInfo(c_scraper_tvmaze) << "[TvMaze] Load TV show with id:" << config.identifier;
     auto* loader = new TvMazeShowScrapeJob(m_api, config, this);
     return loader;
 }
 
 SeasonScrapeJob* TvMaze::loadSeasons(SeasonScrapeJob::Config config)
 {
-    qCInfo(generic) << "[TvMaze] Load season with show id:" << config.showIdentifier;
+    qCInfo(c_scraper_tvmaze) << "[TvMaze] Load season with show id:" << config.showIdentifier;
     auto* loader = new TvMazeSeasonScrapeJob(m_api, config, this);
     return loader;
 }
 
 EpisodeScrapeJob* TvMaze::loadEpisode(EpisodeScrapeJob::Config config)
 {
-    qCDebug(generic) << "[TvMaze] Load single episode of TV show with id:" << config.identifier;
+    qCDebug(c_scraper_tvmaze) << "[TvMaze] Load single episode of TV show with id:" << config.identifier;
     auto* loader = new TvMazeEpisodeScrapeJob(m_api, config, this);
     return loader;
 }
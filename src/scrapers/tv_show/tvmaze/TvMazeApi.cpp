@@ -50,7 +50,8 @@ void TvMazeApi::sendGetRequest(const QUrl& url, TvMazeApi::ApiCallback callback)
             data = QString::fromUtf8(reply->readAll());
 
         } else {
-            qCWarning(generic) << "[TvMazeApi] Network Error:" << reply->errorString() << "for URL" << reply->url();
+            qCWarning(c_scraper_tvmaze) << "[TvMazeApi] Network Error:" << reply->errorString() << "for URL"
+                                        << reply->url();
         }
 
         QJsonParseError parseError{};
@@ -33,7 +33,7 @@ void TvMazeEpisodeScrapeJob::doStart()
 void TvMazeEpisodeScrapeJob::loadAllEpisodes(const TvMazeId& showId)
 {
     if (!showId.isValid()) {
-        qCWarning(generic) << "[TvMazeEpisodeScrapeJob] Invalid TVmaze ID for TV show, cannot scrape episode!";
+        qCWarning(c_scraper_tvmaze) << "[TvMazeEpisodeScrapeJob] Invalid TVmaze ID for TV show, cannot scrape episode!";
         ScraperError configError;
         configError.error = ScraperError::Type::ConfigError;
         configError.message = tr("TVmaze show ID are valid! Cannot load requested episode.");
@@ -60,7 +60,7 @@ void TvMazeEpisodeScrapeJob::loadAllEpisodes(const TvMazeId& showId)
 void TvMazeEpisodeScrapeJob::loadEpisode(const TvMazeId& episodeId)
 {
     if (!episodeId.isValid()) {
-        qCWarning(generic) << "[TvMazeEpisodeScrapeJob] Invalid TVmaze ID, cannot scrape episode!";
+        qCWarning(c_scraper_tvmaze) << "[TvMazeEpisodeScrapeJob] Invalid TVmaze ID, cannot scrape episode!";
         ScraperError configError;
         configError.error = ScraperError::Type::ConfigError;
         configError.message = tr("TVmaze ID is invalid! Cannot load requested episode.");
@@ -69,7 +69,7 @@ void TvMazeEpisodeScrapeJob::loadEpisode(const TvMazeId& episodeId)
         return;
     }
 
-    qCInfo(generic) << "[TvMazeEpisodeScrapeJob] Loading episode with TVmaze ID" << episodeId.toString();
+    qCInfo(c_scraper_tvmaze) << "[TvMazeEpisodeScrapeJob] Loading episode with TVmaze ID" << episodeId.toString();
     m_api.loadEpisode(episodeId, [this](QJsonDocument json, ScraperError error) {
         if (error.hasError()) {
             setScraperError(error);
@@ -19,7 +19,7 @@ TvMazeSeasonScrapeJob::TvMazeSeasonScrapeJob(TvMazeApi& api, SeasonScrapeJob::Co
 void TvMazeSeasonScrapeJob::doStart()
 {
     if (!m_showId.isValid()) {
-        qCWarning(generic) << "[TmdbTv] Provided Tmdb id is invalid:" << config().showIdentifier;
+        qCWarning(c_scraper_tvmaze) << "[TmdbTv] Provided Tmdb id is invalid:" << config().showIdentifier;
         ScraperError error;
         error.error = ScraperError::Type::ConfigError;
         error.message = tr("Show is missing a TMDB id");
@@ -23,7 +23,7 @@ void TvMazeShowScrapeJob::doStart()
     TvMazeId id{config().identifier.str()};
 
     if (!id.isValid()) {
-        qCWarning(generic) << "[TvMaze] Provided TvMaze ID is invalid:" << config().identifier;
+        qCWarning(c_scraper_tvmaze) << "[TvMaze] Provided TvMaze ID is invalid:" << config().identifier;
         ScraperError error;
         error.error = ScraperError::Type::ConfigError;
         error.message = tr("TV show is missing a TVmaze ID");
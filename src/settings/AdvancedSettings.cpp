@@ -8,6 +8,8 @@
 AdvancedSettings::AdvancedSettings()
 {
     m_locale = QLocale::system();
+    m_logFileOptions.maxFileSize = 50 * 1024 * 1024;
+    m_logFileOptions.maxFiles = 2;
     m_sortTokens = QStringList{// English
         "The",
         "A",
@@ -149,6 +151,16 @@ QString AdvancedSettings::logFile() const
     return m_logFile;
 }
 
+mediaelch::LogFileOptions AdvancedSettings::logFileOptions() const
+{
+    return m_logFileOptions;
+}
+
+QMap<QString, mediaelch::LogLevel> AdvancedSettings::logLevels() const
+{
+    return m_logLevels;
+}
+
 QLocale AdvancedSettings::locale() const
 {
     return m_locale;
@@ -233,6 +245,16 @@ int AdvancedSettings::bookletCut() const
     return m_bookletCut;
 }
 
+int AdvancedSettings::customMovieScraperDeadline() const
+{
+    return m_customMovieScraperDeadline;
+}
+
+int AdvancedSettings::directoryScanThreads() const
+{
+    return m_directoryScanThreads;
+}
+
 bool AdvancedSettings::writeThumbUrlsToNfo() const
 {
     return m_writeThumbUrlsToNfo;
@@ -280,6 +302,14 @@ QDebug operator<<(QDebug dbg, const AdvancedSettings& settings)
         << QLocale::countryToString(settings.m_locale.country()) << ")" << nl;
     out << "    debugLog:                " << (settings.m_debugLog ? "true" : "false") << nl;
     out << "    logFile:                 " << settings.m_logFile << nl;
+    out << "    logFormat:               "
+        << (settings.m_logFileOptions.format == mediaelch::LogFormat::Json ? "json" : "text") << nl;
+    out << "    logMaxFileSize:          " << settings.m_logFileOptions.maxFileSize << nl;
+    out << "    logMaxFiles:             " << settings.m_logFileOptions.maxFiles << nl;
+    out << "    logLevels:               " << nl;
+    for (auto it = settings.m_logLevels.constBegin(); it != settings.m_logLevels.constEnd(); ++it) {
+        out << "        " << it.key() << ": " << mediaelch::logLevelToString(it.value()) << nl;
+    }
     out << "    stylesheet:              "
         << (settings.m_customStylesheet.isEmpty() ? "<bundled>" : settings.m_customStylesheet) << nl;
     out << "    sortTokens:              " << settings.m_sortTokens.join(", ") << nl;
@@ -313,6 +343,8 @@ QDebug operator<<(QDebug dbg, const AdvancedSettings& settings)
     out << "        width:               " << settings.m_episodeThumbnailDimensions.width << nl;
     out << "        height:              " << settings.m_episodeThumbnailDimensions.height << nl;
     out << "    bookletCut:              " << settings.m_bookletCut << nl;
+    out << "    customMovieScraperDeadline: " << settings.m_customMovieScraperDeadline << nl;
+    out << "    directoryScanThreads:    " << settings.m_directoryScanThreads << nl;
     out << "    useFirstStudioOnly:      " << (settings.m_useFirstStudioOnly ? "true" : "false") << nl;
     out << "    file exclude patterns:   " << nl;
     printRegExList(settings.m_fileExcludes);
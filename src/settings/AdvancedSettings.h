@@ -1,6 +1,7 @@
 #pragma once
 
 #include "data/ThumbnailDimensions.h"
+#include "log/Log.h"
 #include "media/FileFilter.h"
 
 #include <QDir>
@@ -8,6 +9,7 @@
 #include <QFileInfo>
 #include <QHash>
 #include <QLocale>
+#include <QMap>
 #include <QRegularExpression>
 #include <QString>
 #include <QStringList>
@@ -20,6 +22,10 @@ public:
 
     bool debugLog() const;
     QString logFile() const;
+    /// \brief Format and rotation of the log file.
+    mediaelch::LogFileOptions logFileOptions() const;
+    /// \brief Minimum log levels of logging categories, e.g. "scraper.tmdb".
+    QMap<QString, mediaelch::LogLevel> logLevels() const;
     QLocale locale() const;
     QStringList sortTokens() const;
     QString customStylesheet() const;
@@ -40,6 +46,11 @@ public:
     bool useFirstStudioOnly() const;
     bool portableMode() const;
     int bookletCut() const;
+    /// \brief Seconds after which the custom movie scraper stops waiting for its scrapers.
+    /// \details 0 means that there is no deadline.
+    int customMovieScraperDeadline() const;
+    /// \brief Number of directories of a media directory that are read at the same time.
+    int directoryScanThreads() const;
     bool writeThumbUrlsToNfo() const;
     mediaelch::ThumbnailDimensions episodeThumbnailDimensions() const;
 
@@ -56,6 +67,8 @@ private:
 private:
     bool m_debugLog = false;
     QString m_logFile;
+    mediaelch::LogFileOptions m_logFileOptions;
+    QMap<QString, mediaelch::LogLevel> m_logLevels;
     QLocale m_locale;
     QStringList m_sortTokens;
     QString m_customStylesheet;
@@ -74,6 +87,8 @@ private:
     QVector<QRegularExpression> m_fileExcludes;
     QVector<QRegularExpression> m_folderExcludes;
     int m_bookletCut = 2;
+    int m_customMovieScraperDeadline = 30;
+    int m_directoryScanThreads = 4;
     bool m_portableMode = false;
     bool m_writeThumbUrlsToNfo = true;
     bool m_useFirstStudioOnly = false;
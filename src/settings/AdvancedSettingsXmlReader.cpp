@@ -128,6 +128,14 @@ void AdvancedSettingsXmlReader::parseSettings(const QString& xmlSource)
         } else if (m_xml.name() == QLatin1String("bookletCut")) {
             expectInt(m_settings.m_bookletCut);
 
+        } else if (m_xml.name() == QLatin1String("customMovieScraperDeadline")) {
+            const auto inRange = [](int seconds) { return seconds >= 0 && seconds <= 3600; };
+            expectIntChecked(m_settings.m_customMovieScraperDeadline, inRange);
+
+        } else if (m_xml.name() == QLatin1String("directoryScanThreads")) {
+            const auto inRange = [](int threads) { return threads >= 1 && threads <= 64; };
+            expectIntChecked(m_settings.m_directoryScanThreads, inRange);
+
         } else if (m_xml.name() == QLatin1String("sorttokens")) {
             loadSortTokens();
 
@@ -166,17 +174,13 @@ void AdvancedSettingsXmlReader::parseSettings(const QString& xmlSource)
 
     // Proper setup of file filters: m_fileExcludes / m_folderExcludes may be
     // used generically, but in the end, we have different file filters.
-    m_settings.m_movieFilters.fileExcludes = m_settings.m_fileExcludes;
-    m_settings.m_concertFilters.fileExcludes = m_settings.m_fileExcludes;
-    m_settings.m_tvShowFilters.fileExcludes = m_settings.m_fileExcludes;
-    m_settings.m_musicFilters.fileExcludes = m_settings.m_fileExcludes;
-    m_settings.m_subtitleFilters.fileExcludes = m_settings.m_fileExcludes;
-
-    m_settings.m_movieFilters.folderExcludes = m_settings.m_folderExcludes;
-    m_settings.m_concertFilters.folderExcludes = m_settings.m_folderExcludes;
-    m_settings.m_tvShowFilters.folderExcludes = m_settings.m_folderExcludes;
-    m_settings.m_musicFilters.folderExcludes = m_settings.m_folderExcludes;
-    m_settings.m_subtitleFilters.folderExcludes = m_settings.m_folderExcludes;
+    for (mediaelch::FileFilter* filter : {&m_settings.m_movieFilters,
+             &m_settings.m_concertFilters,
+             &m_settings.m_tvShowFilters,
+             &m_settings.m_musicFilters,
+             &m_settings.m_subtitleFilters}) {
+        filter->setExcludes(m_settings.m_fileExcludes, m_settings.m_folderExcludes);
+    }
 }
 
 void AdvancedSettingsXmlReader::loadLog()
@@ -186,6 +190,47 @@ void AdvancedSettingsXmlReader::loadLog()
             expectBool(m_settings.m_debugLog);
         } else if (m_xml.name() == QLatin1String("file")) {
             m_settings.m_logFile = m_xml.readElementText().trimmed();
+        } else if (m_xml.name() == QLatin1String("format")) {
+            const QString format = m_xml.readElementText().trimmed().toLower();
+            if (format == "text") {
+                m_settings.m_logFileOptions.format = mediaelch::LogFormat::Text;
+            } else if (format == "json") {
+                m_settings.m_logFileOptions.format = mediaelch::LogFormat::Json;
+            } else {
+                invalidValue();
+            }
+        } else if (m_xml.name() == QLatin1String("maxFileSize")) {
+            // In MiB; 0 disables rotation.
+            constexpr qint64 mebibyte = 1024 * 1024;
+            int maxFileSize = static_cast<int>(m_settings.m_logFileOptions.maxFileSize / mebibyte);
+            expectIntChecked(maxFileSize, [](int size) { return size >= 0 && size <= 1024 * 1024; });
+            m_settings.m_logFileOptions.maxFileSize = maxFileSize * mebibyte;
+        } else if (m_xml.name() == QLatin1String("maxFiles")) {
+            const auto inRange = [](int files) { return files >= 0 && files <= 100; };
+            expectIntChecked(m_settings.m_logFileOptions.maxFiles, inRange);
+        } else if (m_xml.name() == QLatin1String("levels")) {
+            loadLogLevels();
+        } else {
+            skipUnsupportedTag();
+        }
+    }
+}
+
+void AdvancedSettingsXmlReader::loadLogLevels()
+{
+    m_settings.m_logLevels.clear();
+    while (m_xml.readNextStartElement()) {
+        if (m_xml.name() == QLatin1String("level")) {
+            const QString category = m_xml.attributes().value("category").trimmed().toString();
+            mediaelch::LogLevel level = mediaelch::LogLevel::Debug;
+            const bool isValidLevel = mediaelch::logLevelFromString(m_xml.readElementText(), level);
+            if (category.isEmpty()) {
+                addError("level", ParseErrorType::InvalidAttributeValue);
+            } else if (!isValidLevel) {
+                invalidValue();
+            } else {
+                m_settings.m_logLevels.insert(category, level);
+            }
         } else {
             skipUnsupportedTag();
         }
@@ -40,6 +40,7 @@ private:
     void parseSettings(const QString& xmlSource);
 
     void loadLog();
+    void loadLogLevels();
     void loadGui();
     void loadSortTokens();
     void loadFilters();
@@ -10,6 +10,7 @@
 #include <QElapsedTimer>
 #include <QFile>
 #include <QFileDialog>
+#include <QFileInfo>
 #include <QRegularExpression>
 
 CsvExportDialog::CsvExportDialog(Settings& settings, QWidget* parent) :
@@ -121,6 +122,12 @@ void CsvExportDialog::onExport()
 
     QDir exportDir(location);
 
+    m_manifest.reset();
+    if (ui->checkUpdateExisting->isChecked()) {
+        m_manifest = std::make_unique<mediaelch::ExportManifest>(exportDir);
+        m_manifest->load();
+    }
+
     // Movies ------------------------------------------
     if (!m_shouldAbort && ui->checkMovies->isChecked()) {
         const QVector<Movie*>& movies = Manager::instance()->movieModel()->movies();
@@ -222,6 +229,10 @@ void CsvExportDialog::onExport()
         }
     }
     // ------------------------------------------
+    if (m_manifest != nullptr) {
+        m_manifest->save();
+        m_manifest.reset();
+    }
     if (!m_shouldAbort) {
         QString secondsElapsed = QString::number(static_cast<double>(timer.elapsed()) / 1000.0);
         ui->lblMessage->setSuccessMessage(tr("Export completed in %1 seconds.").arg(secondsElapsed));
@@ -558,6 +569,10 @@ bool CsvExportDialog::checkTextStreamStatus(QTextStream& stream)
 
 QString CsvExportDialog::exportFilePath(const QDir& dir, const QString& filename) const
 {
+    if (m_manifest != nullptr) {
+        // Existing exports are updated in-place, so the file name must be stable.
+        return dir.path() + "/" + QStringLiteral("MediaElch_%1.csv").arg(filename);
+    }
     return dir.path() + "/" + defaultCsvFileName(filename);
 }
 
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "export/CsvExport.h"
+#include "export/ExportManifest.h"
 
 #include <QDialog>
 #include <QDir>
+#include <QFileInfo>
 #include <QListWidget>
 #include <QListWidgetItem>
+#include <memory>
 
 namespace Ui {
 class CsvExportDialog;
@@ -66,11 +69,10 @@ private:
     template<typename T>
     void openFileWithStream(QFile& file, T callback)
     {
-        bool isOpen = openFileOrPrintError(file);
-        if (!isOpen) {
-            return;
-        }
-        QTextStream out(&file);
+        // The CSV is generated in memory first, so that unchanged files are not
+        // written again when updating an existing export.
+        QByteArray content;
+        QTextStream out(&content, QIODevice::WriteOnly);
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
         // Default in Qt6
         out.setCodec("UTF-8");
@@ -78,10 +80,20 @@ private:
         // UTF-8 BOM required for e.g. Excel
         out.setGenerateByteOrderMark(true);
         callback(out);
-        // flush before closing the file or the data won't be written
         out.flush();
-        file.close();
         m_shouldAbort = !checkTextStreamStatus(out);
+        if (m_shouldAbort) {
+            return;
+        }
+        if (m_manifest != nullptr && !m_manifest->updateFile(QFileInfo(file.fileName()).fileName(), content)) {
+            return;
+        }
+        bool isOpen = openFileOrPrintError(file);
+        if (!isOpen) {
+            return;
+        }
+        file.write(content);
+        file.close();
     }
 
     bool openFileOrPrintError(QFile& file);
@@ -94,4 +106,6 @@ private:
     Ui::CsvExportDialog* ui;
     Settings& m_settings;
     bool m_shouldAbort = false;
+    /// Only set if an existing export is updated.
+    std::unique_ptr<mediaelch::ExportManifest> m_manifest;
 };
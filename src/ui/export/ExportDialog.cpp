@@ -71,15 +71,22 @@ void ExportDialog::onBtnExport()
         return;
     }
 
-    QDir dir(location);
-    QString subDir =
-        QStringLiteral("MediaElch Export %1").arg(QDateTime::currentDateTime().toString("yyyy-MM-dd hh-mm-ss"));
-    if (!dir.mkdir(subDir)) {
-        ui->message->setErrorMessage(tr("Could not create export directory."));
-        return;
+    // Incremental exports update the selected directory directly.
+    const bool isIncremental = ui->chkIncremental->isChecked();
+    QString exportPath = location;
+    if (!isIncremental) {
+        QDir dir(location);
+        QString subDir =
+            QStringLiteral("MediaElch Export %1").arg(QDateTime::currentDateTime().toString("yyyy-MM-dd hh-mm-ss"));
+        if (!dir.mkdir(subDir)) {
+            ui->message->setErrorMessage(tr("Could not create export directory."));
+            return;
+        }
+        exportPath = location + "/" + subDir;
     }
 
     mediaelch::MediaExport exporter(m_canceled);
+    exporter.setIncremental(isIncremental);
     connect(&exporter, &mediaelch::MediaExport::sigItemExported, this, [&]() { //
         ui->progressBar->setValue(++m_itemsExported);
     });
@@ -87,7 +94,7 @@ void ExportDialog::onBtnExport()
     ui->btnExport->setEnabled(false);
     ui->progressBar->setRange(0, libraryItemCount(sections));
 
-    exporter.doExport(*exportTemplate, location + "/" + subDir, sections);
+    exporter.doExport(*exportTemplate, exportPath, sections);
 
     ui->progressBar->setValue(ui->progressBar->maximum());
 
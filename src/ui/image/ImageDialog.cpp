@@ -10,6 +10,8 @@
 #include "globals/Helper.h"
 #include "globals/Manager.h"
 #include "log/Log.h"
+#include "media/ImageCache.h"
+#include "media/ImageUtils.h"
 #include "media/NameFormatter.h"
 #include "network/NetworkRequest.h"
 #include "scrapers/image/ImageProvider.h"
@@ -18,13 +20,67 @@
 
 #include <QBuffer>
 #include <QFileDialog>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QImageReader>
 #include <QLabel>
 #include <QMovie>
 #include <QPainter>
+#include <QSaveFile>
 #include <QSize>
 #include <QTimer>
+#include <QtConcurrent>
 #include <QtCore/qmath.h>
 
+namespace {
+
+// Number of previews that are downloaded at the same time.
+constexpr int MAX_PARALLEL_DOWNLOADS = 6;
+
+/// \brief URL of a small version of the image, which is sufficient for the preview table.
+/// \details Some providers only return the original image. For TMDB and Fanart.tv,
+///          a smaller size variant can be requested instead.
+QUrl previewUrlFor(const QUrl& thumbUrl, const QUrl& originalUrl)
+{
+    QUrl url = thumbUrl.isValid() ? thumbUrl : originalUrl;
+    if (url.isLocalFile()) {
+        return url;
+    }
+    QString path = url.path();
+    if (url.host().endsWith("image.tmdb.org") && path.startsWith("/t/p/original/")) {
+        path.replace(0, qsizetype_to_int(QStringLiteral("/t/p/original/").size()), "/t/p/w500/");
+        url.setPath(path);
+    } else if (url.host().endsWith("fanart.tv") && path.contains("/fanart/")) {
+        url.setPath(path.replace("/fanart/", "/preview/"));
+    }
+    return url;
+}
+
+/// \brief Decode the local image file scaled to the given width.
+/// \details The resolution is read from the image's header, so that large images can be
+///          decoded at a smaller size, e.g. JPEGs at 1/2, 1/4 or 1/8 of their resolution.
+QPixmap loadScaledPixmap(const QString& fileName, int width, QSize& resolution)
+{
+    resolution = ImageCache::instance()->imageHeader(mediaelch::FilePath(fileName)).size;
+    QImageReader reader(fileName);
+    if (!resolution.isValid()) {
+        resolution = reader.size();
+    }
+    if (resolution.isValid() && resolution.width() > width) {
+        reader.setScaledSize(mediaelch::scaledSize(resolution, {width, 0}));
+    }
+    QImage image = reader.read();
+    if (!resolution.isValid()) {
+        resolution = image.size();
+    }
+    if (!image.isNull() && image.width() != width) {
+        image = image.scaledToWidth(width, Qt::SmoothTransformation);
+    }
+    return QPixmap::fromImage(image);
+}
+
+} // namespace
+
 ImageDialog::ImageDialog(QWidget* parent) : QDialog(parent), ui(new Ui::ImageDialog)
 {
     using namespace mediaelch::scraper;
@@ -245,8 +301,19 @@ void ImageDialog::setAndStartDownloads(const QVector<Poster>& downloads)
         }
     }
 
+    const int firstIndex = qsizetype_to_int(m_elements.size());
     m_elements << preferredElements << otherElements;
 
+    for (int i = firstIndex, n = qsizetype_to_int(m_elements.size()); i < n; ++i) {
+        const QUrl url = previewUrlFor(m_elements[i].thumbUrl, m_elements[i].originalUrl);
+        auto it = m_elementsByPreviewUrl.find(url);
+        if (it == m_elementsByPreviewUrl.end()) {
+            it = m_elementsByPreviewUrl.insert(url, {});
+            m_downloadQueue.append(url);
+        }
+        it.value().append(i);
+    }
+
     ui->labelLoading->setVisible(true);
     ui->labelSpinner->setVisible(true);
     renderTable();
@@ -318,72 +385,118 @@ void ImageDialog::resizeAndReposition()
 
 void ImageDialog::startNextDownload()
 {
-    qCDebug(generic) << "[ImageDialog] Start next download";
-
-    elch_ssize_t nextIndex = -1;
-    for (elch_ssize_t i = 0, n = m_elements.size(); i < n; i++) {
-        if (!m_elements[i].downloaded) {
-            nextIndex = i;
-            break;
+    while (!m_downloadQueue.isEmpty() && m_downloadReplies.size() < MAX_PARALLEL_DOWNLOADS) {
+        const QUrl url = m_downloadQueue.takeFirst();
+        const QString cacheFile = ImageCache::instance()->previewCacheFilePath(url);
+        ++m_pendingPreviews;
+
+        if (!cacheFile.isEmpty() && QFileInfo::exists(cacheFile)) {
+            decodePreview(url, {}, cacheFile);
+            continue;
         }
+
+        qCDebug(generic) << "[ImageDialog] Start download of" << url;
+        QNetworkReply* reply = network()->get(mediaelch::network::requestWithDefaults(url));
+        m_downloadReplies.append(reply);
+        const int generation = m_downloadGeneration;
+        connect(reply, &QNetworkReply::finished, this, [this, reply, url, generation]() {
+            downloadFinished(reply, url, generation);
+        });
     }
 
-    if (nextIndex == -1) {
+    if (m_downloadQueue.isEmpty() && m_pendingPreviews == 0) {
         ui->labelLoading->setVisible(false);
         ui->labelSpinner->setVisible(false);
-        return;
     }
-
-    const QUrl url = m_elements[nextIndex].thumbUrl.isValid() //
-                         ? m_elements[nextIndex].thumbUrl
-                         : m_elements[nextIndex].originalUrl;
-
-    m_currentDownloadIndex = qsizetype_to_int(nextIndex);
-    m_currentDownloadReply = network()->get(mediaelch::network::requestWithDefaults(url));
-    connect(m_currentDownloadReply, &QNetworkReply::finished, this, &ImageDialog::downloadFinished);
 }
 
-void ImageDialog::downloadFinished()
+void ImageDialog::downloadFinished(QNetworkReply* reply, const QUrl& previewUrl, int generation)
 {
-    if (m_currentDownloadReply == nullptr) {
-        // In case that the dialog was cancelled, the pointer resetted, and
-        // this signal handler is still reached.
+    reply->deleteLater();
+    if (generation != m_downloadGeneration) {
+        // The downloads were cancelled via abort() or close() and m_elements may have been cleared.
         return;
     }
-    if (m_currentDownloadReply->error() == QNetworkReply::OperationCanceledError) {
-        // It is possible that m_elements has been cleared by aborting all downloads
-        // via abort() or close().
-        m_currentDownloadReply->deleteLater();
-        m_currentDownloadReply = nullptr;
-        return;
+    m_downloadReplies.removeOne(reply);
+
+    if (reply->error() == QNetworkReply::NoError) {
+        decodePreview(previewUrl, reply->readAll(), ImageCache::instance()->previewCacheFilePath(previewUrl));
+
+    } else {
+        showError(tr("Error while downloading one or more images: %1").arg(reply->errorString()));
+        qCWarning(generic) << "Network Error: " << reply->errorString() << " | " << reply->url();
+        // Mark items as downloaded even if there was a network error to avoid an infinite loop.
+        previewLoaded(previewUrl, {});
     }
 
-    // Mark item as downloaded even if there was a network error to avoid an infinite loop.
-    m_elements[m_currentDownloadIndex].downloaded = true;
+    startNextDownload();
+}
 
-    if (m_currentDownloadReply->error() == QNetworkReply::NoError) {
-        DownloadElement& element = m_elements[m_currentDownloadIndex];
-        element.pixmap.loadFromData(m_currentDownloadReply->readAll());
-        element.pixmap.setDevicePixelRatio(devicePixelRatioF());
+void ImageDialog::decodePreview(const QUrl& previewUrl, const QByteArray& data, const QString& cacheFile)
+{
+    const int width = static_cast<int>((getColumnWidth() - 10) * devicePixelRatioF());
+    const int generation = m_downloadGeneration;
+
+    auto* watcher = new QFutureWatcher<DecodedPreview>(this);
+    connect(watcher, &QFutureWatcher<DecodedPreview>::finished, this, [this, watcher, previewUrl, generation]() {
+        watcher->deleteLater();
+        if (generation == m_downloadGeneration) {
+            previewLoaded(previewUrl, watcher->result());
+            startNextDownload();
+        }
+    });
+
+    // Decoding and scaling large images takes a while; don't block the GUI thread.
+    watcher->setFuture(QtConcurrent::run([data, cacheFile, width]() {
+        QByteArray bytes = data;
+        if (bytes.isEmpty()) {
+            QFile file(cacheFile);
+            if (file.open(QIODevice::ReadOnly)) {
+                bytes = file.readAll();
+            }
+        }
 
-        if (!element.pixmap.isNull()) {
-            const int width = static_cast<int>((getColumnWidth() - 10) * devicePixelRatioF());
-            element.scaledPixmap = element.pixmap.scaledToWidth(width, Qt::SmoothTransformation);
-            element.scaledPixmap.setDevicePixelRatio(devicePixelRatioF());
-            element.cellWidget->setImage(element.scaledPixmap);
-            element.cellWidget->setHint(element.resolution, element.hint);
+        DecodedPreview preview;
+        if (!preview.image.loadFromData(bytes)) {
+            return preview;
+        }
+        // Only cache images that could be decoded. Reopening the dialog then doesn't need any download.
+        if (!data.isEmpty() && !cacheFile.isEmpty()) {
+            QSaveFile file(cacheFile);
+            if (file.open(QIODevice::WriteOnly) && file.write(data) == data.size()) {
+                file.commit();
+            }
         }
-        ui->table->resizeRowsToContents();
+        preview.scaledImage = preview.image.scaledToWidth(width, Qt::SmoothTransformation);
+        return preview;
+    }));
+}
 
-    } else {
-        showError(tr("Error while downloading one or more images: %1").arg(m_currentDownloadReply->errorString()));
-        qCWarning(generic) << "Network Error: " << m_currentDownloadReply->errorString() << " | "
-                           << m_currentDownloadReply->url();
+void ImageDialog::previewLoaded(const QUrl& previewUrl, const DecodedPreview& preview)
+{
+    --m_pendingPreviews;
+
+    QPixmap pixmap;
+    QPixmap scaledPixmap;
+    if (!preview.image.isNull()) {
+        pixmap = QPixmap::fromImage(preview.image);
+        pixmap.setDevicePixelRatio(devicePixelRatioF());
+        scaledPixmap = QPixmap::fromImage(preview.scaledImage);
+        scaledPixmap.setDevicePixelRatio(devicePixelRatioF());
     }
 
-    m_currentDownloadReply->deleteLater();
-    m_currentDownloadReply = nullptr;
-    startNextDownload();
+    const QVector<int> indexes = m_elementsByPreviewUrl.value(previewUrl);
+    for (const int index : indexes) {
+        DownloadElement& element = m_elements[index];
+        element.downloaded = true;
+        if (!pixmap.isNull()) {
+            element.pixmap = pixmap;
+            element.scaledPixmap = scaledPixmap;
+            element.cellWidget->setImage(element.scaledPixmap);
+            element.cellWidget->setHint(element.resolution, element.hint);
+        }
+    }
+    ui->table->resizeRowsToContents();
 }
 
 void ImageDialog::renderTable()
@@ -516,13 +629,21 @@ void ImageDialog::cancelDownloads()
     ui->labelLoading->setVisible(false);
     ui->labelSpinner->setVisible(false);
 
-    if (m_currentDownloadReply != nullptr && m_currentDownloadReply->isRunning()) {
+    // Results of running downloads and decodings are discarded.
+    ++m_downloadGeneration;
+
+    QVector<QNetworkReply*> replies;
+    replies.swap(m_downloadReplies);
+    if (!replies.isEmpty()) {
         qCDebug(generic) << "[ImageDialog] Canceling current downloads";
-        m_currentDownloadReply->abort();
+    }
+    for (QNetworkReply* reply : asConst(replies)) {
+        reply->abort();
     }
 
-    m_currentDownloadIndex = 0;
-    m_currentDownloadReply = nullptr;
+    m_downloadQueue.clear();
+    m_elementsByPreviewUrl.clear();
+    m_pendingPreviews = 0;
     m_elements.clear();
 }
 
@@ -554,10 +675,10 @@ void ImageDialog::chooseLocalImage()
     m_elements.append(d);
 
     renderTable();
-    m_elements[index].pixmap = QPixmap(fileName);
-    m_elements[index].pixmap = m_elements[index].pixmap.scaledToWidth(getColumnWidth() - 10, Qt::SmoothTransformation);
+    QSize resolution;
+    m_elements[index].pixmap = loadScaledPixmap(fileName, getColumnWidth() - 10, resolution);
     m_elements[index].cellWidget->setImage(m_elements[index].pixmap);
-    m_elements[index].cellWidget->setHint(m_elements[index].pixmap.size());
+    m_elements[index].cellWidget->setHint(resolution);
     ui->table->resizeRowsToContents();
     m_elements[index].downloaded = true;
     if (m_multiSelection) {
@@ -595,11 +716,10 @@ void ImageDialog::onImageDropped(QUrl url)
     renderTable();
 
     if (url.toString().startsWith("file://")) {
-        m_elements[index].pixmap = QPixmap(url.toLocalFile());
-        m_elements[index].pixmap =
-            m_elements[index].pixmap.scaledToWidth(getColumnWidth() - 10, Qt::SmoothTransformation);
+        QSize resolution;
+        m_elements[index].pixmap = loadScaledPixmap(url.toLocalFile(), getColumnWidth() - 10, resolution);
         m_elements[index].cellWidget->setImage(m_elements[index].pixmap);
-        m_elements[index].cellWidget->setHint(m_elements[index].pixmap.size());
+        m_elements[index].cellWidget->setHint(resolution);
     }
     ui->table->resizeRowsToContents();
     m_elements[index].downloaded = true;
@@ -9,6 +9,8 @@
 #include "scrapers/image/ImageProvider.h"
 
 #include <QDialog>
+#include <QHash>
+#include <QImage>
 #include <QLabel>
 #include <QNetworkReply>
 #include <QResizeEvent>
@@ -64,9 +66,8 @@ protected:
     void resizeEvent(QResizeEvent* event) override;
 
 private slots:
-    /// \brief Called when a download has finished
-    /// \details Renders the table and displays the downloaded image and starts the next download
-    void downloadFinished();
+    /// \brief Starts downloads until the maximum number of parallel downloads is reached.
+    /// \details Previews that are in the preview cache are not downloaded but loaded from disk.
     void startNextDownload();
     void imageClicked(int row, int col);
     void chooseLocalImage();
@@ -108,10 +109,23 @@ private:
         constexpr static int isDefaultProvider = Qt::UserRole + 1;
     };
 
+    struct DecodedPreview
+    {
+        QImage image;
+        QImage scaledImage;
+    };
+
     mediaelch::network::NetworkManager m_network;
-    int m_currentDownloadIndex = 0;
-    QNetworkReply* m_currentDownloadReply{nullptr};
     QVector<DownloadElement> m_elements;
+    /// Preview URLs that still need to be loaded. Each URL is only listed once.
+    QVector<QUrl> m_downloadQueue;
+    /// Indexes into m_elements for each preview URL. Providers may list the same image more than once.
+    QHash<QUrl, QVector<int>> m_elementsByPreviewUrl;
+    QVector<QNetworkReply*> m_downloadReplies;
+    /// Number of previews that are being downloaded or decoded.
+    int m_pendingPreviews = 0;
+    /// Incremented by cancelDownloads() so that results of old downloads are discarded.
+    int m_downloadGeneration = 0;
     QUrl m_imageUrl;
     QVector<QUrl> m_imageUrls;
     ImageType m_type{ImageType::None};
@@ -131,6 +145,13 @@ private:
 
 private:
     void setAndStartDownloads(const QVector<Poster>& downloads);
+    /// \brief Called when a download has finished. Decodes the image and starts the next download.
+    void downloadFinished(QNetworkReply* reply, const QUrl& previewUrl, int generation);
+    /// \brief Decodes and scales the preview in a worker thread. If data is empty, the
+    ///        preview is read from the cache file. Otherwise, data is written to it.
+    void decodePreview(const QUrl& previewUrl, const QByteArray& data, const QString& cacheFile);
+    /// \brief Displays the decoded preview in all cells that show the given preview URL.
+    void previewLoaded(const QUrl& previewUrl, const DecodedPreview& preview);
 
     mediaelch::network::NetworkManager* network();
     void setupProviderCombo();
@@ -10,10 +10,12 @@
 #include "scrapers/movie/custom/CustomMovieScraper.h"
 #include "settings/Settings.h"
 #include "ui/notifications/Notificator.h"
+#include "utils/Time.h"
 
 #include <QMessageBox>
 #include <QMovie>
 #include <QRegularExpression>
+#include <algorithm>
 
 ImportDialog::ImportDialog(QWidget* parent) : QDialog(parent), ui(new Ui::ImportDialog)
 {
@@ -29,8 +31,6 @@ ImportDialog::ImportDialog(QWidget* parent) : QDialog(parent), ui(new Ui::Import
     loadingMovie->start();
     ui->loading->setMovie(loadingMovie);
 
-    m_timer.setInterval(500);
-
     m_posterDownloadManager = new DownloadManager(this);
     connect(m_posterDownloadManager,
         &DownloadManager::sigDownloadFinished,
@@ -42,7 +42,6 @@ ImportDialog::ImportDialog(QWidget* parent) : QDialog(parent), ui(new Ui::Import
     connect(ui->concertSearchWidget, &ConcertSearchWidget::sigResultClicked, this, &ImportDialog::onConcertChosen);
     connect(ui->tvShowSearchWidget, &TvShowSearchWidget::sigResultClicked, this, &ImportDialog::onTvShowChosen);
     connect(ui->btnImport, &QAbstractButton::clicked, this, &ImportDialog::onImport);
-    connect(&m_timer, &QTimer::timeout, this, &ImportDialog::onFileWatcherTimeout);
 }
 
 ImportDialog::~ImportDialog()
@@ -609,51 +608,47 @@ void ImportDialog::onImport()
     ui->loading->setVisible(true);
     ui->btnImport->setEnabled(false);
     ui->btnReject->setEnabled(false);
+    // Files must not be moved while their NFO files and images are still being written.
+    Manager::instance()->saveQueue()->waitForDone();
     m_worker = new FileWorker();
     m_worker->setFiles(m_filesToMove);
     m_workerThread = new QThread(this);
+    m_importText = ui->labelLoading->text();
     if (ui->chkKeepSourceFiles->isChecked()) {
         connect(m_workerThread.data(), &QThread::started, m_worker.data(), &FileWorker::copyFiles);
     } else {
         connect(m_workerThread.data(), &QThread::started, m_worker.data(), &FileWorker::moveFiles);
     }
+    connect(m_worker.data(), &FileWorker::sigProgress, this, &ImportDialog::onFileProgress);
     connect(m_workerThread.data(), &QThread::finished, m_worker.data(), &QObject::deleteLater);
     connect(m_workerThread.data(), &QThread::finished, m_workerThread.data(), &QObject::deleteLater);
     connect(m_worker.data(), &FileWorker::sigFinished, m_workerThread.data(), &QThread::quit);
     connect(m_worker.data(), &FileWorker::sigFinished, this, &ImportDialog::onMovingFilesFinished);
     m_worker->moveToThread(m_workerThread);
     m_workerThread->start();
-    m_timer.start();
 }
 
-void ImportDialog::onFileWatcherTimeout()
+void ImportDialog::onFileProgress(qint64 bytesCopied, qint64 bytesTotal, qint64 bytesPerSecond)
 {
-    qint64 sourceSize = 0;
-    qint64 destinationSize = 0;
-    QMapIterator<QString, QString> it(m_filesToMove);
-    while (it.hasNext()) {
-        it.next();
-        QFileInfo sourceFi(it.key());
-        sourceSize += sourceFi.size();
-
-        QFileInfo destFi(it.value());
-        if (!destFi.exists()) {
-            continue;
-        }
-        destinationSize += destFi.size();
+    if (bytesTotal <= 0) {
+        return;
     }
+    ui->progressBar->setValue(static_cast<int>(bytesCopied * 100 / bytesTotal));
 
-    if (sourceSize == 0) {
+    if (bytesPerSecond <= 0) {
         return;
     }
-
-    ui->progressBar->setValue(qRound(static_cast<float>(destinationSize) * 100.0f / static_cast<float>(sourceSize)));
+    const QLocale locale = Settings::instance()->advanced()->locale();
+    const auto remaining = static_cast<quint32>(std::max<qint64>(0, bytesTotal - bytesCopied) / bytesPerSecond);
+    ui->labelLoading->setText(tr("%1 %2/s, %3 remaining")
+                                  .arg(m_importText,
+                                      helper::formatFileSize(static_cast<int64_t>(bytesPerSecond), locale),
+                                      mediaelch::secondsToTimeCode(remaining)));
 }
 
 void ImportDialog::onMovingFilesFinished()
 {
     ui->progressBar->setValue(100);
-    m_timer.stop();
     if (m_type == "movie") {
         m_movie->setFiles(m_newFiles);
         m_movie->setInSeparateFolder(m_separateFolders);
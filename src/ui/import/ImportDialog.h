@@ -13,7 +13,6 @@
 #include <QDialog>
 #include <QPointer>
 #include <QThread>
-#include <QTimer>
 
 namespace Ui {
 class ImportDialog;
@@ -49,7 +48,7 @@ private slots:
     void onTvShowChosen();
     void onEpisodeLoadDone(TvShowEpisode* episode);
     void onImport();
-    void onFileWatcherTimeout();
+    void onFileProgress(qint64 bytesCopied, qint64 bytesTotal, qint64 bytesPerSecond);
     void onMovingFilesFinished();
     void onEpisodeDownloadFinished(DownloadManagerElement elem);
 
@@ -64,11 +63,12 @@ private:
     QStringList m_extraFiles;
     QString m_importDir;
     bool m_separateFolders = false;
-    QTimer m_timer;
     QMap<QString, QString> m_filesToMove;
     QPointer<QThread> m_workerThread;
     QPointer<FileWorker> m_worker;
     QStringList m_newFiles;
+    /// Text of the loading label before any progress was added.
+    QString m_importText;
     DownloadManager* m_posterDownloadManager = nullptr;
 
     void setDefaults(RenameType renameType);
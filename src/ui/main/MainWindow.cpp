@@ -3,6 +3,7 @@
 
 #include "data/Filter.h"
 #include "globals/Manager.h"
+#include "globals/MessageIds.h"
 #include "log/Log.h"
 #include "scrapers/TvShowUpdater.h"
 #include "settings/Settings.h"
@@ -104,6 +105,7 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent), ui(new Ui::MainWi
     NotificationBox::instance(this)->reposition(this->size());
     Manager::instance();
     Notificator::instance(nullptr, ui->centralWidget);
+    setupSaveQueue();
 
     if (!m_settings->mainSplitterState().isNull()) {
         ui->movieSplitter->restoreState(m_settings->mainSplitterState());
@@ -280,12 +282,41 @@ void MainWindow::resizeEvent(QResizeEvent* event)
 
 void MainWindow::closeEvent(QCloseEvent* /*event*/)
 {
+    // Don't quit before all NFO files and images are written.
+    Manager::instance()->saveQueue()->waitForDone();
     m_settings->setMainWindowSize(size());
     m_settings->setMainWindowPosition(pos());
     m_settings->setMainSplitterState(ui->movieSplitter->saveState());
     m_settings->setMainWindowMaximized(isMaximized());
 }
 
+void MainWindow::setupSaveQueue()
+{
+    // NFO files and artwork are written in the background, so that saving many items doesn't block the GUI.
+    Manager::instance()->setSaveInBackground(true);
+    mediaelch::SaveQueue* saveQueue = Manager::instance()->saveQueue();
+
+    connect(saveQueue, &mediaelch::SaveQueue::progress, this, [](int savedItems, int totalItems) {
+        if (totalItems < 2) {
+            return; // Don't show a progress bar for single items.
+        }
+        NotificationBox::instance()->showProgressBar(
+            tr("Writing NFO files and images"), Constants::SaveQueueProgressMessageId, true);
+        NotificationBox::instance()->progressBarProgress(
+            savedItems, totalItems, Constants::SaveQueueProgressMessageId);
+    });
+    connect(saveQueue, &mediaelch::SaveQueue::allSaved, this, []() {
+        NotificationBox::instance()->hideProgressBar(Constants::SaveQueueProgressMessageId);
+    });
+    connect(saveQueue,
+        &mediaelch::SaveQueue::saveFailed,
+        this,
+        [](QString /*itemKey*/, QString filePath, QString errorString) {
+            NotificationBox::instance()->showError(
+                tr("Could not save %1: %2").arg(QDir::toNativeSeparators(filePath), errorString));
+        });
+}
+
 void MainWindow::setupToolbar()
 {
     // clang-format off
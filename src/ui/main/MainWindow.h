@@ -72,6 +72,7 @@ private slots:
 
 private:
     MainWidgets currentTab() const;
+    void setupSaveQueue();
     void setupToolbar();
     void setIcons(QToolButton* button);
 
@@ -14,6 +14,15 @@
 // KodiSync uses the Kodi JSON-RPC API
 // See: https://kodi.wiki/view/JSON-RPC_API
 
+namespace {
+
+/// Number of JSON-RPC calls per HTTP request.
+constexpr int REMOVE_BATCH_SIZE = 100;
+/// Number of HTTP requests that are sent to Kodi at the same time.
+constexpr int MAX_REMOVE_REQUESTS_IN_FLIGHT = 2;
+
+} // namespace
+
 KodiSync::KodiSync(Settings& settings, QWidget* parent) :
     QDialog(parent),
     ui(new Ui::KodiSync),
@@ -57,10 +66,10 @@ int KodiSync::exec()
     ui->progressBar->setVisible(false);
 
     if (!m_settings.networkSettings().useProxyForKodi()) {
-        qCDebug(generic) << "[KodiSync] Disabled Proxy";
+        qCDebug(c_kodi) << "[KodiSync] Disabled Proxy";
         m_network.disableProxy();
     } else {
-        qCDebug(generic) << "[KodiSync] Enabled Proxy";
+        qCDebug(c_kodi) << "[KodiSync] Enabled Proxy";
         m_network.enableDefaultProxy();
     }
 
@@ -90,7 +99,7 @@ void KodiSync::reject()
 
 void KodiSync::startSync()
 {
-    qCInfo(generic) << "[KodiSync] Start Sync";
+    qCInfo(c_kodi) << "[KodiSync] Start Sync";
 
     m_allReady = false;
     m_elements.clear();
@@ -107,6 +116,10 @@ void KodiSync::startSync()
     m_xbmcConcerts.clear();
     m_xbmcShows.clear();
     m_xbmcEpisodes.clear();
+    m_xbmcMovieIndex.clear();
+    m_xbmcConcertIndex.clear();
+    m_xbmcShowIndex.clear();
+    m_xbmcEpisodeIndex.clear();
 
     m_moviesToRemove.clear();
     m_concertsToRemove.clear();
@@ -244,13 +257,13 @@ void KodiSync::onMovieListFinished()
 {
     auto* reply = dynamic_cast<QNetworkReply*>(sender());
     if (reply == nullptr) {
-        qCDebug(generic) << "invalid response received";
+        qCDebug(c_kodi) << "invalid response received";
         return;
     }
     reply->deleteLater();
 
     if (reply->error() != QNetworkReply::NoError) {
-        qCInfo(generic) << "[KodiSync] Movie Sync: Network error" << reply->errorString();
+        qCInfo(c_kodi) << "[KodiSync] Movie Sync: Network error" << reply->errorString();
         QMessageBox::warning(this, tr("Network error"), reply->errorString());
 
     } else {
@@ -261,10 +274,13 @@ void KodiSync::onMovieListFinished()
             it.next();
             if (it.key() == "movies" && !it.value().toList().isEmpty()) {
                 for (const QVariant& var : it.value().toList()) {
-                    if (var.toMap().value("movieid").toInt() == 0) {
+                    const int id = var.toMap().value("movieid").toInt();
+                    if (id == 0) {
                         continue;
                     }
-                    m_xbmcMovies.insert(var.toMap().value("movieid").toInt(), parseXbmcDataFromMap(var.toMap()));
+                    const XbmcData data = parseXbmcDataFromMap(var.toMap());
+                    m_xbmcMovies.insert(id, data);
+                    m_xbmcMovieIndex.insert(id, data.file);
                 }
             }
         }
@@ -276,13 +292,13 @@ void KodiSync::onConcertListFinished()
 {
     auto* reply = dynamic_cast<QNetworkReply*>(sender());
     if (reply == nullptr) {
-        qCDebug(generic) << "invalid response received";
+        qCDebug(c_kodi) << "invalid response received";
         return;
     }
     reply->deleteLater();
 
     if (reply->error() != QNetworkReply::NoError) {
-        qCInfo(generic) << "[KodiSync] Concert Sync: Network error" << reply->errorString();
+        qCInfo(c_kodi) << "[KodiSync] Concert Sync: Network error" << reply->errorString();
         QMessageBox::warning(this, tr("Network error"), reply->errorString());
 
     } else {
@@ -293,10 +309,13 @@ void KodiSync::onConcertListFinished()
             it.next();
             if (it.key() == "musicvideos" && !it.value().toList().isEmpty()) {
                 for (const QVariant& var : it.value().toList()) {
-                    if (var.toMap().value("musicvideoid").toInt() == 0) {
+                    const int id = var.toMap().value("musicvideoid").toInt();
+                    if (id == 0) {
                         continue;
                     }
-                    m_xbmcConcerts.insert(var.toMap().value("musicvideoid").toInt(), parseXbmcDataFromMap(var.toMap()));
+                    const XbmcData data = parseXbmcDataFromMap(var.toMap());
+                    m_xbmcConcerts.insert(id, data);
+                    m_xbmcConcertIndex.insert(id, data.file);
                 }
             }
         }
@@ -308,13 +327,13 @@ void KodiSync::onTvShowListFinished()
 {
     auto* reply = dynamic_cast<QNetworkReply*>(sender());
     if (reply == nullptr) {
-        qCDebug(generic) << "invalid response received";
+        qCDebug(c_kodi) << "invalid response received";
         return;
     }
     reply->deleteLater();
 
     if (reply->error() != QNetworkReply::NoError) {
-        qCInfo(generic) << "[KodiSync] TV Show Sync: Network error" << reply->errorString();
+        qCInfo(c_kodi) << "[KodiSync] TV Show Sync: Network error" << reply->errorString();
         QMessageBox::warning(this, tr("Network error"), reply->errorString());
 
     } else {
@@ -325,10 +344,13 @@ void KodiSync::onTvShowListFinished()
             it.next();
             if (it.key() == "tvshows" && !it.value().toList().isEmpty()) {
                 for (const QVariant& var : it.value().toList()) {
-                    if (var.toMap().value("tvshowid").toInt() == 0) {
+                    const int id = var.toMap().value("tvshowid").toInt();
+                    if (id == 0) {
                         continue;
                     }
-                    m_xbmcShows.insert(var.toMap().value("tvshowid").toInt(), parseXbmcDataFromMap(var.toMap()));
+                    const XbmcData data = parseXbmcDataFromMap(var.toMap());
+                    m_xbmcShows.insert(id, data);
+                    m_xbmcShowIndex.insert(id, data.file);
                 }
             }
         }
@@ -340,13 +362,13 @@ void KodiSync::onEpisodeListFinished()
 {
     auto* reply = dynamic_cast<QNetworkReply*>(sender());
     if (reply == nullptr) {
-        qCDebug(generic) << "invalid response received";
+        qCDebug(c_kodi) << "invalid response received";
         return;
     }
     reply->deleteLater();
 
     if (reply->error() != QNetworkReply::NoError) {
-        qCInfo(generic) << "[KodiSync] Episode Sync: Network error" << reply->errorString();
+        qCInfo(c_kodi) << "[KodiSync] Episode Sync: Network error" << reply->errorString();
         QMessageBox::warning(this, tr("Network error"), reply->errorString());
 
     } else {
@@ -357,10 +379,13 @@ void KodiSync::onEpisodeListFinished()
             it.next();
             if (it.key() == "episodes" && !it.value().toList().isEmpty()) {
                 for (const QVariant& var : it.value().toList()) {
-                    if (var.toMap().value("episodeid").toInt() == 0) {
+                    const int id = var.toMap().value("episodeid").toInt();
+                    if (id == 0) {
                         continue;
                     }
-                    m_xbmcEpisodes.insert(var.toMap().value("episodeid").toInt(), parseXbmcDataFromMap(var.toMap()));
+                    const XbmcData data = parseXbmcDataFromMap(var.toMap());
+                    m_xbmcEpisodes.insert(id, data);
+                    m_xbmcEpisodeIndex.insert(id, data.file);
                 }
             }
         }
@@ -398,7 +423,7 @@ void KodiSync::setupItemsToRemove()
 {
     for (Movie* movie : m_moviesToSync) {
         movie->setSyncNeeded(false);
-        int id = findId(movie->files().toStringList(), m_xbmcMovies);
+        int id = m_xbmcMovieIndex.findId(movie->files().toStringList());
         if (id > 0) {
             m_moviesToRemove.append(id);
         }
@@ -406,7 +431,7 @@ void KodiSync::setupItemsToRemove()
 
     for (Concert* concert : m_concertsToSync) {
         concert->setSyncNeeded(false);
-        int id = findId(concert->files().toStringList(), m_xbmcConcerts);
+        int id = m_xbmcConcertIndex.findId(concert->files().toStringList());
         if (id > 0) {
             m_concertsToRemove.append(id);
         }
@@ -423,7 +448,7 @@ void KodiSync::setupItemsToRemove()
         } else if (!showDir.contains("/") && !showDir.endsWith("\\")) {
             showDir.append("\\");
         }
-        int id = findId(QStringList() << showDir, m_xbmcShows);
+        int id = m_xbmcShowIndex.findId(QStringList() << showDir);
         if (id > 0) {
             m_tvShowsToRemove.append(id);
         }
@@ -431,7 +456,7 @@ void KodiSync::setupItemsToRemove()
 
     for (TvShowEpisode* episode : m_episodesToSync) {
         episode->setSyncNeeded(false);
-        int id = findId(episode->files().toStringList(), m_xbmcEpisodes);
+        int id = m_xbmcEpisodeIndex.findId(episode->files().toStringList());
         if (id > 0) {
             m_episodesToRemove.append(id);
         }
@@ -440,92 +465,92 @@ void KodiSync::setupItemsToRemove()
 
 void KodiSync::removeItems()
 {
-    QJsonObject o;
-    o.insert("jsonrpc", QString("2.0"));
-    o.insert("id", ++m_requestId);
-
-    if (!m_moviesToRemove.isEmpty()) {
-        ui->status->setText(tr("Removing movies from database"));
-        int id = m_moviesToRemove.takeFirst();
-        QJsonObject params;
-        params.insert("movieid", id);
-        o.insert("params", params);
-        o.insert("method", QString("VideoLibrary.RemoveMovie"));
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onRemoveFinished);
-        return;
+    mediaelch::kodi::JsonRpcBatch batch(REMOVE_BATCH_SIZE);
+    for (int id : asConst(m_moviesToRemove)) {
+        batch.addCall("VideoLibrary.RemoveMovie", QJsonObject{{"movieid", id}});
     }
-
-    if (!m_concertsToRemove.isEmpty()) {
-        ui->status->setText(tr("Removing concerts from database"));
-        int id = m_concertsToRemove.takeFirst();
-        QJsonObject params;
-        params.insert("musicvideoid", id);
-        o.insert("params", params);
-        o.insert("method", QString("VideoLibrary.RemoveMusicVideo"));
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onRemoveFinished);
-        return;
+    for (int id : asConst(m_concertsToRemove)) {
+        batch.addCall("VideoLibrary.RemoveMusicVideo", QJsonObject{{"musicvideoid", id}});
+    }
+    for (int id : asConst(m_tvShowsToRemove)) {
+        batch.addCall("VideoLibrary.RemoveTVShow", QJsonObject{{"tvshowid", id}});
+    }
+    for (int id : asConst(m_episodesToRemove)) {
+        batch.addCall("VideoLibrary.RemoveEpisode", QJsonObject{{"episodeid", id}});
     }
+    m_moviesToRemove.clear();
+    m_concertsToRemove.clear();
+    m_tvShowsToRemove.clear();
+    m_episodesToRemove.clear();
 
-    if (!m_tvShowsToRemove.isEmpty()) {
-        ui->status->setText(tr("Removing TV shows from database"));
-        int id = m_tvShowsToRemove.takeFirst();
-        QJsonObject params;
-        params.insert("tvshowid", id);
-        o.insert("params", params);
-        o.insert("method", QString("VideoLibrary.RemoveTVShow"));
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onRemoveFinished);
+    if (batch.isEmpty()) {
+        QTimer::singleShot(m_reloadTimeOut, this, &KodiSync::triggerReload);
         return;
     }
 
-    if (!m_episodesToRemove.isEmpty()) {
-        ui->status->setText(tr("Removing episodes from database"));
-        int id = m_episodesToRemove.takeFirst();
+    m_removeRequests = batch.toRequests(m_requestId);
+    m_removeRequestsInFlight = 0;
+    m_itemsToRemove = batch.callCount();
+    m_itemsRemoved = 0;
+    m_removeTimer.start();
 
-        QJsonObject params;
-        params.insert("episodeid", id);
-        o.insert("params", params);
-        o.insert("method", QString("VideoLibrary.RemoveEpisode"));
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onRemoveFinished);
-        return;
+    qCInfo(c_kodi) << "[KodiSync] Removing" << m_itemsToRemove << "items in" << m_removeRequests.size() << "requests";
+    ui->status->setText(tr("Removing items from database"));
+    ui->progressBar->setMaximum(m_itemsToRemove);
+    ui->progressBar->setValue(0);
+
+    while (m_removeRequestsInFlight < MAX_REMOVE_REQUESTS_IN_FLIGHT && sendNextRemoveRequest()) {
     }
+}
 
-    QTimer::singleShot(m_reloadTimeOut, this, &KodiSync::triggerReload);
+bool KodiSync::sendNextRemoveRequest()
+{
+    if (m_removeRequests.isEmpty()) {
+        return false;
+    }
+    const mediaelch::kodi::JsonRpcBatch::Request next = m_removeRequests.takeFirst();
+
+    QNetworkRequest request(xbmcUrl());
+    request.setRawHeader("Content-Type", "application/json");
+    request.setRawHeader("Accept", "application/json");
+    QNetworkReply* reply = m_network.post(request, next.body);
+    reply->setProperty("callCount", next.callCount);
+    connect(reply, &QNetworkReply::finished, this, &KodiSync::onRemoveFinished);
+    ++m_removeRequestsInFlight;
+    return true;
 }
 
 void KodiSync::onRemoveFinished()
 {
+    --m_removeRequestsInFlight;
+
     auto* reply = dynamic_cast<QNetworkReply*>(sender());
     if (reply != nullptr) {
         reply->deleteLater();
+        const int callCount = reply->property("callCount").toInt();
+        if (reply->error() != QNetworkReply::NoError) {
+            qCWarning(c_kodi) << "[KodiSync] Network Error:" << reply->errorString() << "|" << reply->url();
+        } else if (const int errors = mediaelch::kodi::JsonRpcBatch::countErrors(reply->readAll(), callCount)) {
+            qCWarning(c_kodi) << "[KodiSync]" << errors << "of" << callCount << "items could not be removed";
+        }
+        m_itemsRemoved += callCount;
     }
 
-    ui->progressBar->setValue(ui->progressBar->maximum()
-                              - qsizetype_to_int(m_moviesToRemove.count() + m_episodesToRemove.count()
-                                                 + m_tvShowsToRemove.count() + m_concertsToRemove.count()));
-    QApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
+    // Items per second; avoid division by zero for very fast responses.
+    const double seconds = qMax<qint64>(1, m_removeTimer.elapsed()) / 1000.0;
+    const int itemsPerSecond = qRound(m_itemsRemoved / seconds);
+    ui->progressBar->setValue(m_itemsRemoved);
+    ui->status->setText(tr("Removing items from database (%1 of %2, %3 items per second)")
+                            .arg(m_itemsRemoved)
+                            .arg(m_itemsToRemove)
+                            .arg(itemsPerSecond));
 
-    if (!m_moviesToRemove.isEmpty() || !m_concertsToRemove.isEmpty() || !m_tvShowsToRemove.isEmpty()
-        || !m_episodesToRemove.isEmpty()) {
-        removeItems();
-    } else {
-        QTimer::singleShot(m_reloadTimeOut, this, &KodiSync::triggerReload);
+    if (sendNextRemoveRequest() || m_removeRequestsInFlight > 0) {
+        return;
     }
+
+    qCInfo(c_kodi) << "[KodiSync] Removed" << m_itemsRemoved << "items in" << m_removeTimer.elapsed() << "ms";
+    QTimer::singleShot(m_reloadTimeOut, this, &KodiSync::triggerReload);
 }
 
 void KodiSync::triggerReload()
@@ -548,12 +573,12 @@ void KodiSync::onScanFinished()
 {
     auto* reply = dynamic_cast<QNetworkReply*>(QObject::sender());
     if (reply == nullptr) {
-        qCCritical(generic) << "[KodiSync] dynamic_cast<QNetworkReply*> failed for onScanFinished!";
+        qCCritical(c_kodi) << "[KodiSync] dynamic_cast<QNetworkReply*> failed for onScanFinished!";
 
     } else if (reply->error() != QNetworkReply::NoError) {
         reply->deleteLater();
         ui->status->setText(tr("Error: %1").arg(reply->errorString()));
-        qCWarning(generic) << "[KodiSync] Network Error:" << reply->errorString() << "|" << reply->url();
+        qCWarning(c_kodi) << "[KodiSync] Network Error:" << reply->errorString() << "|" << reply->url();
 
     } else {
         reply->deleteLater();
@@ -586,40 +611,40 @@ void KodiSync::onCleanFinished()
 void KodiSync::updateWatched()
 {
     for (Movie* movie : asConst(m_moviesToSync)) {
-        const int id = findId(movie->files().toStringList(), m_xbmcMovies);
+        const int id = m_xbmcMovieIndex.findId(movie->files().toStringList());
         if (id > 0) {
             movie->blockSignals(true);
             movie->setPlayCount(m_xbmcMovies.value(id).playCount);
             movie->setLastPlayed(m_xbmcMovies.value(id).lastPlayed);
             movie->blockSignals(false);
         } else {
-            qCDebug(generic) << "Movie not found" << movie->name();
+            qCDebug(c_kodi) << "Movie not found" << movie->name();
         }
         movie->setSyncNeeded(false);
     }
 
     for (Concert* concert : asConst(m_concertsToSync)) {
-        const int id = findId(concert->files().toStringList(), m_xbmcConcerts);
+        const int id = m_xbmcConcertIndex.findId(concert->files().toStringList());
         if (id > 0) {
             concert->blockSignals(true);
             concert->setPlayCount(m_xbmcConcerts.value(id).playCount);
             concert->setLastPlayed(m_xbmcConcerts.value(id).lastPlayed);
             concert->blockSignals(false);
         } else {
-            qCDebug(generic) << "Concert not found" << concert->title();
+            qCDebug(c_kodi) << "Concert not found" << concert->title();
         }
         concert->setSyncNeeded(false);
     }
 
     for (TvShowEpisode* episode : asConst(m_episodesToSync)) {
-        const int id = findId(episode->files().toStringList(), m_xbmcEpisodes);
+        const int id = m_xbmcEpisodeIndex.findId(episode->files().toStringList());
         if (id > 0) {
             episode->blockSignals(true);
             episode->setPlayCount(m_xbmcEpisodes.value(id).playCount);
             episode->setLastPlayed(m_xbmcEpisodes.value(id).lastPlayed);
             episode->blockSignals(false);
         } else {
-            qCDebug(generic) << "Episode not found" << episode->title();
+            qCDebug(c_kodi) << "Episode not found" << episode->title();
         }
         episode->setSyncNeeded(false);
     }
@@ -628,103 +653,6 @@ void KodiSync::updateWatched()
     ui->buttonSync->setEnabled(true);
 }
 
-int KodiSync::findId(const QStringList& files, const QMap<int, XbmcData>& items)
-{
-    if (files.isEmpty()) {
-        return -1;
-    }
-
-    QVector<int> matches;
-    int level = 0;
-
-    do {
-        matches.clear();
-        QMapIterator<int, XbmcData> it(items);
-        while (it.hasNext()) {
-            it.next();
-            QString file = it.value().file;
-            QStringList xbmcFiles;
-            if (file.startsWith("stack://")) {
-                xbmcFiles << file.mid(8).split(" , ");
-            } else {
-                xbmcFiles << file;
-            }
-
-            if (compareFiles(files, xbmcFiles, level)) {
-                matches.append(it.key());
-            }
-        }
-    } while (matches.count() > 1 && level++ < 4);
-
-    if (matches.count() == 1) {
-        return matches.at(0);
-    }
-    if (matches.count() == 0) {
-        return 0;
-    }
-    return -1;
-}
-
-bool KodiSync::compareFiles(const QStringList& files, const QStringList& xbmcFiles, const int& level)
-{
-    if (files.count() == 1 && xbmcFiles.count() == 1) {
-        QStringList file = splitFile(files.at(0));
-        QStringList xbmcFile = splitFile(xbmcFiles.at(0));
-        for (int i = 0; i <= level; ++i) {
-            if (file.isEmpty() || xbmcFile.isEmpty()) {
-                return false;
-            }
-            if (QString::compare(file.takeLast(), xbmcFile.takeLast(), Qt::CaseInsensitive) != 0) {
-                return false;
-            }
-        }
-        return true;
-    }
-    if (files.count() == xbmcFiles.count()) {
-        // construct a new stack
-        QStringList stack;
-        QStringList xbmcStack;
-        for (const QString& file : xbmcFiles) {
-            QStringList parts = splitFile(file);
-            if (parts.count() < level) {
-                return false;
-            }
-            QStringList partsNew;
-            for (int i = 0; i <= level; ++i) {
-                partsNew << parts.takeLast();
-            }
-            xbmcStack << partsNew.join("/");
-        }
-
-        for (const QString& file : files) {
-            QStringList parts = splitFile(file);
-            if (parts.count() < level) {
-                return false;
-            }
-            QStringList partsNew;
-            for (int i = 0; i <= level; ++i) {
-                partsNew << parts.takeLast();
-            }
-            stack << partsNew.join("/");
-        }
-
-        std::sort(stack.begin(), stack.end());
-        std::sort(xbmcStack.begin(), xbmcStack.end());
-
-        return (stack == xbmcStack);
-    }
-    return false;
-}
-
-QStringList KodiSync::splitFile(const QString& file)
-{
-    // Windows file names must not contain /
-    if (file.contains("/")) {
-        return file.split("/");
-    }
-    return file.split("\\");
-}
-
 void KodiSync::onRadioContents()
 {
     ui->lblContents->setVisible(true);
@@ -764,7 +692,7 @@ void KodiSync::updateFolderLastModified(const QDir& dir)
     if (!file.exists() && file.open(QIODevice::WriteOnly)) {
         file.close();
         if (!file.remove()) {
-            qCWarning(generic) << "[KodiSync] Could not remove .update file in:" << dir.absolutePath();
+            qCWarning(c_kodi) << "[KodiSync] Could not remove .update file in:" << dir.absolutePath();
         }
     }
 }
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "data/movie/Movie.h"
+#include "media_center/kodi/KodiJsonRpcBatch.h"
+#include "media_center/kodi/KodiPathIndex.h"
 #include "network/NetworkManager.h"
 #include "settings/Settings.h"
 
 #include <QAuthenticator>
 #include <QDialog>
+#include <QElapsedTimer>
 #include <QMutex>
 #include <QNetworkReply>
 #include <QTcpSocket>
@@ -84,10 +87,21 @@ private:
     QMap<int, XbmcData> m_xbmcConcerts;
     QMap<int, XbmcData> m_xbmcShows;
     QMap<int, XbmcData> m_xbmcEpisodes;
+    // Built once per sync when Kodi's item lists arrive; used to find local items in Kodi's library.
+    mediaelch::KodiPathIndex m_xbmcMovieIndex;
+    mediaelch::KodiPathIndex m_xbmcConcertIndex;
+    mediaelch::KodiPathIndex m_xbmcShowIndex;
+    mediaelch::KodiPathIndex m_xbmcEpisodeIndex;
     QVector<int> m_moviesToRemove;
     QVector<int> m_concertsToRemove;
     QVector<int> m_tvShowsToRemove;
     QVector<int> m_episodesToRemove;
+    // Remove calls are sent as JSON-RPC batches with a limited number of requests in flight.
+    QVector<mediaelch::kodi::JsonRpcBatch::Request> m_removeRequests;
+    int m_removeRequestsInFlight = 0;
+    int m_itemsToRemove = 0;
+    int m_itemsRemoved = 0;
+    QElapsedTimer m_removeTimer;
     QMutex m_mutex;
     bool m_allReady;
     bool m_aborted;
@@ -98,11 +112,9 @@ private:
     int m_reloadTimeOut;
     int m_requestId;
 
-    int findId(const QStringList& files, const QMap<int, XbmcData>& items);
-    bool compareFiles(const QStringList& files, const QStringList& xbmcFiles, const int& level);
-    QStringList splitFile(const QString& file);
     void setupItemsToRemove();
     void removeItems();
+    bool sendNextRemoveRequest();
     void updateWatched();
     void checkIfListsReady(Element element);
     KodiSync::XbmcData parseXbmcDataFromMap(QMap<QString, QVariant> map);
@@ -13,7 +13,8 @@
 
 #include "log/Log.h"
 
-MovieSearchWidget::MovieSearchWidget(QWidget* parent) : QWidget(parent), ui(new Ui::MovieSearchWidget)
+MovieSearchWidget::MovieSearchWidget(QWidget* parent) :
+    QWidget(parent), ui(new Ui::MovieSearchWidget), m_prefetcher{new mediaelch::scraper::ScrapePrefetcher(this)}
 {
     ui->setupUi(this);
     ui->results->verticalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
@@ -61,9 +62,33 @@ void MovieSearchWidget::abortCurrentJobs()
         m_currentSearchJob->kill();
         m_currentSearchJob = nullptr;
     }
+    m_prefetcher->cancel();
     ui->preview->clearAndAbortPreview();
 }
 
+void MovieSearchWidget::prefetchResults(const QVector<mediaelch::scraper::MovieSearchJob::Result>& results)
+{
+    using namespace mediaelch::scraper;
+
+    // The custom movie scraper needs results of multiple scrapers before it can load anything.
+    if (isCustomScrapingInProgress() || m_currentScraper->meta().identifier == CustomMovieScraper::ID) {
+        return;
+    }
+
+    QVector<ScrapePrefetcher::JobFactory> jobs;
+    const int count = qMin(qsizetype_to_int(results.size()), ScrapePrefetcher::defaultResultCount);
+    for (int i = 0; i < count; ++i) {
+        MovieScrapeJob::Config config;
+        config.identifier = results[i].identifier;
+        config.locale = m_currentLanguage;
+        config.details = m_infosToLoad;
+
+        MovieScraper* scraper = m_currentScraper;
+        jobs.append([scraper, config]() -> mediaelch::worker::Job* { return scraper->loadMovie(config); });
+    }
+    m_prefetcher->prefetch(std::move(jobs));
+}
+
 void MovieSearchWidget::openAndSearch(QString searchString, const ImdbId& imdbId, const TmdbId& tmdbId)
 {
     setupScraperDropdown();
@@ -246,6 +271,8 @@ void MovieSearchWidget::onShowResults(mediaelch::scraper::MovieSearchJob* search
         ui->results->setItem(row, 0, item);
     }
     ui->results->setCurrentCell(0, 0);
+
+    prefetchResults(searchJob->results());
 }
 
 void MovieSearchWidget::onSelectedResultChanged(QTableWidgetItem* current, QTableWidgetItem* previous)
@@ -283,6 +310,8 @@ void MovieSearchWidget::onResultDoubleClicked(QTableWidgetItem* item)
     using namespace mediaelch::scraper;
 
     MovieIdentifier currentIdentifier(item->data(Qt::UserRole).toString());
+    // Don't compete with the actual scrape job.
+    m_prefetcher->cancel();
 
     // For all scrapers except the CustomMovieScraper, we simply emit
     // a signal.  The CustomMovieScraper may need to search on multiple sites.
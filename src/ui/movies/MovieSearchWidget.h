@@ -3,6 +3,7 @@
 #include "data/ImdbId.h"
 #include "data/TmdbId.h"
 #include "globals/Globals.h"
+#include "scrapers/ScrapePrefetcher.h"
 #include "scrapers/ScraperInfos.h"
 #include "scrapers/movie/MovieScraper.h"
 #include "scrapers/movie/MovieSearchJob.h"
@@ -73,6 +74,9 @@ private:
 
     void abortAndClearResults();
     void abortCurrentJobs();
+    /// \brief Load the details of the top search results in the background so that
+    ///        scraping a result is faster.
+    void prefetchResults(const QVector<mediaelch::scraper::MovieSearchJob::Result>& results);
     void setCheckBoxesForCurrentScraper();
     void setupComboBoxes();
     void setSearchText();
@@ -94,6 +98,7 @@ private:
     // Selected scraper or the currently used scraper for the custom movie scraper.
     mediaelch::scraper::MovieScraper* m_currentScraper{nullptr};
     QPointer<mediaelch::scraper::MovieSearchJob> m_currentSearchJob{nullptr};
+    mediaelch::scraper::ScrapePrefetcher* m_prefetcher{nullptr};
 
     QString m_scraperMovieId;
     QSet<MovieScraperInfo> m_infosToLoad;
@@ -9,6 +9,7 @@
 #include "log/Log.h"
 #include "media/ImageCache.h"
 #include "media/ImageCapture.h"
+#include "media_center/SaveQueue.h"
 #include "scrapers/movie/custom/CustomMovieScraper.h"
 #include "ui/UiUtils.h"
 #include "ui/image/ImageDialog.h"
@@ -906,6 +907,7 @@ void MovieWidget::saveInformation()
         NotificationBox::instance()->showProgressBar(tr("Saving movies..."), Constants::MovieWidgetProgressMessageId);
         NotificationBox::instance()->progressBarProgress(0, moviesToSave, Constants::MovieWidgetProgressMessageId);
         QApplication::processEvents();
+        QVector<Movie*> savedMovies;
         for (Movie* movie : movies) {
             if (movie->hasChanged()) {
                 counter++;
@@ -913,12 +915,10 @@ void MovieWidget::saveInformation()
                     counter, moviesToSave, Constants::MovieWidgetProgressMessageId);
                 QApplication::processEvents();
                 movie->controller()->saveData(Manager::instance()->mediaCenterInterface());
-                movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
-                if (m_movie == movie) {
-                    updateMovieInfo();
-                }
+                savedMovies << movie;
             }
         }
+        reloadSavedMovies(savedMovies);
         NotificationBox::instance()->hideProgressBar(Constants::MovieWidgetProgressMessageId);
         NotificationBox::instance()->showSuccess(tr("Movies Saved"));
     } else {
@@ -956,6 +956,7 @@ void MovieWidget::saveAll()
     QApplication::processEvents();
 
     const auto movies = Manager::instance()->movieModel()->movies();
+    QVector<Movie*> savedMovies;
     for (Movie* movie : movies) {
         if (movie->hasChanged()) {
             counter++;
@@ -963,12 +964,10 @@ void MovieWidget::saveAll()
                 counter, moviesToSave, Constants::MovieWidgetProgressMessageId);
             QApplication::processEvents();
             movie->controller()->saveData(Manager::instance()->mediaCenterInterface());
-            movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
-            if (m_movie == movie) {
-                updateMovieInfo();
-            }
+            savedMovies << movie;
         }
     }
+    reloadSavedMovies(savedMovies);
     setEnabledTrue();
     m_savingWidget->hide();
     NotificationBox::instance()->hideProgressBar(Constants::MovieWidgetProgressMessageId);
@@ -976,6 +975,36 @@ void MovieWidget::saveAll()
     ui->buttonRevert->setVisible(false);
 }
 
+/// \brief Reload the movies from their NFO files once the files are written.
+/// \details Reloading right after saving would wait for each movie's files, i.e. save them one by one.
+void MovieWidget::reloadSavedMovies(const QVector<Movie*>& movies)
+{
+    QVector<QPointer<Movie>> moviesToReload;
+    for (Movie* movie : movies) {
+        moviesToReload << movie;
+    }
+
+    auto reload = [this, moviesToReload]() {
+        for (const QPointer<Movie>& movie : moviesToReload) {
+            // Don't discard changes that were made in the meantime.
+            if (movie.isNull() || movie->hasChanged()) {
+                continue;
+            }
+            movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
+            if (m_movie == movie) {
+                updateMovieInfo();
+            }
+        }
+    };
+
+    mediaelch::SaveQueue* saveQueue = Manager::instance()->mediaCenterInterface()->saveQueue();
+    if (saveQueue == nullptr) {
+        reload();
+    } else {
+        saveQueue->whenIdle(this, reload);
+    }
+}
+
 /// \brief Revert changes for current movie
 void MovieWidget::onRevertChanges()
 {
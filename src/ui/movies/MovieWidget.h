@@ -119,6 +119,7 @@ private slots:
 
 private:
     void updateImage(ImageType imageType, ClosableImage* image);
+    void reloadSavedMovies(const QVector<Movie*>& movies);
 
 private:
     Ui::MovieWidget* ui;
@@ -12,6 +12,8 @@
 #include <QFile>
 #include <QFileInfo>
 #include <QTimer>
+#include <QtConcurrent>
+#include <numeric>
 
 RenamerDialog::RenamerDialog(QWidget* parent) : QDialog(parent), ui(new Ui::RenamerDialog)
 {
@@ -243,6 +245,12 @@ void RenamerDialog::renameType(const bool isDryRun)
     config.filePatternMulti = ui->fileNamingMulti->text();
     config.renameFiles = ui->chkFileNaming->isChecked();
 
+    if (!isDryRun) {
+        // NFO files and images that are still queued must be written before their
+        // files are renamed.  Otherwise they would end up at the old paths.
+        Manager::instance()->saveQueue()->waitForDone();
+    }
+
     if (m_renameType == RenameType::Movies) {
         config.directoryPattern = ui->directoryNaming->text();
         config.renameDirectories = ui->chkDirectoryNaming->isChecked();
@@ -275,6 +283,8 @@ void RenamerDialog::renameMovies(QVector<Movie*> movies, const RenamerConfig& co
     }
 
     MovieRenamer renamer(config, this);
+
+    QVector<Movie*> moviesToRename;
     for (Movie* movie : movies) {
         if (movie->files().isEmpty() || (movie->files().count() > 1 && config.filePatternMulti.isEmpty())) {
             continue;
@@ -284,10 +294,32 @@ void RenamerDialog::renameMovies(QVector<Movie*> movies, const RenamerConfig& co
                 tr("<b>Movie</b> \"%1\" not renamed: It has been edited but is not saved").arg(movie->name()));
             continue;
         }
+        moviesToRename << movie;
+    }
+
+    // New names only depend on the movie itself and can be generated in parallel.
+    // Renaming is done afterwards in the GUI thread as it updates the results table.
+    QVector<MovieRenamer::Names> names(moviesToRename.size());
+    QVector<int> indices(moviesToRename.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    MovieRenamer::Names* results = names.data();
+    QtConcurrent::blockingMap(indices, [&](int i) { results[i] = renamer.names(*moviesToRename.at(i)); });
+
+    const QSet<int> conflicts = MovieRenamer::findConflicts(names);
+
+    for (int i = 0; i < qsizetype_to_int(moviesToRename.size()); ++i) {
+        Movie* movie = moviesToRename[i];
+        if (conflicts.contains(i)) {
+            ui->results->append(
+                tr("<b>Movie</b> \"%1\" not renamed: Another movie would be renamed to the same name")
+                    .arg(movie->name()));
+            m_renameErrorOccured = true;
+            continue;
+        }
 
         QApplication::processEvents();
 
-        Renamer::RenameError err = renamer.renameMovie(*movie);
+        Renamer::RenameError err = renamer.renameMovie(*movie, names[i]);
         if (err != Renamer::RenameError::None) {
             m_renameErrorOccured = true;
         }
@@ -329,6 +361,8 @@ void RenamerDialog::renameTvShows(const QVector<TvShow*>& shows, const QString&
         return;
     }
 
+    const mediaelch::RenamerTemplate pattern(directoryPattern);
+
     for (TvShow* show : shows) {
         if (show->hasChanged()) {
             ui->results->append(
@@ -337,10 +371,11 @@ void RenamerDialog::renameTvShows(const QVector<TvShow*>& shows, const QString&
         }
 
         QDir dir(show->dir().toString());
-        QString newFolderName = directoryPattern;
-        Renamer::replace(newFolderName, "title", show->title());
-        Renamer::replace(newFolderName, "showTitle", show->title());
-        Renamer::replace(newFolderName, "year", show->firstAired().toString("yyyy"));
+        mediaelch::RenamerValues values;
+        values.insert("title", show->title());
+        values.insert("showTitle", show->title());
+        values.insert("year", show->firstAired().toString("yyyy"));
+        QString newFolderName = pattern.render(values);
         helper::sanitizeFolderName(newFolderName);
         if (newFolderName != dir.dirName()) {
             const int row = addResultToTable(dir.dirName(), newFolderName, Renamer::RenameOperation::Rename);
@@ -1,5 +1,6 @@
 #include "ui/small_widgets/ClosableImage.h"
 
+#include "media/ImageHeader.h"
 #include "settings/Settings.h"
 #include "ui/image/ImagePreviewDialog.h"
 #include "ui/main/MainWindow.h"
@@ -194,9 +195,13 @@ void ClosableImage::setMyData(const QVariant& myData)
 void ClosableImage::setImage(const QByteArray& image)
 {
     clear();
-    QImage img = QImage::fromData(image);
     m_image = image;
-    updateSize(img.width(), img.height());
+    // Only the size is needed here; the image is decoded when it's painted.
+    QSize size = mediaelch::ImageHeader::fromData(image).size;
+    if (size.isEmpty()) {
+        size = QImage::fromData(image).size();
+    }
+    updateSize(size.width(), size.height());
 }
 
 void ClosableImage::setImageFromPath(const mediaelch::FilePath& image)
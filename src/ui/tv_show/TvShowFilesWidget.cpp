@@ -7,12 +7,18 @@
 
 #include "globals/Globals.h"
 #include "globals/Manager.h"
+#include "globals/MessageIds.h"
 #include "log/Log.h"
+#include "media/ImageCache.h"
+#include "media/StreamDetails.h"
+#include "media/ThumbnailCaptureJob.h"
 #include "model/tv_show/EpisodeModelItem.h"
 #include "model/tv_show/SeasonModelItem.h"
 #include "model/tv_show/TvShowModelItem.h"
 #include "scrapers/TvShowUpdater.h"
+#include "settings/Settings.h"
 #include "ui/main/MainWindow.h"
+#include "ui/notifications/NotificationBox.h"
 #include "ui/small_widgets/LoadingStreamDetails.h"
 #include "ui/tv_show/TvShowMultiScrapeDialog.h"
 
@@ -110,6 +116,9 @@ void TvShowFilesWidget::showContextMenu(QPoint point)
         m_actionPlay->setEnabled(item.type() == TvShowType::Episode);
     }
 
+    m_actionCreateThumbnails->setText(m_thumbnailJob != nullptr ? tr("Cancel Creating Episode Thumbnails")
+                                                                : tr("Create Missing Episode Thumbnails"));
+
     QPoint globalPoint = ui->files->mapToGlobal(point);
     m_contextMenu->exec(globalPoint);
 }
@@ -314,6 +323,78 @@ void TvShowFilesWidget::loadStreamDetails()
     emitSelected(ui->files->currentIndex());
 }
 
+void TvShowFilesWidget::createEpisodeThumbnails()
+{
+    using namespace mediaelch;
+
+    m_contextMenu->close();
+
+    if (m_thumbnailJob != nullptr) {
+        m_thumbnailJob->cancel();
+        return;
+    }
+
+    // Only episodes without any thumbnail: neither a file, a captured image nor one that will be downloaded.
+    m_thumbnailEpisodes.clear();
+    QVector<ThumbnailCaptureJob::Video> videos;
+    for (TvShowEpisode* episode : selectedEpisodes()) {
+        if (episode->files().isEmpty() || !episode->thumbnail().isEmpty() || !episode->thumbnailImage().isEmpty()) {
+            continue;
+        }
+        const QString thumbFile = Manager::instance()->mediaCenterInterface()->imageFileName(
+            episode, ImageType::TvShowEpisodeThumb);
+        if (!thumbFile.isEmpty() && !episode->imagesToRemove().contains(ImageType::TvShowEpisodeThumb)) {
+            continue;
+        }
+        const unsigned duration = episode->streamDetails()
+                                      ->videoDetails()
+                                      .value(StreamDetails::VideoDetails::DurationInSeconds, nullptr)
+                                      .toUInt();
+        videos.append({episode->files().first(), duration});
+        m_thumbnailEpisodes.append(episode);
+    }
+
+    if (videos.isEmpty()) {
+        NotificationBox::instance()->showInfo(tr("All selected episodes already have a thumbnail"));
+        return;
+    }
+
+    m_thumbnailJob = new ThumbnailCaptureJob(
+        std::move(videos), Settings::instance()->advanced()->episodeThumbnailDimensions(), false, this);
+
+    NotificationBox::instance()->showProgressBar(
+        tr("Creating episode thumbnails..."), Constants::EpisodeThumbnailsProgressMessageId, true);
+
+    connect(m_thumbnailJob, &ThumbnailCaptureJob::progress, this, [](int processed, int total) {
+        NotificationBox::instance()->progressBarProgress(
+            processed, total, Constants::EpisodeThumbnailsProgressMessageId);
+    });
+    connect(m_thumbnailJob, &ThumbnailCaptureJob::thumbnailCaptured, this, [this](int index, QByteArray image) {
+        TvShowEpisode* episode = m_thumbnailEpisodes.at(index);
+        if (episode == nullptr) {
+            return;
+        }
+        ImageCache::instance()->invalidateImages(mediaelch::FilePath(
+            Manager::instance()->mediaCenterInterface()->imageFileName(episode, ImageType::TvShowEpisodeThumb)));
+        episode->setThumbnailImage(image);
+    });
+    connect(m_thumbnailJob, &ThumbnailCaptureJob::finished, this, [this](bool canceled) {
+        NotificationBox::instance()->hideProgressBar(Constants::EpisodeThumbnailsProgressMessageId);
+        if (canceled) {
+            NotificationBox::instance()->showInfo(tr("Creating episode thumbnails was canceled"));
+        } else if (m_thumbnailJob->failedCount() > 0) {
+            NotificationBox::instance()->showWarning(
+                tr("Could not create %n episode thumbnails", "", m_thumbnailJob->failedCount()));
+        }
+        m_thumbnailJob->deleteLater();
+        m_thumbnailJob = nullptr;
+        m_thumbnailEpisodes.clear();
+        emitSelected(ui->files->currentIndex());
+    });
+
+    m_thumbnailJob->start();
+}
+
 void TvShowFilesWidget::markForSyncBool(bool markForSync)
 {
     m_contextMenu->close();
@@ -760,6 +841,7 @@ void TvShowFilesWidget::setupContextMenu()
     auto* actionMarkAsWatched     = new QAction(tr("Mark as watched"),                   this);
     auto* actionMarkAsUnwatched   = new QAction(tr("Mark as unwatched"),                 this);
     auto* actionLoadStreamDetails = new QAction(tr("Load Stream Details"),               this);
+    m_actionCreateThumbnails      = new QAction(tr("Create Missing Episode Thumbnails"), this);
     auto* actionMarkForSync       = new QAction(tr("Add to Synchronization Queue"),      this);
     auto* actionUnmarkForSync     = new QAction(tr("Remove from Synchronization Queue"), this);
     auto* actionOpenFolder        = new QAction(tr("Open TV Show Folder"),               this);
@@ -771,6 +853,7 @@ void TvShowFilesWidget::setupContextMenu()
     connect(actionMarkAsWatched,     &QAction::triggered, this, &TvShowFilesWidget::markAsWatched);
     connect(actionMarkAsUnwatched,   &QAction::triggered, this, &TvShowFilesWidget::markAsUnwatched);
     connect(actionLoadStreamDetails, &QAction::triggered, this, &TvShowFilesWidget::loadStreamDetails);
+    connect(m_actionCreateThumbnails, &QAction::triggered, this, &TvShowFilesWidget::createEpisodeThumbnails);
     connect(actionMarkForSync,       &QAction::triggered, this, &TvShowFilesWidget::markForSync);
     connect(actionUnmarkForSync,     &QAction::triggered, this, &TvShowFilesWidget::unmarkForSync);
     connect(actionOpenFolder,        &QAction::triggered, this, &TvShowFilesWidget::openFolder);
@@ -802,6 +885,7 @@ void TvShowFilesWidget::setupContextMenu()
     m_contextMenu->addAction(actionMarkAsUnwatched);
     m_contextMenu->addSeparator();
     m_contextMenu->addAction(actionLoadStreamDetails);
+    m_contextMenu->addAction(m_actionCreateThumbnails);
     m_contextMenu->addSeparator();
     m_contextMenu->addAction(actionMarkForSync);
     m_contextMenu->addAction(actionUnmarkForSync);
@@ -9,6 +9,7 @@
 #include <QAction>
 #include <QMenu>
 #include <QModelIndex>
+#include <QPointer>
 #include <QWidget>
 #include <functional>
 
@@ -18,6 +19,10 @@ class TvShowFilesWidget;
 
 class TvShowBaseModelItem;
 
+namespace mediaelch {
+class ThumbnailCaptureJob;
+}
+
 /// The TvShowFilesWidget class is responsible for showing a list of TV shows
 /// with correct sorting and filtering. Internally, a TvShowTreeView is used
 /// to display the TV shows with their seasons and episodes.
@@ -55,6 +60,7 @@ private slots:
     void markAsWatched();
     void markAsUnwatched();
     void loadStreamDetails();
+    void createEpisodeThumbnails();
     void markForSyncBool(bool markForSync);
     void markForSync();
     void unmarkForSync();
@@ -81,4 +87,9 @@ private:
     QAction* m_actionPlay = nullptr;
     QAction* m_actionShowMissingEpisodes = nullptr;
     QAction* m_actionHideSpecialsInMissingEpisodes = nullptr;
+    QAction* m_actionCreateThumbnails = nullptr;
+
+    /// Running job that captures thumbnails of episodes without one.
+    mediaelch::ThumbnailCaptureJob* m_thumbnailJob = nullptr;
+    QVector<QPointer<TvShowEpisode>> m_thumbnailEpisodes;
 };
@@ -19,7 +19,8 @@ static constexpr unsigned ComboIndex_ShowAndAllEpisodes = 2;
 static constexpr unsigned ComboIndex_NewEpisodes = 3;
 static constexpr unsigned ComboIndex_AllEpisodes = 4;
 
-TvShowSearchWidget::TvShowSearchWidget(QWidget* parent) : QWidget{parent}, ui(new Ui::TvShowSearchWidget)
+TvShowSearchWidget::TvShowSearchWidget(QWidget* parent) :
+    QWidget{parent}, ui(new Ui::TvShowSearchWidget), m_prefetcher{new ScrapePrefetcher(this)}
 {
     ui->setupUi(this);
 
@@ -206,6 +207,8 @@ void TvShowSearchWidget::onShowResults(ShowSearchJob* searchJob)
         ui->results->setItem(row, 0, item);
     }
     ui->results->setCurrentCell(0, 0);
+
+    prefetchResults(results);
 }
 
 void TvShowSearchWidget::onResultChanged(QTableWidgetItem* current, QTableWidgetItem* previous)
@@ -227,6 +230,8 @@ void TvShowSearchWidget::onResultChanged(QTableWidgetItem* current, QTableWidget
 
 void TvShowSearchWidget::onResultDoubleClicked(QTableWidgetItem* item)
 {
+    // Don't compete with the actual scrape job.
+    m_prefetcher->cancel();
     m_showIdentifier = item->data(Qt::UserRole).toString();
     emit sigResultClicked();
 }
@@ -457,9 +462,31 @@ void TvShowSearchWidget::abortCurrentJobs()
         m_currentSearchJob->kill();
         m_currentSearchJob = nullptr;
     }
+    m_prefetcher->cancel();
     ui->tvShowPreview->clearAndAbortPreview();
 }
 
+void TvShowSearchWidget::prefetchResults(const QVector<ShowSearchJob::Result>& results)
+{
+    // Episodes are loaded separately; only the show's details are prefetched.
+    if (!isShowUpdateType(updateType())) {
+        return;
+    }
+
+    QVector<ScrapePrefetcher::JobFactory> jobs;
+    const int count = qMin(qsizetype_to_int(results.size()), ScrapePrefetcher::defaultResultCount);
+    for (int i = 0; i < count; ++i) {
+        ShowScrapeJob::Config config;
+        config.identifier = results[i].identifier;
+        config.locale = m_currentLanguage;
+        config.details = m_showDetailsToLoad;
+
+        TvScraper* scraper = m_currentScraper;
+        jobs.append([scraper, config]() -> mediaelch::worker::Job* { return scraper->loadShow(config); });
+    }
+    m_prefetcher->prefetch(std::move(jobs));
+}
+
 void TvShowSearchWidget::onSeasonOrderChanged(int index)
 {
     bool ok = false;
@@ -2,6 +2,7 @@
 
 #include "data/tv_show/SeasonOrder.h"
 #include "globals/Globals.h"
+#include "scrapers/ScrapePrefetcher.h"
 #include "scrapers/ScraperInfos.h"
 #include "scrapers/ScraperInterface.h"
 #include "scrapers/tv_show/TvScraper.h"
@@ -80,6 +81,9 @@ private:
     void showSuccess(const QString& message);
     void abortAndClearResults();
     void abortCurrentJobs();
+    /// \brief Load the details of the top search results in the background so that
+    ///        scraping a result is faster.
+    void prefetchResults(const QVector<mediaelch::scraper::ShowSearchJob::Result>& results);
     void updateCheckBoxes();
 
 private:
@@ -94,5 +98,6 @@ private:
 
     mediaelch::scraper::TvScraper* m_currentScraper = nullptr;
     QPointer<mediaelch::scraper::ShowSearchJob> m_currentSearchJob = nullptr;
+    mediaelch::scraper::ScrapePrefetcher* m_prefetcher = nullptr;
     mediaelch::Locale m_currentLanguage = mediaelch::Locale::English;
 };
@@ -1,5 +1,6 @@
 #include "workers/Job.h"
 
+#include <QThread>
 #include <QTimer>
 
 namespace mediaelch {
@@ -120,6 +121,17 @@ void Job::emitPercent(elch_ssize_t processed, elch_ssize_t total)
     }
 }
 
+QThread* createAutoDeleteThreadWithJob(Job* job, QObject* threadParent, const QString& threadName)
+{
+    auto* thread = new QThread(threadParent);
+    thread->setObjectName(threadName);
+    job->moveToThread(thread);
+
+    QObject::connect(thread, &QThread::started, job, &Job::start);
+    QObject::connect(job, &Job::destroyed, thread, &QThread::quit);
+    QObject::connect(thread, &QThread::finished, thread, &QThread::deleteLater);
+    return thread;
+}
 
 } // namespace worker
 } // namespace mediaelch
@@ -4,6 +4,8 @@
 
 #include <QObject>
 
+class QThread;
+
 namespace mediaelch {
 namespace worker {
 
@@ -91,5 +93,10 @@ private:
     QString m_errorText;
 };
 
+/// \brief Creates a thread and moves the job to it. The job is started as soon as
+///        the thread is started. The thread quits when the job is destroyed and
+///        deletes itself afterwards.
+QThread* createAutoDeleteThreadWithJob(Job* job, QObject* threadParent, const QString& threadName);
+
 } // namespace worker
 } // namespace mediaelch
@@ -0,0 +1,42 @@
+#include "test/test_helpers.h"
+
+#include "export/ExportManifest.h"
+#include "test/helpers/resource_dir.h"
+
+using namespace mediaelch;
+
+TEST_CASE("ExportManifest detects changed and stale files", "[export][incremental]")
+{
+    QDir dir = test::makeTempDir("export/manifest");
+    QFile::remove(dir.filePath(ExportManifest::fileName()));
+
+    {
+        ExportManifest manifest(dir);
+        CHECK_FALSE(manifest.load());
+        CHECK(manifest.updateFile("movies/1.html", "one"));
+        CHECK(manifest.updateFile("movies/2.html", "two"));
+        test::writeTempFile("export/manifest/movies/1.html", "one");
+        test::writeTempFile("export/manifest/movies/2.html", "two");
+        test::writeTempFile("export/manifest/tvshows/1.html", "show");
+        REQUIRE(manifest.save());
+    }
+
+    ExportManifest manifest(dir);
+    REQUIRE(manifest.load());
+
+    SECTION("unchanged files are not written again")
+    {
+        CHECK_FALSE(manifest.updateFile("movies/1.html", "one"));
+        CHECK(manifest.updateFile("movies/2.html", "changed"));
+        CHECK(manifest.updateFile("movies/3.html", "new"));
+    }
+
+    SECTION("stale files of the exported section are removed")
+    {
+        CHECK_FALSE(manifest.updateFile("movies/1.html", "one"));
+        CHECK(manifest.removeStaleFiles({"movies/"}) == 1);
+        CHECK(QFileInfo::exists(dir.filePath("movies/1.html")));
+        CHECK_FALSE(QFileInfo::exists(dir.filePath("movies/2.html")));
+        CHECK(QFileInfo::exists(dir.filePath("tvshows/1.html")));
+    }
+}
@@ -0,0 +1,116 @@
+#include "test/test_helpers.h"
+
+#include "data/tv_show/TvShowEpisode.h"
+#include "database/EpisodeSnapshot.h"
+
+using namespace mediaelch;
+
+namespace {
+
+void setupEpisode(TvShowEpisode& episode)
+{
+    episode.setTitle("Pilot");
+    episode.setShowTitle("Some Show");
+    episode.setOverview("The first episode.");
+    episode.setNetwork("HBO");
+    episode.setSeason(SeasonNumber(1));
+    episode.setEpisode(EpisodeNumber(2));
+    episode.setDisplaySeason(SeasonNumber(0));
+    episode.setDisplayEpisode(EpisodeNumber(3));
+    episode.setWriters({"Writer A", "Writer B"});
+    episode.setDirectors({"Director"});
+    episode.addTag("tag");
+    episode.setImdbId(ImdbId("tt0959621"));
+    episode.setTvdbId(TvDbId("349232"));
+    episode.setTvMazeId(TvMazeId("185"));
+    episode.setCertification(Certification("TV-14"));
+    episode.setThumbnail(QUrl("https://example.com/thumb.jpg"));
+    episode.setFirstAired(QDate(2008, 1, 20));
+    episode.setLastPlayed(QDateTime(QDate(2020, 5, 1), QTime(20, 15)));
+    episode.setEpBookmark(QTime(0, 12, 30));
+    episode.setPlayCount(3);
+    episode.setTop250(42);
+
+    Rating rating;
+    rating.source = "imdb";
+    rating.rating = 9.1;
+    rating.voteCount = 1234;
+    episode.ratings().addRating(rating);
+
+    Actor actor;
+    actor.name = "Bryan Cranston";
+    actor.role = "Walter White";
+    actor.thumb = "https://example.com/actor.jpg";
+    actor.order = 1;
+    episode.addActor(actor);
+
+    episode.streamDetails()->setVideoDetail(StreamDetails::VideoDetails::Codec, "h264");
+    episode.streamDetails()->setAudioDetail(0, StreamDetails::AudioDetails::Language, "eng");
+    episode.streamDetails()->setSubtitleDetail(0, StreamDetails::SubtitleDetails::Language, "ger");
+}
+
+} // namespace
+
+TEST_CASE("EpisodeSnapshot", "[database][episode]")
+{
+    TvShowEpisode original;
+    setupEpisode(original);
+
+    SECTION("round trip restores all NFO details")
+    {
+        const QByteArray snapshot = EpisodeSnapshot::write(original);
+        REQUIRE_FALSE(snapshot.isEmpty());
+
+        TvShowEpisode copy;
+        REQUIRE(EpisodeSnapshot::read(snapshot, copy));
+
+        CHECK(copy.title() == original.title());
+        CHECK(copy.showTitle() == original.showTitle());
+        CHECK(copy.overview() == original.overview());
+        CHECK(copy.network() == original.network());
+        CHECK(copy.seasonNumber() == original.seasonNumber());
+        CHECK(copy.episodeNumber() == original.episodeNumber());
+        CHECK(copy.displaySeason() == original.displaySeason());
+        CHECK(copy.displayEpisode() == original.displayEpisode());
+        CHECK(copy.writers() == original.writers());
+        CHECK(copy.directors() == original.directors());
+        CHECK(copy.tags() == original.tags());
+        CHECK(copy.imdbId() == original.imdbId());
+        CHECK(copy.tvdbId() == original.tvdbId());
+        CHECK(copy.tvmazeId() == original.tvmazeId());
+        CHECK(copy.certification() == original.certification());
+        CHECK(copy.thumbnail() == original.thumbnail());
+        CHECK(copy.firstAired() == original.firstAired());
+        CHECK(copy.lastPlayed() == original.lastPlayed());
+        CHECK(copy.epBookmark() == original.epBookmark());
+        CHECK(copy.playCount() == original.playCount());
+        CHECK(copy.top250() == original.top250());
+
+        REQUIRE(copy.ratings().size() == 1);
+        CHECK(copy.ratings()[0].source == "imdb");
+        CHECK(copy.ratings()[0].rating == Approx(9.1));
+        CHECK(copy.ratings()[0].voteCount == 1234);
+
+        REQUIRE(copy.actors().size() == 1);
+        CHECK(copy.actors().actors().first()->name == "Bryan Cranston");
+        CHECK(copy.actors().actors().first()->role == "Walter White");
+        CHECK(copy.actors().actors().first()->order == 1);
+
+        CHECK(copy.streamDetails()->videoDetails() == original.streamDetails()->videoDetails());
+        CHECK(copy.streamDetails()->audioDetails() == original.streamDetails()->audioDetails());
+        CHECK(copy.streamDetails()->subtitleDetails() == original.streamDetails()->subtitleDetails());
+    }
+
+    SECTION("empty snapshots are rejected")
+    {
+        TvShowEpisode copy;
+        CHECK_FALSE(EpisodeSnapshot::read(QByteArray(), copy));
+    }
+
+    SECTION("truncated snapshots are rejected")
+    {
+        const QByteArray snapshot = EpisodeSnapshot::write(original);
+        TvShowEpisode copy;
+        CHECK_FALSE(EpisodeSnapshot::read(snapshot.left(snapshot.size() / 2), copy));
+    }
+}
@@ -0,0 +1,84 @@
+#include "test/test_helpers.h"
+
+#include "data/movie/Movie.h"
+#include "database/MovieSnapshot.h"
+#include "test/helpers/fake_data.h"
+
+using namespace mediaelch;
+
+TEST_CASE("MovieSnapshot", "[database][movie]")
+{
+    std::unique_ptr<Movie> original = test::movieWithAllDetails();
+
+    SECTION("round trip restores all NFO details")
+    {
+        const QByteArray snapshot = MovieSnapshot::write(*original);
+        REQUIRE_FALSE(snapshot.isEmpty());
+
+        Movie copy(original->files().toStringList());
+        REQUIRE(MovieSnapshot::read(snapshot, copy));
+
+        CHECK(copy.name() == original->name());
+        CHECK(copy.originalName() == original->originalName());
+        CHECK(copy.sortTitle() == original->sortTitle());
+        CHECK(copy.overview() == original->overview());
+        CHECK(copy.outline() == original->outline());
+        CHECK(copy.tagline() == original->tagline());
+        CHECK(copy.set().name == original->set().name);
+        CHECK(copy.set().overview == original->set().overview);
+        CHECK(copy.writer() == original->writer());
+        CHECK(copy.director() == original->director());
+        CHECK(copy.tags() == original->tags());
+        CHECK(copy.studios() == original->studios());
+        CHECK(copy.genres() == original->genres());
+        CHECK(copy.countries() == original->countries());
+        CHECK(copy.imdbId() == original->imdbId());
+        CHECK(copy.certification() == original->certification());
+        CHECK(copy.trailer() == original->trailer());
+        CHECK(copy.released() == original->released());
+        CHECK(copy.lastPlayed() == original->lastPlayed());
+        CHECK(copy.runtime() == original->runtime());
+        CHECK(copy.playcount() == original->playcount());
+        CHECK(copy.top250() == original->top250());
+
+        REQUIRE(copy.ratings().size() == original->ratings().size());
+        for (int i = 0; i < qsizetype_to_int(copy.ratings().size()); ++i) {
+            CHECK(copy.ratings()[i].source == original->ratings()[i].source);
+            CHECK(copy.ratings()[i].rating == Approx(original->ratings()[i].rating));
+            CHECK(copy.ratings()[i].voteCount == original->ratings()[i].voteCount);
+        }
+
+        REQUIRE(copy.actors().size() == original->actors().size());
+        CHECK(copy.actors().actors().first()->name == original->actors().actors().first()->name);
+        CHECK(copy.actors().actors().last()->role == original->actors().actors().last()->role);
+
+        REQUIRE(copy.images().posters().size() == original->images().posters().size());
+        CHECK(copy.images().posters().first().originalUrl == original->images().posters().first().originalUrl);
+
+        CHECK(copy.streamDetails()->videoDetails() == original->streamDetails()->videoDetails());
+        CHECK(copy.streamDetails()->audioDetails() == original->streamDetails()->audioDetails());
+        CHECK(copy.streamDetails()->subtitleDetails() == original->streamDetails()->subtitleDetails());
+    }
+
+    SECTION("empty snapshots are rejected")
+    {
+        Movie copy;
+        CHECK_FALSE(MovieSnapshot::read(QByteArray(), copy));
+    }
+
+    SECTION("truncated snapshots are rejected")
+    {
+        const QByteArray snapshot = MovieSnapshot::write(*original);
+        Movie copy;
+        CHECK_FALSE(MovieSnapshot::read(snapshot.left(snapshot.size() / 2), copy));
+    }
+
+    SECTION("snapshots of other format versions are rejected")
+    {
+        QByteArray snapshot = MovieSnapshot::write(*original);
+        // The format version directly follows the 4 byte magic number.
+        snapshot[5] = static_cast<char>(snapshot[5] + 1);
+        Movie copy;
+        CHECK_FALSE(MovieSnapshot::read(snapshot, copy));
+    }
+}
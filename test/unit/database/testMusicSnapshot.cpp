@@ -0,0 +1,106 @@
+#include "test/test_helpers.h"
+
+#include "data/music/Album.h"
+#include "data/music/Artist.h"
+#include "database/AlbumSnapshot.h"
+#include "database/ArtistSnapshot.h"
+
+using namespace mediaelch;
+
+TEST_CASE("ArtistSnapshot", "[database][music]")
+{
+    Artist original;
+    original.setName("Some Artist");
+    original.setMbId(MusicBrainzId("a74b1b7f-71a5-4011-9441-d0b5e4122711"));
+    original.setGenres({"Rock", "Pop"});
+    original.setStyles({"Alternative"});
+    original.setMoods({"Energetic"});
+    original.setYearsActive("1990s");
+    original.setFormed("1985");
+    original.setBiography("Biography");
+    original.setDisbanded("2020");
+
+    Poster thumb;
+    thumb.originalUrl = QUrl("https://example.com/thumb.jpg");
+    thumb.thumbUrl = QUrl("https://example.com/thumb_preview.jpg");
+    original.addImage(ImageType::ArtistThumb, thumb);
+
+    DiscographyAlbum album;
+    album.title = "First Album";
+    album.year = "1990";
+    original.addDiscographyAlbum(album);
+
+    SECTION("round trip restores all NFO details")
+    {
+        Artist copy;
+        REQUIRE(ArtistSnapshot::read(ArtistSnapshot::write(original), copy));
+
+        CHECK(copy.name() == original.name());
+        CHECK(copy.mbId() == original.mbId());
+        CHECK(copy.genres() == original.genres());
+        CHECK(copy.styles() == original.styles());
+        CHECK(copy.moods() == original.moods());
+        CHECK(copy.yearsActive() == original.yearsActive());
+        CHECK(copy.formed() == original.formed());
+        CHECK(copy.biography() == original.biography());
+        CHECK(copy.disbanded() == original.disbanded());
+
+        REQUIRE(copy.images(ImageType::ArtistThumb).size() == 1);
+        CHECK(copy.images(ImageType::ArtistThumb).first().thumbUrl == thumb.thumbUrl);
+        CHECK(copy.images(ImageType::ArtistFanart).isEmpty());
+
+        REQUIRE(copy.discographyAlbums().size() == 1);
+        CHECK(copy.discographyAlbums().first().title == "First Album");
+        CHECK(copy.discographyAlbums().first().year == "1990");
+    }
+
+    SECTION("truncated snapshots are rejected")
+    {
+        const QByteArray snapshot = ArtistSnapshot::write(original);
+        Artist copy;
+        CHECK_FALSE(ArtistSnapshot::read(snapshot.left(snapshot.size() / 2), copy));
+    }
+}
+
+TEST_CASE("AlbumSnapshot", "[database][music]")
+{
+    Album original;
+    original.setTitle("Some Album");
+    original.setArtist("Some Artist");
+    original.setMbReleaseGroupId(MusicBrainzId("1dc4c347-a1db-32aa-b14f-bc9cc507b843"));
+    original.setGenres({"Rock"});
+    original.setReview("Review");
+    original.setLabel("Label");
+    original.setReleaseDate("1990-01-01");
+    original.setYear(1990);
+    original.setRating(8.5);
+
+    Poster thumb;
+    thumb.originalUrl = QUrl("https://example.com/cover.jpg");
+    original.addImage(ImageType::AlbumThumb, thumb);
+
+    SECTION("round trip restores all NFO details")
+    {
+        Album copy;
+        REQUIRE(AlbumSnapshot::read(AlbumSnapshot::write(original), copy));
+
+        CHECK(copy.title() == original.title());
+        CHECK(copy.artist() == original.artist());
+        CHECK(copy.mbReleaseGroupId() == original.mbReleaseGroupId());
+        CHECK(copy.genres() == original.genres());
+        CHECK(copy.review() == original.review());
+        CHECK(copy.label() == original.label());
+        CHECK(copy.releaseDate() == original.releaseDate());
+        CHECK(copy.year() == original.year());
+        CHECK(copy.rating() == Approx(original.rating()));
+
+        REQUIRE(copy.images(ImageType::AlbumThumb).size() == 1);
+        CHECK(copy.images(ImageType::AlbumThumb).first().originalUrl == thumb.originalUrl);
+    }
+
+    SECTION("empty snapshots are rejected")
+    {
+        Album copy;
+        CHECK_FALSE(AlbumSnapshot::read(QByteArray(), copy));
+    }
+}
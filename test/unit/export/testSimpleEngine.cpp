@@ -0,0 +1,36 @@
+#include "test/test_helpers.h"
+
+#include "data/tv_show/TvShowEpisode.h"
+#include "export/SimpleEngine.h"
+
+using namespace mediaelch;
+
+TEST_CASE("SimpleEngine export ids", "[export][simple]")
+{
+    SECTION("episodes in one multi-episode file get different ids")
+    {
+        const QStringList files{"/tv/Show/Season 1/S01E01-E02.mkv"};
+        TvShowEpisode first(files);
+        first.setSeason(SeasonNumber(1));
+        first.setEpisode(EpisodeNumber(1));
+        TvShowEpisode second(files);
+        second.setSeason(SeasonNumber(1));
+        second.setEpisode(EpisodeNumber(2));
+
+        CHECK(SimpleEngine::exportId(&first) != SimpleEngine::exportId(&second));
+    }
+
+    SECTION("ids do not depend on the lifetime of the item")
+    {
+        const QStringList files{"/tv/Show/Season 1/S01E03.mkv"};
+        TvShowEpisode first(files);
+        first.setSeason(SeasonNumber(1));
+        first.setEpisode(EpisodeNumber(3));
+        TvShowEpisode second(files);
+        second.setSeason(SeasonNumber(1));
+        second.setEpisode(EpisodeNumber(3));
+
+        REQUIRE(first.episodeId() != second.episodeId());
+        CHECK(SimpleEngine::exportId(&first) == SimpleEngine::exportId(&second));
+    }
+}
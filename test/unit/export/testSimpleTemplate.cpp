@@ -0,0 +1,90 @@
+#include "test/test_helpers.h"
+
+#include "export/SimpleTemplate.h"
+
+using namespace mediaelch;
+
+TEST_CASE("SimpleTemplate renders placeholders", "[export][simple]")
+{
+    SECTION("variables are replaced and unknown ones are kept")
+    {
+        SimpleTemplate tmpl = SimpleTemplate::parse("<b>{{ MOVIE.TITLE }}</b> {{ MOVIE.UNKNOWN }}");
+        SimpleTemplateContext context;
+        context.setVariable("MOVIE.TITLE", "Oceans 12");
+        CHECK(tmpl.render(context, false, {}) == "<b>Oceans 12</b> {{ MOVIE.UNKNOWN }}");
+    }
+
+    SECTION("values are not interpreted as placeholders")
+    {
+        SimpleTemplate tmpl = SimpleTemplate::parse("{{ A }}|{{ B }}");
+        SimpleTemplateContext context;
+        context.setVariable("A", "{{ B }}");
+        context.setVariable("B", "b");
+        CHECK(tmpl.render(context, false, {}) == "{{ B }}|b");
+    }
+
+    SECTION("blocks are repeated and can access parent variables")
+    {
+        SimpleTemplate tmpl = SimpleTemplate::parse(
+            "{{ BEGIN_BLOCK_TAGS }} <i>{{ TAG.NAME }} ({{ MOVIE.TITLE }})</i> {{ END_BLOCK_TAGS }}");
+        SimpleTemplateContext context;
+        context.setVariable("MOVIE.TITLE", "Up");
+        context.setListBlock("TAGS", "TAG.NAME", {"a", "<b>"});
+        CHECK(tmpl.render(context, false, {}) == "<i>a (Up)</i> <i>&lt;b&gt; (Up)</i>");
+        CHECK(tmpl.hasBlock("TAGS"));
+        CHECK_FALSE(tmpl.hasBlock("GENRES"));
+    }
+
+    SECTION("nested blocks")
+    {
+        SimpleTemplate tmpl = SimpleTemplate::parse("{{ BEGIN_BLOCK_SEASON }}S{{ SEASON }}: "
+                                                    "{{ BEGIN_BLOCK_EPISODE }}E{{ EPISODE }}{{ END_BLOCK_EPISODE }}"
+                                                    "{{ END_BLOCK_SEASON }}");
+        SimpleTemplateContext episode1;
+        episode1.setVariable("EPISODE", "1");
+        SimpleTemplateContext episode2;
+        episode2.setVariable("EPISODE", "2");
+        SimpleTemplateContext season;
+        season.setVariable("SEASON", "3");
+        season.setBlock("EPISODE", {episode1, episode2}, ",");
+        SimpleTemplateContext context;
+        context.setBlock("SEASON", {season}, "\n");
+        CHECK(tmpl.render(context, false, {}) == "S3: E1,E2");
+        CHECK(tmpl.hasBlock("EPISODE"));
+    }
+
+    SECTION("unknown and unclosed blocks are kept")
+    {
+        const QString content = "{{ BEGIN_BLOCK_A }}x{{ END_BLOCK_A }} {{ BEGIN_BLOCK_B }}";
+        SimpleTemplate tmpl = SimpleTemplate::parse(content);
+        CHECK(tmpl.render(SimpleTemplateContext{}, false, {}) == content);
+    }
+
+    SECTION("images are reported and linked")
+    {
+        SimpleTemplate tmpl = SimpleTemplate::parse(
+            "{{ IMAGE.POSTER[200, 300] }} {{ IMAGE.logo[10,20] }} {{ IMAGE.banner[1, 1] }} {{ IMAGE.fanart[0, 1] }}");
+        CHECK(tmpl.imageTypes() == QSet<QString>{"poster", "logo", "banner"});
+
+        SimpleTemplateImage poster;
+        poster.sourceFile = "/movies/poster.jpg";
+        poster.destinationBase = "movie_images/1-poster";
+        poster.suffix = "jpg";
+        poster.typeName = "movie";
+        SimpleTemplateImage logo;
+        logo.typeName = "movie";
+
+        SimpleTemplateContext context;
+        context.setImage("poster", poster);
+        context.setImage("logo", logo);
+
+        QStringList destinations;
+        const QString result = tmpl.render(context, true, [&](const QString&, const QString& destination, QSize) {
+            destinations << destination;
+        });
+        CHECK(result
+              == "../movie_images/1-poster_200x300.jpg ../defaults/movie_logo_10x20.png "
+                 "{{ IMAGE.banner[1, 1] }} {{ IMAGE.fanart[0, 1] }}");
+        CHECK(destinations == QStringList{"movie_images/1-poster_200x300.jpg"});
+    }
+}
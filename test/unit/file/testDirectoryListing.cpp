@@ -0,0 +1,70 @@
+#include "test/test_helpers.h"
+
+#include "media/DirectoryListing.h"
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace mediaelch;
+
+namespace {
+
+bool touch(const QString& path)
+{
+    QFile file(path);
+    return file.open(QIODevice::WriteOnly);
+}
+
+} // namespace
+
+TEST_CASE("DirectoryListing", "[file]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    REQUIRE(touch(dir.filePath("movie.mkv")));
+    REQUIRE(touch(dir.filePath("movie.nfo")));
+    REQUIRE(touch(dir.filePath("movie.en.srt")));
+    REQUIRE(touch(dir.filePath("movie.de.SUB")));
+    REQUIRE(touch(dir.filePath(".hidden.srt")));
+    REQUIRE(QDir(dir.path()).mkdir("extrafanart"));
+
+    SECTION("contains files and directories")
+    {
+        const DirectoryListing listing = DirectoryListing::read(dir.path());
+        REQUIRE(listing.isValid());
+        CHECK(listing.hasFile("movie.mkv"));
+        CHECK(listing.hasFile("movie.nfo"));
+        CHECK_FALSE(listing.hasFile("movie-poster.jpg"));
+        CHECK_FALSE(listing.hasFile("extrafanart"));
+        CHECK(listing.hasDir("extrafanart"));
+        CHECK_FALSE(listing.hasDir("movie.mkv"));
+    }
+
+    SECTION("filters files by suffix")
+    {
+        const DirectoryListing listing = DirectoryListing::read(dir.path());
+        CHECK(listing.filesWithSuffix({"srt", "sub"}) == QStringList({"movie.de.SUB", "movie.en.srt"}));
+        CHECK(listing.filesWithSuffix({"idx"}).isEmpty());
+    }
+
+    SECTION("is invalid for missing directories")
+    {
+        CHECK_FALSE(DirectoryListing::read(dir.filePath("does-not-exist")).isValid());
+    }
+
+    SECTION("cache falls back to the filesystem for directories that were not read")
+    {
+        DirectoryListingCache cache;
+        CHECK_FALSE(cache.find(dir.path()).isValid());
+        CHECK(cache.isFile(dir.path(), "movie.nfo"));
+
+        cache.add(dir.path());
+        REQUIRE(touch(dir.filePath("movie-poster.jpg")));
+        // The listing is a snapshot.
+        CHECK_FALSE(cache.isFile(dir.path(), "movie-poster.jpg"));
+
+        cache.remove({dir.path()});
+        CHECK(cache.isFile(dir.path(), "movie-poster.jpg"));
+    }
+}
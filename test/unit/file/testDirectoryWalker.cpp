@@ -0,0 +1,97 @@
+#include "test/test_helpers.h"
+
+#include "file_search/DirectoryWalker.h"
+
+#include <QDir>
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QTemporaryDir>
+#include <algorithm>
+
+using namespace mediaelch;
+
+namespace {
+
+bool touch(const QString& path)
+{
+    QFile file(path);
+    return file.open(QIODevice::WriteOnly);
+}
+
+} // namespace
+
+TEST_CASE("DirectoryWalker", "[file]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    QDir root(dir.path());
+    REQUIRE(root.mkpath("Movie A/extrafanart"));
+    REQUIRE(root.mkpath("Movie B/sub/subsub"));
+    REQUIRE(touch(root.filePath("Movie A/movie.mkv")));
+    REQUIRE(touch(root.filePath("Movie A/movie.nfo")));
+    REQUIRE(touch(root.filePath("Movie A/.hidden.mkv")));
+    REQUIRE(touch(root.filePath("Movie B/sub/subsub/movie.AVI")));
+
+    DirectoryWalker::Options options;
+    options.fileGlob = {"*.mkv", "*.avi"};
+
+    SECTION("reads a single directory")
+    {
+        options.withLastModified = true;
+        DirectoryWalker walker(options);
+        const auto entries = walker.readDirectory(root.filePath("Movie A"));
+        REQUIRE(entries.size() == 2);
+
+        const auto file = std::find_if(
+            entries.cbegin(), entries.cend(), [](const DirectoryWalker::Entry& entry) { return entry.isFile(); });
+        REQUIRE(file != entries.cend());
+        CHECK(file->name == "movie.mkv");
+        CHECK(file->lastModified.isValid());
+
+        const auto subDir = std::find_if(
+            entries.cbegin(), entries.cend(), [](const DirectoryWalker::Entry& entry) { return entry.isDir(); });
+        REQUIRE(subDir != entries.cend());
+        CHECK(subDir->name == "extrafanart");
+    }
+
+    SECTION("walks all subdirectories returned by the visitor")
+    {
+        options.parallelism = 3;
+        DirectoryWalker walker(options);
+
+        QMutex mutex;
+        QStringList visited;
+        QStringList files;
+        walker.walk(dir.path(), [&](const QString& dirPath, const QVector<DirectoryWalker::Entry>& entries) {
+            QStringList subDirs;
+            QMutexLocker locker(&mutex);
+            visited << dirPath;
+            for (const auto& entry : entries) {
+                if (entry.isFile()) {
+                    files << entry.name;
+                } else if (entry.name != "extrafanart") {
+                    subDirs << dirPath + "/" + entry.name;
+                }
+            }
+            return subDirs;
+        });
+
+        files.sort();
+        CHECK(files == QStringList({"movie.AVI", "movie.mkv"}));
+        CHECK(visited.size() == 5);
+        CHECK_FALSE(visited.contains(root.filePath("Movie A/extrafanart")));
+    }
+
+    SECTION("stops walking if aborted")
+    {
+        options.isAborted = []() { return true; };
+        DirectoryWalker walker(options);
+        int visits = 0;
+        walker.walk(dir.path(), [&visits](const QString&, const QVector<DirectoryWalker::Entry>&) {
+            ++visits;
+            return QStringList();
+        });
+        CHECK(visits == 0);
+    }
+}
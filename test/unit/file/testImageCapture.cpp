@@ -0,0 +1,29 @@
+#include "test/test_helpers.h"
+
+#include "media/ImageCapture.h"
+
+#include <QImage>
+
+using namespace mediaelch;
+
+TEST_CASE("ImageCapture picks a time inside the video", "[image][ImageCapture]")
+{
+    CHECK(ImageCapture::randomTime(0) == 0);
+    for (int i = 0; i < 100; ++i) {
+        CHECK(ImageCapture::randomTime(10) < 10);
+
+        // Avoids the first and last 10%, e.g. opening and closing credits.
+        const unsigned time = ImageCapture::randomTime(1000);
+        CHECK(time >= 100);
+        CHECK(time < 900);
+    }
+}
+
+TEST_CASE("ImageCapture scales captured frames", "[image][ImageCapture]")
+{
+    const QImage frame(1920, 1080, QImage::Format_RGB32);
+
+    CHECK(ImageCapture::scaledToDimensions(frame, {0, 0}, true).size() == QSize(1920, 1080));
+    CHECK(ImageCapture::scaledToDimensions(frame, {400, 300}, false).size() == QSize(400, 225));
+    CHECK(ImageCapture::scaledToDimensions(frame, {720, 1080}, true).size() == QSize(720, 1080));
+}
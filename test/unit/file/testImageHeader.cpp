@@ -0,0 +1,203 @@
+#include "test/test_helpers.h"
+
+#include "media/ImageHeader.h"
+#include "media/ImageMetadataCache.h"
+#include "media/ImageUtils.h"
+
+#include <QBuffer>
+#include <QDataStream>
+#include <QFile>
+#include <QImage>
+#include <QTemporaryDir>
+
+using namespace mediaelch;
+
+namespace {
+
+QByteArray bytes(std::initializer_list<int> values)
+{
+    QByteArray data;
+    for (const int value : values) {
+        data.append(static_cast<char>(value));
+    }
+    return data;
+}
+
+QByteArray encodePng(QSize size)
+{
+    QImage image(size, QImage::Format_RGB32);
+    image.fill(Qt::darkCyan);
+    QByteArray data;
+    QBuffer buffer(&data);
+    REQUIRE(image.save(&buffer, "png"));
+    return data;
+}
+
+void writeFile(const QString& path, const QByteArray& data)
+{
+    QFile file(path);
+    REQUIRE(file.open(QIODevice::WriteOnly));
+    REQUIRE(file.write(data) == data.size());
+}
+
+} // namespace
+
+TEST_CASE("ImageHeader reads dimensions without decoding", "[image][ImageHeader]")
+{
+    SECTION("JPEG with segments before the frame header")
+    {
+        // SOI, APP0 (JFIF), DQT (truncated table), SOF2 (progressive), 1000 x 1500
+        const QByteArray jpeg = bytes({0xFF, 0xD8, //
+                                    0xFF, 0xE0, 0x00, 0x07, 'J', 'F', 'I', 'F', 0x00,
+                                    0xFF, 0xDB, 0x00, 0x03, 0x00,
+                                    0xFF, 0xC2, 0x00, 0x11, 0x08, 0x05, 0xDC, 0x03, 0xE8, 0x03});
+        const ImageHeader header = ImageHeader::fromData(jpeg);
+        CHECK(header.isValid());
+        CHECK(header.format == ImageHeader::Format::Jpeg);
+        CHECK(header.size == QSize(1000, 1500));
+    }
+
+    SECTION("JPEG with Exif orientation")
+    {
+        // SOI, APP1 (Exif, big endian, IFD0 with orientation 6), SOF0, 1500 x 1000
+        const QByteArray jpeg = bytes({0xFF, 0xD8, //
+            0xFF, 0xE1, 0x00, 0x22, 'E', 'x', 'i', 'f', 0x00, 0x00, //
+            'M', 'M', 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, //
+            0x00, 0x01, 0x01, 0x12, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, //
+            0x00, 0x00, 0x00, 0x00, //
+            0xFF, 0xC0, 0x00, 0x11, 0x08, 0x03, 0xE8, 0x05, 0xDC, 0x03});
+        const ImageHeader header = ImageHeader::fromData(jpeg);
+        CHECK(header.isValid());
+        CHECK(header.orientation == 6);
+        CHECK(header.size == QSize(1500, 1000));
+        CHECK(header.displaySize() == QSize(1000, 1500));
+    }
+
+    SECTION("JPEG with truncated Exif segment")
+    {
+        // Same as above, but only the first bytes were read from the file.
+        const QByteArray jpeg = bytes({0xFF, 0xD8, //
+            0xFF, 0xE1, 0x00, 0x22, 'E', 'x', 'i', 'f', 0x00, 0x00, //
+            'M', 'M', 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, //
+            0x00, 0x01, 0x01, 0x12, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06});
+        // Cut off after the TIFF header's magic number, i.e. before the offset of IFD0,
+        // after the offset of IFD0 and inside of the IFD0 entry.
+        for (const int size : {16, 20, 28}) {
+            const ImageHeader header = ImageHeader::fromData(jpeg.left(size));
+            CHECK(header.format == ImageHeader::Format::Jpeg);
+            CHECK(header.orientation == 1);
+            CHECK_FALSE(header.isValid());
+        }
+    }
+
+    SECTION("JPEG without frame header")
+    {
+        const ImageHeader header = ImageHeader::fromData(bytes({0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10}));
+        CHECK(header.format == ImageHeader::Format::Jpeg);
+        CHECK_FALSE(header.isValid());
+    }
+
+    SECTION("PNG")
+    {
+        const ImageHeader header = ImageHeader::fromData(encodePng({123, 45}));
+        CHECK(header.isValid());
+        CHECK(header.format == ImageHeader::Format::Png);
+        CHECK(header.size == QSize(123, 45));
+    }
+
+    SECTION("WebP")
+    {
+        const QByteArray riff = QByteArray("RIFF") + bytes({0, 0, 0, 0}) + "WEBP";
+
+        // Lossy, 1920 x 1080
+        const QByteArray lossy = riff + "VP8 " + bytes({0, 0, 0, 0, 0, 0, 0, 0x9D, 0x01, 0x2A, 0x80, 0x07, 0x38, 0x04});
+        CHECK(ImageHeader::fromData(lossy).format == ImageHeader::Format::WebP);
+        CHECK(ImageHeader::fromData(lossy).size == QSize(1920, 1080));
+
+        // Lossless, 2 x 3: width - 1 = 1, height - 1 = 2 (bits 14-27)
+        const QByteArray lossless = riff + "VP8L" + bytes({0, 0, 0, 0, 0x2F, 0x01, 0x80, 0x00, 0x00});
+        CHECK(ImageHeader::fromData(lossless).size == QSize(2, 3));
+
+        // Extended, 1000 x 1500
+        const QByteArray extended =
+            riff + "VP8X" + bytes({0, 0, 0, 0, 0x10, 0, 0, 0, 0xE7, 0x03, 0x00, 0xDB, 0x05, 0x00});
+        CHECK(ImageHeader::fromData(extended).size == QSize(1000, 1500));
+    }
+
+    SECTION("unknown and truncated data")
+    {
+        CHECK_FALSE(ImageHeader::fromData({}).isValid());
+        CHECK(ImageHeader::fromData("GIF89a").format == ImageHeader::Format::Unknown);
+        CHECK_FALSE(ImageHeader::fromData(encodePng({10, 10}).left(20)).isValid());
+    }
+}
+
+TEST_CASE("resizeBackdrop keeps images that need no resize", "[image][ImageHeader]")
+{
+    CHECK(backdropResizeTarget({1918, 1080}) == QSize(1920, 1080));
+    CHECK(backdropResizeTarget({1281, 721}) == QSize(1280, 720));
+    CHECK_FALSE(backdropResizeTarget({1920, 1080}).isValid());
+    CHECK_FALSE(backdropResizeTarget({3840, 2160}).isValid());
+
+    const QByteArray png = encodePng({300, 200});
+    QByteArray backdrop = png;
+    resizeBackdrop(backdrop);
+    CHECK(backdrop == png);
+}
+
+TEST_CASE("scaledSize matches scaledImage", "[image][ImageHeader]")
+{
+    const QImage image(400, 300, QImage::Format_RGB32);
+    for (const QSize target : {QSize(200, 0), QSize(0, 150), QSize(100, 100), QSize(0, 0)}) {
+        CHECK(scaledSize(image.size(), target) == scaledImage(image, target).size());
+    }
+}
+
+TEST_CASE("ImageMetadataCache caches headers of files", "[image][ImageHeader]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    const QString image = dir.filePath("poster.png");
+    const QString cacheFile = dir.filePath("image_metadata.cache");
+    writeFile(image, encodePng({30, 20}));
+
+    CHECK(ImageHeader::fromFile(image).size == QSize(30, 20));
+    CHECK_FALSE(ImageHeader::fromFile(dir.filePath("missing.png")).isValid());
+
+    {
+        ImageMetadataCache cache(cacheFile);
+        CHECK(cache.header(image).size == QSize(30, 20));
+        CHECK(cache.size() == 1);
+    }
+
+    SECTION("is loaded from disk")
+    {
+        ImageMetadataCache cache(cacheFile);
+        CHECK(cache.size() == 1);
+        CHECK(cache.header(image).size == QSize(30, 20));
+    }
+
+    SECTION("probes changed files again")
+    {
+        ImageMetadataCache cache(cacheFile);
+        writeFile(image, encodePng({300, 200}));
+        CHECK(cache.header(image).size == QSize(300, 200));
+        cache.invalidate(image);
+        CHECK(cache.size() == 0);
+    }
+
+    SECTION("discards caches with more entries than the file can hold")
+    {
+        QFile file(cacheFile);
+        REQUIRE(file.open(QIODevice::ReadWrite));
+        // Entry count after magic number and version
+        REQUIRE(file.seek(8));
+        QDataStream out(&file);
+        out << quint32(0x7FFFFFFF);
+        file.close();
+
+        ImageMetadataCache cache(cacheFile);
+        CHECK(cache.size() == 0);
+        CHECK(cache.header(image).size == QSize(30, 20));
+    }
+}
@@ -0,0 +1,104 @@
+#include "test/test_helpers.h"
+
+#include "media/NameMatcher.h"
+
+using namespace mediaelch;
+
+namespace {
+
+bool matchesAnyRegex(const QVector<QRegularExpression>& patterns, const QString& name)
+{
+    for (const QRegularExpression& rx : patterns) {
+        if (rx.isValid() && rx.match(name).hasMatch()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+TEST_CASE("NameMatcher", "[file]")
+{
+    SECTION("empty matcher matches nothing")
+    {
+        NameMatcher matcher;
+        CHECK(matcher.isEmpty());
+        CHECK_FALSE(matcher.matches("movie.mkv"));
+        CHECK_FALSE(matcher.matches(""));
+    }
+
+    SECTION("literal patterns respect anchors")
+    {
+        NameMatcher matcher({QRegularExpression("^[.]git$"),
+            QRegularExpression("^\\._"),
+            QRegularExpression("\\.part$"),
+            QRegularExpression("-extra")});
+        CHECK_FALSE(matcher.isEmpty());
+
+        CHECK(matcher.matches(".git"));
+        CHECK_FALSE(matcher.matches(".gitignore"));
+        CHECK_FALSE(matcher.matches("x.git"));
+        CHECK(matcher.matches("._movie.mkv"));
+        CHECK_FALSE(matcher.matches("movie._mkv"));
+        CHECK(matcher.matches("movie.mkv.part"));
+        CHECK_FALSE(matcher.matches("movie.part.mkv"));
+        CHECK(matcher.matches("movie-extra.mkv"));
+        CHECK_FALSE(matcher.matches("movie-EXTRA.mkv"));
+    }
+
+    SECTION("case-insensitive literals and parts")
+    {
+        NameMatcher matcher({QRegularExpression("^sample$", QRegularExpression::CaseInsensitiveOption)},
+            {"-trailer", "-sample"});
+        CHECK(matcher.matches("Sample"));
+        CHECK(matcher.matches("SAMPLE"));
+        CHECK_FALSE(matcher.matches("samples"));
+        CHECK(matcher.matches("Movie-Trailer.mkv"));
+        CHECK(matcher.matches("movie-SAMPLE.mkv"));
+        CHECK_FALSE(matcher.matches("movie trailer.mkv"));
+    }
+
+    SECTION("escaped dollar sign is no anchor")
+    {
+        NameMatcher matcher({QRegularExpression("price\\$")});
+        CHECK(matcher.matches("price$ list"));
+        CHECK_FALSE(matcher.matches("price"));
+    }
+
+    SECTION("behaves like matching each regular expression")
+    {
+        const QVector<QRegularExpression> patterns{
+            QRegularExpression("^[.]git$"),
+            QRegularExpression("-sample\\.(mkv|avi)$", QRegularExpression::CaseInsensitiveOption),
+            QRegularExpression("^\\d{4}$"),
+            QRegularExpression("(a)\\1"),
+            QRegularExpression("^(?<name>tmp)_"),
+            QRegularExpression("[Ee]xtras?$"),
+            QRegularExpression("(invalid"),
+            QRegularExpression("\\$RECYCLE\\.BIN"),
+        };
+        const QStringList names{".git",
+            "movie-Sample.MKV",
+            "movie-sample.mp4",
+            "2001",
+            "20011",
+            "aa",
+            "ab",
+            "tmp_file",
+            "my_tmp_file",
+            "Extras",
+            "extra",
+            "Extras.mkv",
+            "$RECYCLE.BIN",
+            "RECYCLE.BIN",
+            "(invalid",
+            ""};
+
+        NameMatcher matcher(patterns);
+        for (const QString& name : names) {
+            CAPTURE(name);
+            CHECK(matcher.matches(name) == matchesAnyRegex(patterns, name));
+        }
+    }
+}
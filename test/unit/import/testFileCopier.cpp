@@ -0,0 +1,74 @@
+#include "test/test_helpers.h"
+
+#include "import/FileCopier.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace mediaelch;
+
+namespace {
+
+QByteArray testContent(int size)
+{
+    QByteArray content(size, Qt::Uninitialized);
+    for (int i = 0; i < size; ++i) {
+        content[i] = static_cast<char>(i % 251);
+    }
+    return content;
+}
+
+bool writeFile(const QString& path, const QByteArray& content)
+{
+    QFile file(path);
+    return file.open(QIODevice::WriteOnly) && file.write(content) == content.size();
+}
+
+QByteArray readFile(const QString& path)
+{
+    QFile file(path);
+    return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+}
+
+} // namespace
+
+TEST_CASE("FileCopier", "[import]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    const QString source = dir.filePath("source.bin");
+    const QString destination = dir.filePath("destination.bin");
+
+    SECTION("copies content larger than the buffer and reports all bytes")
+    {
+        const QByteArray content = testContent(static_cast<int>(FileCopier::bufferSize) + 12345);
+        REQUIRE(writeFile(source, content));
+
+        qint64 reported = 0;
+        CHECK(FileCopier::copy(source, destination, [&reported](qint64 bytes) { reported += bytes; }));
+        CHECK(reported == content.size());
+        CHECK(readFile(destination) == content);
+    }
+
+    SECTION("copies empty files")
+    {
+        REQUIRE(writeFile(source, QByteArray()));
+        CHECK(FileCopier::copy(source, destination));
+        CHECK(QFile::exists(destination));
+        CHECK(readFile(destination).isEmpty());
+    }
+
+    SECTION("does not overwrite existing files")
+    {
+        REQUIRE(writeFile(source, "new"));
+        REQUIRE(writeFile(destination, "old"));
+        CHECK_FALSE(FileCopier::copy(source, destination));
+        CHECK(readFile(destination) == "old");
+    }
+
+    SECTION("fails for missing source files")
+    {
+        CHECK_FALSE(FileCopier::copy(dir.filePath("missing.bin"), destination));
+        CHECK_FALSE(QFile::exists(destination));
+    }
+}
@@ -0,0 +1,71 @@
+#include "test/test_helpers.h"
+
+#include "import/FileOperationBatch.h"
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace mediaelch;
+
+namespace {
+
+void createFile(const QString& path, const QByteArray& content)
+{
+    QFile file(path);
+    REQUIRE(file.open(QIODevice::WriteOnly));
+    REQUIRE(file.write(content) == content.size());
+}
+
+} // namespace
+
+TEST_CASE("FileOperationBatch", "[import]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    REQUIRE(QDir(dir.path()).mkdir("target"));
+
+    createFile(dir.filePath("a.mkv"), "movie");
+    createFile(dir.filePath("a.nfo"), "<movie/>");
+
+    FileOperationBatch batch;
+    batch.addMove(dir.filePath("a.mkv"), dir.filePath("target/a.mkv"));
+    batch.addMove(dir.filePath("a.nfo"), dir.filePath("target/a.nfo"));
+
+    SECTION("plan does not touch any file")
+    {
+        const auto& operations = batch.plan();
+        REQUIRE(operations.size() == 2);
+        CHECK(operations[0].type == FileOperationBatch::OperationType::Rename);
+        CHECK(operations[0].status == FileOperationBatch::OperationStatus::Planned);
+        CHECK(operations[0].size == 5);
+        CHECK(QFile::exists(dir.filePath("a.mkv")));
+        CHECK_FALSE(QFile::exists(dir.filePath("target/a.mkv")));
+    }
+
+    SECTION("moves all files and reports progress")
+    {
+        qint64 moved = 0;
+        CHECK(batch.execute([&moved](qint64 bytes) { moved += bytes; }));
+        CHECK(moved == 13);
+        CHECK(batch.report().done == 2);
+        CHECK(batch.report().failed == 0);
+        CHECK(batch.report().bytesMoved == 13);
+        CHECK(QFile::exists(dir.filePath("target/a.mkv")));
+        CHECK(QFile::exists(dir.filePath("target/a.nfo")));
+        CHECK_FALSE(QFile::exists(dir.filePath("a.mkv")));
+    }
+
+    SECTION("existing destinations fail and successful moves can be rolled back")
+    {
+        createFile(dir.filePath("target/a.nfo"), "existing");
+        CHECK_FALSE(batch.execute());
+        CHECK(batch.report().done == 1);
+        CHECK(batch.report().failed == 1);
+
+        CHECK(batch.rollback());
+        CHECK(QFile::exists(dir.filePath("a.mkv")));
+        CHECK_FALSE(QFile::exists(dir.filePath("target/a.mkv")));
+        CHECK(batch.operations()[0].status == FileOperationBatch::OperationStatus::RolledBack);
+    }
+}
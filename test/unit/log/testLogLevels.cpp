@@ -0,0 +1,50 @@
+#include "test/test_helpers.h"
+
+#include "log/Log.h"
+
+using namespace mediaelch;
+
+TEST_CASE("Log levels", "[log]")
+{
+    SECTION("levels are parsed case-insensitively")
+    {
+        LogLevel level = LogLevel::Debug;
+        CHECK(logLevelFromString("WARNING", level));
+        CHECK(level == LogLevel::Warning);
+        CHECK(logLevelFromString(" off ", level));
+        CHECK(level == LogLevel::Off);
+        CHECK_FALSE(logLevelFromString("verbose", level));
+        CHECK(level == LogLevel::Off);
+        CHECK(logLevelToString(LogLevel::Info) == "info");
+    }
+
+    SECTION("filter rules enable the level and all higher ones")
+    {
+        const QString rules = logFilterRules({{"scraper.tmdb", LogLevel::Info}});
+        CHECK(rules
+              == "scraper.tmdb.debug=false\n"
+                 "scraper.tmdb.info=true\n"
+                 "scraper.tmdb.warning=true\n"
+                 "scraper.tmdb.critical=true\n");
+    }
+
+    SECTION("more specific categories override wildcards")
+    {
+        setLogLevels({
+            {"scraper.tmdb", LogLevel::Debug},
+            {"scraper.*", LogLevel::Warning},
+            {"database", LogLevel::Off},
+        });
+
+        CHECK(c_scraper_tmdb().isDebugEnabled());
+        CHECK_FALSE(c_scraper_imdb().isDebugEnabled());
+        CHECK_FALSE(c_scraper_imdb().isInfoEnabled());
+        CHECK(c_scraper_imdb().isWarningEnabled());
+        CHECK_FALSE(c_database().isCriticalEnabled());
+        CHECK(c_scanner().isDebugEnabled());
+
+        setLogLevels({});
+        CHECK(c_scraper_imdb().isDebugEnabled());
+        CHECK(c_database().isCriticalEnabled());
+    }
+}
@@ -0,0 +1,150 @@
+#include "test/test_helpers.h"
+
+#include "log/LogRingBuffer.h"
+#include "log/LogWriter.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QVector>
+#include <thread>
+#include <vector>
+
+using namespace mediaelch;
+
+namespace {
+
+QByteArray readFile(const QString& path)
+{
+    QFile file(path);
+    REQUIRE(file.open(QIODevice::ReadOnly));
+    return file.readAll();
+}
+
+} // namespace
+
+TEST_CASE("LogRingBuffer", "[log]")
+{
+    SECTION("capacity is rounded up to a power of two")
+    {
+        LogRingBuffer<int> queue(5);
+        CHECK(queue.capacity() == 8);
+    }
+
+    SECTION("values are popped in order until the queue is empty")
+    {
+        LogRingBuffer<int> queue(4);
+        for (int i = 0; i < 4; ++i) {
+            CHECK(queue.tryPush(int(i)));
+        }
+        CHECK_FALSE(queue.tryPush(4));
+
+        int value = -1;
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(queue.tryPop(value));
+            CHECK(value == i);
+        }
+        CHECK_FALSE(queue.tryPop(value));
+
+        // Wraps around
+        CHECK(queue.tryPush(5));
+        REQUIRE(queue.tryPop(value));
+        CHECK(value == 5);
+    }
+
+    SECTION("multiple producers don't lose values")
+    {
+        constexpr int producerCount = 4;
+        constexpr int valuesPerProducer = 10000;
+        LogRingBuffer<int> queue(64);
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < producerCount; ++p) {
+            producers.emplace_back([&queue, p]() {
+                for (int i = 0; i < valuesPerProducer; ++i) {
+                    while (!queue.tryPush(p * valuesPerProducer + i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        QVector<int> lastValue(producerCount, -1);
+        int outOfOrder = 0;
+        int popped = 0;
+        int value = 0;
+        while (popped < producerCount * valuesPerProducer) {
+            if (!queue.tryPop(value)) {
+                std::this_thread::yield();
+                continue;
+            }
+            // Values of a single producer keep their order.
+            const int producer = value / valuesPerProducer;
+            if (value <= lastValue[producer]) {
+                ++outOfOrder;
+            }
+            lastValue[producer] = value;
+            ++popped;
+        }
+        CHECK(outOfOrder == 0);
+
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+        CHECK_FALSE(queue.tryPop(value));
+    }
+}
+
+TEST_CASE("LogWriter", "[log]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    const QString logFile = dir.filePath("MediaElch.log");
+
+    SECTION("writes all lines to the log file")
+    {
+        LogWriter writer(16);
+        REQUIRE(writer.open(logFile));
+        CHECK(writer.isRunning());
+        for (int i = 0; i < 100; ++i) {
+            writer.append(QByteArray::number(i) + '\n');
+        }
+        writer.close();
+        CHECK_FALSE(writer.isRunning());
+
+        const QList<QByteArray> lines = readFile(logFile).split('\n');
+        REQUIRE(lines.size() == 101);
+        for (int i = 0; i < 100; ++i) {
+            CHECK(lines[i] == QByteArray::number(i));
+        }
+    }
+
+    SECTION("flush writes pending lines")
+    {
+        LogWriter writer;
+        REQUIRE(writer.open(logFile));
+        writer.append("first line\n");
+        writer.flush();
+        CHECK(readFile(logFile) == "first line\n");
+        writer.close();
+    }
+
+    SECTION("rotates the log file")
+    {
+        LogFileOptions options;
+        options.maxFileSize = 10;
+        options.maxFiles = 2;
+
+        LogWriter writer;
+        REQUIRE(writer.open(logFile, options));
+        for (const char* line : {"aaaaaaaa\n", "bbbbbbbb\n", "cccccccc\n", "dddddddd\n"}) {
+            writer.append(line);
+            writer.flush();
+        }
+        writer.close();
+
+        CHECK(readFile(logFile) == "dddddddd\n");
+        CHECK(readFile(logFile + ".1") == "cccccccc\n");
+        CHECK(readFile(logFile + ".2") == "bbbbbbbb\n");
+        CHECK_FALSE(QFile::exists(logFile + ".3"));
+    }
+}
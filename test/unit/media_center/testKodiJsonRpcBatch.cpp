@@ -0,0 +1,60 @@
+#include "test/test_helpers.h"
+
+#include "media_center/kodi/KodiJsonRpcBatch.h"
+
+#include <QJsonDocument>
+
+using namespace mediaelch::kodi;
+
+TEST_CASE("JsonRpcBatch splits calls into batch requests", "[kodi][sync]")
+{
+    SECTION("empty batch")
+    {
+        JsonRpcBatch batch(10);
+        int requestId = 5;
+        CHECK(batch.isEmpty());
+        CHECK(batch.toRequests(requestId).isEmpty());
+        CHECK(requestId == 5);
+    }
+
+    SECTION("calls are split and get unique ids")
+    {
+        JsonRpcBatch batch(2);
+        for (int i = 1; i <= 5; ++i) {
+            batch.addCall("VideoLibrary.RemoveMovie", QJsonObject{{"movieid", i}});
+        }
+        CHECK(batch.callCount() == 5);
+
+        int requestId = 10;
+        const auto requests = batch.toRequests(requestId);
+        REQUIRE(requests.size() == 3);
+        CHECK(requestId == 15);
+        CHECK(requests[0].callCount == 2);
+        CHECK(requests[2].callCount == 1);
+
+        const QJsonArray first = QJsonDocument::fromJson(requests[0].body).array();
+        REQUIRE(first.size() == 2);
+        CHECK(first[0].toObject().value("jsonrpc").toString() == "2.0");
+        CHECK(first[0].toObject().value("method").toString() == "VideoLibrary.RemoveMovie");
+        CHECK(first[0].toObject().value("id").toInt() == 11);
+        CHECK(first[1].toObject().value("params").toObject().value("movieid").toInt() == 2);
+
+        const QJsonArray last = QJsonDocument::fromJson(requests[2].body).array();
+        REQUIRE(last.size() == 1);
+        CHECK(last[0].toObject().value("id").toInt() == 15);
+    }
+}
+
+TEST_CASE("JsonRpcBatch counts errors in batch responses", "[kodi][sync]")
+{
+    CHECK(JsonRpcBatch::countErrors(R"([{"id":1,"jsonrpc":"2.0","result":"OK"},{"id":2,"jsonrpc":"2.0","result":"OK"}])", 2)
+          == 0);
+    CHECK(JsonRpcBatch::countErrors(
+              R"([{"id":1,"jsonrpc":"2.0","result":"OK"},{"id":2,"jsonrpc":"2.0","error":{"code":-32602,"message":"Invalid params."}}])",
+              2)
+          == 1);
+    // Missing responses, invalid batches and invalid JSON count as failed calls.
+    CHECK(JsonRpcBatch::countErrors(R"([{"id":1,"jsonrpc":"2.0","result":"OK"}])", 3) == 2);
+    CHECK(JsonRpcBatch::countErrors(R"({"error":{"code":-32600,"message":"Invalid request."},"id":null})", 4) == 4);
+    CHECK(JsonRpcBatch::countErrors("<html>", 2) == 2);
+}
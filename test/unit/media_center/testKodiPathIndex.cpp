@@ -0,0 +1,67 @@
+#include "test/test_helpers.h"
+
+#include "media_center/kodi/KodiPathIndex.h"
+
+using namespace mediaelch;
+
+TEST_CASE("KodiPathIndex finds Kodi items by their path suffix", "[kodi][sync]")
+{
+    SECTION("empty index and empty files")
+    {
+        KodiPathIndex index;
+        CHECK(index.isEmpty());
+        CHECK(index.findId({"/movies/Up/Up.mkv"}) == 0);
+        CHECK(index.findId({}) == -1);
+    }
+
+    SECTION("file names are matched case-insensitively across mount points")
+    {
+        KodiPathIndex index;
+        index.insert(1, "smb://nas/movies/Up (2009)/Up.mkv");
+        index.insert(2, "smb://nas/movies/Cars (2006)/Cars.mkv");
+        CHECK(index.findId({"/mnt/movies/Up (2009)/up.MKV"}) == 1);
+        CHECK(index.findId({"C:\\Movies\\Cars (2006)\\Cars.mkv"}) == 2);
+        CHECK(index.findId({"/mnt/movies/Brave.mkv"}) == 0);
+    }
+
+    SECTION("ambiguous file names are resolved by parent directories")
+    {
+        KodiPathIndex index;
+        index.insert(1, "/tv/Show A/Season 1/S01E01.mkv");
+        index.insert(2, "/tv/Show B/Season 1/S01E01.mkv");
+        CHECK(index.findId({"/media/tv/Show B/Season 1/S01E01.mkv"}) == 2);
+        // Not enough path components to tell both apart
+        CHECK(index.findId({"Season 1/S01E01.mkv"}) == -1);
+    }
+
+    SECTION("identical paths stay ambiguous")
+    {
+        KodiPathIndex index;
+        index.insert(1, "/movies/Up/Up.mkv");
+        index.insert(2, "/movies/Up/Up.mkv");
+        CHECK(index.findId({"/movies/Up/Up.mkv"}) == -1);
+    }
+
+    SECTION("stacked files only match the same set of files")
+    {
+        KodiPathIndex index;
+        index.insert(1, "stack:///movies/Up/Up-cd1.mkv , /movies/Up/Up-cd2.mkv");
+        index.insert(2, "/movies/Up/Up-cd1.mkv");
+        CHECK(index.findId({"/mnt/Up/Up-cd2.mkv", "/mnt/Up/Up-cd1.mkv"}) == 1);
+        CHECK(index.findId({"/mnt/Up/Up-cd1.mkv"}) == 2);
+        CHECK(index.findId({"/mnt/Up/Up-cd1.mkv", "/mnt/Up/Up-cd3.mkv"}) == 0);
+    }
+
+    SECTION("large libraries")
+    {
+        KodiPathIndex index;
+        const int count = 50000;
+        for (int i = 1; i <= count; ++i) {
+            // Every file name exists twice; only the show directory differs.
+            index.insert(i, QStringLiteral("nfs://nas/tv/Show %1/Season 1/episode%2.mkv").arg(i).arg(i % (count / 2)));
+        }
+        CHECK(index.findId({"/tv/Show 123/Season 1/episode123.mkv"}) == 123);
+        CHECK(index.findId({"/tv/Show 25123/Season 1/episode123.mkv"}) == 25123);
+        CHECK(index.findId({"/tv/Show 1/Season 1/episode2.mkv"}) == 0);
+    }
+}
@@ -0,0 +1,95 @@
+#include "test/test_helpers.h"
+
+#include "media_center/SaveQueue.h"
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace mediaelch;
+
+namespace {
+
+QByteArray readFile(const QString& path)
+{
+    QFile file(path);
+    REQUIRE(file.open(QIODevice::ReadOnly));
+    return file.readAll();
+}
+
+} // namespace
+
+TEST_CASE("SaveQueue executes file operations", "[media_center][SaveQueue]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+
+    SECTION("writes create missing directories")
+    {
+        const QString path = dir.filePath("extrafanart/fanart1.jpg");
+        CHECK(SaveQueue::execute(FileOperation::write(path, "image")));
+        CHECK(readFile(path) == "image");
+    }
+
+    SECTION("removing a missing file is no error")
+    {
+        const QString path = dir.filePath("poster.jpg");
+        CHECK(SaveQueue::execute(FileOperation::write(path, "image")));
+        CHECK(SaveQueue::execute(FileOperation::remove(path)));
+        CHECK_FALSE(QFile::exists(path));
+        CHECK(SaveQueue::execute(FileOperation::remove(path)));
+    }
+
+    SECTION("errors are reported")
+    {
+        // A directory can't be overwritten by a file.
+        REQUIRE(QDir(dir.path()).mkdir("movie.nfo"));
+        QString errorString;
+        CHECK_FALSE(SaveQueue::execute(FileOperation::write(dir.filePath("movie.nfo"), "<movie/>"), &errorString));
+        CHECK_FALSE(errorString.isEmpty());
+    }
+}
+
+TEST_CASE("SaveQueue writes items in the background", "[media_center][SaveQueue]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    const QString nfo = dir.filePath("movie.nfo");
+    const QString poster = dir.filePath("movie-poster.jpg");
+
+    SaveQueue queue;
+
+    SECTION("files of an item are written")
+    {
+        queue.enqueue("movie:a", {FileOperation::write(nfo, "<movie/>", true), FileOperation::write(poster, "image")});
+        queue.waitForItem("movie:a");
+        CHECK_FALSE(queue.isItemPending("movie:a"));
+        CHECK_FALSE(queue.isWritePending(nfo));
+        CHECK(readFile(nfo) == "<movie/>");
+        CHECK(readFile(poster) == "image");
+    }
+
+    SECTION("saving an item again writes the latest data")
+    {
+        for (int i = 0; i < 20; ++i) {
+            queue.enqueue("movie:a", {FileOperation::write(nfo, QByteArray::number(i), true)});
+        }
+        queue.enqueue("movie:a", {FileOperation::write(poster, "image"), FileOperation::remove(nfo)});
+        queue.waitForDone();
+        CHECK_FALSE(queue.isItemPending("movie:a"));
+        CHECK_FALSE(QFile::exists(nfo));
+        CHECK(readFile(poster) == "image");
+    }
+
+    SECTION("items are written independently")
+    {
+        for (int i = 0; i < 10; ++i) {
+            const QString path = dir.filePath(QStringLiteral("%1/movie.nfo").arg(i));
+            queue.enqueue(QStringLiteral("movie:%1").arg(i), {FileOperation::write(path, QByteArray::number(i))});
+        }
+        queue.waitForDone();
+        for (int i = 0; i < 10; ++i) {
+            CHECK(readFile(dir.filePath(QStringLiteral("%1/movie.nfo").arg(i))) == QByteArray::number(i));
+        }
+    }
+}
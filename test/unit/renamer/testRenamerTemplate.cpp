@@ -0,0 +1,67 @@
+#include "test/test_helpers.h"
+
+#include "renamer/Renamer.h"
+#include "renamer/RenamerTemplate.h"
+
+using namespace mediaelch;
+
+namespace {
+
+/// \brief Render the pattern the way the renamers did before templates were compiled.
+QString renderWithReplace(QString text, const QString& title, const QString& year, const QString& movieset, bool is3D)
+{
+    Renamer::replace(text, "title", title);
+    Renamer::replace(text, "year", year);
+    Renamer::replaceCondition(text, "movieset", movieset);
+    Renamer::replaceCondition(text, "3D", is3D);
+    return text;
+}
+
+} // namespace
+
+TEST_CASE("RenamerTemplate", "[renamer]")
+{
+    RenamerValues values;
+    values.insert("title", " Alien ");
+    values.insert("year", "1979");
+    values.insert("movieset", "");
+    values.insertCondition("3D", true);
+
+    SECTION("placeholders are replaced by their trimmed values")
+    {
+        CHECK(RenamerTemplate("<title> (<year>)").render(values) == "Alien (1979)");
+    }
+
+    SECTION("unknown placeholders and conditions are kept")
+    {
+        CHECK(RenamerTemplate("<title> <unknown>").render(values) == "Alien <unknown>");
+        CHECK(RenamerTemplate("{other}<title>{/other}").render(values) == "{other}Alien{/other}");
+        CHECK(RenamerTemplate("a < b > c").render(values) == "a < b > c");
+        CHECK(RenamerTemplate("{title} without end").render(values) == "{title} without end");
+    }
+
+    SECTION("conditions depend on values or explicit conditions")
+    {
+        CHECK(RenamerTemplate("{movieset}<movieset> - {/movieset}<title>").render(values) == "Alien");
+        CHECK(RenamerTemplate("<title>{3D}.3D{/3D}").render(values) == "Alien.3D");
+        CHECK(RenamerTemplate("<title>{year} [<year>]{/year}").render(values) == "Alien [1979]");
+    }
+
+    SECTION("nested conditions")
+    {
+        CHECK(RenamerTemplate("{year}<year>{3D} 3D{movieset} <movieset>{/movieset}{/3D}{/year}").render(values)
+              == "1979 3D");
+    }
+
+    SECTION("same result as Renamer::replace()")
+    {
+        const QStringList patterns{"<title> (<year>).<extension>",
+            "{movieset}<movieset> - {/movieset}<title> (<year>)",
+            "<title>{3D}-3D{/3D}{movieset} [<movieset>]{/movieset}",
+            ""};
+        for (const QString& pattern : patterns) {
+            CAPTURE(pattern);
+            CHECK(RenamerTemplate(pattern).render(values) == renderWithReplace(pattern, " Alien ", "1979", "", true));
+        }
+    }
+}
@@ -2,6 +2,8 @@
 
 #include "scrapers/movie/MovieMerger.h"
 
+#include <QTimer>
+
 namespace test {
 
 StubMovieScraper::StubMovieScraper(const QString& id, QObject* parent) : MovieScraper(parent)
@@ -24,11 +26,14 @@ mediaelch::scraper::MovieSearchJob* StubMovieScraper::search(mediaelch::scraper:
 mediaelch::scraper::MovieScrapeJob* StubMovieScraper::loadMovie(mediaelch::scraper::MovieScrapeJob::Config config)
 {
     using namespace mediaelch::scraper;
-    return new StubMovieScrapeJob(std::move(config), stub_movie, this);
+    return new StubMovieScrapeJob(std::move(config), stub_movie, stub_delay, this);
 }
 
-StubMovieScrapeJob::StubMovieScrapeJob(Config config, Movie& stubMovie, QObject* parent) :
-    mediaelch::scraper::MovieScrapeJob(std::move(config), parent)
+StubMovieScrapeJob::StubMovieScrapeJob(Config config,
+    Movie& stubMovie,
+    std::chrono::milliseconds delay,
+    QObject* parent) :
+    mediaelch::scraper::MovieScrapeJob(std::move(config), parent), m_delay{delay}
 {
     mediaelch::scraper::copyDetailsToMovie(
         movie(), stubMovie, mediaelch::scraper::allMovieScraperInfos(), false, false);
@@ -37,7 +42,11 @@ StubMovieScrapeJob::StubMovieScrapeJob(Config config, Movie& stubMovie, QObject*
 
 void StubMovieScrapeJob::doStart()
 {
-    emitFinished();
+    if (m_delay.count() > 0) {
+        QTimer::singleShot(m_delay, this, [this]() { emitFinished(); });
+    } else {
+        emitFinished();
+    }
 }
 
 void StubMovieSearchJob::doStart()
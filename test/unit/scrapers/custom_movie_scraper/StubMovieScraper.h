@@ -4,6 +4,8 @@
 #include "scrapers/movie/MovieScrapeJob.h"
 #include "scrapers/movie/MovieScraper.h"
 
+#include <chrono>
+
 namespace test {
 
 /// \brief Stub used to test the custom movie scraper's implementation.
@@ -34,6 +36,8 @@ public:
 
 public:
     Movie stub_movie;
+    /// Time until scrape jobs of this scraper finish.  Zero means immediately.
+    std::chrono::milliseconds stub_delay{0};
 
 private:
     ScraperMeta m_meta;
@@ -45,9 +49,15 @@ class StubMovieScrapeJob : public mediaelch::scraper::MovieScrapeJob
     Q_OBJECT
 
 public:
-    explicit StubMovieScrapeJob(Config config, Movie& stubMovie, QObject* parent = nullptr);
+    explicit StubMovieScrapeJob(Config config,
+        Movie& stubMovie,
+        std::chrono::milliseconds delay,
+        QObject* parent = nullptr);
     ~StubMovieScrapeJob() override = default;
     void doStart() override;
+
+private:
+    std::chrono::milliseconds m_delay;
 };
 
 
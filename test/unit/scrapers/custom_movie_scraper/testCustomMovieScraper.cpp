@@ -7,6 +7,9 @@
 #include "test/helpers/scraper_helpers.h"
 #include "test/unit/scrapers/custom_movie_scraper/StubMovieScraper.h"
 
+#include <QEventLoop>
+#include <QPointer>
+#include <QTimer>
 #include <memory>
 #include <vector>
 
@@ -95,3 +98,44 @@ TEST_CASE("CustomMovieScraper scrapes correct movie details", "[CustomMovieScrap
         CHECK(movie.overview().isEmpty());
     }
 }
+
+TEST_CASE("CustomMovieScraper stops waiting for scrapers at the deadline", "[CustomMovieScraper][load_data]")
+{
+    auto setup = setupCustomMovieScraperStubs(2);
+    setup.mainConfig.scraperMap[setup.scrapers[0].get()].details = {MovieScraperInfo::Title};
+    setup.mainConfig.scraperMap[setup.scrapers[1].get()].details = {MovieScraperInfo::Director};
+    setup.scrapers[1]->stub_delay = 300ms;
+    setup.mainConfig.deadline = 50ms;
+
+    auto scrapeJob = makeScrapeJob(setup.mainConfig);
+    test::scrapeMovieScraperSync(scrapeJob.get(), true);
+
+    // The slow scraper's job is still running in the background.
+    QPointer<MovieScrapeJob> lateJob = setup.scrapers[1]->findChild<MovieScrapeJob*>();
+    REQUIRE(lateJob != nullptr);
+
+    SECTION("details of scrapers that finished in time are used and the late one is reported")
+    {
+        CHECK(scrapeJob->movie().name() == "name-0");
+        CHECK(scrapeJob->movie().director().isEmpty());
+        CHECK(scrapeJob->hasError());
+        CHECK(scrapeJob->errorString().contains("stub-scraper-1"));
+
+        const auto& timings = scrapeJob->sourceTimings();
+        REQUIRE(timings.size() == 2);
+        for (const auto& timing : timings) {
+            CHECK(timing.finished == (timing.scraperId == "stub-scraper-0"));
+        }
+    }
+
+    SECTION("the late job is deleted once it finishes")
+    {
+        QEventLoop loop;
+        QObject::connect(lateJob.data(), &QObject::destroyed, &loop, &QEventLoop::quit);
+        QTimer::singleShot(2000, &loop, &QEventLoop::quit);
+        loop.exec();
+        CHECK(lateJob.isNull());
+        // The late result must not be merged into the finished movie.
+        CHECK(scrapeJob->movie().director().isEmpty());
+    }
+}
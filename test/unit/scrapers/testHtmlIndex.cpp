@@ -0,0 +1,111 @@
+#include "test/test_helpers.h"
+
+#include "scrapers/HtmlIndex.h"
+
+using namespace mediaelch::scraper;
+
+TEST_CASE("HtmlIndex indexes elements in a single pass", "[scraper][HtmlIndex]")
+{
+    const QString html = QStringLiteral(R"html(<!DOCTYPE html>
+<html>
+<head>
+  <meta property='og:image' content="https://example.com/poster.jpg" />
+  <meta itemprop="genre" content="Drama">
+  <meta itemprop="genre" content="Comedy">
+  <!-- <div id="commented-out"></div> -->
+  <script type="application/ld+json">{"@type": "Movie", "name": "<b>Alien</b>"}</script>
+  <script id="__NEXT_DATA__" type="application/json">{"props": {}}</script>
+  <style>.title > span { color: red; }</style>
+</head>
+<body>
+  <h3 itemprop="name">Alien <span class="year">(1979)</span></h3>
+  <section class="titlereference-section-overview">
+    <div>In space, no one can hear you scream &amp; run.</div>
+  </section>
+  <span class="ipl-rating-star__rating main">8.5</span>
+  <ul data-testid=cast>
+    <li>Sigourney Weaver<br>Ripley
+    <li>Tom Skerritt</li>
+  </ul>
+  <p>Unclosed paragraph with a stray end tag</b> and 1 < 2
+</body>
+</html>)html");
+
+    HtmlIndex page(html);
+
+    SECTION("elements by id, class and attribute")
+    {
+        CHECK(page.elementById("commented-out") == nullptr);
+
+        const auto ratings = page.elementsByClass("ipl-rating-star__rating");
+        REQUIRE(ratings.size() == 1);
+        CHECK(ratings.first()->tag == "span");
+        CHECK(page.innerHtml(*ratings.first()) == "8.5");
+        CHECK(page.elementsByClass("main").size() == 1);
+
+        const auto genres = page.elementsByAttribute("itemprop", "genre");
+        REQUIRE(genres.size() == 2);
+        CHECK(HtmlIndex::attribute(*genres.at(0), "content") == "Drama");
+        CHECK(HtmlIndex::attribute(*genres.at(1), "content") == "Comedy");
+
+        const auto images = page.elementsByAttribute("property", "og:image");
+        REQUIRE(images.size() == 1);
+        CHECK(HtmlIndex::attribute(*images.first(), "content") == "https://example.com/poster.jpg");
+        CHECK(HtmlIndex::attribute(*images.first(), "missing").isNull());
+    }
+
+    SECTION("inner HTML and text")
+    {
+        const auto titles = page.elementsByAttribute("itemprop", "name");
+        REQUIRE(titles.size() == 1);
+        CHECK(page.innerHtml(*titles.first()) == R"(Alien <span class="year">(1979)</span>)");
+        CHECK(page.text(*titles.first()) == "Alien (1979)");
+
+        const auto sections = page.elementsByClass("titlereference-section-overview");
+        REQUIRE(sections.size() == 1);
+        const HtmlIndex::Element* div = page.firstDescendant(*sections.first(), "div");
+        REQUIRE(div != nullptr);
+        CHECK(page.text(*div) == "In space, no one can hear you scream & run.");
+        CHECK(page.firstDescendant(*sections.first(), "span") == nullptr);
+    }
+
+    SECTION("navigation by tag and document order")
+    {
+        const auto titles = page.elementsByTag("h3");
+        REQUIRE(titles.size() == 1);
+        CHECK(page.hasInnerHtml(*titles.first(), R"(Alien <span class="year">(1979)</span>)"));
+        CHECK_FALSE(page.hasInnerHtml(*titles.first(), "Alien"));
+
+        const HtmlIndex::Element* section = page.nextElement(*titles.first());
+        REQUIRE(section != nullptr);
+        CHECK(section->tag == "section");
+        CHECK(page.textBefore(*section).isEmpty());
+        CHECK(page.nextElement(*titles.first(), "ul") == page.elementsByTag("ul").first());
+
+        const auto items = page.elementsByTag("li");
+        REQUIRE(items.size() == 2);
+        CHECK(page.descendants(*page.elementsByTag("ul").first(), "li") == items);
+        CHECK(HtmlIndex::contains(*page.elementsByTag("ul").first(), *items.last()));
+        CHECK_FALSE(HtmlIndex::contains(*section, *items.last()));
+        CHECK(page.textBefore(*items.last()) == "Ripley");
+    }
+
+    SECTION("unclosed elements end at their parent's end tag")
+    {
+        const auto lists = page.elementsByAttribute("data-testid", "cast");
+        REQUIRE(lists.size() == 1);
+        const HtmlIndex::Element* firstItem = page.firstDescendant(*lists.first(), "li");
+        REQUIRE(firstItem != nullptr);
+        CHECK(page.innerHtml(*firstItem).trimmed() == "Sigourney Weaver<br>Ripley");
+        CHECK(lists.first()->end == html.indexOf("</ul>") + 5);
+    }
+
+    SECTION("embedded JSON")
+    {
+        REQUIRE(page.jsonLd().size() == 1);
+        CHECK(page.jsonLd().first() == R"({"@type": "Movie", "name": "<b>Alien</b>"})");
+        CHECK(page.nextData() == R"({"props": {}})");
+        // Script contents are not tokenized.
+        CHECK(page.elementsByClass("title").isEmpty());
+    }
+}
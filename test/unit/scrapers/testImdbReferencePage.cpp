@@ -0,0 +1,263 @@
+#include "test/test_helpers.h"
+
+#include "data/movie/Movie.h"
+#include "scrapers/HtmlIndex.h"
+#include "scrapers/imdb/ImdbReferencePage.h"
+
+#include <QElapsedTimer>
+#include <QRegularExpression>
+#include <QVector>
+#include <chrono>
+#include <limits>
+
+using namespace mediaelch::scraper;
+using namespace std::chrono_literals;
+
+namespace {
+
+/// Excerpt of https://www.imdb.com/title/tt0090605/reference with the given number of cast rows.
+QString referencePage(int castCount)
+{
+    QString cast;
+    for (int i = 0; i < castCount; ++i) {
+        cast += QStringLiteral(R"html(
+<tr class="odd">
+  <td class="primary_photo"><a href="/name/nm%1/"><img height="44" width="32" alt="Actor %1"
+    loadlate="https://m.media-amazon.com/images/M/%1._V1_UY44_CR0,0,32,44_AL_.jpg" /></a></td>
+  <td itemprop="actor" itemscope itemtype="http://schema.org/Person">
+    <a href="/name/nm%1/" itemprop='url'> <span class="itemprop" itemprop="name">Actor %1</span></a>
+  </td>
+  <td class="ellipsis">...</td>
+  <td class="character"><div>Character %1 <a href="/title/tt0090605/characters/nm%1">(voice)</a></div></td>
+</tr>)html")
+                    .arg(i);
+    }
+
+    return QStringLiteral(R"html(<!DOCTYPE html>
+<html>
+<head>
+  <meta property="pageId" content="tt0090605" />
+  <meta property='og:image' content="https://m.media-amazon.com/images/M/poster._V1_UX182_CR0,0,182,268_AL_.jpg" />
+</head>
+<body>
+<h3 itemprop="name">
+Aliens 2
+<span class="titlereference-title-year">(<a href="/year/1986/">1986</a>)</span>
+</h3>
+Aliens
+    <span class="titlereference-original-title-label">(original title)</span>
+<ul class="ipl-inline-list">
+  <li class="ipl-inline-list__item"><a href="/title/tt0090605/releaseinfo">29 Aug 1986 (Germany)</a></li>
+</ul>
+<div class="ipl-rating-star">
+  <span class="ipl-rating-star__rating">8.4</span>
+  <span class="ipl-rating-star__total-votes">(745,123)</span>
+</div>
+<a href="/chart/top?ref_=tt_awd">Top Rated Movies #67</a>
+<section class="titlereference-section-overview">
+  <div>Fifty-seven years after surviving an apocalyptic attack aboard her space vessel.</div>
+  <div class="titlereference-overview-section">
+    Director:
+    <ul class="ipl-inline-list">
+      <li class="ipl-inline-list__item"><a href="/name/nm0000116/">James Cameron</a></li>
+    </ul>
+  </div>
+  <div class="titlereference-overview-section">
+    Writers:
+    <ul class="ipl-inline-list">
+      <li class="ipl-inline-list__item"><a href="/name/nm0000116/">James Cameron</a> (story)</li>
+      <li class="ipl-inline-list__item"><a href="/name/nm0317525/">David Giler</a> (story)</li>
+    </ul>
+  </div>
+</section>
+<table class="cast_list">%1
+</table>
+<table class="titlereference-overview-table">
+  <tr class="ipl-zebra-list__item">
+    <td class="ipl-zebra-list__label">Genres</td>
+    <td>
+      <ul class="ipl-inline-list">
+        <li class="ipl-inline-list__item"><a href="/genre/Action">Action</a></li>
+        <li class="ipl-inline-list__item"><a href="/genre/Sci-Fi">Sci-Fi</a></li>
+      </ul>
+    </td>
+  </tr>
+  <tr class="ipl-zebra-list__item">
+    <td class="ipl-zebra-list__label">Certificate</td>
+    <td>
+      <ul class="ipl-inline-list">
+        <li class="ipl-inline-list__item"><a href="/search/title?certificates=DE%3A16">Germany:16</a></li>
+        <li class="ipl-inline-list__item"><a href="/search/title?certificates=US%3AR">United States:R</a></li>
+      </ul>
+    </td>
+  </tr>
+  <tr class="ipl-zebra-list__item">
+    <td class="ipl-zebra-list__label">Runtime</td>
+    <td>
+      <ul class="ipl-inline-list">
+        <li class="ipl-inline-list__item">
+          137 min
+        </li>
+      </ul>
+    </td>
+  </tr>
+  <tr class="ipl-zebra-list__item">
+    <td class="ipl-zebra-list__label">Country</td>
+    <td>
+      <ul class="ipl-inline-list">
+        <li class="ipl-inline-list__item"><a href="/country/gb">United Kingdom</a></li>
+        <li class="ipl-inline-list__item"><a href="/country/us">United States</a></li>
+      </ul>
+    </td>
+  </tr>
+  <tr class="ipl-zebra-list__item">
+    <td class="ipl-zebra-list__label">Plot Summary</td>
+    <td>
+      <p>Ripley is rescued &amp; returns.<em class="ipl-pipe">|</em>
+        <a href="/title/tt0090605/plotsummary">Plot Summary</a></p>
+    </td>
+  </tr>
+  <tr class="ipl-zebra-list__item">
+    <td class="ipl-zebra-list__label">Taglines</td>
+    <td>
+      This time it's war. <a href="/title/tt0090605/taglines">See more</a>
+    </td>
+  </tr>
+  <tr class="ipl-zebra-list__item">
+    <td class="ipl-zebra-list__label">Plot Keywords</td>
+    <td>
+      <ul class="ipl-inline-list">
+        <li class="ipl-inline-list__item"><a href="/keyword/alien">alien</a></li>
+        <li class="ipl-inline-list__item"><a href="/keyword/space-marine">space marine</a></li>
+      </ul>
+    </td>
+  </tr>
+</table>
+<header class="ipl-header">
+  <h4 class="ipl-header__content ipl-list-title">Production Companies</h4>
+</header>
+<ul class="simpleList">
+  <li><a href="/company/co0000756/">Twentieth Century Fox</a></li>
+  <li><a href="/company/co0022594/">Brandywine Productions</a></li>
+</ul>
+</body>
+</html>)html")
+        .arg(cast);
+}
+
+/// All extractors of a reference page, as used by ImdbMovieScrapeJob.
+void extractAll(Movie& movie, const HtmlIndex& page)
+{
+    movie.setName(ImdbReferencePage::extractTitle(page));
+    movie.setOriginalName(ImdbReferencePage::extractOriginalTitle(page));
+    ImdbReferencePage::extractDirectors(&movie, page);
+    ImdbReferencePage::extractWriters(&movie, page);
+    ImdbReferencePage::extractGenres(&movie, page);
+    ImdbReferencePage::extractTaglines(&movie, page);
+    ImdbReferencePage::extractTags(&movie, page);
+    movie.setReleased(ImdbReferencePage::extractReleaseDate(page));
+    ImdbReferencePage::extractCertification(&movie, page);
+    movie.setRuntime(ImdbReferencePage::extractRuntime(page));
+    ImdbReferencePage::extractOverview(&movie, page);
+    ImdbReferencePage::extractRating(&movie, page);
+    ImdbReferencePage::extractStudios(&movie, page);
+    ImdbReferencePage::extractCountries(&movie, page);
+}
+
+/// The label-anchored patterns that were previously run over the whole page, one per detail.
+int scanPerDetail(const QString& html)
+{
+    const auto options =
+        QRegularExpression::DotMatchesEverythingOption | QRegularExpression::InvertedGreedinessOption;
+    static const QVector<QRegularExpression> patterns{
+        QRegularExpression(R"(<h3 itemprop="name">\n?([^<]+)<span)", options),
+        QRegularExpression(R"(</h3>\n([^\n]+)\n\s+<span class="titlereference-original-title)", options),
+        QRegularExpression(R"(<a href="/title/tt\d+/releaseinfo">([^<]+)</a>)", options),
+        QRegularExpression(R"(Production Companies</h4>.+<ul class="simpleList">(.+)</ul>)", options),
+        QRegularExpression(R"re(Directors?:\s?\n\s+<ul class="[^"]+">(.*)</ul>)re", options),
+        QRegularExpression(R"re(Writers?:\s?\n\s+<ul class="[^"]+">(.*)</ul>)re", options),
+        QRegularExpression(R"(Genres</td>\n\s+<td>(.+)</td>)", options),
+        QRegularExpression(R"(<span class="ipl-rating-star__rating">(.*)</span>)", options),
+        QRegularExpression(R"(<span class="ipl-rating-star__total-votes">\((.*)\)</span>)", options),
+        QRegularExpression("Top Rated Movies:? #([0-9]{1,3})</a>", options),
+        QRegularExpression("Top Rated TV:? #([0-9]{1,3})\\n</a>", options),
+        QRegularExpression(R"(<section class="titlereference-section-overview">\n\s+<div>(.+)</div>)", options),
+        QRegularExpression(R"(Plot Summary</td>\n\s+<td>\n\s+<p>(.+)<)", options),
+        QRegularExpression(R"(Taglines</td>\n\s+<td>(.*)<a href)", options),
+        QRegularExpression(R"(Plot Keywords</td>\n\s+<td>(.*)</ul>)", options),
+        QRegularExpression(R"(Country</td>(.*)</ul>)", options),
+        QRegularExpression(R"re(Runtime</td>.*<li class="ipl-inline-list__item">\n\s+(\d+) min)re", options),
+        QRegularExpression(R"(<h4 class="inline">Runtime:</h4>[^<]*<time datetime="PT([0-9]+)M">)", options)};
+    static const QRegularExpression certificationRx(
+        R"rx(<a href="/search/title\?certificates=US%3A[^"]+">([^<]+)</a>)rx", options);
+
+    int matches = 0;
+    for (const QRegularExpression& rx : patterns) {
+        matches += rx.match(html).hasMatch() ? 1 : 0;
+    }
+    QRegularExpressionMatchIterator certifications = certificationRx.globalMatch(html);
+    while (certifications.hasNext()) {
+        certifications.next();
+        ++matches;
+    }
+    return matches;
+}
+
+} // namespace
+
+TEST_CASE("ImdbReferencePage extracts details from the page index", "[scraper][imdb][HtmlIndex]")
+{
+    const HtmlIndex page(referencePage(3));
+    Movie movie;
+    extractAll(movie, page);
+
+    CHECK(movie.name() == "Aliens 2");
+    CHECK(movie.originalName() == "Aliens");
+    CHECK(movie.released() == QDate(1986, 8, 29));
+    CHECK(movie.director() == "James Cameron");
+    CHECK(movie.writer() == "James Cameron, David Giler");
+    CHECK(movie.genres() == QStringList{"Action", "Sci-Fi"});
+    CHECK(movie.certification() == Certification("R"));
+    CHECK(movie.runtime() == 137min);
+    CHECK(movie.countries() == QStringList{"United Kingdom", "United States"});
+    CHECK(movie.outline() == "Fifty-seven years after surviving an apocalyptic attack aboard her space vessel.");
+    CHECK(movie.overview() == "Ripley is rescued & returns.");
+    CHECK(movie.tagline() == "This time it's war.");
+    CHECK(movie.tags() == QStringList{"alien", "space marine"});
+    CHECK(movie.studios() == QStringList{"Twentieth Century Fox", "Brandywine Productions"});
+    CHECK(movie.top250() == 67);
+    REQUIRE(movie.ratings().size() == 1);
+    CHECK(movie.ratings().first().rating == Approx(8.4));
+    CHECK(movie.ratings().first().voteCount == 745123);
+}
+
+// Timings depend on the machine, so this test is hidden.  Run it with:
+//   mediaelch_unit_test "[benchmark]"
+TEST_CASE("Indexing a reference page once is faster than scanning it per detail", "[.][benchmark][HtmlIndex]")
+{
+    const QString html = referencePage(2000);
+    const int rounds = 10;
+
+    qint64 scanned = std::numeric_limits<qint64>::max();
+    qint64 indexed = std::numeric_limits<qint64>::max();
+    QElapsedTimer timer;
+
+    for (int i = 0; i < rounds; ++i) {
+        timer.start();
+        CHECK(scanPerDetail(html) > 0);
+        scanned = qMin(scanned, timer.nsecsElapsed());
+
+        timer.start();
+        const HtmlIndex page(html);
+        Movie movie;
+        extractAll(movie, page);
+        indexed = qMin(indexed, timer.nsecsElapsed());
+    }
+
+    WARN(QStringLiteral("page: %1 KiB, scan per detail: %2 ms, index and extract: %3 ms")
+             .arg(html.size() * 2 / 1024)
+             .arg(static_cast<double>(scanned) / 1e6, 0, 'f', 2)
+             .arg(static_cast<double>(indexed) / 1e6, 0, 'f', 2)
+             .toStdString());
+    CHECK(indexed < scanned);
+}
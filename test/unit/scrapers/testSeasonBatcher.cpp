@@ -0,0 +1,180 @@
+#include "test/test_helpers.h"
+
+#include "data/tv_show/TvShowEpisode.h"
+#include "scrapers/tv_show/BatchedEpisodeScrapeJob.h"
+#include "scrapers/tv_show/SeasonBatcher.h"
+#include "scrapers/tv_show/TvScraper.h"
+#include "test/helpers/scraper_helpers.h"
+
+#include <QTimer>
+#include <memory>
+
+using namespace mediaelch;
+using namespace mediaelch::scraper;
+
+namespace {
+
+/// Season job that returns episodes 1-3 of each requested season.
+class StubSeasonScrapeJob : public SeasonScrapeJob
+{
+public:
+    StubSeasonScrapeJob(Config config, bool fail, QObject* parent) : SeasonScrapeJob(std::move(config), parent)
+    {
+        if (fail) {
+            ScraperError error;
+            error.error = ScraperError::Type::NetworkError;
+            setScraperError(error);
+            return;
+        }
+        for (const SeasonNumber& season : this->config().seasons) {
+            for (int i = 1; i <= 3; ++i) {
+                auto* episode = new TvShowEpisode({}, this);
+                episode->setSeason(season);
+                episode->setEpisode(EpisodeNumber(i));
+                episode->setTitle(QStringLiteral("Season %1").arg(i));
+                m_episodes.insert({season, EpisodeNumber(i)}, episode);
+            }
+        }
+    }
+    void doStart() override
+    {
+        QTimer::singleShot(0, this, [this]() { emitFinished(); });
+    }
+};
+
+/// Episode job that is used if an episode can't be taken from its season.
+class StubEpisodeScrapeJob : public EpisodeScrapeJob
+{
+public:
+    StubEpisodeScrapeJob(Config config, QObject* parent) : EpisodeScrapeJob(std::move(config), parent) {}
+    void doStart() override
+    {
+        episode().setTitle("Single");
+        QTimer::singleShot(0, this, [this]() { emitFinished(); });
+    }
+};
+
+class StubTvScraper : public TvScraper
+{
+public:
+    StubTvScraper() { m_meta.supportedEpisodeDetails = {EpisodeScraperInfo::Title, EpisodeScraperInfo::Actors}; }
+    const ScraperMeta& meta() const override { return m_meta; }
+    void initialize() override {}
+    bool isInitialized() const override { return true; }
+    ShowSearchJob* search(ShowSearchJob::Config /*config*/) override { return nullptr; }
+    ShowScrapeJob* loadShow(ShowScrapeJob::Config /*config*/) override { return nullptr; }
+    SeasonScrapeJob* loadSeasons(SeasonScrapeJob::Config config) override
+    {
+        ++seasonRequests;
+        return new StubSeasonScrapeJob(std::move(config), failSeasons, this);
+    }
+    EpisodeScrapeJob* loadEpisode(EpisodeScrapeJob::Config config) override
+    {
+        ++episodeRequests;
+        return new StubEpisodeScrapeJob(std::move(config), this);
+    }
+
+public:
+    int seasonRequests = 0;
+    int episodeRequests = 0;
+    bool failSeasons = false;
+
+private:
+    ScraperMeta m_meta;
+};
+
+EpisodeScrapeJob::Config episodeConfig(int season, int episode, QSet<EpisodeScraperInfo> details)
+{
+    return EpisodeScrapeJob::Config(
+        EpisodeIdentifier("1234", SeasonNumber(season), EpisodeNumber(episode), SeasonOrder::Aired),
+        Locale::English,
+        std::move(details));
+}
+
+std::unique_ptr<BatchedEpisodeScrapeJob> batchedJob(StubTvScraper& scraper,
+    SeasonBatcher& batcher,
+    EpisodeScrapeJob::Config config)
+{
+    auto job = std::make_unique<BatchedEpisodeScrapeJob>(batcher,
+        [&scraper](EpisodeScrapeJob::Config singleConfig) { return scraper.loadEpisode(std::move(singleConfig)); },
+        std::move(config));
+    job->setAutoDelete(false);
+    return job;
+}
+
+} // namespace
+
+TEST_CASE("SeasonBatcher coalesces episode requests of a season", "[tv][SeasonBatcher]")
+{
+    StubTvScraper scraper;
+    SeasonBatcher batcher(scraper);
+
+    SECTION("episodes of the same season result in one season request")
+    {
+        auto first = batchedJob(scraper, batcher, episodeConfig(1, 1, {EpisodeScraperInfo::Title}));
+        auto second = batchedJob(scraper, batcher, episodeConfig(1, 2, {EpisodeScraperInfo::Title}));
+        first->start();
+        test::scrapeEpisodeSync(second.get());
+        // Both are answered by the same season result in the order of their requests.
+        REQUIRE(first->isFinished());
+
+        CHECK(scraper.seasonRequests == 1);
+        CHECK(scraper.episodeRequests == 0);
+        CHECK(first->episode().title() == "Season 1");
+        CHECK(second->episode().title() == "Season 2");
+
+        // Finished seasons are kept for subsequent requests.
+        auto third = batchedJob(scraper, batcher, episodeConfig(1, 3, {EpisodeScraperInfo::Title}));
+        test::scrapeEpisodeSync(third.get());
+        CHECK(scraper.seasonRequests == 1);
+        CHECK(third->episode().title() == "Season 3");
+    }
+
+    SECTION("episodes that are not part of the season are loaded on their own")
+    {
+        auto job = batchedJob(scraper, batcher, episodeConfig(1, 4, {EpisodeScraperInfo::Title}));
+        test::scrapeEpisodeSync(job.get());
+        CHECK(scraper.seasonRequests == 1);
+        CHECK(scraper.episodeRequests == 1);
+        CHECK(job->episode().title() == "Single");
+    }
+
+    SECTION("failed seasons fall back to single requests and are not kept")
+    {
+        scraper.failSeasons = true;
+        auto job = batchedJob(scraper, batcher, episodeConfig(1, 1, {EpisodeScraperInfo::Title}));
+        test::scrapeEpisodeSync(job.get());
+        CHECK(scraper.episodeRequests == 1);
+        CHECK(job->episode().title() == "Single");
+
+        scraper.failSeasons = false;
+        auto retry = batchedJob(scraper, batcher, episodeConfig(1, 1, {EpisodeScraperInfo::Title}));
+        test::scrapeEpisodeSync(retry.get());
+        CHECK(scraper.seasonRequests == 2);
+        CHECK(retry->episode().title() == "Season 1");
+    }
+
+    SECTION("details that the season does not contain are loaded on their own")
+    {
+        auto job = batchedJob(scraper, batcher, episodeConfig(1, 1, {EpisodeScraperInfo::Actors}));
+        job->setSingleEpisodeDetails({EpisodeScraperInfo::Actors});
+        test::scrapeEpisodeSync(job.get());
+        CHECK(scraper.seasonRequests == 0);
+        CHECK(scraper.episodeRequests == 1);
+    }
+
+    SECTION("the completion is called for episodes taken from their season")
+    {
+        auto job = batchedJob(scraper, batcher, episodeConfig(1, 2, {EpisodeScraperInfo::Title}));
+        job->setCompletion([](const EpisodeScrapeJob::Config& /*config*/,
+                               TvShowEpisode& episode,
+                               std::function<void(ScraperError)> done) {
+            episode.setImdbId(ImdbId("tt0000002"));
+            QTimer::singleShot(0, [done]() { done({}); });
+        });
+        test::scrapeEpisodeSync(job.get());
+        CHECK(scraper.episodeRequests == 0);
+        CHECK(job->episode().title() == "Season 2");
+        CHECK(job->episode().imdbId() == ImdbId("tt0000002"));
+    }
+}
@@ -166,4 +166,71 @@ TEST_CASE("Advanced Settings XML", "[settings]")
         REQUIRE(messages.empty());
         CHECK(settings.useFirstStudioOnly() == true);
     }
+
+    SECTION("custom movie scraper deadline")
+    {
+        const auto valid = AdvancedSettingsXmlReader::loadFromXml(
+            addBaseXml("<customMovieScraperDeadline>10</customMovieScraperDeadline>"));
+        CHECK(valid.second.isEmpty());
+        CHECK(valid.first.customMovieScraperDeadline() == 10);
+
+        const auto negative = AdvancedSettingsXmlReader::loadFromXml(
+            addBaseXml("<customMovieScraperDeadline>-1</customMovieScraperDeadline>"));
+        REQUIRE(negative.second.size() == 1);
+        CHECK(negative.second[0].type == AdvancedSettingsXmlReader::ParseErrorType::InvalidValue);
+        CHECK(negative.first.customMovieScraperDeadline() == AdvancedSettings().customMovieScraperDeadline());
+    }
+
+    SECTION("directory scan threads")
+    {
+        const auto valid =
+            AdvancedSettingsXmlReader::loadFromXml(addBaseXml("<directoryScanThreads>16</directoryScanThreads>"));
+        CHECK(valid.second.isEmpty());
+        CHECK(valid.first.directoryScanThreads() == 16);
+
+        const auto zero =
+            AdvancedSettingsXmlReader::loadFromXml(addBaseXml("<directoryScanThreads>0</directoryScanThreads>"));
+        REQUIRE(zero.second.size() == 1);
+        CHECK(zero.second[0].type == AdvancedSettingsXmlReader::ParseErrorType::InvalidValue);
+        CHECK(zero.first.directoryScanThreads() == AdvancedSettings().directoryScanThreads());
+    }
+
+    SECTION("log file format and rotation")
+    {
+        const auto valid = AdvancedSettingsXmlReader::loadFromXml(
+            addBaseXml("<log><format>json</format><maxFileSize>10</maxFileSize><maxFiles>5</maxFiles></log>"));
+        CHECK(valid.second.isEmpty());
+        CHECK(valid.first.logFileOptions().format == mediaelch::LogFormat::Json);
+        CHECK(valid.first.logFileOptions().maxFileSize == 10 * 1024 * 1024);
+        CHECK(valid.first.logFileOptions().maxFiles == 5);
+
+        const auto invalid = AdvancedSettingsXmlReader::loadFromXml(
+            addBaseXml("<log><format>xml</format><maxFiles>-1</maxFiles></log>"));
+        REQUIRE(invalid.second.size() == 2);
+        CHECK(invalid.second[0].type == AdvancedSettingsXmlReader::ParseErrorType::InvalidValue);
+        CHECK(invalid.second[1].type == AdvancedSettingsXmlReader::ParseErrorType::InvalidValue);
+        CHECK(invalid.first.logFileOptions().format == mediaelch::LogFormat::Text);
+        CHECK(invalid.first.logFileOptions().maxFiles == AdvancedSettings().logFileOptions().maxFiles);
+    }
+
+    SECTION("log levels")
+    {
+        const auto valid = AdvancedSettingsXmlReader::loadFromXml(addBaseXml(R"(<log><levels>
+                <level category="scraper.*">debug</level>
+                <level category="database">off</level>
+            </levels></log>)"));
+        CHECK(valid.second.isEmpty());
+        REQUIRE(valid.first.logLevels().size() == 2);
+        CHECK(valid.first.logLevels().value("scraper.*") == mediaelch::LogLevel::Debug);
+        CHECK(valid.first.logLevels().value("database") == mediaelch::LogLevel::Off);
+
+        const auto invalid = AdvancedSettingsXmlReader::loadFromXml(addBaseXml(R"(<log><levels>
+                <level category="scanner">verbose</level>
+                <level>debug</level>
+            </levels></log>)"));
+        REQUIRE(invalid.second.size() == 2);
+        CHECK(invalid.second[0].type == AdvancedSettingsXmlReader::ParseErrorType::InvalidValue);
+        CHECK(invalid.second[1].type == AdvancedSettingsXmlReader::ParseErrorType::InvalidAttributeValue);
+        CHECK(invalid.first.logLevels().isEmpty());
+    }
 }